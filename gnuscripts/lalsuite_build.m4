@@ -1339,7 +1339,7 @@ AC_DEFUN([LALSUITE_CHECK_SIMD],[
   # list of recognised SIMD instruction sets
   m4_define([simd_isets],[m4_normalize([
     [SSE],[SSE2],[SSE3],[SSSE3],[SSE4.1],[SSE4.2],
-    [AVX],[AVX2]
+    [AVX],[AVX2],[AVX512F]
   ])])
 
   # push compiler environment
@@ -1463,7 +1463,7 @@ AC_DEFUN([LALSUITE_USE_CFITSIO],[
     LALSUITE_ADD_FLAGS([C],[${CFITSIO_CFLAGS}],[${CFITSIO_LIBS}])
     AC_CHECK_LIB([cfitsio],[ffopen],[],[cfitsio=false])
     AC_CHECK_HEADER([fitsio.h],[],[cfitsio=false])
-    AC_CHECK_FUNCS([fffree])
+    AC_CHECK_FUNCS([fffree fits_compress_table])
     AC_CHECK_DECLS([fffree],[],[],[AC_INCLUDES_DEFAULT
 #include <fitsio.h>
 ])
@@ -419,12 +419,6 @@ static void median_cleanup_REAL8( REAL8FrequencySeries *work, UINT4 n )
 }
 
 /* comparison for floating point numbers */
-static int compare_REAL4( const void *p1, const void *p2 )
-{
-  REAL4 x1 = *(const REAL4 *)p1;
-  REAL4 x2 = *(const REAL4 *)p2;
-  return (x1 > x2) - (x1 < x2);
-}
 static int compare_REAL8( const void *p1, const void *p2 )
 {
   REAL8 x1 = *(const REAL8 *)p1;
@@ -432,6 +426,108 @@ static int compare_REAL8( const void *p1, const void *p2 )
   return (x1 > x2) - (x1 < x2);
 }
 
+/* median of an array of floating point numbers, the same as would be found
+ * by sorting the array; uses Wirth's selection algorithm, which is linear
+ * on average, and reorders the array */
+static REAL4 median_REAL4( REAL4 *x, int n )
+{
+  const int k = ( n - 1 ) / 2;
+  int lo = 0;
+  int hi = n - 1;
+  REAL4 upper;
+  int i;
+
+  /* move the k-th smallest element to x[k], with no larger elements below
+   * it and no smaller elements above it */
+  while ( lo < hi )
+  {
+    REAL4 pivot = x[k];
+    int j;
+    i = lo;
+    j = hi;
+    do
+    {
+      while ( x[i] < pivot )
+        ++i;
+      while ( pivot < x[j] )
+        --j;
+      if ( i <= j )
+      {
+        REAL4 tmp = x[i];
+        x[i] = x[j];
+        x[j] = tmp;
+        ++i;
+        --j;
+      }
+    } while ( i <= j );
+    if ( j < k )
+      lo = i;
+    if ( k < i )
+      hi = j;
+  }
+
+  if ( n % 2 ) /* odd number of elements */
+    return x[k];
+
+  /* even number... take average with the smallest element above x[k] */
+  upper = x[k + 1];
+  for ( i = k + 2; i < n; ++i )
+    if ( x[i] < upper )
+      upper = x[i];
+  return 0.5*(x[k] + upper);
+}
+
+/* median of an array of floating point numbers, the same as would be found
+ * by sorting the array; uses Wirth's selection algorithm, which is linear
+ * on average, and reorders the array */
+static REAL8 median_REAL8( REAL8 *x, int n )
+{
+  const int k = ( n - 1 ) / 2;
+  int lo = 0;
+  int hi = n - 1;
+  REAL8 upper;
+  int i;
+
+  /* move the k-th smallest element to x[k], with no larger elements below
+   * it and no smaller elements above it */
+  while ( lo < hi )
+  {
+    REAL8 pivot = x[k];
+    int j;
+    i = lo;
+    j = hi;
+    do
+    {
+      while ( x[i] < pivot )
+        ++i;
+      while ( pivot < x[j] )
+        --j;
+      if ( i <= j )
+      {
+        REAL8 tmp = x[i];
+        x[i] = x[j];
+        x[j] = tmp;
+        ++i;
+        --j;
+      }
+    } while ( i <= j );
+    if ( j < k )
+      lo = i;
+    if ( k < i )
+      hi = j;
+  }
+
+  if ( n % 2 ) /* odd number of elements */
+    return x[k];
+
+  /* even number... take average with the smallest element above x[k] */
+  upper = x[k + 1];
+  for ( i = k + 2; i < n; ++i )
+    if ( x[i] < upper )
+      upper = x[i];
+  return 0.5*(x[k] + upper);
+}
+
 
 /**
  * Median Method: use median average rather than mean.  Note: this will
@@ -458,6 +554,7 @@ int XLALREAL4AverageSpectrumMedian(
   UINT4 numseg;
   UINT4 seg;
   UINT4 k;
+  int errflag = 0;
 
   if ( ! spectrum || ! tseries || ! plan )
       XLAL_ERROR( XLAL_EFAULT );
@@ -490,38 +587,35 @@ int XLALREAL4AverageSpectrumMedian(
     }
   }
 
+  /* the segments are independent, so compute their modified periodograms
+   * in parallel; each uses its own view of the time series data */
+#pragma omp parallel for schedule(dynamic)
   for ( seg = 0; seg < numseg; ++seg )
   {
-    REAL4Vector savevec; /* save the time series data vector */
-    int code;
-
-    /* save the time series data vector */
-    savevec = *tseries->data;
+    REAL4Vector segvec = *tseries->data;
+    REAL4TimeSeries segseries = *tseries;
 
-    /* set the data vector to be appropriate for the even segment */
-    tseries->data->length  = seglen;
-    tseries->data->data   += seg * stride;
+    if ( errflag )
+      continue;
 
-    /* compute the modified periodogram for the even segment */
-    code = XLALREAL4ModifiedPeriodogram( work + seg, tseries, window, plan );
+    /* set the data vector to be appropriate for this segment */
+    segvec.length  = seglen;
+    segvec.data   += seg * stride;
+    segseries.data = &segvec;
 
-    /* restore the time series data vector to its original state */
-    *tseries->data = savevec;
-
-    /* now check for failure of the XLAL routine */
-    if ( code == XLAL_FAILURE )
+    /* compute the modified periodogram for this segment */
+    if ( XLALREAL4ModifiedPeriodogram( work + seg, &segseries, window, plan ) == XLAL_FAILURE )
     {
-      median_cleanup_REAL4( work, numseg ); /* cleanup */
-      XLAL_ERROR( XLAL_EFUNC );
+#pragma omp atomic write
+      errflag = 1;
     }
   }
 
-  /* create array to hold a particular frequency bin data */
-  bin = XLALMalloc( numseg * sizeof( *bin ) );
-  if ( ! bin )
+  /* now check for failure of the XLAL routine */
+  if ( errflag )
   {
     median_cleanup_REAL4( work, numseg ); /* cleanup */
-    XLAL_ERROR( XLAL_ENOMEM );
+    XLAL_ERROR( XLAL_EFUNC );
   }
 
   /* compute median bias factor */
@@ -530,22 +624,40 @@ int XLALREAL4AverageSpectrumMedian(
   /* normaliztion takes into account bias */
   normfac = 1.0 / biasfac;
 
-  /* now loop over frequency bins and compute the median-mean */
-  for ( k = 0; k < spectrum->data->length; ++k )
+  /* now loop over frequency bins and compute the median, with an array to
+   * hold a particular frequency bin data for each thread */
+#pragma omp parallel private(bin)
+  {
+    bin = XLALMalloc( numseg * sizeof( *bin ) );
+    if ( ! bin )
+    {
+#pragma omp atomic write
+      errflag = 1;
+    }
+
+#pragma omp for schedule(static)
+    for ( k = 0; k < spectrum->data->length; ++k )
+    {
+      UINT4 s;
+
+      if ( ! bin )
+        continue;
+
+      /* assign array of segment values to bin array for this freq bin */
+      for ( s = 0; s < numseg; ++s )
+        bin[s] = work[s].data->data[k];
+
+      /* find median, and remove median bias */
+      spectrum->data->data[k] = normfac * median_REAL4( bin, numseg );
+    }
+
+    XLALFree( bin );
+  }
+
+  if ( errflag )
   {
-    /* assign array of even segment values to bin array for this freq bin */
-    for ( seg = 0; seg < numseg; ++seg )
-      bin[seg] = work[seg].data->data[k];
-
-    /* sort them and find median */
-    qsort( bin, numseg, sizeof( *bin ), compare_REAL4 );
-    if ( numseg % 2 ) /* odd number of evens */
-      spectrum->data->data[k] = bin[numseg/2];
-    else /* even number... take average */
-      spectrum->data->data[k] = 0.5*(bin[numseg/2-1] + bin[numseg/2]);
-
-    /* remove median bias */
-    spectrum->data->data[k] *= normfac;
+    median_cleanup_REAL4( work, numseg ); /* cleanup */
+    XLAL_ERROR( XLAL_ENOMEM );
   }
 
   /* set metadata */
@@ -555,7 +667,6 @@ int XLALREAL4AverageSpectrumMedian(
   spectrum->sampleUnits = work->sampleUnits;
 
   /* free the workspace data */
-  XLALFree( bin );
   median_cleanup_REAL4( work, numseg );
 
   return 0;
@@ -586,6 +697,7 @@ int XLALREAL8AverageSpectrumMedian(
   UINT4 numseg;
   UINT4 seg;
   UINT4 k;
+  int errflag = 0;
 
   if ( ! spectrum || ! tseries || ! plan )
       XLAL_ERROR( XLAL_EFAULT );
@@ -618,38 +730,35 @@ int XLALREAL8AverageSpectrumMedian(
     }
   }
 
+  /* the segments are independent, so compute their modified periodograms
+   * in parallel; each uses its own view of the time series data */
+#pragma omp parallel for schedule(dynamic)
   for ( seg = 0; seg < numseg; ++seg )
   {
-    REAL8Vector savevec; /* save the time series data vector */
-    int code;
-
-    /* save the time series data vector */
-    savevec = *tseries->data;
-
-    /* set the data vector to be appropriate for the even segment */
-    tseries->data->length  = seglen;
-    tseries->data->data   += seg * stride;
+    REAL8Vector segvec = *tseries->data;
+    REAL8TimeSeries segseries = *tseries;
 
-    /* compute the modified periodogram for the even segment */
-    code = XLALREAL8ModifiedPeriodogram( work + seg, tseries, window, plan );
+    if ( errflag )
+      continue;
 
-    /* restore the time series data vector to its original state */
-    *tseries->data = savevec;
+    /* set the data vector to be appropriate for this segment */
+    segvec.length  = seglen;
+    segvec.data   += seg * stride;
+    segseries.data = &segvec;
 
-    /* now check for failure of the XLAL routine */
-    if ( code == XLAL_FAILURE )
+    /* compute the modified periodogram for this segment */
+    if ( XLALREAL8ModifiedPeriodogram( work + seg, &segseries, window, plan ) == XLAL_FAILURE )
     {
-      median_cleanup_REAL8( work, numseg ); /* cleanup */
-      XLAL_ERROR( XLAL_EFUNC );
+#pragma omp atomic write
+      errflag = 1;
     }
   }
 
-  /* create array to hold a particular frequency bin data */
-  bin = XLALMalloc( numseg * sizeof( *bin ) );
-  if ( ! bin )
+  /* now check for failure of the XLAL routine */
+  if ( errflag )
   {
     median_cleanup_REAL8( work, numseg ); /* cleanup */
-    XLAL_ERROR( XLAL_ENOMEM );
+    XLAL_ERROR( XLAL_EFUNC );
   }
 
   /* compute median bias factor */
@@ -658,22 +767,40 @@ int XLALREAL8AverageSpectrumMedian(
   /* normaliztion takes into account bias */
   normfac = 1.0 / biasfac;
 
-  /* now loop over frequency bins and compute the median-mean */
-  for ( k = 0; k < spectrum->data->length; ++k )
+  /* now loop over frequency bins and compute the median, with an array to
+   * hold a particular frequency bin data for each thread */
+#pragma omp parallel private(bin)
   {
-    /* assign array of even segment values to bin array for this freq bin */
-    for ( seg = 0; seg < numseg; ++seg )
-      bin[seg] = work[seg].data->data[k];
-
-    /* sort them and find median */
-    qsort( bin, numseg, sizeof( *bin ), compare_REAL8 );
-    if ( numseg % 2 ) /* odd number of evens */
-      spectrum->data->data[k] = bin[numseg/2];
-    else /* even number... take average */
-      spectrum->data->data[k] = 0.5*(bin[numseg/2-1] + bin[numseg/2]);
-
-    /* remove median bias */
-    spectrum->data->data[k] *= normfac;
+    bin = XLALMalloc( numseg * sizeof( *bin ) );
+    if ( ! bin )
+    {
+#pragma omp atomic write
+      errflag = 1;
+    }
+
+#pragma omp for schedule(static)
+    for ( k = 0; k < spectrum->data->length; ++k )
+    {
+      UINT4 s;
+
+      if ( ! bin )
+        continue;
+
+      /* assign array of segment values to bin array for this freq bin */
+      for ( s = 0; s < numseg; ++s )
+        bin[s] = work[s].data->data[k];
+
+      /* find median, and remove median bias */
+      spectrum->data->data[k] = normfac * median_REAL8( bin, numseg );
+    }
+
+    XLALFree( bin );
+  }
+
+  if ( errflag )
+  {
+    median_cleanup_REAL8( work, numseg ); /* cleanup */
+    XLAL_ERROR( XLAL_ENOMEM );
   }
 
   /* set metadata */
@@ -683,7 +810,6 @@ int XLALREAL8AverageSpectrumMedian(
   spectrum->sampleUnits = work->sampleUnits;
 
   /* free the workspace data */
-  XLALFree( bin );
   median_cleanup_REAL8( work, numseg );
 
   return 0;
@@ -757,6 +883,7 @@ int XLALREAL4AverageSpectrumMedianMean(
   UINT4 halfnumseg;
   UINT4 seg;
   UINT4 k;
+  int errflag = 0;
 
   if ( ! spectrum || ! tseries || ! plan )
       XLAL_ERROR( XLAL_EFAULT );
@@ -799,53 +926,36 @@ int XLALREAL4AverageSpectrumMedianMean(
     }
   }
 
-  for ( seg = 0; seg < halfnumseg; ++seg )
+  /* the even and odd segments are independent, so compute their modified
+   * periodograms in parallel; each uses its own view of the time series */
+#pragma omp parallel for schedule(dynamic)
+  for ( seg = 0; seg < numseg; ++seg )
   {
-    REAL4Vector savevec; /* save the time series data vector */
-    int code;
-
-    /* save the time series data vector */
-    savevec = *tseries->data;
+    REAL4Vector segvec = *tseries->data;
+    REAL4TimeSeries segseries = *tseries;
+    REAL4FrequencySeries *periodogram = ( seg % 2 ) ? odd + seg/2 : even + seg/2;
 
-    /* set the data vector to be appropriate for the even segment */
-    tseries->data->length  = seglen;
-    tseries->data->data   += 2 * seg * stride;
+    if ( errflag )
+      continue;
 
-    /* compute the modified periodogram for the even segment */
-    code = XLALREAL4ModifiedPeriodogram( even + seg, tseries, window, plan );
+    /* set the data vector to be appropriate for this segment */
+    segvec.length  = seglen;
+    segvec.data   += seg * stride;
+    segseries.data = &segvec;
 
-    /* now check for failure of the XLAL routine */
-    if ( code == XLAL_FAILURE )
+    /* compute the modified periodogram for this segment */
+    if ( XLALREAL4ModifiedPeriodogram( periodogram, &segseries, window, plan ) == XLAL_FAILURE )
     {
-      *tseries->data = savevec;
-      median_mean_cleanup_REAL4( even, odd, halfnumseg ); /* cleanup */
-      XLAL_ERROR( XLAL_EFUNC );
+#pragma omp atomic write
+      errflag = 1;
     }
-
-    /* set the data vector to be appropriate for the odd segment */
-    tseries->data->data += stride;
-
-    /* compute the modified periodogram for the odd segment */
-    code = XLALREAL4ModifiedPeriodogram( odd + seg, tseries, window, plan );
-
-    /* now check for failure of the XLAL routine */
-    if ( code == XLAL_FAILURE )
-    {
-      *tseries->data = savevec;
-      median_mean_cleanup_REAL4( even, odd, halfnumseg ); /* cleanup */
-      XLAL_ERROR( XLAL_EFUNC );
-    }
-
-    /* restore the time series data vector to its original state */
-    *tseries->data = savevec;
   }
 
-  /* create array to hold a particular frequency bin data */
-  bin = XLALMalloc( halfnumseg * sizeof( *bin ) );
-  if ( ! bin )
+  /* now check for failure of the XLAL routine */
+  if ( errflag )
   {
     median_mean_cleanup_REAL4( even, odd, halfnumseg ); /* cleanup */
-    XLAL_ERROR( XLAL_ENOMEM );
+    XLAL_ERROR( XLAL_EFUNC );
   }
 
   /* compute median bias factor */
@@ -855,36 +965,52 @@ int XLALREAL4AverageSpectrumMedianMean(
    * the even and the odd */
   normfac = 1.0 / ( 2.0 * biasfac );
 
-  /* now loop over frequency bins and compute the median-mean */
-  for ( k = 0; k < spectrum->data->length; ++k )
+  /* now loop over frequency bins and compute the median-mean, with an array
+   * to hold a particular frequency bin data for each thread */
+#pragma omp parallel private(bin)
+  {
+    bin = XLALMalloc( halfnumseg * sizeof( *bin ) );
+    if ( ! bin )
+    {
+#pragma omp atomic write
+      errflag = 1;
+    }
+
+#pragma omp for schedule(static)
+    for ( k = 0; k < spectrum->data->length; ++k )
+    {
+      REAL4 evenmedian;
+      REAL4 oddmedian;
+      UINT4 s;
+
+      if ( ! bin )
+        continue;
+
+      /* assign array of even segment values to bin array for this freq bin */
+      for ( s = 0; s < halfnumseg; ++s )
+        bin[s] = even[s].data->data[k];
+
+      /* find median */
+      evenmedian = median_REAL4( bin, halfnumseg );
+
+      /* assign array of odd segment values to bin array for this freq bin */
+      for ( s = 0; s < halfnumseg; ++s )
+        bin[s] = odd[s].data->data[k];
+
+      /* find median */
+      oddmedian = median_REAL4( bin, halfnumseg );
+
+      /* spectrum for this bin is the mean of the medians */
+      spectrum->data->data[k] = normfac * (evenmedian + oddmedian);
+    }
+
+    XLALFree( bin );
+  }
+
+  if ( errflag )
   {
-    REAL4 evenmedian;
-    REAL4 oddmedian;
-
-    /* assign array of even segment values to bin array for this freq bin */
-    for ( seg = 0; seg < halfnumseg; ++seg )
-      bin[seg] = even[seg].data->data[k];
-
-    /* sort them and find median */
-    qsort( bin, halfnumseg, sizeof( *bin ), compare_REAL4 );
-    if ( halfnumseg % 2 ) /* odd number of evens */
-      evenmedian = bin[halfnumseg/2];
-    else /* even number... take average */
-      evenmedian = 0.5*(bin[halfnumseg/2-1] + bin[halfnumseg/2]);
-
-    /* assign array of odd segment values to bin array for this freq bin */
-    for ( seg = 0; seg < halfnumseg; ++seg )
-      bin[seg] = odd[seg].data->data[k];
-
-    /* sort them and find median */
-    qsort( bin, halfnumseg, sizeof( *bin ), compare_REAL4 );
-    if ( halfnumseg % 2 ) /* odd number of odds */
-      oddmedian = bin[halfnumseg/2];
-    else /* even number... take average */
-      oddmedian = 0.5*(bin[halfnumseg/2-1] + bin[halfnumseg/2]);
-
-    /* spectrum for this bin is the mean of the medians */
-    spectrum->data->data[k] = normfac * (evenmedian + oddmedian);
+    median_mean_cleanup_REAL4( even, odd, halfnumseg ); /* cleanup */
+    XLAL_ERROR( XLAL_ENOMEM );
   }
 
   /* set metadata */
@@ -894,7 +1020,6 @@ int XLALREAL4AverageSpectrumMedianMean(
   spectrum->sampleUnits = even->sampleUnits;
 
   /* free the workspace data */
-  XLALFree( bin );
   median_mean_cleanup_REAL4( even, odd, halfnumseg );
 
   return 0;
@@ -926,6 +1051,7 @@ int XLALREAL8AverageSpectrumMedianMean(
   UINT4 halfnumseg;
   UINT4 seg;
   UINT4 k;
+  int errflag = 0;
 
   if ( ! spectrum || ! tseries || ! plan )
       XLAL_ERROR( XLAL_EFAULT );
@@ -968,53 +1094,36 @@ int XLALREAL8AverageSpectrumMedianMean(
     }
   }
 
-  for ( seg = 0; seg < halfnumseg; ++seg )
+  /* the even and odd segments are independent, so compute their modified
+   * periodograms in parallel; each uses its own view of the time series */
+#pragma omp parallel for schedule(dynamic)
+  for ( seg = 0; seg < numseg; ++seg )
   {
-    REAL8Vector savevec; /* save the time series data vector */
-    int code;
-
-    /* save the time series data vector */
-    savevec = *tseries->data;
+    REAL8Vector segvec = *tseries->data;
+    REAL8TimeSeries segseries = *tseries;
+    REAL8FrequencySeries *periodogram = ( seg % 2 ) ? odd + seg/2 : even + seg/2;
 
-    /* set the data vector to be appropriate for the even segment */
-    tseries->data->length  = seglen;
-    tseries->data->data   += 2 * seg * stride;
+    if ( errflag )
+      continue;
 
-    /* compute the modified periodogram for the even segment */
-    code = XLALREAL8ModifiedPeriodogram( even + seg, tseries, window, plan );
+    /* set the data vector to be appropriate for this segment */
+    segvec.length  = seglen;
+    segvec.data   += seg * stride;
+    segseries.data = &segvec;
 
-    /* now check for failure of the XLAL routine */
-    if ( code == XLAL_FAILURE )
+    /* compute the modified periodogram for this segment */
+    if ( XLALREAL8ModifiedPeriodogram( periodogram, &segseries, window, plan ) == XLAL_FAILURE )
     {
-      *tseries->data = savevec;
-      median_mean_cleanup_REAL8( even, odd, halfnumseg ); /* cleanup */
-      XLAL_ERROR( XLAL_EFUNC );
+#pragma omp atomic write
+      errflag = 1;
     }
-
-    /* set the data vector to be appropriate for the odd segment */
-    tseries->data->data += stride;
-
-    /* compute the modified periodogram for the odd segment */
-    code = XLALREAL8ModifiedPeriodogram( odd + seg, tseries, window, plan );
-
-    /* now check for failure of the XLAL routine */
-    if ( code == XLAL_FAILURE )
-    {
-      *tseries->data = savevec;
-      median_mean_cleanup_REAL8( even, odd, halfnumseg ); /* cleanup */
-      XLAL_ERROR( XLAL_EFUNC );
-    }
-
-    /* restore the time series data vector to its original state */
-    *tseries->data = savevec;
   }
 
-  /* create array to hold a particular frequency bin data */
-  bin = XLALMalloc( halfnumseg * sizeof( *bin ) );
-  if ( ! bin )
+  /* now check for failure of the XLAL routine */
+  if ( errflag )
   {
     median_mean_cleanup_REAL8( even, odd, halfnumseg ); /* cleanup */
-    XLAL_ERROR( XLAL_ENOMEM );
+    XLAL_ERROR( XLAL_EFUNC );
   }
 
   /* compute median bias factor */
@@ -1024,36 +1133,52 @@ int XLALREAL8AverageSpectrumMedianMean(
    * the even and the odd */
   normfac = 1.0 / ( 2.0 * biasfac );
 
-  /* now loop over frequency bins and compute the median-mean */
-  for ( k = 0; k < spectrum->data->length; ++k )
+  /* now loop over frequency bins and compute the median-mean, with an array
+   * to hold a particular frequency bin data for each thread */
+#pragma omp parallel private(bin)
   {
-    REAL8 evenmedian;
-    REAL8 oddmedian;
-
-    /* assign array of even segment values to bin array for this freq bin */
-    for ( seg = 0; seg < halfnumseg; ++seg )
-      bin[seg] = even[seg].data->data[k];
-
-    /* sort them and find median */
-    qsort( bin, halfnumseg, sizeof( *bin ), compare_REAL8 );
-    if ( halfnumseg % 2 ) /* odd number of evens */
-      evenmedian = bin[halfnumseg/2];
-    else /* even number... take average */
-      evenmedian = 0.5*(bin[halfnumseg/2-1] + bin[halfnumseg/2]);
-
-    /* assign array of odd segment values to bin array for this freq bin */
-    for ( seg = 0; seg < halfnumseg; ++seg )
-      bin[seg] = odd[seg].data->data[k];
-
-    /* sort them and find median */
-    qsort( bin, halfnumseg, sizeof( *bin ), compare_REAL8 );
-    if ( halfnumseg % 2 ) /* odd number of odds */
-      oddmedian = bin[halfnumseg/2];
-    else /* even number... take average */
-      oddmedian = 0.5*(bin[halfnumseg/2-1] + bin[halfnumseg/2]);
-
-    /* spectrum for this bin is the mean of the medians */
-    spectrum->data->data[k] = normfac * (evenmedian + oddmedian);
+    bin = XLALMalloc( halfnumseg * sizeof( *bin ) );
+    if ( ! bin )
+    {
+#pragma omp atomic write
+      errflag = 1;
+    }
+
+#pragma omp for schedule(static)
+    for ( k = 0; k < spectrum->data->length; ++k )
+    {
+      REAL8 evenmedian;
+      REAL8 oddmedian;
+      UINT4 s;
+
+      if ( ! bin )
+        continue;
+
+      /* assign array of even segment values to bin array for this freq bin */
+      for ( s = 0; s < halfnumseg; ++s )
+        bin[s] = even[s].data->data[k];
+
+      /* find median */
+      evenmedian = median_REAL8( bin, halfnumseg );
+
+      /* assign array of odd segment values to bin array for this freq bin */
+      for ( s = 0; s < halfnumseg; ++s )
+        bin[s] = odd[s].data->data[k];
+
+      /* find median */
+      oddmedian = median_REAL8( bin, halfnumseg );
+
+      /* spectrum for this bin is the mean of the medians */
+      spectrum->data->data[k] = normfac * (evenmedian + oddmedian);
+    }
+
+    XLALFree( bin );
+  }
+
+  if ( errflag )
+  {
+    median_mean_cleanup_REAL8( even, odd, halfnumseg ); /* cleanup */
+    XLAL_ERROR( XLAL_ENOMEM );
   }
 
   /* set metadata */
@@ -1063,7 +1188,6 @@ int XLALREAL8AverageSpectrumMedianMean(
   spectrum->sampleUnits = even->sampleUnits;
 
   /* free the workspace data */
-  XLALFree( bin );
   median_mean_cleanup_REAL8( even, odd, halfnumseg );
 
   return 0;
@@ -123,6 +123,7 @@ extern "C" {
  * \defgroup IIRFilter_c 		Module IIRFilter.c
  * \defgroup IIRFilterVector_c 	Module IIRFilterVector.c
  * \defgroup IIRFilterVectorR_c 	Module IIRFilterVectorR.c
+ * \defgroup IIRFilterBank_c 		Module IIRFilterBank.c
  * @}
  */
 
@@ -189,6 +190,27 @@ typedef struct tagCOMPLEX16IIRFilter{
   COMPLEX16Vector *history;    /**< The previous values of w. */
 } COMPLEX16IIRFilter;
 
+/**
+ * This structure stores a bank of identical cascades of REAL8 IIR filters,
+ * which are applied in lockstep to several independent data streams, or
+ * \e lanes, such as the real and imaginary parts of a complex time series.
+ * All stages are stored with the same order, padding the coefficients of
+ * lower-order stages with zeros.  The complete filter state is the
+ * contiguous \c history vector of length
+ * <tt>numStages*order*numLanes</tt>, in which the history of lane \f$l\f$
+ * of stage \f$s\f$ at lag \f$k\f$ is stored at index
+ * \f$(s\times\mathrm{order}+k)\times\mathrm{numLanes}+l\f$; saving and
+ * restoring this vector is sufficient to checkpoint the filter bank.
+ */
+typedef struct tagREAL8IIRFilterBank{
+  UINT4 numStages;         /**< Number of filters in each cascade. */
+  UINT4 numLanes;          /**< Number of independent data streams. */
+  UINT4 order;             /**< Order of each filter stage. */
+  REAL8Vector *directCoef; /**< The direct coefficients of each stage, of length <tt>numStages*(order+1)</tt>. */
+  REAL8Vector *recursCoef; /**< The recursive coefficients of each stage, of length <tt>numStages*(order+1)</tt>. */
+  REAL8Vector *history;    /**< The previous values of w for each stage and lane. */
+} REAL8IIRFilterBank;
+
 /** @} */
 
 /* Function prototypes. */
@@ -215,6 +237,15 @@ REAL4 LALSIIRFilter( REAL4 x, REAL4IIRFilter *filter );
 /* REAL8 LALDIIRFilter( REAL8 x, REAL8IIRFilter *filter ); */
 #define LALDIIRFilter(x,f) XLALIIRFilterREAL8(x,f)
 
+/* ----- IIRFilterBank.c ---------- */
+REAL8IIRFilterBank *XLALCreateREAL8IIRFilterBank( REAL8IIRFilter **stages, UINT4 numStages, UINT4 numLanes );
+void XLALDestroyREAL8IIRFilterBank( REAL8IIRFilterBank *bank );
+int XLALResetREAL8IIRFilterBank( REAL8IIRFilterBank *bank );
+int XLALIIRFilterBankREAL8Vector( REAL8Vector *vector, REAL8IIRFilterBank *bank );
+int XLALIIRFilterBankCOMPLEX16Vector( COMPLEX16Vector *vector, REAL8IIRFilterBank *bank );
+int XLALIIRFilterDecimateBankREAL8Vector( REAL8Vector *output, const REAL8Vector *input, UINT4 factor, REAL8IIRFilterBank *bank );
+int XLALIIRFilterDecimateBankCOMPLEX16Vector( COMPLEX16Vector *output, const COMPLEX16Vector *input, UINT4 factor, REAL8IIRFilterBank *bank );
+
 
 
 /* ----- CreateIIRFilter.c ---------- */
@@ -0,0 +1,276 @@
+/*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with with program; see the file COPYING. If not, write to the
+*  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+*  MA  02110-1301  USA
+*/
+
+#include <string.h>
+#include <lal/LALStdlib.h>
+#include <lal/AVFactories.h>
+#include <lal/IIRFilter.h>
+
+/**
+ * \addtogroup IIRFilterBank_c
+ *
+ * \brief Applies a cascade of IIR filters to several data streams at once.
+ *
+ * ### Description ###
+ *
+ * A \c REAL8IIRFilterBank holds a cascade of IIR filters, e.g. the
+ * several low-pass filters used to band-limit heterodyned data, together
+ * with an independent filter history for each of several data streams,
+ * or \e lanes.  The filter bank is created from the individual
+ * \c REAL8IIRFilter stages with XLALCreateREAL8IIRFilterBank(); the
+ * histories of all lanes start at zero.
+ *
+ * The data passed to XLALIIRFilterBankREAL8Vector() are interleaved, i.e.
+ * sample \f$n\f$ of lane \f$l\f$ is element \f$n\times\mathrm{numLanes}+l\f$
+ * of the vector, so that a \c COMPLEX16Vector is simply a two-lane
+ * vector of its real and imaginary parts; this case is handled by
+ * XLALIIRFilterBankCOMPLEX16Vector().  Each sample is passed through every
+ * stage of the cascade for all lanes before moving on to the next sample,
+ * and the lanes are the innermost loop, so that the compiler can
+ * vectorise the filter over the lanes.  The result for each lane is
+ * identical to passing it through each stage in turn using
+ * XLALIIRFilterREAL8().
+ *
+ * The functions XLALIIRFilterDecimateBankREAL8Vector() and
+ * XLALIIRFilterDecimateBankCOMPLEX16Vector() fuse the filter with a
+ * decimation stage: the filtered data are averaged over consecutive
+ * blocks of \c factor samples without being written back to memory.  Any
+ * samples after the last complete block are filtered, so that the
+ * filter history is continuous across calls, but are not output.
+ *
+ * The complete state of the filter bank is contained in its \c history
+ * vector, which may be saved and later copied back to checkpoint the
+ * filters; XLALResetREAL8IIRFilterBank() sets it back to zero.
+ *
+ */
+/** @{ */
+
+/* Pass one sample for each lane through all stages of the filter bank */
+static inline void IIRFilterBankSample( REAL8 *x, REAL8 *w, const REAL8IIRFilterBank *bank )
+{
+  const UINT4 numLanes = bank->numLanes;
+  const UINT4 order = bank->order;
+
+  for ( UINT4 s = 0; s < bank->numStages; ++s ) {
+    const REAL8 *directCoef = bank->directCoef->data + s * ( order + 1 );
+    const REAL8 *recursCoef = bank->recursCoef->data + s * ( order + 1 );
+    REAL8 *hist = bank->history->data + s * order * numLanes;
+
+    /* Compute the auxiliary datum. */
+    for ( UINT4 l = 0; l < numLanes; ++l ) {
+      w[l] = x[l];
+    }
+    for ( UINT4 k = 1; k <= order; ++k ) {
+      const REAL8 *h = hist + ( k - 1 ) * numLanes;
+      for ( UINT4 l = 0; l < numLanes; ++l ) {
+        w[l] += recursCoef[k] * h[l];
+      }
+    }
+
+    /* Compute the filter output. */
+    for ( UINT4 l = 0; l < numLanes; ++l ) {
+      x[l] = directCoef[0] * w[l];
+    }
+    for ( UINT4 k = 1; k <= order; ++k ) {
+      const REAL8 *h = hist + ( k - 1 ) * numLanes;
+      for ( UINT4 l = 0; l < numLanes; ++l ) {
+        x[l] += directCoef[k] * h[l];
+      }
+    }
+
+    /* Update the filter history. */
+    if ( order > 0 ) {
+      memmove( hist + numLanes, hist, ( order - 1 ) * numLanes * sizeof( *hist ) );
+      memcpy( hist, w, numLanes * sizeof( *hist ) );
+    }
+  }
+}
+
+/** \see See \ref IIRFilterBank_c for documentation */
+REAL8IIRFilterBank *XLALCreateREAL8IIRFilterBank( REAL8IIRFilter **stages, UINT4 numStages, UINT4 numLanes )
+{
+  REAL8IIRFilterBank *bank = NULL;
+  UINT4 order = 0;
+
+  XLAL_CHECK_NULL( stages != NULL, XLAL_EFAULT );
+  XLAL_CHECK_NULL( numStages > 0, XLAL_EINVAL, "Filter bank must have at least one stage" );
+  XLAL_CHECK_NULL( numLanes > 0, XLAL_EINVAL, "Filter bank must have at least one lane" );
+
+  /* Find the largest order of all the stages */
+  for ( UINT4 s = 0; s < numStages; ++s ) {
+    XLAL_CHECK_NULL( stages[s] != NULL, XLAL_EFAULT );
+    XLAL_CHECK_NULL( stages[s]->directCoef != NULL && stages[s]->recursCoef != NULL && stages[s]->history != NULL, XLAL_EINVAL );
+    XLAL_CHECK_NULL( stages[s]->directCoef->length > 0, XLAL_EINVAL );
+    XLAL_CHECK_NULL( stages[s]->directCoef->length <= stages[s]->history->length + 1, XLAL_EINVAL );
+    XLAL_CHECK_NULL( stages[s]->recursCoef->length <= stages[s]->history->length + 1, XLAL_EINVAL );
+    if ( order < stages[s]->history->length ) {
+      order = stages[s]->history->length;
+    }
+  }
+
+  bank = XLALCalloc( 1, sizeof( *bank ) );
+  XLAL_CHECK_NULL( bank != NULL, XLAL_ENOMEM );
+  bank->numStages = numStages;
+  bank->numLanes = numLanes;
+  bank->order = order;
+
+  bank->directCoef = XLALCreateREAL8Vector( numStages * ( order + 1 ) );
+  bank->recursCoef = XLALCreateREAL8Vector( numStages * ( order + 1 ) );
+  bank->history = XLALCreateREAL8Vector( numStages * order * numLanes );
+  if ( bank->directCoef == NULL || bank->recursCoef == NULL || bank->history == NULL ) {
+    XLALDestroyREAL8IIRFilterBank( bank );
+    XLAL_ERROR_NULL( XLAL_ENOMEM );
+  }
+
+  /* Copy the coefficients of each stage, padding with zeros up to the common order;
+     the redundant recursive coefficient d_0 is copied but never used */
+  memset( bank->directCoef->data, 0, bank->directCoef->length * sizeof( REAL8 ) );
+  memset( bank->recursCoef->data, 0, bank->recursCoef->length * sizeof( REAL8 ) );
+  for ( UINT4 s = 0; s < numStages; ++s ) {
+    memcpy( bank->directCoef->data + s * ( order + 1 ), stages[s]->directCoef->data, stages[s]->directCoef->length * sizeof( REAL8 ) );
+    if ( stages[s]->recursCoef->length > 0 ) {
+      memcpy( bank->recursCoef->data + s * ( order + 1 ), stages[s]->recursCoef->data, stages[s]->recursCoef->length * sizeof( REAL8 ) );
+    }
+  }
+
+  XLAL_CHECK_NULL( XLALResetREAL8IIRFilterBank( bank ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  return bank;
+}
+
+/** \see See \ref IIRFilterBank_c for documentation */
+void XLALDestroyREAL8IIRFilterBank( REAL8IIRFilterBank *bank )
+{
+  if ( bank )
+  {
+    XLALDestroyREAL8Vector( bank->directCoef );
+    XLALDestroyREAL8Vector( bank->recursCoef );
+    XLALDestroyREAL8Vector( bank->history );
+    XLALFree( bank );
+  }
+  return;
+}
+
+/** \see See \ref IIRFilterBank_c for documentation */
+int XLALResetREAL8IIRFilterBank( REAL8IIRFilterBank *bank )
+{
+  XLAL_CHECK( bank != NULL && bank->history != NULL, XLAL_EFAULT );
+  if ( bank->history->length > 0 ) {
+    memset( bank->history->data, 0, bank->history->length * sizeof( REAL8 ) );
+  }
+  return XLAL_SUCCESS;
+}
+
+/** \see See \ref IIRFilterBank_c for documentation */
+int XLALIIRFilterBankREAL8Vector( REAL8Vector *vector, REAL8IIRFilterBank *bank )
+{
+  REAL8 *w = NULL;
+
+  XLAL_CHECK( vector != NULL && bank != NULL, XLAL_EFAULT );
+  XLAL_CHECK( vector->length == 0 || vector->data != NULL, XLAL_EINVAL );
+  XLAL_CHECK( vector->length % bank->numLanes == 0, XLAL_EBADLEN, "Vector length %u is not a multiple of the number of lanes %u", vector->length, bank->numLanes );
+
+  w = XLALMalloc( bank->numLanes * sizeof( *w ) );
+  XLAL_CHECK( w != NULL, XLAL_ENOMEM );
+
+  /* Filter the data in place */
+  const UINT4 numSamples = vector->length / bank->numLanes;
+  for ( UINT4 n = 0; n < numSamples; ++n ) {
+    IIRFilterBankSample( vector->data + n * bank->numLanes, w, bank );
+  }
+
+  XLALFree( w );
+
+  return XLAL_SUCCESS;
+}
+
+/** \see See \ref IIRFilterBank_c for documentation */
+int XLALIIRFilterBankCOMPLEX16Vector( COMPLEX16Vector *vector, REAL8IIRFilterBank *bank )
+{
+  XLAL_CHECK( vector != NULL && bank != NULL, XLAL_EFAULT );
+  XLAL_CHECK( bank->numLanes == 2, XLAL_EINVAL, "Filter bank must have two lanes to filter complex data" );
+
+  /* A complex vector is a two-lane vector of its real and imaginary parts */
+  REAL8Vector view = { .length = 2 * vector->length, .data = ( REAL8 * ) vector->data };
+  XLAL_CHECK( XLALIIRFilterBankREAL8Vector( &view, bank ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  return XLAL_SUCCESS;
+}
+
+/** \see See \ref IIRFilterBank_c for documentation */
+int XLALIIRFilterDecimateBankREAL8Vector( REAL8Vector *output, const REAL8Vector *input, UINT4 factor, REAL8IIRFilterBank *bank )
+{
+  REAL8 *work = NULL;
+
+  XLAL_CHECK( output != NULL && input != NULL && bank != NULL, XLAL_EFAULT );
+  XLAL_CHECK( factor > 0, XLAL_EINVAL, "Decimation factor must be positive" );
+  XLAL_CHECK( input->length == 0 || input->data != NULL, XLAL_EINVAL );
+  XLAL_CHECK( input->length % bank->numLanes == 0, XLAL_EBADLEN, "Input length %u is not a multiple of the number of lanes %u", input->length, bank->numLanes );
+  const UINT4 numLanes = bank->numLanes;
+  const UINT4 numSamples = input->length / numLanes;
+  const UINT4 numBlocks = numSamples / factor;
+  XLAL_CHECK( output->length == numBlocks * numLanes, XLAL_EBADLEN, "Output length %u should be %u", output->length, numBlocks * numLanes );
+  XLAL_CHECK( output->length == 0 || output->data != NULL, XLAL_EINVAL );
+
+  /* Workspace for the current sample, auxiliary data, and block sums of each lane */
+  work = XLALMalloc( 3 * numLanes * sizeof( *work ) );
+  XLAL_CHECK( work != NULL, XLAL_ENOMEM );
+  REAL8 *x = work, *w = work + numLanes, *sum = work + 2 * numLanes;
+
+  for ( UINT4 n = 0, b = 0; n < numSamples; ++b ) {
+
+    /* Filter and sum a block of samples, or filter the remaining samples */
+    for ( UINT4 l = 0; l < numLanes; ++l ) {
+      sum[l] = 0;
+    }
+    for ( UINT4 j = 0; j < factor && n < numSamples; ++j, ++n ) {
+      memcpy( x, input->data + n * numLanes, numLanes * sizeof( *x ) );
+      IIRFilterBankSample( x, w, bank );
+      for ( UINT4 l = 0; l < numLanes; ++l ) {
+        sum[l] += x[l];
+      }
+    }
+
+    /* Output the average of each complete block */
+    if ( b < numBlocks ) {
+      for ( UINT4 l = 0; l < numLanes; ++l ) {
+        output->data[b * numLanes + l] = sum[l] / ( REAL8 ) factor;
+      }
+    }
+
+  }
+
+  XLALFree( work );
+
+  return XLAL_SUCCESS;
+}
+
+/** \see See \ref IIRFilterBank_c for documentation */
+int XLALIIRFilterDecimateBankCOMPLEX16Vector( COMPLEX16Vector *output, const COMPLEX16Vector *input, UINT4 factor, REAL8IIRFilterBank *bank )
+{
+  XLAL_CHECK( output != NULL && input != NULL && bank != NULL, XLAL_EFAULT );
+  XLAL_CHECK( bank->numLanes == 2, XLAL_EINVAL, "Filter bank must have two lanes to filter complex data" );
+
+  /* A complex vector is a two-lane vector of its real and imaginary parts */
+  REAL8Vector outview = { .length = 2 * output->length, .data = ( REAL8 * ) output->data };
+  const REAL8Vector inview = { .length = 2 * input->length, .data = ( REAL8 * ) input->data };
+  XLAL_CHECK( XLALIIRFilterDecimateBankREAL8Vector( &outview, &inview, factor, bank ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  return XLAL_SUCCESS;
+}
+
+/** @} */
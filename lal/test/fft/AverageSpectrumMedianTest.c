@@ -0,0 +1,272 @@
+/*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with with program; see the file COPYING. If not, write to the
+*  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+*  MA  02110-1301  USA
+*/
+
+/*
+ * Check the median and median-mean average spectra, whose per-bin medians
+ * are found by selection rather than by sorting, against reference spectra
+ * computed here from the sorted per-bin periodograms, and check that the
+ * median-mean spectrum does not depend on the number of threads.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <lal/LALStdlib.h>
+#include <lal/AVFactories.h>
+#include <lal/TimeFreqFFT.h>
+#include <lal/RealFFT.h>
+#include <lal/Window.h>
+#include <lal/Random.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#define SEGLEN 256
+#define MAX_NUMSEG 16
+#define NUM_DISTINCT 3
+
+static int compare_REAL4( const void *p1, const void *p2 )
+{
+  REAL4 x1 = *( const REAL4 * )p1;
+  REAL4 x2 = *( const REAL4 * )p2;
+  return ( x1 > x2 ) - ( x1 < x2 );
+}
+
+static int compare_REAL8( const void *p1, const void *p2 )
+{
+  REAL8 x1 = *( const REAL8 * )p1;
+  REAL8 x2 = *( const REAL8 * )p2;
+  return ( x1 > x2 ) - ( x1 < x2 );
+}
+
+/* median of an array by sorting */
+static REAL4 sorted_median_REAL4( REAL4 *x, UINT4 n )
+{
+  qsort( x, n, sizeof( *x ), compare_REAL4 );
+  if ( n % 2 ) {
+    return x[n / 2];
+  }
+  return 0.5 * ( x[n / 2 - 1] + x[n / 2] );
+}
+
+static REAL8 sorted_median_REAL8( REAL8 *x, UINT4 n )
+{
+  qsort( x, n, sizeof( *x ), compare_REAL8 );
+  if ( n % 2 ) {
+    return x[n / 2];
+  }
+  return 0.5 * ( x[n / 2 - 1] + x[n / 2] );
+}
+
+/*
+ * Fill a time series, whose segments are stride samples apart, with
+ * Gaussian noise.  If duplicate is non-zero, the noise repeats every
+ * NUM_DISTINCT strides, so that segments NUM_DISTINCT apart have identical
+ * periodograms and each frequency bin holds duplicate values.
+ */
+static int fill_series( REAL8Vector *data, UINT4 stride, int duplicate, RandomParams *randpar )
+{
+  REAL4Vector *noise = XLALCreateREAL4Vector( data->length );
+  XLAL_CHECK( noise != NULL, XLAL_EFUNC );
+  XLAL_CHECK( XLALNormalDeviates( noise, randpar ) == XLAL_SUCCESS, XLAL_EFUNC );
+  for ( UINT4 i = 0; i < data->length; ++i ) {
+    data->data[i] = noise->data[duplicate ? ( i % ( NUM_DISTINCT * stride ) ) : i];
+  }
+  XLALDestroyREAL4Vector( noise );
+  return XLAL_SUCCESS;
+}
+
+/* per-bin periodograms of each segment of a time series */
+static int segment_periodograms( REAL8FrequencySeries *periodograms, const REAL8TimeSeries *tseries, UINT4 numseg, UINT4 stride, const REAL8Window *window, const REAL8FFTPlan *plan )
+{
+  for ( UINT4 seg = 0; seg < numseg; ++seg ) {
+    REAL8Vector segvec = *tseries->data;
+    REAL8TimeSeries segseries = *tseries;
+    segvec.length = SEGLEN;
+    segvec.data += seg * stride;
+    segseries.data = &segvec;
+    XLAL_CHECK( XLALREAL8ModifiedPeriodogram( &periodograms[seg], &segseries, window, plan ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+  return XLAL_SUCCESS;
+}
+
+int main( void )
+{
+
+  RandomParams *randpar = XLALCreateRandomParams( 1234 );
+  XLAL_CHECK_MAIN( randpar != NULL, XLAL_EFUNC );
+  REAL4Window *window4 = XLALCreateHannREAL4Window( SEGLEN );
+  REAL8Window *window8 = XLALCreateHannREAL8Window( SEGLEN );
+  XLAL_CHECK_MAIN( window4 != NULL && window8 != NULL, XLAL_EFUNC );
+  REAL4FFTPlan *plan4 = XLALCreateForwardREAL4FFTPlan( SEGLEN, 0 );
+  REAL8FFTPlan *plan8 = XLALCreateForwardREAL8FFTPlan( SEGLEN, 0 );
+  XLAL_CHECK_MAIN( plan4 != NULL && plan8 != NULL, XLAL_EFUNC );
+
+  REAL8FrequencySeries periodograms[MAX_NUMSEG];
+  memset( periodograms, 0, sizeof( periodograms ) );
+  for ( UINT4 seg = 0; seg < MAX_NUMSEG; ++seg ) {
+    periodograms[seg].data = XLALCreateREAL8Vector( SEGLEN / 2 + 1 );
+    XLAL_CHECK_MAIN( periodograms[seg].data != NULL, XLAL_EFUNC );
+  }
+  REAL4FrequencySeries spectrum4;
+  REAL8FrequencySeries spectrum8;
+  memset( &spectrum4, 0, sizeof( spectrum4 ) );
+  memset( &spectrum8, 0, sizeof( spectrum8 ) );
+  spectrum4.data = XLALCreateREAL4Vector( SEGLEN / 2 + 1 );
+  spectrum8.data = XLALCreateREAL8Vector( SEGLEN / 2 + 1 );
+  XLAL_CHECK_MAIN( spectrum4.data != NULL && spectrum8.data != NULL, XLAL_EFUNC );
+
+  /* Check the median spectrum for odd and even numbers of segments, with and without duplicate values */
+  for ( UINT4 numseg = 1; numseg <= MAX_NUMSEG; ++numseg ) {
+    for ( int duplicate = 0; duplicate < 2; ++duplicate ) {
+      const UINT4 stride = SEGLEN;
+      const REAL8 normfac = 1.0 / XLALMedianBias( numseg );
+
+      REAL8TimeSeries tseries8;
+      REAL4TimeSeries tseries4;
+      memset( &tseries8, 0, sizeof( tseries8 ) );
+      memset( &tseries4, 0, sizeof( tseries4 ) );
+      tseries8.deltaT = tseries4.deltaT = 1.0 / 1024;
+      tseries8.data = XLALCreateREAL8Vector( ( numseg - 1 ) * stride + SEGLEN );
+      tseries4.data = XLALCreateREAL4Vector( ( numseg - 1 ) * stride + SEGLEN );
+      XLAL_CHECK_MAIN( tseries8.data != NULL && tseries4.data != NULL, XLAL_EFUNC );
+      XLAL_CHECK_MAIN( fill_series( tseries8.data, stride, duplicate, randpar ) == XLAL_SUCCESS, XLAL_EFUNC );
+      for ( UINT4 i = 0; i < tseries4.data->length; ++i ) {
+        tseries4.data->data[i] = tseries8.data->data[i];
+      }
+
+      /* REAL8 median against the sorted median of each bin */
+      XLAL_CHECK_MAIN( segment_periodograms( periodograms, &tseries8, numseg, stride, window8, plan8 ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK_MAIN( XLALREAL8AverageSpectrumMedian( &spectrum8, &tseries8, SEGLEN, stride, window8, plan8 ) == XLAL_SUCCESS, XLAL_EFUNC );
+      for ( UINT4 k = 0; k < spectrum8.data->length; ++k ) {
+        REAL8 bin[MAX_NUMSEG];
+        for ( UINT4 s = 0; s < numseg; ++s ) {
+          bin[s] = periodograms[s].data->data[k];
+        }
+        const REAL8 expected = normfac * sorted_median_REAL8( bin, numseg );
+        XLAL_CHECK_MAIN( spectrum8.data->data[k] == expected, XLAL_EFAILED, "REAL8 median of %u segments%s: bin %u = %.17g != %.17g", numseg, duplicate ? " with duplicates" : "", k, spectrum8.data->data[k], expected );
+      }
+
+      /* REAL4 median against the sorted median of each bin, with the bias factor in single precision as in XLALREAL4AverageSpectrumMedian() */
+      {
+        const REAL4 biasfac4 = XLALMedianBias( numseg );
+        const REAL4 normfac4 = 1.0 / biasfac4;
+        REAL4FrequencySeries work[MAX_NUMSEG];
+        memset( work, 0, sizeof( work ) );
+        for ( UINT4 seg = 0; seg < numseg; ++seg ) {
+          REAL4Vector segvec = *tseries4.data;
+          REAL4TimeSeries segseries = tseries4;
+          segvec.length = SEGLEN;
+          segvec.data += seg * stride;
+          segseries.data = &segvec;
+          work[seg].data = XLALCreateREAL4Vector( SEGLEN / 2 + 1 );
+          XLAL_CHECK_MAIN( work[seg].data != NULL, XLAL_EFUNC );
+          XLAL_CHECK_MAIN( XLALREAL4ModifiedPeriodogram( &work[seg], &segseries, window4, plan4 ) == XLAL_SUCCESS, XLAL_EFUNC );
+        }
+        XLAL_CHECK_MAIN( XLALREAL4AverageSpectrumMedian( &spectrum4, &tseries4, SEGLEN, stride, window4, plan4 ) == XLAL_SUCCESS, XLAL_EFUNC );
+        for ( UINT4 k = 0; k < spectrum4.data->length; ++k ) {
+          REAL4 bin[MAX_NUMSEG];
+          for ( UINT4 s = 0; s < numseg; ++s ) {
+            bin[s] = work[s].data->data[k];
+          }
+          const REAL4 expected = normfac4 * sorted_median_REAL4( bin, numseg );
+          XLAL_CHECK_MAIN( spectrum4.data->data[k] == expected, XLAL_EFAILED, "REAL4 median of %u segments%s: bin %u = %.9g != %.9g", numseg, duplicate ? " with duplicates" : "", k, spectrum4.data->data[k], expected );
+        }
+        for ( UINT4 seg = 0; seg < numseg; ++seg ) {
+          XLALDestroyREAL4Vector( work[seg].data );
+        }
+      }
+
+      XLALDestroyREAL8Vector( tseries8.data );
+      XLALDestroyREAL4Vector( tseries4.data );
+    }
+  }
+  printf( "Median spectra match sorted medians\n" );
+
+  /* Check the median-mean spectrum, with half-overlapping segments, against a serial reference, and for different numbers of threads */
+  for ( UINT4 numseg = 2; numseg <= MAX_NUMSEG; numseg += 2 ) {
+    for ( int duplicate = 0; duplicate < 2; ++duplicate ) {
+      const UINT4 stride = SEGLEN / 2;
+      const UINT4 halfnumseg = numseg / 2;
+      const REAL8 normfac = 1.0 / ( 2.0 * XLALMedianBias( halfnumseg ) );
+
+      REAL8TimeSeries tseries;
+      memset( &tseries, 0, sizeof( tseries ) );
+      tseries.deltaT = 1.0 / 1024;
+      tseries.data = XLALCreateREAL8Vector( ( numseg - 1 ) * stride + SEGLEN );
+      XLAL_CHECK_MAIN( tseries.data != NULL, XLAL_EFUNC );
+      XLAL_CHECK_MAIN( fill_series( tseries.data, stride, duplicate, randpar ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+      XLAL_CHECK_MAIN( segment_periodograms( periodograms, &tseries, numseg, stride, window8, plan8 ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK_MAIN( XLALREAL8AverageSpectrumMedianMean( &spectrum8, &tseries, SEGLEN, stride, window8, plan8 ) == XLAL_SUCCESS, XLAL_EFUNC );
+      for ( UINT4 k = 0; k < spectrum8.data->length; ++k ) {
+        REAL8 even[MAX_NUMSEG / 2], odd[MAX_NUMSEG / 2];
+        for ( UINT4 s = 0; s < halfnumseg; ++s ) {
+          even[s] = periodograms[2 * s].data->data[k];
+          odd[s] = periodograms[2 * s + 1].data->data[k];
+        }
+        const REAL8 evenmedian = sorted_median_REAL8( even, halfnumseg );
+        const REAL8 oddmedian = sorted_median_REAL8( odd, halfnumseg );
+        const REAL8 expected = normfac * ( evenmedian + oddmedian );
+        XLAL_CHECK_MAIN( spectrum8.data->data[k] == expected, XLAL_EFAILED, "Median-mean of %u segments%s: bin %u = %.17g != %.17g", numseg, duplicate ? " with duplicates" : "", k, spectrum8.data->data[k], expected );
+      }
+
+#ifdef _OPENMP
+      {
+        const int max_threads = omp_get_max_threads();
+        REAL8FrequencySeries serial;
+        memset( &serial, 0, sizeof( serial ) );
+        serial.data = XLALCreateREAL8Vector( SEGLEN / 2 + 1 );
+        XLAL_CHECK_MAIN( serial.data != NULL, XLAL_EFUNC );
+        omp_set_num_threads( 1 );
+        XLAL_CHECK_MAIN( XLALREAL8AverageSpectrumMedianMean( &serial, &tseries, SEGLEN, stride, window8, plan8 ) == XLAL_SUCCESS, XLAL_EFUNC );
+        for ( int nthreads = 2; nthreads <= 5; ++nthreads ) {
+          omp_set_num_threads( nthreads );
+          XLAL_CHECK_MAIN( XLALREAL8AverageSpectrumMedianMean( &spectrum8, &tseries, SEGLEN, stride, window8, plan8 ) == XLAL_SUCCESS, XLAL_EFUNC );
+          for ( UINT4 k = 0; k < spectrum8.data->length; ++k ) {
+            XLAL_CHECK_MAIN( spectrum8.data->data[k] == serial.data->data[k], XLAL_EFAILED, "Median-mean of %u segments with %d threads: bin %u = %.17g != %.17g with 1 thread", numseg, nthreads, k, spectrum8.data->data[k], serial.data->data[k] );
+          }
+        }
+        omp_set_num_threads( max_threads );
+        XLALDestroyREAL8Vector( serial.data );
+      }
+#endif
+
+      XLALDestroyREAL8Vector( tseries.data );
+    }
+  }
+  printf( "Median-mean spectra match serial reference\n" );
+
+  /* Cleanup */
+  for ( UINT4 seg = 0; seg < MAX_NUMSEG; ++seg ) {
+    XLALDestroyREAL8Vector( periodograms[seg].data );
+  }
+  XLALDestroyREAL4Vector( spectrum4.data );
+  XLALDestroyREAL8Vector( spectrum8.data );
+  XLALDestroyREAL4FFTPlan( plan4 );
+  XLALDestroyREAL8FFTPlan( plan8 );
+  XLALDestroyREAL4Window( window4 );
+  XLALDestroyREAL8Window( window8 );
+  XLALDestroyRandomParams( randpar );
+
+  /* Check for memory leaks */
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+
+}
@@ -0,0 +1,203 @@
+/*
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with with program; see the file COPYING. If not, write to the
+ *  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ *  MA  02110-1301  USA
+ */
+
+#include <complex.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <gsl/gsl_math.h>
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/AVFactories.h>
+#include <lal/IIRFilter.h>
+#include <lal/ZPGFilter.h>
+
+#define NUM_STAGES 3
+#define NUM_LANES 5
+#define NUM_SAMPLES 1003
+#define DECIMATE 10
+
+/* Create a second- or third-order Butterworth low-pass filter */
+static REAL8IIRFilter *create_butterworth( REAL8 knee, UINT4 order )
+{
+  const REAL8 wc = tan( LAL_PI * knee );
+  COMPLEX16ZPGFilter *zpg = XLALCreateCOMPLEX16ZPGFilter( 0, order );
+  XLAL_CHECK_NULL( zpg != NULL, XLAL_EFUNC );
+  if ( order == 3 ) {
+    zpg->poles->data[0] = ( wc * sqrt( 3. ) / 2. ) + I * ( wc * 0.5 );
+    zpg->poles->data[1] = I * wc;
+    zpg->poles->data[2] = -( wc * sqrt( 3. ) / 2. ) + I * ( wc * 0.5 );
+    zpg->gain = I * wc * wc * wc;
+  } else {
+    zpg->poles->data[0] = ( wc * sqrt( 2. ) / 2. ) + I * ( wc * sqrt( 2. ) / 2. );
+    zpg->poles->data[1] = -( wc * sqrt( 2. ) / 2. ) + I * ( wc * sqrt( 2. ) / 2. );
+    zpg->gain = -wc * wc;
+  }
+  XLAL_CHECK_NULL( XLALWToZCOMPLEX16ZPGFilter( zpg ) == XLAL_SUCCESS, XLAL_EFUNC );
+  REAL8IIRFilter *filter = XLALCreateREAL8IIRFilter( zpg );
+  XLAL_CHECK_NULL( filter != NULL, XLAL_EFUNC );
+  XLALDestroyCOMPLEX16ZPGFilter( zpg );
+  return filter;
+}
+
+/* Input data for each lane */
+static REAL8 input_datum( UINT4 n, UINT4 l )
+{
+  return sin( 0.37 * n * ( l + 1 ) ) + ( ( n + 3 * l ) % 17 == 0 ? 1.0 : 0.0 );
+}
+
+int main( void )
+{
+
+  /* Create a cascade of filters of different orders */
+  REAL8IIRFilter *stages[NUM_STAGES];
+  for ( UINT4 s = 0; s < NUM_STAGES; ++s ) {
+    stages[s] = create_butterworth( 0.05 * ( s + 1 ), ( s == 1 ) ? 2 : 3 );
+    XLAL_CHECK_MAIN( stages[s] != NULL, XLAL_EFUNC );
+  }
+
+  /* Create reference filters for each lane */
+  REAL8IIRFilter *ref[NUM_LANES][NUM_STAGES];
+  for ( UINT4 l = 0; l < NUM_LANES; ++l ) {
+    for ( UINT4 s = 0; s < NUM_STAGES; ++s ) {
+      ref[l][s] = create_butterworth( 0.05 * ( s + 1 ), ( s == 1 ) ? 2 : 3 );
+      XLAL_CHECK_MAIN( ref[l][s] != NULL, XLAL_EFUNC );
+    }
+  }
+
+  /* Create filter bank */
+  REAL8IIRFilterBank *bank = XLALCreateREAL8IIRFilterBank( stages, NUM_STAGES, NUM_LANES );
+  XLAL_CHECK_MAIN( bank != NULL, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( bank->order == GSL_MAX( stages[0]->history->length, stages[1]->history->length ), XLAL_EFAILED );
+  XLAL_CHECK_MAIN( stages[0]->history->length != stages[1]->history->length, XLAL_EFAILED );
+
+  /* Filter interleaved data with the filter bank, and each lane with the reference filters */
+  REAL8Vector *data = XLALCreateREAL8Vector( NUM_SAMPLES * NUM_LANES );
+  REAL8Vector *refdata = XLALCreateREAL8Vector( NUM_SAMPLES * NUM_LANES );
+  XLAL_CHECK_MAIN( data != NULL && refdata != NULL, XLAL_EFUNC );
+  for ( UINT4 n = 0; n < NUM_SAMPLES; ++n ) {
+    for ( UINT4 l = 0; l < NUM_LANES; ++l ) {
+      REAL8 x = data->data[n * NUM_LANES + l] = input_datum( n, l );
+      for ( UINT4 s = 0; s < NUM_STAGES; ++s ) {
+        x = XLALIIRFilterREAL8( x, ref[l][s] );
+      }
+      refdata->data[n * NUM_LANES + l] = x;
+    }
+  }
+  XLAL_CHECK_MAIN( XLALIIRFilterBankREAL8Vector( data, bank ) == XLAL_SUCCESS, XLAL_EFUNC );
+  for ( UINT4 i = 0; i < data->length; ++i ) {
+    XLAL_CHECK_MAIN( data->data[i] == refdata->data[i], XLAL_EFAILED, "Filter bank output [%u] = %.16g does not match reference %.16g", i, data->data[i], refdata->data[i] );
+  }
+  printf( "Filter bank output matches reference filters\n" );
+
+  /* Save the filter bank state */
+  REAL8Vector *checkpoint = XLALCreateREAL8Vector( bank->history->length );
+  XLAL_CHECK_MAIN( checkpoint != NULL, XLAL_EFUNC );
+  memcpy( checkpoint->data, bank->history->data, checkpoint->length * sizeof( REAL8 ) );
+
+  /* Filter and decimate more data with the filter bank, and filter and average with the reference filters */
+  const UINT4 numBlocks = NUM_SAMPLES / DECIMATE;
+  REAL8Vector *decdata = XLALCreateREAL8Vector( numBlocks * NUM_LANES );
+  REAL8Vector *refdecdata = XLALCreateREAL8Vector( numBlocks * NUM_LANES );
+  XLAL_CHECK_MAIN( decdata != NULL && refdecdata != NULL, XLAL_EFUNC );
+  for ( UINT4 n = 0; n < NUM_SAMPLES; ++n ) {
+    for ( UINT4 l = 0; l < NUM_LANES; ++l ) {
+      REAL8 x = data->data[n * NUM_LANES + l] = input_datum( n + NUM_SAMPLES, l );
+      for ( UINT4 s = 0; s < NUM_STAGES; ++s ) {
+        x = XLALIIRFilterREAL8( x, ref[l][s] );
+      }
+      refdata->data[n * NUM_LANES + l] = x;
+    }
+  }
+  for ( UINT4 b = 0; b < numBlocks; ++b ) {
+    for ( UINT4 l = 0; l < NUM_LANES; ++l ) {
+      REAL8 sum = 0;
+      for ( UINT4 j = 0; j < DECIMATE; ++j ) {
+        sum += refdata->data[( b * DECIMATE + j ) * NUM_LANES + l];
+      }
+      refdecdata->data[b * NUM_LANES + l] = sum / ( REAL8 ) DECIMATE;
+    }
+  }
+  XLAL_CHECK_MAIN( XLALIIRFilterDecimateBankREAL8Vector( decdata, data, DECIMATE, bank ) == XLAL_SUCCESS, XLAL_EFUNC );
+  for ( UINT4 i = 0; i < decdata->length; ++i ) {
+    XLAL_CHECK_MAIN( decdata->data[i] == refdecdata->data[i], XLAL_EFAILED, "Decimated output [%u] = %.16g does not match reference %.16g", i, decdata->data[i], refdecdata->data[i] );
+  }
+  printf( "Decimated filter bank output matches reference filters\n" );
+
+  /* Restore the filter bank state, and check the decimated output is reproduced */
+  memcpy( bank->history->data, checkpoint->data, checkpoint->length * sizeof( REAL8 ) );
+  XLAL_CHECK_MAIN( XLALIIRFilterDecimateBankREAL8Vector( decdata, data, DECIMATE, bank ) == XLAL_SUCCESS, XLAL_EFUNC );
+  for ( UINT4 i = 0; i < decdata->length; ++i ) {
+    XLAL_CHECK_MAIN( decdata->data[i] == refdecdata->data[i], XLAL_EFAILED, "Restored decimated output [%u] = %.16g does not match reference %.16g", i, decdata->data[i], refdecdata->data[i] );
+  }
+  printf( "Restored filter bank state reproduces decimated output\n" );
+
+  /* Filter complex data with a two-lane filter bank, and the real and imaginary parts with new reference filters */
+  {
+    REAL8IIRFilterBank *cbank = XLALCreateREAL8IIRFilterBank( stages, NUM_STAGES, 2 );
+    XLAL_CHECK_MAIN( cbank != NULL, XLAL_EFUNC );
+    REAL8IIRFilter *cref[2][NUM_STAGES];
+    for ( UINT4 l = 0; l < 2; ++l ) {
+      for ( UINT4 s = 0; s < NUM_STAGES; ++s ) {
+        cref[l][s] = create_butterworth( 0.05 * ( s + 1 ), ( s == 1 ) ? 2 : 3 );
+        XLAL_CHECK_MAIN( cref[l][s] != NULL, XLAL_EFUNC );
+      }
+    }
+    COMPLEX16Vector *cdata = XLALCreateCOMPLEX16Vector( NUM_SAMPLES );
+    XLAL_CHECK_MAIN( cdata != NULL, XLAL_EFUNC );
+    for ( UINT4 n = 0; n < NUM_SAMPLES; ++n ) {
+      cdata->data[n] = input_datum( n, 0 ) + I * input_datum( n, 1 );
+    }
+    XLAL_CHECK_MAIN( XLALIIRFilterBankCOMPLEX16Vector( cdata, cbank ) == XLAL_SUCCESS, XLAL_EFUNC );
+    for ( UINT4 n = 0; n < NUM_SAMPLES; ++n ) {
+      REAL8 re = input_datum( n, 0 ), im = input_datum( n, 1 );
+      for ( UINT4 s = 0; s < NUM_STAGES; ++s ) {
+        re = XLALIIRFilterREAL8( re, cref[0][s] );
+        im = XLALIIRFilterREAL8( im, cref[1][s] );
+      }
+      XLAL_CHECK_MAIN( creal( cdata->data[n] ) == re && cimag( cdata->data[n] ) == im, XLAL_EFAILED, "Complex filter bank output [%u] does not match reference", n );
+    }
+    printf( "Complex filter bank output matches reference filters\n" );
+    for ( UINT4 l = 0; l < 2; ++l ) {
+      for ( UINT4 s = 0; s < NUM_STAGES; ++s ) {
+        XLALDestroyREAL8IIRFilter( cref[l][s] );
+      }
+    }
+    XLALDestroyCOMPLEX16Vector( cdata );
+    XLALDestroyREAL8IIRFilterBank( cbank );
+  }
+
+  /* Cleanup */
+  for ( UINT4 s = 0; s < NUM_STAGES; ++s ) {
+    XLALDestroyREAL8IIRFilter( stages[s] );
+    for ( UINT4 l = 0; l < NUM_LANES; ++l ) {
+      XLALDestroyREAL8IIRFilter( ref[l][s] );
+    }
+  }
+  XLALDestroyREAL8IIRFilterBank( bank );
+  XLALDestroyREAL8Vector( data );
+  XLALDestroyREAL8Vector( refdata );
+  XLALDestroyREAL8Vector( decdata );
+  XLALDestroyREAL8Vector( refdecdata );
+  XLALDestroyREAL8Vector( checkpoint );
+
+  /* Check for memory leaks */
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+
+}
@@ -455,6 +455,8 @@ REAL8 mean_time_step_sfr(REAL8 zmax, REAL8 rate_local);
 REAL8 drawRedshift(REAL8 zmin, REAL8 zmax, REAL8 pzmax);
 REAL8 redshift_mass(REAL8 mass, REAL8 z);
 static void scale_lalsim_distance(SimInspiralTable *inj,char ** IFOnames, REAL8FrequencySeries **psds,REAL8 *start_freqs,LoudnessDistribution dDistr);
+static void scale_lalsim_distance_block(SimInspiralTable **injs,UINT4 num_injs,char ** IFOnames, REAL8FrequencySeries **psds,REAL8 *start_freqs,LoudnessDistribution dDistr);
+static void draw_lalsim_distance(SimInspiralTable *inj,const REAL8 *SNRs,UINT4 num_ifos,LoudnessDistribution snrDistr);
 static REAL8 draw_uniform_snr(REAL8 snrmin,REAL8 snrmax);
 static REAL8 draw_log10_snr(REAL8 snrmin,REAL8 snrmax);
 static REAL8 draw_volume_snr(REAL8 snrmin,REAL8 snrmax);
@@ -546,6 +548,7 @@ AlignmentType alignInj = notAligned;
 REAL8 redshift;
 
 REAL8 single_IFO_SNR_threshold=0.0;
+INT4 snrBlockSize=0;
 char ** ifonames=NULL;
 int numifos=0;
 
@@ -1021,6 +1024,7 @@ static void print_usage(char *program)
       " [--min-snr] SMIN          set the minimum network snr\n"\
       " [--max-snr] SMAX          set the maximum network snr\n"\
       " [--min-coinc-snr] sm      Set the minimum SNR in two IFOs. Neglected if a single IFO is used\n"\
+      " [--snr-block-size] N      Compute the LALSimulation SNRs of blocks of N injections in parallel\n"\
       " [--ligo-psd] filename     Ascii, tab-separated file of frequency, value pairs to use for LIGO PSD in snr computation\n"\
       " [--ligo-fake-psd] PSD     LALsimulation PSD fit to use instead of a file. Allowed values: LALLIGO, LALAdLIGO\n"\
       " [--ligo-start-freq] freq  Frequency in Hz to use for LIGO snr computation\n"\
@@ -1889,6 +1893,10 @@ int main( int argc, char *argv[] )
   REAL8 pzmax=0; /* maximal value of the probability distribution of the redshift */
   INT4 ncount;
   size_t ninj;
+  SimInspiralTable **snrBlock=NULL;
+  UINT4 numSnrBlock=0;
+  REAL8FrequencySeries **blockPsds=NULL;
+  REAL8 *blockStartFreqs=NULL;
   int rand_seed = 1;
 
   /* waveform */
@@ -1978,6 +1986,7 @@ int main( int argc, char *argv[] )
     {"min-snr",                 required_argument, 0,                '2'},
     {"max-snr",                 required_argument, 0,                '3'},
     {"min-coinc-snr",           required_argument, 0,                1707},
+    {"snr-block-size",          required_argument, 0,                1708},
     {"ifos",                    required_argument, 0,                '4'},
     {"ninja-snr",               no_argument,       &ninjaSNR,          1},
     {"ligo-psd",                required_argument, 0,                500},
@@ -3007,6 +3016,21 @@ int main( int argc, char *argv[] )
               "float", "%e", single_IFO_SNR_threshold );
         break;
 
+      case 1708: /* Set number of injections whose SNRs are computed together */
+        snrBlockSize=(INT4) atoi(LALoptarg);
+        if ( snrBlockSize < 1 )
+        {
+          fprintf( stderr, "invalid argument to --%s:\n"
+              "SNR block size must be a positive integer "
+              "(%d specified)\n",
+              long_options[option_index].name, snrBlockSize );
+          exit( 1 );
+        }
+        this_proc_param = this_proc_param->next =
+          next_process_param( long_options[option_index].name,
+              "int", "%d", snrBlockSize );
+        break;
+
       case 'g':
         minSpin1 = atof( LALoptarg );
         this_proc_param = this_proc_param->next =
@@ -4017,6 +4041,10 @@ int main( int argc, char *argv[] )
     pzmax = probability_redshift(maxZ);
   }
 
+  /* allocate the block of injections whose SNRs are computed together */
+  if (snrBlockSize > 1 && ifos!=NULL && !ninjaSNR)
+    snrBlock = (SimInspiralTable **) LALCalloc(snrBlockSize, sizeof(SimInspiralTable *));
+
   /* loop over parameter generation until end time is reached */
   ninj = 0;
   ncount = 0;
@@ -4387,16 +4415,39 @@ int main( int argc, char *argv[] )
         single_IFO_SNR_threshold=0.0;
       }
 
-      /* This function draws a proposed SNR and rescales the distance accordingly */
-      scale_lalsim_distance(simTable, ifonames, psds, start_freqs, dDistr);
+      if (snrBlockSize > 1)
+      {
+        /* Defer the SNR calculation and distance rescaling, and do them
+         * for a whole block of injections at once */
+        if (!blockPsds)
+        {
+          blockPsds = psds;
+          blockStartFreqs = start_freqs;
+          psds = NULL;
+          start_freqs = NULL;
+        }
+        snrBlock[numSnrBlock++] = simTable;
+        if (numSnrBlock == (UINT4) snrBlockSize)
+        {
+          scale_lalsim_distance_block(snrBlock, numSnrBlock, ifonames, blockPsds, blockStartFreqs, dDistr);
+          numSnrBlock = 0;
+        }
+      }
+      else
+      {
+        /* This function draws a proposed SNR and rescales the distance accordingly */
+        scale_lalsim_distance(simTable, ifonames, psds, start_freqs, dDistr);
+      }
 
       /* Clean  */
       if (psds) LALFree(psds);
       if (start_freqs) LALFree(start_freqs);
     }
 
-    /* populate the site specific information: end times and effective distances */
-    LALPopulateSimInspiralSiteInfo( &status, simTable );
+    /* populate the site specific information: end times and effective distances;
+     * for deferred injections this is done once their distance is known */
+    if (!(snrBlockSize > 1 && ifos!=NULL && !ninjaSNR))
+      LALPopulateSimInspiralSiteInfo( &status, simTable );
 
     /* populate the taper options */
     {
@@ -4458,6 +4509,13 @@ int main( int argc, char *argv[] )
 
   }
 
+  /* rescale the distances of any remaining deferred injections */
+  if (numSnrBlock > 0)
+    scale_lalsim_distance_block(snrBlock, numSnrBlock, ifonames, blockPsds, blockStartFreqs, dDistr);
+  if (snrBlock) LALFree(snrBlock);
+  if (blockPsds) LALFree(blockPsds);
+  if (blockStartFreqs) LALFree(blockStartFreqs);
+
   /* destroy the structure containing the random params */
   LAL_CALL(  LALDestroyRandomParams( &status, &randParams ), &status);
 
@@ -4537,12 +4595,7 @@ static void scale_lalsim_distance(SimInspiralTable *inj,
                                   REAL8 *start_freqs,
                                   LoudnessDistribution snrDistr)
 {
-  REAL8 proposedSNR=0.0;
-  REAL8 local_min=0.0;
-  REAL8 net_snr=0.0;
   REAL8 *SNRs=NULL;
-  UINT4 above_threshold=0;
-  REAL8 ratio=1.0;
   UINT4 j=0;
   UINT4 num_ifos=0;
   /* If not already done, set distance to 100Mpc, just to have something while calculating the actual SNR */
@@ -4564,10 +4617,89 @@ static void scale_lalsim_distance(SimInspiralTable *inj,
   }
 
   SNRs=calloc(num_ifos+1 ,sizeof(REAL8));
-  /* Calculate the single IFO and network SNR for the dummy distance of 100Mpc */
+  /* Calculate the single IFO SNRs for the dummy distance of 100Mpc */
   for (j=0;j<num_ifos;j++)
   {
     SNRs[j]=calculate_lalsim_snr(inj,IFOnames[j],psds[j],start_freqs[j]);
+  }
+
+  /* Draw a new SNR and rescale the distance accordingly */
+  draw_lalsim_distance(inj, SNRs, num_ifos, snrDistr);
+
+  if (SNRs) free(SNRs);
+
+}
+
+/* Same as scale_lalsim_distance(), but for a block of injections. The single
+ * IFO SNRs of all injections are calculated in parallel, after which the new
+ * SNRs are drawn in order of the injections. The site specific information of
+ * the injections is then populated with the new distances. */
+static void scale_lalsim_distance_block(SimInspiralTable **injs,
+                                        UINT4 num_injs,
+                                        char **IFOnames,
+                                        REAL8FrequencySeries **psds,
+                                        REAL8 *start_freqs,
+                                        LoudnessDistribution snrDistr)
+{
+  REAL8 *SNRs=NULL;
+  UINT4 k=0;
+  UINT4 num_ifos=0;
+
+  if (IFOnames ==NULL)
+  {
+    fprintf(stderr,"scale_lalsim_distance_block() called with IFOnames=NULL. Exiting...\n");
+    exit(1);
+  }
+
+  /* Get the number of IFOs from IFOnames*/
+  while(IFOnames[num_ifos] !=NULL)
+    num_ifos++;
+
+  /* If not already done, set distance to 100Mpc, just to have something while calculating the actual SNR */
+  for (k=0;k<num_injs;k++)
+  {
+    if (injs[k]->distance<=0)
+      injs[k]->distance=100.0;
+  }
+
+  /* Calculate the single IFO SNRs of all injections and IFOs, sharing the PSDs */
+  SNRs=calloc(num_injs*num_ifos+1 ,sizeof(REAL8));
+#pragma omp parallel for schedule(dynamic)
+  for (k=0;k<num_injs*num_ifos;k++)
+  {
+    SNRs[k]=calculate_lalsim_snr(injs[k/num_ifos],IFOnames[k%num_ifos],psds[k%num_ifos],start_freqs[k%num_ifos]);
+  }
+
+  /* Draw the new SNRs in order, and rescale the distances accordingly */
+  for (k=0;k<num_injs;k++)
+  {
+    draw_lalsim_distance(injs[k], &SNRs[k*num_ifos], num_ifos, snrDistr);
+
+    /* populate the site specific information: end times and effective distances */
+    LALPopulateSimInspiralSiteInfo( &status, injs[k] );
+  }
+
+  if (SNRs) free(SNRs);
+
+}
+
+/* Draw a proposed network SNR for an injection with the given single IFO SNRs,
+ * and rescale its distance accordingly */
+static void draw_lalsim_distance(SimInspiralTable *inj,
+                                 const REAL8 *SNRs,
+                                 UINT4 num_ifos,
+                                 LoudnessDistribution snrDistr)
+{
+  REAL8 proposedSNR=0.0;
+  REAL8 local_min=0.0;
+  REAL8 net_snr=0.0;
+  UINT4 above_threshold=0;
+  REAL8 ratio=1.0;
+  UINT4 j=0;
+
+  /* Calculate the network SNR */
+  for (j=0;j<num_ifos;j++)
+  {
     net_snr+=SNRs[j]*SNRs[j];
   }
   net_snr=sqrt(net_snr);
@@ -4643,8 +4775,6 @@ static void scale_lalsim_distance(SimInspiralTable *inj,
   fclose(snrout);
   */
 
-  if (SNRs) free(SNRs);
-
 }
 
 static REAL8 draw_volume_snr(REAL8 minsnr,REAL8 maxsnr)
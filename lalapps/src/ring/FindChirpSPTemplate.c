@@ -421,9 +421,12 @@ LALFindChirpSPTemplate (
     for ( k = kmin; k < kmax ; ++k )
     {
       REAL4 x_0 = x1 * xfac[k];
+      /* evaluate the logarithm and reciprocal once per sample */
+      const double logx_0 = log(x_0);
+      const double invx_0 = 1.0/x_0;
       REAL4 psi_0 = c0 * ( x_0 * ( c20 + x_0 * ( c15 + x_0 * (c10 + x_0 * x_0 ) ) )
-                  + c25 - c25Log * log(x_0) + (1.0/x_0) * ( c30 - c30Log * log(x_0)
-                  + (1.0/x_0) * ( c35 - (1.0/x_0) * c40P * log(x_0) ) ) );
+                  + c25 - c25Log * logx_0 + invx_0 * ( c30 - c30Log * logx_0
+                  + invx_0 * ( c35 - invx_0 * c40P * logx_0 ) ) );
       REAL4 psi1 = psi_0 + psi0;
       REAL4 psi2;
 
@@ -692,7 +692,6 @@ void coh_PTF_bank_veto_segment_setup(
   struct bankDataOverlaps *dataOverlaps,
   FindChirpTemplate       *bankFcTmplts,
   RingDataSegments        **segments,
-  COMPLEX8VectorSequence  **PTFqVec,
   COMPLEX8FFTPlan         *invplan,
   INT4                    segmentNum,
   struct timeval           startTime
@@ -105,26 +105,36 @@ void coh_PTF_bank_veto_segment_setup(
   struct bankDataOverlaps *dataOverlaps,
   FindChirpTemplate       *bankFcTmplts,
   RingDataSegments        **segments,
-  COMPLEX8VectorSequence  **PTFqVec,
   COMPLEX8FFTPlan         *invplan,
   INT4                    segmentNum,
   struct timeval           startTime
 )
 {
   UINT4 ifoNumber,ui;
-  for (ui = 0 ; ui < params->BVsubBankSize ; ui++)
+  COMPLEX8VectorSequence *tempqVec;
+
+  /* All the bank veto templates are filtered against the same data
+   * segments, so filter them in parallel. Each thread needs its own
+   * workspace for the inverse FFTs */
+#pragma omp parallel private(ui,ifoNumber,tempqVec)
   {
-    for(ifoNumber = 0; ifoNumber < LAL_NUM_IFO; ifoNumber++)
+    tempqVec = XLALCreateCOMPLEX8VectorSequence(1, params->numTimePoints);
+#pragma omp for schedule(dynamic)
+    for (ui = 0 ; ui < params->BVsubBankSize ; ui++)
     {
-      if (params->haveTrig[ifoNumber])
+      for(ifoNumber = 0; ifoNumber < LAL_NUM_IFO; ifoNumber++)
       {
-        /* This function calculates the overlap */
-        coh_PTF_bank_filters(params, &(bankFcTmplts[ui]), 0,
-                             &segments[ifoNumber]->sgmnt[segmentNum], invplan,
-                             PTFqVec[ifoNumber],
-                             dataOverlaps[ui].PTFqVec[ifoNumber], 0, 0);
+        if (params->haveTrig[ifoNumber])
+        {
+          /* This function calculates the overlap */
+          coh_PTF_bank_filters(params, &(bankFcTmplts[ui]), 0,
+                               &segments[ifoNumber]->sgmnt[segmentNum], invplan,
+                               tempqVec,
+                               dataOverlaps[ui].PTFqVec[ifoNumber], 0, 0);
+        }
       }
     }
+    XLALDestroyCOMPLEX8VectorSequence(tempqVec);
   }
   verbose("Generated bank veto filters for segment %d at %ld \n", segmentNum,
           timeval_subtract(&startTime));
@@ -143,6 +153,7 @@ void coh_PTF_calculate_bank_veto_template_filters(
   {
     if (params->haveTrig[ifoNumber])
     {
+#pragma omp parallel for schedule(static)
       for (ui = 0 ; ui < params->BVsubBankSize ; ui++)
       {
         memset(bankOverlaps[ui].PTFM[ifoNumber]->data,0,1*sizeof(COMPLEX8));
@@ -400,72 +411,79 @@ void coh_PTF_chi_square_coh_setup(
 
   if (! chisqOverlaps)
   {
-    tempqVec = XLALCreateCOMPLEX8VectorSequence (1, params->numTimePoints);
     chisqOverlaps = LALCalloc(2*params->numChiSquareBins,\
                               sizeof(*chisqOverlaps));
     *chisqOverlapsP = chisqOverlaps;
-    /* Loop over the chisq bins */
-    for(j = 0; j < params->numChiSquareBins; j++)
+    /* Loop over the chisq bins. Each bin is a pair of band-limited filters
+     * of the same data segments, so the bins are filtered in parallel, each
+     * thread with its own inverse FFT workspace */
+#pragma omp parallel private(j,k,fLowPlus,fHighPlus,fLowCross,fHighCross,\
+                             tempqVec)
     {
-      /* Figure out the upper and lower frequencies for each bin */
-      if (params->numChiSquareBins == 1)
-      {
-        /* This is a stupid case to run! */
-        fLowPlus = 0;
-        fHighPlus = 0;
-        fLowCross = 0;
-        fHighCross = 0;
-      }
-      else if (j == 0)
-      {
-        fLowPlus = 0;
-        fHighPlus = frequencyRangesPlus[LAL_NUM_IFO][0];
-        fLowCross = 0;
-        fHighCross = frequencyRangesCross[LAL_NUM_IFO][0];
-      }
-      else if (j == params->numChiSquareBins-1)
-      {
-        fLowPlus = frequencyRangesPlus[LAL_NUM_IFO][params->numChiSquareBins-2];
-        fHighPlus = 0;
-        fLowCross = \
-            frequencyRangesCross[LAL_NUM_IFO][params->numChiSquareBins-2];
-        fHighCross = 0;
-      }
-      else
-      {
-        fLowPlus = frequencyRangesPlus[LAL_NUM_IFO][j-1];
-        fHighPlus = frequencyRangesPlus[LAL_NUM_IFO][j];
-        fLowCross = frequencyRangesCross[LAL_NUM_IFO][j-1];
-        fHighCross = frequencyRangesCross[LAL_NUM_IFO][j];
-      }
-      /* Calculate the single detector filters for each bin (this is SLOW!)*/
-      for(k = 0; k < LAL_NUM_IFO; k++)
+      tempqVec = XLALCreateCOMPLEX8VectorSequence (1, params->numTimePoints);
+#pragma omp for schedule(dynamic)
+      for(j = 0; j < params->numChiSquareBins; j++)
       {
-        if (params->haveTrig[k])
+        /* Figure out the upper and lower frequencies for each bin */
+        if (params->numChiSquareBins == 1)
+        {
+          /* This is a stupid case to run! */
+          fLowPlus = 0;
+          fHighPlus = 0;
+          fLowCross = 0;
+          fHighCross = 0;
+        }
+        else if (j == 0)
         {
-          /* The + filters done first */
-          chisqOverlaps[j].PTFqVec[k] = \
-              XLALCreateCOMPLEX8VectorSequence (1,params->numAnalPointsBuf);
-          coh_PTF_bank_filters(params,fcTmplt,0,
-              &segments[k]->sgmnt[segmentNumber],invPlan,tempqVec,
-              chisqOverlaps[j].PTFqVec[k],fLowPlus,fHighPlus);
-
-          /* The x filters done here */
-          chisqOverlaps[j+params->numChiSquareBins].PTFqVec[k] = \
-              XLALCreateCOMPLEX8VectorSequence (1,params->numAnalPointsBuf);
-          coh_PTF_bank_filters(params,fcTmplt,0,
-              &segments[k]->sgmnt[segmentNumber],invPlan,tempqVec,
-              chisqOverlaps[j+params->numChiSquareBins].PTFqVec[k],
-              fLowCross,fHighCross);
+          fLowPlus = 0;
+          fHighPlus = frequencyRangesPlus[LAL_NUM_IFO][0];
+          fLowCross = 0;
+          fHighCross = frequencyRangesCross[LAL_NUM_IFO][0];
+        }
+        else if (j == params->numChiSquareBins-1)
+        {
+          fLowPlus = frequencyRangesPlus[LAL_NUM_IFO][params->numChiSquareBins-2];
+          fHighPlus = 0;
+          fLowCross = \
+              frequencyRangesCross[LAL_NUM_IFO][params->numChiSquareBins-2];
+          fHighCross = 0;
         }
         else
         {
-          chisqOverlaps[j].PTFqVec[k] = NULL;
-          chisqOverlaps[j+params->numChiSquareBins].PTFqVec[k] = NULL;
+          fLowPlus = frequencyRangesPlus[LAL_NUM_IFO][j-1];
+          fHighPlus = frequencyRangesPlus[LAL_NUM_IFO][j];
+          fLowCross = frequencyRangesCross[LAL_NUM_IFO][j-1];
+          fHighCross = frequencyRangesCross[LAL_NUM_IFO][j];
         }
-      }/* End loop over ifos */
-    }/* End loop over chi-square bins */
-    XLALDestroyCOMPLEX8VectorSequence(tempqVec);
+        /* Calculate the single detector filters for each bin (this is SLOW!)*/
+        for(k = 0; k < LAL_NUM_IFO; k++)
+        {
+          if (params->haveTrig[k])
+          {
+            /* The + filters done first */
+            chisqOverlaps[j].PTFqVec[k] = \
+                XLALCreateCOMPLEX8VectorSequence (1,params->numAnalPointsBuf);
+            coh_PTF_bank_filters(params,fcTmplt,0,
+                &segments[k]->sgmnt[segmentNumber],invPlan,tempqVec,
+                chisqOverlaps[j].PTFqVec[k],fLowPlus,fHighPlus);
+
+            /* The x filters done here */
+            chisqOverlaps[j+params->numChiSquareBins].PTFqVec[k] = \
+                XLALCreateCOMPLEX8VectorSequence (1,params->numAnalPointsBuf);
+            coh_PTF_bank_filters(params,fcTmplt,0,
+                &segments[k]->sgmnt[segmentNumber],invPlan,tempqVec,
+                chisqOverlaps[j+params->numChiSquareBins].PTFqVec[k],
+                fLowCross,fHighCross);
+          }
+          else
+          {
+            chisqOverlaps[j].PTFqVec[k] = NULL;
+            chisqOverlaps[j+params->numChiSquareBins].PTFqVec[k] = NULL;
+          }
+        }/* End loop over ifos */
+      }/* End loop over chi-square bins */
+      XLALDestroyCOMPLEX8VectorSequence(tempqVec);
+    }
   }
 
 }
@@ -533,52 +551,57 @@ void coh_PTF_chi_square_sngl_setup(
             PTFM,NULL,NULL,frequencyRangesPlus[k],frequencyRangesCross[k],\
             powerBinsPlus[k],powerBinsCross[k],overlapCont,NULL,k,0);
       }
-      for(j = 0; j < params->numChiSquareBins; j++)
+      /* The bins are independent filters of the same data segment, so
+       * filter them in parallel, each thread with its own workspace */
+#pragma omp parallel private(j,fLow,fHigh) firstprivate(tempqVec)
       {
-        if (! chisqSnglOverlaps[j].PTFqVec[k])
+#pragma omp for schedule(dynamic)
+        for(j = 0; j < params->numChiSquareBins; j++)
         {
-          if (! tempqVec)
-          {
-            tempqVec = XLALCreateCOMPLEX8VectorSequence(1, \
-                                                        params->numTimePoints);
-          }
-          /* Work out the upper and lower frequency bins */
-          if (params->numChiSquareBins == 1)
-          {
-            fLow = 0;
-            fHigh = 0;
-          }
-          else if (j == 0)
+          if (! chisqSnglOverlaps[j].PTFqVec[k])
           {
-            fLow = 0;
-            fHigh = frequencyRangesPlus[k][0];
-          }
-          else if (j == params->numChiSquareBins-1)
-          {
-            fLow = frequencyRangesPlus[k][params->numChiSquareBins-2];
-            fHigh = 0;
-          }
-          else
-          {
-            fLow = frequencyRangesPlus[k][j-1];
-            fHigh = frequencyRangesPlus[k][j];
+            if (! tempqVec)
+            {
+              tempqVec = XLALCreateCOMPLEX8VectorSequence(1, \
+                  params->numTimePoints);
+            }
+            /* Work out the upper and lower frequency bins */
+            if (params->numChiSquareBins == 1)
+            {
+              fLow = 0;
+              fHigh = 0;
+            }
+            else if (j == 0)
+            {
+              fLow = 0;
+              fHigh = frequencyRangesPlus[k][0];
+            }
+            else if (j == params->numChiSquareBins-1)
+            {
+              fLow = frequencyRangesPlus[k][params->numChiSquareBins-2];
+              fHigh = 0;
+            }
+            else
+            {
+              fLow = frequencyRangesPlus[k][j-1];
+              fHigh = frequencyRangesPlus[k][j];
+            }
+            /* Calculate the overlaps */
+            chisqSnglOverlaps[j].PTFqVec[k] =
+                XLALCreateCOMPLEX8VectorSequence (1,params->numAnalPointsBuf);
+            coh_PTF_bank_filters(params,fcTmplt,0,\
+                &segments[k]->sgmnt[segmentNumber],invPlan,tempqVec,\
+                chisqSnglOverlaps[j].PTFqVec[k],fLow,fHigh);
           }
-          /* Calculate the overlaps */
-          chisqSnglOverlaps[j].PTFqVec[k] =
-              XLALCreateCOMPLEX8VectorSequence (1,params->numAnalPointsBuf);
-          coh_PTF_bank_filters(params,fcTmplt,0,\
-              &segments[k]->sgmnt[segmentNumber],invPlan,tempqVec,\
-              chisqSnglOverlaps[j].PTFqVec[k],fLow,fHigh);
+        } /* End loop over chisq bins */
+        if (tempqVec)
+        {
+          XLALDestroyCOMPLEX8VectorSequence(tempqVec);
         }
-      } /* End loop over chisq bins */
+      }
     } /* End of if params->haveTrig */
   } /* End loop over ifos */
 
-  if (tempqVec)
-  {
-    XLALDestroyCOMPLEX8VectorSequence(tempqVec);
-  }
-
 }
 
 
@@ -421,7 +421,7 @@ int main(int argc, char **argv)
       /* For every segment we need to calculate the overlap between bank veto
        * templates and the data for use in bank veto calculation */
       coh_PTF_bank_veto_segment_setup(params,dataOverlaps,bankFcTmplts,\
-                                      segments,PTFqVec,invplan,j,startTime);
+                                      segments,invplan,j,startTime);
     }
 
     /* This is the primary loop over templates in the bank */
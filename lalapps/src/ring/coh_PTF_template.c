@@ -206,8 +206,7 @@ void coh_PTF_normalize(
 
   UINT4         i, j, k, kmin, len, kmax,numPoints,vecLength;
   REAL8         f_min, deltaF,deltaT, fFinal, r, s, x, y, length;
-  COMPLEX8     *qtilde, *inputData;
-  COMPLEX8Vector *qtildeVec,qVec;
+  COMPLEX8     *inputData;
   COMPLEX8     *PTFQtilde   = NULL;
 
 
@@ -234,10 +233,6 @@ void coh_PTF_normalize(
   kmin      = f_min / deltaF > 1 ?  f_min / deltaF : 1;
   fFinal    = params->highFilterFrequency;
   kmax      = fFinal / deltaF < (len - 1) ? fFinal / deltaF : (len - 1);
-  qVec.length = numPoints;
-  qtildeVec    = XLALCreateCOMPLEX8Vector( numPoints );
-  qtilde = qtildeVec->data;
-
   /* Data params */
   inputData   = sgmnt->data->data;
   length      = sgmnt->data->length;
@@ -307,8 +302,17 @@ void coh_PTF_normalize(
     }
   }
 
+  /* The filters are independent, so each thread transforms its own using
+   * its own qtilde workspace; the inverse plan is shared */
+#pragma omp parallel for schedule(static) private(k,r,s,x,y)
   for ( i = 0; i < vecLength; ++i )
   {
+    COMPLEX8Vector *qtildeVec = XLALCreateCOMPLEX8Vector( numPoints );
+    COMPLEX8Vector qVec;
+    COMPLEX8 *qtilde;
+    sanity_check( qtildeVec );
+    qtilde = qtildeVec->data;
+    qVec.length = numPoints;
 
     /* compute qtilde using data and Qtilde */
 
@@ -330,12 +334,12 @@ void coh_PTF_normalize(
 
     /* inverse fft to get q */
     XLALCOMPLEX8VectorFFT( &qVec, qtildeVec, invPlan );
+
+    XLALDestroyCOMPLEX8Vector( qtildeVec );
   }
 
   /* FIXME: We would like to be able to print off A,B and M.
      like above, this may be better in the main function */
-
-  XLALDestroyCOMPLEX8Vector( qtildeVec );
 }
 
 void coh_PTF_template_overlaps(
@@ -1524,13 +1524,19 @@ void coh_PTF_calculate_single_detector_filters(
   UINT4                      segNum
 )
 {
-  UINT4 ifoNumber,ui,uj,localCount;
+  INT4 ifoNumber;
+  UINT4 ui,uj,localCount;
   REAL4 reSNRcomp,imSNRcomp;
   REAL4 *localSNRData;
   UINT4 *localAcceptPoints;
 
   REAL4 acceptThresh = params->snglSNRThreshold;
 
+  /* Each detector only touches its own filters, so filter them in parallel.
+   * Spinning templates are instead parallelized over their five filters and
+   * over time within each detector */
+#pragma omp parallel for schedule(dynamic) if(!spinTemplate) \
+    private(ui,uj,localCount,reSNRcomp,imSNRcomp,localSNRData,localAcceptPoints)
   for(ifoNumber = 0; ifoNumber < LAL_NUM_IFO; ifoNumber++)
   {
     if (params->haveTrig[ifoNumber])
@@ -1601,11 +1607,8 @@ UINT4 coh_PTF_calculate_single_det_spin_snr(
   gsl_matrix *eigenvecsSngl;
   gsl_eigen_symmv_workspace *matTemp = gsl_eigen_symmv_alloc(5);
   REAL4 v1_dot_u1, v1_dot_u2, v2_dot_u1, v2_dot_u2,max_eigen;
-  REAL4 *snglv1p,*snglv2p;
   eigenvecsSngl = gsl_matrix_alloc(5,5);
   eigenvalsSngl = gsl_vector_alloc(5);
-  snglv1p = LALCalloc(5 , sizeof(REAL4));
-  snglv2p = LALCalloc(5 , sizeof(REAL4));
   REAL4 acceptThresh = params->snglSNRThreshold;
 
   /* convert PTFM to gsl_matrix */
@@ -1622,11 +1625,14 @@ UINT4 coh_PTF_calculate_single_det_spin_snr(
   gsl_eigen_symmv(PTFmatrix, eigenvalsSngl, eigenvecsSngl,matTemp);
   gsl_eigen_symmv_free(matTemp);
   gsl_matrix_free(PTFmatrix);
-  localCount = 0;
+  /* The time samples are independent, so calculate the SNR in parallel */
+#pragma omp parallel for schedule(static) \
+    private(uj,uk,v1_dot_u1,v1_dot_u2,v2_dot_u1,v2_dot_u2,max_eigen)
   for (ui = params->analStartPointBuf; ui < params->analEndPointBuf; ++ui)
   {  /* loop over time */
+    REAL4 localv1p[5],localv2p[5];
     uk = ui - params->analStartPointBuf;
-    coh_PTF_calculate_rotated_vectors(params,PTFqVec,snglv1p,snglv2p,NULL,\
+    coh_PTF_calculate_rotated_vectors(params,PTFqVec,localv1p,localv2p,NULL,\
             NULL,NULL,eigenvecsSngl,eigenvalsSngl,\
             params->numTimePoints,ui,5,5,ifoNumber);
 
@@ -1634,24 +1640,27 @@ UINT4 coh_PTF_calculate_single_det_spin_snr(
     v1_dot_u1 = v1_dot_u2 = v2_dot_u1 = v2_dot_u2 = max_eigen = 0.0;
     for (uj = 0; uj < 5; uj++)
     {
-      v1_dot_u1 += snglv1p[uj] * snglv1p[uj];
-      v1_dot_u2 += snglv1p[uj] * snglv2p[uj];
-      v2_dot_u2 += snglv2p[uj] * snglv2p[uj];
+      v1_dot_u1 += localv1p[uj] * localv1p[uj];
+      v1_dot_u2 += localv1p[uj] * localv2p[uj];
+      v2_dot_u2 += localv2p[uj] * localv2p[uj];
     }
     max_eigen =0.5 * (v1_dot_u1 + v2_dot_u2 + sqrt((v1_dot_u1 - v2_dot_u2) * \
         (v1_dot_u1 - v2_dot_u2) + 4 * v1_dot_u2 * v1_dot_u2));
-    snrComps[ifoNumber]->data->data[ui-params->analStartPointBuf] =\
-        sqrt(max_eigen);
-    if (snrComps[ifoNumber]->data->data[ui-params->analStartPointBuf] >\
-         acceptThresh)
+    snrComps[ifoNumber]->data->data[uk] = sqrt(max_eigen);
+  }
+
+  /* Then record the points above threshold in time order */
+  localCount = 0;
+  for (uk = 0; uk < params->analEndPointBuf - params->analStartPointBuf; ++uk)
+  {
+    if (snrComps[ifoNumber]->data->data[uk] > acceptThresh)
     {
       localAcceptPoints[localCount] = uk;
       localCount++;
     }
-
   }
-  LALFree(snglv1p);
-  LALFree(snglv2p);
+  gsl_matrix_free(eigenvecsSngl);
+  gsl_vector_free(eigenvalsSngl);
   return localCount;
 }
 
@@ -1788,8 +1797,6 @@ void coh_PTF_calculate_coherent_SNR(
 )
 {
   REAL4 snglSNRthresh = params->snglSNRThreshold;
-  REAL4 *v1p = LALCalloc(vecLengthTwo , sizeof(REAL4));
-  REAL4 *v2p = LALCalloc(vecLengthTwo , sizeof(REAL4));
 
   UINT4 i,j,k,ifoNumber,ifoNumber2,currPointLoc,ifoNum1,ifoNum2;
   UINT4 localCount,*localAcceptPoints,localOffset;
@@ -1827,8 +1834,13 @@ void coh_PTF_calculate_coherent_SNR(
     localCount = snglAcceptCount[ifoNumber2];
     localAcceptPoints = snglAcceptPoints[ifoNumber2];
     localOffset = params->analStartPointBuf-timeOffsetPoints[ifoNumber2];
+    /* Each accepted point of this detector is a distinct time sample, so
+     * they can be processed in parallel */
+#pragma omp parallel for schedule(dynamic,64) \
+    private(i,j,ifoNumber,currPointLoc,v1_dot_u1,v2_dot_u2,max_eigen,coincSNR)
     for (k = 0; k < localCount; ++k)
     {
+      REAL4 v1p[vecLengthTwo],v2p[vecLengthTwo];
       i = localAcceptPoints[k] + localOffset;
       currPointLoc = i-params->analStartPoint;
       /* Continue if not in this analysis segment */
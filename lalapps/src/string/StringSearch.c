@@ -600,53 +600,108 @@ int FindEvents(struct CommandLineArgsTag CLA, const StringTemplate *strtemplate,
 
 int FindStringBurst(struct CommandLineArgsTag CLA, REAL8TimeSeries *ht, unsigned seg_length, const StringTemplate *strtemplate, int NTemplates, REAL8FFTPlan *fplan, REAL8FFTPlan *rplan, SnglBurst **head){
   int i,m;
-  unsigned p;
-  COMPLEX16FrequencySeries *vtilde;
+  int NSegments;
+  int errflag = 0;
+  COMPLEX16FrequencySeries *dtilde;
+  SnglBurst **events;
+
+  /* count overlapping chunks */
+  for(NSegments=0; NSegments < 2*(ht->data->length*ht->deltaT)/CLA.ShortSegDuration - 1 ;NSegments++);
 
   /* create vector that will hold FFT of data;  metadata will be populated
    * by FFT function */
-  vtilde = XLALCreateCOMPLEX16FrequencySeries( ht->name, &ht->epoch, ht->f0, 0.0, &lalDimensionlessUnit, seg_length / 2 + 1 );
-
-  /* loop over templates  */
-  for (m = 0; m < NTemplates; m++){
-    /* loop over overlapping chunks */
-    for(i=0; i < 2*(ht->data->length*ht->deltaT)/CLA.ShortSegDuration - 1 ;i++){
-      /* extract overlapping chunk of data */
-      REAL8TimeSeries *vector = XLALCutREAL8TimeSeries(ht, i * seg_length / 2, seg_length);
-
-      /* FFT it */
-      if(XLALREAL8TimeFreqFFT( vtilde, vector, fplan )) return 1;
+  dtilde = XLALCreateCOMPLEX16FrequencySeries( ht->name, &ht->epoch, ht->f0, 0.0, &lalDimensionlessUnit, seg_length / 2 + 1 );
+
+  /* triggers found by each (template, chunk) pair, collected separately so
+   * that they can be merged in the order of a serial template-by-chunk
+   * loop no matter how the work is shared between threads */
+  events = XLALCalloc(NTemplates * NSegments + 1, sizeof(*events));
+  if(!dtilde || !events){
+    XLALDestroyCOMPLEX16FrequencySeries( dtilde );
+    XLALFree( events );
+    return 1;
+  }
 
-      /* multiply FT of data and String Filter */
-      for ( p = 0 ; p < vtilde->data->length; p++ )
-        vtilde->data->data[p] *= strtemplate[m].StringFilter->data->data[p];
+  /* each chunk of data is Fourier transformed once, then filtered with all
+   * templates in parallel;  printing the snr requires a serial loop */
+#pragma omp parallel private(i,m) if(!CLA.printsnrflag)
+  {
+    /* per-thread workspaces for the filtered data in the frequency and
+     * time domains */
+    COMPLEX16FrequencySeries *vtilde = XLALCutCOMPLEX16FrequencySeries( dtilde, 0, dtilde->data->length );
+    REAL8TimeSeries *vector = XLALCutREAL8TimeSeries( ht, 0, seg_length );
+    if(!vtilde || !vector){
+#pragma omp atomic write
+      errflag = 1;
+    }
 
-      /* reverse FFT it */
-      if(XLALREAL8FreqTimeFFT( vector, vtilde, rplan )) return 1;
-      vector->deltaT = ht->deltaT;	/* gets mucked up by round-off */
+    /* loop over overlapping chunks */
+    for(i=0; i < NSegments; i++){
+#pragma omp single
+      {
+	/* extract overlapping chunk of data and FFT it */
+	REAL8TimeSeries *chunk = errflag ? NULL : XLALCutREAL8TimeSeries(ht, i * seg_length / 2, seg_length);
+	if(!errflag && (!chunk || XLALREAL8TimeFreqFFT( dtilde, chunk, fplan )))
+	  errflag = 1;
+	XLALDestroyREAL8TimeSeries( chunk );
+      }
 
-      /* normalise the result by template normalisation
-	 factor of 2 is from match-filter definition */
-      for ( p = 0 ; p < vector->data->length; p++ )
-	vector->data->data[p] *= 2.0 / strtemplate[m].norm;
+      /* loop over templates */
+#pragma omp for schedule(dynamic)
+      for (m = 0; m < NTemplates; m++){
+	const REAL8 *filter = strtemplate[m].StringFilter->data->data;
+	unsigned p;
+	if(errflag)
+	  continue;
+
+	/* multiply FT of data and String Filter */
+	for ( p = 0 ; p < vtilde->data->length; p++ )
+	  vtilde->data->data[p] = dtilde->data->data[p] * filter[p];
+	vtilde->epoch = dtilde->epoch;
+	vtilde->deltaF = dtilde->deltaF;
+	vtilde->sampleUnits = dtilde->sampleUnits;
+
+	/* reverse FFT it */
+	if(XLALREAL8FreqTimeFFT( vector, vtilde, rplan )){
+#pragma omp atomic write
+	  errflag = 1;
+	  continue;
+	}
+	vector->deltaT = ht->deltaT;	/* gets mucked up by round-off */
 
-      /* find triggers */
-      if(FindEvents(CLA, &strtemplate[m], vector, head)) return 1;
+	/* normalise the result by template normalisation
+	   factor of 2 is from match-filter definition */
+	for ( p = 0 ; p < vector->data->length; p++ )
+	  vector->data->data[p] *= 2.0 / strtemplate[m].norm;
 
-      /*
-      if(m==10){
-      	for ( int ii = 0 ; ii < vector->data->length; ii++ )
-	  printf("%.3e\n",vector->data->data[ii]);
+	/* find triggers */
+	if(FindEvents(CLA, &strtemplate[m], vector, &events[m * NSegments + i])){
+#pragma omp atomic write
+	  errflag = 1;
+	}
       }
-      */
-      /* free chunk */
-      XLALDestroyREAL8TimeSeries( vector );
     }
+
+    XLALDestroyCOMPLEX16FrequencySeries( vtilde );
+    XLALDestroyREAL8TimeSeries( vector );
   }
 
-  XLALDestroyCOMPLEX16FrequencySeries( vtilde );
+  /* prepend the triggers to the list in the order of the serial loop */
+  for (m = 0; m < NTemplates; m++)
+    for(i=0; i < NSegments; i++){
+      SnglBurst *tail = events[m * NSegments + i];
+      if(!tail)
+	continue;
+      while(tail->next)
+	tail = tail->next;
+      tail->next = *head;
+      *head = events[m * NSegments + i];
+    }
 
-  return 0;
+  XLALFree( events );
+  XLALDestroyCOMPLEX16FrequencySeries( dtilde );
+
+  return errflag;
 }
 
 
@@ -31,7 +31,6 @@
 #include <math.h>
 
 
-#include <gsl/gsl_blas.h>
 #include <gsl/gsl_matrix.h>
 #include <gsl/gsl_vector.h>
 
@@ -794,121 +793,103 @@ static SnglBurst *XLALTFTileToBurstEvent(
 }
 
 
-static SnglBurst *XLALComputeExcessPower(
+/*
+ * One row of the tiling:  the "virtual channel" formed by combining
+ * channels adjacent channels starting at channel.  Rows are independent of
+ * one another, so they are analyzed in parallel, and the events found in
+ * each row are collected in a separate list.
+ */
+
+
+struct tiling_row {
+	unsigned channels;
+	unsigned channel;
+	SnglBurst *head;
+};
+
+
+/*
+ * Compute the excess power for all tiles in one row of the tiling, adding
+ * those tiles whose confidence is above threshold to the row's event
+ * list.  sumsquares and uwsumsquares are work spaces with room for one
+ * more sample than the tiling spans;  they are filled with the cumulative
+ * sums of the squared (unwhitened) channel samples, so that the sum of
+ * squares of any tile is the difference of two of them.
+ */
+
+
+static int compute_excess_power_row(
 	const REAL8TimeFrequencyPlane *plane,
 	const LALExcessPowerFilterBank *filter_bank,
-	SnglBurst *head,
+	struct tiling_row *row,
+	double *sumsquares,
+	double *uwsumsquares,
 	double confidence_threshold
 )
 {
-	gsl_vector filter_output = {
-		.size = plane->tiles.tiling_end - plane->tiles.tiling_start,
-		.stride = plane->channel_data->size2,
-		.data = NULL,
-		.block = NULL,
-		.owner = 0
-	};
-	gsl_vector_view filter_output_view;
-	gsl_vector *channel_buffer;
-	gsl_vector *unwhitened_channel_buffer;
-	unsigned channel;
-	unsigned channels;
-	unsigned channel_end;
+	const unsigned channels = row->channels;
+	const unsigned channel = row->channel;
+	const unsigned channel_end = channel + channels;
+	/* compute distance between "virtual pixels" for this (wide)
+	 * channel */
+	const unsigned stride = round(1.0 / (channels * plane->tiles.dof_per_pixel));
+	/* number of "virtual pixels" in the channel time series */
+	const unsigned length = (plane->tiles.tiling_end - plane->tiles.tiling_start) / stride;
+	/* the root mean square of the "virtual channel",
+	 * \sqrt{\mu^{2}} in the algorithm description */
+	const double sample_rms = sqrt(channels * plane->deltaF / plane->fseries_deltaF + XLALREAL8SequenceSum(filter_bank->twice_channel_overlap, channel, channels - 1));
+	/* the root mean square of the "uwapprox" quantity computed
+	 * below, which is proportional to an approximation of the
+	 * unwhitened time series. */
+	double uwsample_rms;
+	/* true unwhitened root mean square for this channel.  the
+	 * ratio of this squared to uwsample_rms^2 is the
+	 * correction factor to be applied to uwapprox^2 to convert
+	 * it to an approximation of the square of the unwhitened
+	 * channel */
+	const double strain_rms = sqrt(compute_unwhitened_mean_square(filter_bank, channel, channels) + XLALREAL8SequenceSum(filter_bank->unwhitened_cross, channel, channels - 1));
 	double h_rss;
 	double confidence;
 	/* number of degrees of freedom in tile = number of
 	 * "virtual pixels" in tile. */
 	double tile_dof;
-	unsigned i;
-
-	/*
-	 * create work spaces
-	 */
-
-	channel_buffer = gsl_vector_alloc(filter_output.size);
-	unwhitened_channel_buffer = gsl_vector_alloc(filter_output.size);
-	if(!channel_buffer || !unwhitened_channel_buffer) {
-		if(channel_buffer)
-			gsl_vector_free(channel_buffer);
-		if(unwhitened_channel_buffer)
-			gsl_vector_free(unwhitened_channel_buffer);
-		XLAL_ERROR_NULL(XLAL_ENOMEM);
-	}
-
-	/*
-	 * enter loops.  note:  this is a quadruply-nested loop that is not
-	 * indented to help fit the code on a terminal display.
-	 */
-
-	for(channels = plane->tiles.min_channels; channels <= plane->tiles.max_channels; channels *= 2) {
-		/* compute distance between "virtual pixels" for this
-		 * (wide) channel */
-		const unsigned stride = round(1.0 / (channels * plane->tiles.dof_per_pixel));
-
-	for(channel_end = (channel = 0) + channels; channel_end <= plane->channel_data->size2; channel_end = (channel += channels / plane->tiles.inv_fractional_stride) + channels) {
-		/* the root mean square of the "virtual channel",
-		 * \sqrt{\mu^{2}} in the algorithm description */
-		const double sample_rms = sqrt(channels * plane->deltaF / plane->fseries_deltaF + XLALREAL8SequenceSum(filter_bank->twice_channel_overlap, channel, channels - 1));
-		/* the root mean square of the "uwapprox" quantity computed
-		 * below, which is proportional to an approximation of the
-		 * unwhitened time series. */
-		double uwsample_rms;
-		/* true unwhitened root mean square for this channel.  the
-		 * ratio of this squared to uwsample_rms^2 is the
-		 * correction factor to be applied to uwapprox^2 to convert
-		 * it to an approximation of the square of the unwhitened
-		 * channel */
-		const double strain_rms = sqrt(compute_unwhitened_mean_square(filter_bank, channel, channels) + XLALREAL8SequenceSum(filter_bank->unwhitened_cross, channel, channels - 1));
-
-		/* compute uwsample_rms */
-		uwsample_rms = compute_unwhitened_mean_square(filter_bank, channel, channels);
-		for(i = channel; i < channel_end - 1; i++)
-			uwsample_rms += filter_bank->twice_channel_overlap->data[i] * filter_bank->basis_filters[i].unwhitened_rms * filter_bank->basis_filters[i + 1].unwhitened_rms * plane->fseries_deltaF / plane->deltaF;
-		uwsample_rms = sqrt(uwsample_rms);
-
-		/* reconstruct the time series and unwhitened time series
-		 * for this (possibly multi-filter) channel.  both time
-		 * series are normalized so that each sample has a mean
-		 * square of 1 */
-		filter_output.data = plane->channel_data->data + filter_output.stride * plane->tiles.tiling_start + channel;
-		filter_output_view = gsl_vector_subvector_with_stride(&filter_output, 0, stride, filter_output.size / stride);
-		gsl_vector_set_zero(channel_buffer);
-		gsl_vector_set_zero(unwhitened_channel_buffer);
-		channel_buffer->size = unwhitened_channel_buffer->size = filter_output_view.vector.size;
-		for(i = channel; i < channel_end; filter_output_view.vector.data++, i++) {
-			gsl_blas_daxpy(1.0 / sample_rms, &filter_output_view.vector, channel_buffer);
-			gsl_blas_daxpy(filter_bank->basis_filters[i].unwhitened_rms * sqrt(plane->fseries_deltaF / plane->deltaF) / uwsample_rms, &filter_output_view.vector, unwhitened_channel_buffer);
-		}
-
-#if 0
-		/* diagnostic code to dump data for the s_{j} histogram */
-		{
-		FILE *f = fopen("sj.dat", "a");
-		for(i = 0; i < channel_buffer->size; i++)
-			fprintf(f, "%g\n", gsl_vector_get(unwhitened_channel_buffer, i));
-		fclose(f);
-		}
-#endif
-
-		/* square the samples in the channel time series because
-		 * from now on that's all we'll need */
-		for(i = 0; i < channel_buffer->size; i++) {
-			gsl_vector_set(channel_buffer, i, pow(gsl_vector_get(channel_buffer, i), 2));
-			gsl_vector_set(unwhitened_channel_buffer, i, pow(gsl_vector_get(unwhitened_channel_buffer, i), 2));
+	unsigned i, j;
+
+	/* compute uwsample_rms */
+	uwsample_rms = compute_unwhitened_mean_square(filter_bank, channel, channels);
+	for(i = channel; i < channel_end - 1; i++)
+		uwsample_rms += filter_bank->twice_channel_overlap->data[i] * filter_bank->basis_filters[i].unwhitened_rms * filter_bank->basis_filters[i + 1].unwhitened_rms * plane->fseries_deltaF / plane->deltaF;
+	uwsample_rms = sqrt(uwsample_rms);
+
+	/* reconstruct the time series and unwhitened time series for this
+	 * (possibly multi-filter) channel, and accumulate the cumulative
+	 * sums of their squares.  both time series are normalized so that
+	 * each sample has a mean square of 1.  the channels of each time
+	 * sample are contiguous in the channel_data array, so the inner
+	 * sum runs over unit-stride memory */
+	sumsquares[0] = uwsumsquares[0] = 0;
+	for(j = 0; j < length; j++) {
+		const double *pixel = plane->channel_data->data + (plane->tiles.tiling_start + j * stride) * plane->channel_data->tda + channel;
+		double sample = 0;
+		double uwsample = 0;
+		for(i = 0; i < channels; i++) {
+			sample += pixel[i];
+			uwsample += pixel[i] * filter_bank->basis_filters[channel + i].unwhitened_rms;
 		}
+		sample /= sample_rms;
+		uwsample *= sqrt(plane->fseries_deltaF / plane->deltaF) / uwsample_rms;
+		sumsquares[j + 1] = sumsquares[j] + sample * sample;
+		uwsumsquares[j + 1] = uwsumsquares[j] + uwsample * uwsample;
+	}
 
 	/* start with at least 2 degrees of freedom */
 	for(tile_dof = 2; tile_dof <= plane->tiles.max_length / stride; tile_dof *= 2) {
 		unsigned start;
-	for(start = 0; start + tile_dof <= channel_buffer->size; start += tile_dof / plane->tiles.inv_fractional_stride) {
-		/* compute sum of squares, and unwhitened sum of squares
-		 * (samples have already been squared) */
-		double sumsquares = 0;
-		double uwsumsquares = 0;
-		for(i = start; i < start + tile_dof; i++) {
-			sumsquares += gsl_vector_get(channel_buffer, i);
-			uwsumsquares += gsl_vector_get(unwhitened_channel_buffer, i);
-		}
+	for(start = 0; start + tile_dof <= length; start += tile_dof / plane->tiles.inv_fractional_stride) {
+		/* compute sum of squares, and unwhitened sum of squares */
+		const unsigned end = start + tile_dof;
+		const double tile_sumsquares = sumsquares[end] - sumsquares[start];
+		const double tile_uwsumsquares = uwsumsquares[end] - uwsumsquares[start];
 
 		/* compute statistical confidence */
 		/* FIXME:  the 0.62 is an empirically determined
@@ -918,38 +899,122 @@ static SnglBurst *XLALComputeExcessPower(
 		 * independent of one another as a consequence of a
 		 * non-zero inner product of the time-domain impulse
 		 * response of the channel filter for adjacent pixels */
-		confidence = -XLALLogChisqCCDF(sumsquares * .62, tile_dof * .62);
-		if(XLALIsREAL8FailNaN(confidence)) {
-			gsl_vector_free(channel_buffer);
-			gsl_vector_free(unwhitened_channel_buffer);
-			XLAL_ERROR_NULL(XLAL_EFUNC);
-		}
+		confidence = -XLALLogChisqCCDF(tile_sumsquares * .62, tile_dof * .62);
+		if(XLALIsREAL8FailNaN(confidence))
+			XLAL_ERROR(XLAL_EFUNC);
 
 		/* record tiles whose statistical confidence is above
 		 * threshold and that have real-valued h_rss */
-		if((confidence >= confidence_threshold) && (uwsumsquares >= tile_dof)) {
-			SnglBurst *oldhead = head;
+		if((confidence >= confidence_threshold) && (tile_uwsumsquares >= tile_dof)) {
+			SnglBurst *oldhead = row->head;
 
 			/* compute h_rss */
-			h_rss = sqrt((uwsumsquares - tile_dof) * (stride * plane->deltaT)) * strain_rms;
+			h_rss = sqrt((tile_uwsumsquares - tile_dof) * (stride * plane->deltaT)) * strain_rms;
 
 			/* add new event to head of linked list */
-			head = XLALTFTileToBurstEvent(plane, plane->tiles.tiling_start + (start - 0.5) * stride, tile_dof * stride, plane->flow + (channel + .5 * channels) * plane->deltaF, channels * plane->deltaF, h_rss, sumsquares, tile_dof, confidence);
-			if(!head) {
-				gsl_vector_free(channel_buffer);
-				gsl_vector_free(unwhitened_channel_buffer);
-				XLAL_ERROR_NULL(XLAL_EFUNC);
+			row->head = XLALTFTileToBurstEvent(plane, plane->tiles.tiling_start + (start - 0.5) * stride, tile_dof * stride, plane->flow + (channel + .5 * channels) * plane->deltaF, channels * plane->deltaF, h_rss, tile_sumsquares, tile_dof, confidence);
+			if(!row->head) {
+				row->head = oldhead;
+				XLAL_ERROR(XLAL_EFUNC);
 			}
-			head->next = oldhead;
+			row->head->next = oldhead;
 		}
 	}
 	}
+
+	/* success */
+	return 0;
+}
+
+
+static SnglBurst *XLALComputeExcessPower(
+	const REAL8TimeFrequencyPlane *plane,
+	const LALExcessPowerFilterBank *filter_bank,
+	SnglBurst *head,
+	double confidence_threshold
+)
+{
+	const unsigned length = plane->tiles.tiling_end - plane->tiles.tiling_start;
+	struct tiling_row *rows;
+	unsigned n_rows;
+	unsigned channel;
+	unsigned channels;
+	unsigned channel_end;
+	int errflag = 0;
+	int r;
+
+	/*
+	 * enumerate the rows of the tiling in the order in which they
+	 * were analyzed by the original serial loop
+	 */
+
+	n_rows = 0;
+	for(channels = plane->tiles.min_channels; channels <= plane->tiles.max_channels; channels *= 2)
+		for(channel_end = (channel = 0) + channels; channel_end <= plane->channel_data->size2; channel_end = (channel += channels / plane->tiles.inv_fractional_stride) + channels)
+			n_rows++;
+	rows = XLALCalloc(n_rows ? n_rows : 1, sizeof(*rows));
+	if(!rows)
+		XLAL_ERROR_NULL(XLAL_ENOMEM);
+	n_rows = 0;
+	for(channels = plane->tiles.min_channels; channels <= plane->tiles.max_channels; channels *= 2)
+		for(channel_end = (channel = 0) + channels; channel_end <= plane->channel_data->size2; channel_end = (channel += channels / plane->tiles.inv_fractional_stride) + channels) {
+			rows[n_rows].channels = channels;
+			rows[n_rows].channel = channel;
+			rows[n_rows].head = NULL;
+			n_rows++;
+		}
+
+	/*
+	 * analyze the rows in parallel, each thread with its own work
+	 * spaces
+	 */
+
+#pragma omp parallel
+	{
+	double *sumsquares = XLALMalloc((length + 1) * sizeof(*sumsquares));
+	double *uwsumsquares = XLALMalloc((length + 1) * sizeof(*uwsumsquares));
+	if(!sumsquares || !uwsumsquares) {
+#pragma omp atomic write
+		errflag = 1;
+	}
+#pragma omp for schedule(dynamic)
+	for(r = 0; r < (int) n_rows; r++) {
+		if(errflag)
+			continue;
+		if(compute_excess_power_row(plane, filter_bank, &rows[r], sumsquares, uwsumsquares, confidence_threshold)) {
+#pragma omp atomic write
+			errflag = 1;
+		}
 	}
+	XLALFree(sumsquares);
+	XLALFree(uwsumsquares);
+	}
+
+	/*
+	 * merge the rows' event lists.  each row's list is in the order
+	 * the serial loop would have prepended the row's events to the
+	 * output list, so prepending the rows' lists in row order
+	 * reproduces the serial result independently of the number of
+	 * threads
+	 */
+
+	for(r = 0; r < (int) n_rows; r++) {
+		SnglBurst *tail = rows[r].head;
+		if(!tail)
+			continue;
+		while(tail->next)
+			tail = tail->next;
+		tail->next = head;
+		head = rows[r].head;
+	}
+	XLALFree(rows);
+
+	if(errflag) {
+		XLALDestroySnglBurstTable(head);
+		XLAL_ERROR_NULL(XLAL_EFUNC);
 	}
 
 	/* success */
-	gsl_vector_free(channel_buffer);
-	gsl_vector_free(unwhitened_channel_buffer);
 	return head;
 }
 
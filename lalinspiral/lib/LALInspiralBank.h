@@ -532,6 +532,23 @@ tagInspiralMomentsEtc
 }
 InspiralMomentsEtc;
 
+/**
+ * Cumulative moment of a noise power spectral density, from which the
+ * moment integral
+ * \f[ \int_{f_\textrm{low}}^{f_\textrm{high}} \frac{f^{-p}}{S_h(f)}\, df \f]
+ * between any pair of limits is found in constant time. It is created once
+ * per PSD by XLALCreateInspiralMomentTable().
+ */
+typedef struct
+tagInspiralMomentTable
+{
+  REAL8        ndx;	/**< index \f$p\f$ (without the negative sign) in the moment integral as above */
+  REAL8        f0;	/**< frequency of the first sample of the PSD */
+  REAL8        deltaF;	/**< frequency spacing of the PSD */
+  REAL8Vector *cumulative;	/**< moment integral from \c f0 to <tt>f0 + k * deltaF</tt>, for each sample \c k of the PSD */
+}
+InspiralMomentTable;
+
 /** UNDOCUMENTED */
 typedef struct
 tagInspiralMomentsEtcBCV
@@ -861,6 +878,45 @@ XLALInspiralMoments(
     REAL8FrequencySeries *shf
     );
 
+InspiralMomentTable *
+XLALCreateInspiralMomentTable(
+    REAL8 ndx,
+    const REAL8FrequencySeries *psd
+    );
+
+void
+XLALDestroyInspiralMomentTable(
+    InspiralMomentTable *table
+    );
+
+REAL8
+XLALInspiralMomentTableIntegral(
+    const InspiralMomentTable *table,
+    REAL8 fLower,
+    REAL8 fUpper
+    );
+
+REAL8
+XLALInspiralHorizonDistance(
+    const InspiralMomentTable *table,
+    REAL8 mass1,
+    REAL8 mass2,
+    REAL8 fLower,
+    REAL8 fUpper,
+    REAL8 snr
+    );
+
+int
+XLALInspiralHorizonDistances(
+    REAL8Vector *horizon,
+    const REAL8Vector *mass1,
+    const REAL8Vector *mass2,
+    const InspiralMomentTable *table,
+    REAL8 fLower,
+    REAL8 lastOrbit,
+    REAL8 snr
+    );
+
 void
 LALInspiralSetSearchLimits (
     LALStatus            *status,
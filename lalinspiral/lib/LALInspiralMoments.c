@@ -52,11 +52,30 @@
  * \mathtt{moment} = \int_{\mathtt{xmin}}^{\mathtt{xmax}}
  * \frac{x^{-\mathtt{ndx}}}{S_h(x)}\, dx \, .
  * \f}
+ *
+ * ### Moment tables ###
+ *
+ * When the same moment is needed for many pairs of limits, e.g. the horizon
+ * distance of every point of a mass grid, XLALCreateInspiralMomentTable()
+ * accumulates the integrand of a PSD once, with the same trapezoidal rule
+ * as XLALInspiralMoments(). XLALInspiralMomentTableIntegral() then returns
+ * the moment between any limits in constant time, interpolating linearly
+ * between the samples of the PSD. XLALInspiralHorizonDistance() and
+ * XLALInspiralHorizonDistances() use the \f$p=7/3\f$ table to give the
+ * distance at which an optimally oriented binary has a given
+ * stationary-phase SNR,
+ * \f{equation}{
+ * D = \frac{1}{\rho} \sqrt{\frac{5}{6}} \frac{c}{\pi^{2/3}}
+ * \left(\frac{G\mathcal{M}}{c^3}\right)^{5/6}
+ * \left[ \int_{f_\textrm{low}}^{f_\textrm{high}}
+ * \frac{f^{-7/3}}{S_h(f)}\, df \right]^{1/2} \,.
+ * \f}
  */
 
 /** @{ */
 
 #include <lal/LALInspiralBank.h>
+#include <lal/AVFactories.h>
 #include <lal/Integrate.h>
 
 /* Deprecation Warning */
@@ -355,4 +374,251 @@ XLALInspiralMoments(
 
   return moment;
 }
+
+/* moment integral up to frequency f, interpolating linearly between the
+ * samples of the table; f must lie within the table */
+static REAL8
+InspiralMomentTableCumulative(
+    const InspiralMomentTable *table,
+    REAL8 f
+    )
+{
+  const REAL8 *cumulative = table->cumulative->data;
+  const REAL8 x = (f - table->f0) / table->deltaF;
+  size_t k = floor(x);
+
+  if ( k >= table->cumulative->length - 1 )
+    return cumulative[table->cumulative->length - 1];
+  return cumulative[k] + (x - k) * (cumulative[k + 1] - cumulative[k]);
+}
+
+/* horizon distance for the given chirp mass in seconds, without checks */
+static REAL8
+InspiralHorizonDistance(
+    const InspiralMomentTable *table,
+    REAL8 mchirp,
+    REAL8 fLower,
+    REAL8 fUpper,
+    REAL8 snr
+    )
+{
+  const REAL8 fMax = table->f0 + (table->cumulative->length - 1) * table->deltaF;
+  REAL8 moment;
+
+  /* the integrand vanishes outside the PSD */
+  if ( fLower < table->f0 )
+    fLower = table->f0;
+  if ( fUpper > fMax )
+    fUpper = fMax;
+  if ( fUpper <= fLower )
+    return 0;
+
+  moment = InspiralMomentTableCumulative(table, fUpper)
+    - InspiralMomentTableCumulative(table, fLower);
+
+  return sqrt(5.0 / 6.0) * LAL_C_SI * pow(mchirp, 5.0 / 6.0)
+    * sqrt(moment) / (cbrt(LAL_PI * LAL_PI) * snr);
+}
+
+/** \see See \ref LALInspiralMoments_c for documentation */
+InspiralMomentTable *
+XLALCreateInspiralMomentTable(
+    REAL8 ndx,
+    const REAL8FrequencySeries *psd
+    )
+{
+  InspiralMomentTable *table;
+  REAL8 *cumulative;
+  REAL8 prev;
+  size_t k;
+
+  /* Check inputs */
+  if (!psd || !(psd->data) || !(psd->data->data)) {
+    XLALPrintError("PSD or its data are NULL\n");
+    XLAL_ERROR_NULL(XLAL_EFAULT);
+  }
+
+  if (psd->data->length < 2 || psd->deltaF <= 0 || psd->f0 < 0) {
+    XLALPrintError("PSD must have at least two samples at non-negative frequencies\n");
+    XLAL_ERROR_NULL(XLAL_EDOM);
+  }
+
+  table = XLALCalloc(1, sizeof(*table));
+  if (!table)
+    XLAL_ERROR_NULL(XLAL_ENOMEM);
+  table->cumulative = XLALCreateREAL8Vector(psd->data->length);
+  if (!table->cumulative) {
+    XLALFree(table);
+    XLAL_ERROR_NULL(XLAL_EFUNC);
+  }
+  table->ndx = ndx;
+  table->f0 = psd->f0;
+  table->deltaF = psd->deltaF;
+
+  /* accumulate the integrand with the trapezoidal rule; samples where the
+   * PSD is zero, and the DC sample, do not contribute */
+  cumulative = table->cumulative->data;
+  cumulative[0] = 0;
+  prev = 0;
+  for ( k = 0; k < psd->data->length; ++k ) {
+    const REAL8 psd_val = psd->data->data[k];
+    const REAL8 f = psd->f0 + k * psd->deltaF;
+    const REAL8 integrand = ( psd_val && f > 0 ) ? pow( f, -(ndx) ) / psd_val : 0;
+    if ( k > 0 )
+      cumulative[k] = cumulative[k - 1] + 0.5 * psd->deltaF * ( prev + integrand );
+    prev = integrand;
+  }
+
+  return table;
+}
+
+/** \see See \ref LALInspiralMoments_c for documentation */
+void
+XLALDestroyInspiralMomentTable(
+    InspiralMomentTable *table
+    )
+{
+  if (table) {
+    XLALDestroyREAL8Vector(table->cumulative);
+    XLALFree(table);
+  }
+}
+
+/** \see See \ref LALInspiralMoments_c for documentation */
+REAL8
+XLALInspiralMomentTableIntegral(
+    const InspiralMomentTable *table,
+    REAL8 fLower,
+    REAL8 fUpper
+    )
+{
+  REAL8 fMax;
+
+  /* Check inputs */
+  if (!table || !(table->cumulative)) {
+    XLALPrintError("Moment table is NULL\n");
+    XLAL_ERROR_REAL8(XLAL_EFAULT);
+  }
+
+  fMax = table->f0 + (table->cumulative->length - 1) * table->deltaF;
+  if (fLower < table->f0 || fUpper > fMax || fUpper <= fLower) {
+    XLALPrintError("fLower and fUpper must lie within the PSD and fUpper must be greater than fLower\n");
+    XLAL_ERROR_REAL8(XLAL_EDOM);
+  }
+
+  return InspiralMomentTableCumulative(table, fUpper)
+    - InspiralMomentTableCumulative(table, fLower);
+}
+
+/**
+ * Horizon distance, in metres, of a binary with masses \c mass1 and
+ * \c mass2 in solar masses. The moment is integrated over the part of
+ * <tt>[fLower, fUpper]</tt> covered by the PSD.
+ *
+ * \see See \ref LALInspiralMoments_c for documentation
+ */
+REAL8
+XLALInspiralHorizonDistance(
+    const InspiralMomentTable *table,
+    REAL8 mass1,
+    REAL8 mass2,
+    REAL8 fLower,
+    REAL8 fUpper,
+    REAL8 snr
+    )
+{
+  REAL8 totalMass, eta;
+
+  /* Check inputs */
+  if (!table || !(table->cumulative)) {
+    XLALPrintError("Moment table is NULL\n");
+    XLAL_ERROR_REAL8(XLAL_EFAULT);
+  }
+
+  if (fabs(table->ndx - 7.0 / 3.0) > LAL_REAL8_EPS) {
+    XLALPrintError("Horizon distance requires the moment table of index 7/3\n");
+    XLAL_ERROR_REAL8(XLAL_EINVAL);
+  }
+
+  if (mass1 <= 0 || mass2 <= 0 || snr <= 0) {
+    XLALPrintError("mass1, mass2 and snr must be positive\n");
+    XLAL_ERROR_REAL8(XLAL_EDOM);
+  }
+
+  totalMass = (mass1 + mass2) * LAL_MTSUN_SI;
+  eta = mass1 * mass2 / ((mass1 + mass2) * (mass1 + mass2));
+
+  return InspiralHorizonDistance(table,
+      pow(eta, 3.0 / 5.0) * totalMass, fLower, fUpper, snr);
+}
+
+/**
+ * Horizon distance of each binary of a list of masses, integrated from
+ * \c fLower up to the frequency of its last orbit at a radius of
+ * \c lastOrbit times its total mass, e.g. 6 for the Schwarzschild ISCO.
+ *
+ * \see See \ref LALInspiralMoments_c for documentation
+ */
+int
+XLALInspiralHorizonDistances(
+    REAL8Vector *horizon,
+    const REAL8Vector *mass1,
+    const REAL8Vector *mass2,
+    const InspiralMomentTable *table,
+    REAL8 fLower,
+    REAL8 lastOrbit,
+    REAL8 snr
+    )
+{
+  INT4 k;
+  int errflag = 0;
+
+  /* Check inputs */
+  if (!horizon || !mass1 || !mass2 || !table || !(table->cumulative)) {
+    XLALPrintError("Horizon, masses or moment table are NULL\n");
+    XLAL_ERROR(XLAL_EFAULT);
+  }
+
+  if (mass1->length != horizon->length || mass2->length != horizon->length) {
+    XLALPrintError("Horizon and masses must have the same length\n");
+    XLAL_ERROR(XLAL_EBADLEN);
+  }
+
+  if (fabs(table->ndx - 7.0 / 3.0) > LAL_REAL8_EPS) {
+    XLALPrintError("Horizon distance requires the moment table of index 7/3\n");
+    XLAL_ERROR(XLAL_EINVAL);
+  }
+
+  if (lastOrbit <= 0 || snr <= 0) {
+    XLALPrintError("lastOrbit and snr must be positive\n");
+    XLAL_ERROR(XLAL_EDOM);
+  }
+
+  /* each binary is independent */
+#pragma omp parallel for schedule(static)
+  for ( k = 0; k < (INT4) horizon->length; ++k ) {
+    const REAL8 m1 = mass1->data[k];
+    const REAL8 m2 = mass2->data[k];
+    const REAL8 totalMass = (m1 + m2) * LAL_MTSUN_SI;
+    REAL8 eta, fUpper;
+
+    if (m1 <= 0 || m2 <= 0) {
+#pragma omp atomic write
+      errflag = 1;
+      continue;
+    }
+
+    eta = m1 * m2 / ((m1 + m2) * (m1 + m2));
+    fUpper = 1.0 / (pow(lastOrbit, 1.5) * LAL_PI * totalMass);
+    horizon->data[k] = InspiralHorizonDistance(table,
+        pow(eta, 3.0 / 5.0) * totalMass, fLower, fUpper, snr);
+  }
+
+  if (errflag) {
+    XLALPrintError("Masses must be positive\n");
+    XLAL_ERROR(XLAL_EDOM);
+  }
+
+  return XLAL_SUCCESS;
+}
 /** @} */
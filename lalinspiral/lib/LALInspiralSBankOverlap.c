@@ -21,6 +21,7 @@
 #include <math.h>
 #include <complex.h>
 #include <lal/LALError.h>
+#include <lal/LALMalloc.h>
 #include <lal/AVFactories.h>
 #include <lal/ComplexFFT.h>
 #include <lal/XLALError.h>
@@ -28,7 +29,10 @@
 #include <lal/LALInspiralSBankOverlap.h>
 #include <sys/types.h>
 
-#define MAX_NUM_WS 32  /* maximum number of workspaces */
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #define CHECK_OOM(ptr, msg) if (!(ptr)) { XLALPrintError((msg)); XLAL_ERROR_NULL(XLAL_ENOMEM); }
 
 /*
@@ -36,21 +40,22 @@
  */
 
 WS *XLALCreateSBankWorkspaceCache(void) {
-    WS *workspace_cache = calloc(MAX_NUM_WS, sizeof(WS));
+    WS *workspace_cache = calloc(1, sizeof(WS));
     CHECK_OOM(workspace_cache, "unable to allocate workspace\n");
     return workspace_cache;
 }
 
 void XLALDestroySBankWorkspaceCache(WS *workspace_cache) {
-    size_t k = MAX_NUM_WS;
-    for (;k--;) {
-        if (workspace_cache[k].n) {
-            XLALDestroyCOMPLEX8FFTPlan(workspace_cache[k].plan);
-            XLALDestroyCOMPLEX8Vector(workspace_cache[k].zf);
-            XLALDestroyCOMPLEX8Vector(workspace_cache[k].zt);
+    while (workspace_cache) {
+        WS *next = workspace_cache->next;
+        if (workspace_cache->n) {
+            XLALDestroyCOMPLEX8FFTPlan(workspace_cache->plan);
+            XLALDestroyCOMPLEX8Vector(workspace_cache->zf);
+            XLALDestroyCOMPLEX8Vector(workspace_cache->zt);
         }
+        free(workspace_cache);
+        workspace_cache = next;
     }
-    free(workspace_cache);
 }
 
 static WS *get_workspace(WS *workspace_cache, const size_t n) {
@@ -63,16 +68,20 @@ static WS *get_workspace(WS *workspace_cache, const size_t n) {
     WS *ptr = workspace_cache;
     while (ptr->n) {
         if (ptr->n == n) return ptr;
-        if (++ptr - workspace_cache > MAX_NUM_WS) return NULL;  /* out of space! */
+        if (!ptr->next) {
+            ptr->next = calloc(1, sizeof(WS));
+            CHECK_OOM(ptr->next, "unable to allocate workspace\n");
+        }
+        ptr = ptr->next;
     }
 
     /* if n not in cache, ptr now points at first blank entry */
     ptr->zf = XLALCreateCOMPLEX8Vector(n);
-    CHECK_OOM(ptr->zf->data, "unable to allocate workspace array zf\n");
+    CHECK_OOM(ptr->zf, "unable to allocate workspace array zf\n");
     memset(ptr->zf->data, 0, n * sizeof(COMPLEX8));
 
     ptr->zt = XLALCreateCOMPLEX8Vector(n);
-    CHECK_OOM(ptr->zf->data, "unable to allocate workspace array zt\n");
+    CHECK_OOM(ptr->zt, "unable to allocate workspace array zt\n");
     memset(ptr->zt->data, 0, n * sizeof(COMPLEX8));
 
     ptr->n = n;
@@ -106,10 +115,11 @@ static double abs2(const COMPLEX8 x) {
     return re * re + im * im;
 }
 
-/* interpolate the peak with a parabolic interpolation */
+/* interpolate the peak with a parabolic interpolation; if the peak is flat, e.g. when only two samples are available, there is nothing to interpolate */
 static double vector_peak_interp(const double ym1, const double y, const double yp1) {
     const double dy = 0.5 * (yp1 - ym1);
     const double d2y = 2. * y - ym1 - yp1;
+    if (d2y <= 0.) return y;
     return y + 0.5 * dy * dy / d2y;
 }
 
@@ -124,7 +134,7 @@ REAL8 XLALInspiralSBankComputeMatch(const COMPLEX8FrequencySeries *inj, const CO
     size_t n = 2 * (min_len - 1);   /* no need to integrate implicit zeros */
     WS *ws = get_workspace(workspace_cache, n);
     if (!ws) {
-        XLALPrintError("out of space in the workspace_cache\n");
+        XLALPrintError("unable to allocate workspace\n");
         XLAL_ERROR_REAL8(XLAL_ENOMEM);
     }
 
@@ -161,6 +171,206 @@ REAL8 XLALInspiralSBankComputeMatch(const COMPLEX8FrequencySeries *inj, const CO
 }
 
 
+/*
+ * Returns a coarse approximation to XLALInspiralSBankComputeMatch(), for
+ * cheaply screening proposals. Only the band of frequencies in which both
+ * inputs are non-zero is used, shifted down to zero frequency, which leaves
+ * |z(t)| unchanged. This allows an inverse FFT of the shortest power-of-two
+ * length that samples the band at least twice, instead of the full length.
+ * The maximum of the coarsely sampled |z(t)|^2 is refined with a parabolic
+ * interpolation.
+ */
+REAL8 XLALInspiralSBankComputeMatchCoarse(const COMPLEX8FrequencySeries *inj, const COMPLEX8FrequencySeries *tmplt, WS *workspace_cache) {
+    size_t min_len = (inj->data->length <= tmplt->data->length) ? inj->data->length : tmplt->data->length;
+
+    /* find the band in which both inputs are non-zero */
+    size_t kmin = 0, kmax = min_len;
+    while (kmin < kmax && (abs2(inj->data->data[kmin]) == 0. || abs2(tmplt->data->data[kmin]) == 0.))
+        ++kmin;
+    while (kmax > kmin && (abs2(inj->data->data[kmax - 1]) == 0. || abs2(tmplt->data->data[kmax - 1]) == 0.))
+        --kmax;
+    if (kmax == kmin) return 0.;
+    const size_t band = kmax - kmin;
+
+    /* get workspace, no longer than for the full match */
+    size_t n = 2 * (min_len - 1);
+    size_t nc = 2;
+    while (nc < 2 * band) nc <<= 1;
+    if (nc < n) n = nc;
+    WS *ws = get_workspace(workspace_cache, n);
+    if (!ws) {
+        XLALPrintError("unable to allocate workspace\n");
+        XLAL_ERROR_REAL8(XLAL_ENOMEM);
+    }
+
+    /* compute complex SNR time-series of the shifted band */
+    multiply_conjugate(ws->zf->data, inj->data->data + kmin, tmplt->data->data + kmin, band);
+    memset(ws->zf->data + band, 0, (n - band) * sizeof(COMPLEX8));
+    XLALCOMPLEX8VectorFFT(ws->zt, ws->zf, ws->plan); /* plan is reverse */
+
+    /* maximize over |z(t)|^2 */
+    COMPLEX8 *zdata = ws->zt->data;
+    size_t k = n;
+    ssize_t argmax = -1;
+    REAL8 max = 0.;
+    for (;k--;) {
+        REAL8 temp = abs2(zdata[k]);
+        if (temp > max) {
+            argmax = k;
+            max = temp;
+        }
+    }
+    if (max == 0.) return 0.;
+
+    /* refine estimate of maximum; z(t) is periodic */
+    const size_t km1 = (argmax == 0) ? n - 1 : (size_t) argmax - 1;
+    const size_t kp1 = ((size_t) argmax == n - 1) ? 0 : (size_t) argmax + 1;
+    REAL8 result = vector_peak_interp(abs2(zdata[km1]), max, abs2(zdata[kp1]));
+
+    return 4. * inj->deltaF * sqrt(result);
+}
+
+
+/*
+ * Computes the matches of many pairs of whitened, normalized,
+ * positive-frequency COMPLEX8FrequencySeries, e.g. of a proposal with each
+ * of its neighbours in the bank, using XLALInspiralSBankComputeMatch() or,
+ * if coarse is non-zero, XLALInspiralSBankComputeMatchCoarse(). The pairs
+ * are shared between num_caches threads, each of which uses its own one of
+ * the workspace caches.
+ */
+int XLALInspiralSBankComputeMatchBatch(REAL8 *matches, const COMPLEX8FrequencySeries **injs, const COMPLEX8FrequencySeries **tmplts, const size_t num_pairs, const int coarse, WS **workspace_caches, const size_t num_caches) {
+    XLAL_CHECK(matches != NULL && injs != NULL && tmplts != NULL && workspace_caches != NULL, XLAL_EFAULT);
+    XLAL_CHECK(num_caches > 0, XLAL_EINVAL);
+
+    int errflag = 0;
+#pragma omp parallel for schedule(dynamic) num_threads(num_caches)
+    for (size_t k = 0; k < num_pairs; ++k) {
+        size_t thread = 0;
+#ifdef _OPENMP
+        thread = omp_get_thread_num();
+#endif
+        if (errflag) continue;
+        if (coarse)
+            matches[k] = XLALInspiralSBankComputeMatchCoarse(injs[k], tmplts[k], workspace_caches[thread]);
+        else
+            matches[k] = XLALInspiralSBankComputeMatch(injs[k], tmplts[k], workspace_caches[thread]);
+        if (XLAL_IS_REAL8_FAIL_NAN(matches[k])) {
+#pragma omp atomic write
+            errflag = 1;
+        }
+    }
+    XLAL_CHECK(!errflag, XLAL_EFUNC);
+
+    return XLAL_SUCCESS;
+}
+
+
+/*
+ * A batch of pairs of waveforms whose matches are computed together by
+ * XLALSBankMatchBatchCompute(). This wraps XLALInspiralSBankComputeMatchBatch()
+ * in an interface which can be used from SWIG, where arrays of pointers to
+ * waveforms and workspace caches cannot be passed directly.
+ */
+struct tagSBankMatchBatch {
+    size_t num_pairs;
+    size_t max_pairs;
+    const COMPLEX8FrequencySeries **injs;
+    const COMPLEX8FrequencySeries **tmplts;
+    size_t num_caches;
+    WS **workspace_caches;
+};
+
+/*
+ * Creates an empty batch, whose matches are computed by num_threads threads,
+ * or by the default number of OpenMP threads if num_threads is zero.
+ */
+SBankMatchBatch *XLALCreateSBankMatchBatch(const UINT4 num_threads) {
+    SBankMatchBatch *batch = XLALCalloc(1, sizeof(*batch));
+    XLAL_CHECK_NULL(batch != NULL, XLAL_ENOMEM);
+    batch->num_caches = num_threads;
+    if (batch->num_caches == 0) {
+        batch->num_caches = 1;
+#ifdef _OPENMP
+        batch->num_caches = omp_get_max_threads();
+#endif
+    }
+    batch->workspace_caches = XLALCalloc(batch->num_caches, sizeof(*batch->workspace_caches));
+    if (batch->workspace_caches == NULL) {
+        XLALDestroySBankMatchBatch(batch);
+        XLAL_ERROR_NULL(XLAL_ENOMEM);
+    }
+    for (size_t i = 0; i < batch->num_caches; ++i) {
+        batch->workspace_caches[i] = XLALCreateSBankWorkspaceCache();
+        if (batch->workspace_caches[i] == NULL) {
+            XLALDestroySBankMatchBatch(batch);
+            XLAL_ERROR_NULL(XLAL_EFUNC);
+        }
+    }
+    return batch;
+}
+
+void XLALDestroySBankMatchBatch(SBankMatchBatch *batch) {
+    if (batch) {
+        if (batch->workspace_caches) {
+            for (size_t i = 0; i < batch->num_caches; ++i)
+                XLALDestroySBankWorkspaceCache(batch->workspace_caches[i]);
+            XLALFree(batch->workspace_caches);
+        }
+        XLALFree(batch->injs);
+        XLALFree(batch->tmplts);
+        XLALFree(batch);
+    }
+}
+
+/*
+ * Adds a pair of whitened, normalized, positive-frequency
+ * COMPLEX8FrequencySeries to a batch. The waveforms are not copied, and must
+ * not be destroyed until the matches have been computed.
+ */
+int XLALSBankMatchBatchAdd(SBankMatchBatch *batch, const COMPLEX8FrequencySeries *inj, const COMPLEX8FrequencySeries *tmplt) {
+    XLAL_CHECK(batch != NULL && inj != NULL && tmplt != NULL, XLAL_EFAULT);
+    if (batch->num_pairs == batch->max_pairs) {
+        const size_t max_pairs = (batch->max_pairs > 0) ? 2 * batch->max_pairs : 64;
+        const COMPLEX8FrequencySeries **injs = XLALRealloc(batch->injs, max_pairs * sizeof(*injs));
+        XLAL_CHECK(injs != NULL, XLAL_ENOMEM);
+        batch->injs = injs;
+        const COMPLEX8FrequencySeries **tmplts = XLALRealloc(batch->tmplts, max_pairs * sizeof(*tmplts));
+        XLAL_CHECK(tmplts != NULL, XLAL_ENOMEM);
+        batch->tmplts = tmplts;
+        batch->max_pairs = max_pairs;
+    }
+    batch->injs[batch->num_pairs] = inj;
+    batch->tmplts[batch->num_pairs] = tmplt;
+    ++batch->num_pairs;
+    return XLAL_SUCCESS;
+}
+
+/*
+ * Removes all pairs from a batch, keeping its workspace caches for reuse.
+ */
+int XLALSBankMatchBatchClear(SBankMatchBatch *batch) {
+    XLAL_CHECK(batch != NULL, XLAL_EFAULT);
+    batch->num_pairs = 0;
+    return XLAL_SUCCESS;
+}
+
+/*
+ * Returns the matches of all pairs in a batch, in the order they were added,
+ * computed as by XLALInspiralSBankComputeMatchBatch().
+ */
+REAL8Vector *XLALSBankMatchBatchCompute(SBankMatchBatch *batch, const int coarse) {
+    XLAL_CHECK_NULL(batch != NULL, XLAL_EFAULT);
+    REAL8Vector *matches = XLALCreateREAL8Vector(batch->num_pairs);
+    XLAL_CHECK_NULL(matches != NULL, XLAL_EFUNC);
+    if (batch->num_pairs > 0 && XLALInspiralSBankComputeMatchBatch(matches->data, batch->injs, batch->tmplts, batch->num_pairs, coarse, batch->workspace_caches, batch->num_caches) != XLAL_SUCCESS) {
+        XLALDestroyREAL8Vector(matches);
+        XLAL_ERROR_NULL(XLAL_EFUNC);
+    }
+    return matches;
+}
+
+
 /*
   Compute the overlap between a normalized template waveform h and a
   normalized signal proposal maximizing over the template h's overall
@@ -173,7 +383,7 @@ REAL8 XLALInspiralSBankComputeRealMatch(const COMPLEX8FrequencySeries *inj, cons
     size_t n = 2 * (min_len - 1);   /* no need to integrate implicit zeros */
     WS *ws = get_workspace(workspace_cache, n);
     if (!ws) {
-        XLALPrintError("out of space in the workspace_cache\n");
+        XLALPrintError("unable to allocate workspace\n");
 	XLAL_ERROR_REAL8(XLAL_ENOMEM);
     }
 
@@ -215,12 +425,12 @@ REAL8 XLALInspiralSBankComputeMatchMaxSkyLoc(const COMPLEX8FrequencySeries *hp,
     size_t n = 2 * (min_len - 1);   /* no need to integrate implicit zeros */
     WS *ws1 = get_workspace(workspace_cache1, n);
     if (!ws1) {
-        XLALPrintError("out of space in the workspace_cache\n");
+        XLALPrintError("unable to allocate workspace\n");
         XLAL_ERROR_REAL8(XLAL_ENOMEM);
     }
     WS *ws2 = get_workspace(workspace_cache2, n);
     if (!ws2) {
-        XLALPrintError("out of space in the workspace_cache\n");
+        XLALPrintError("unable to allocate workspace\n");
         XLAL_ERROR_REAL8(XLAL_ENOMEM);
     }
 
@@ -292,12 +502,12 @@ REAL8 XLALInspiralSBankComputeMatchMaxSkyLocNoPhase(const COMPLEX8FrequencySerie
     size_t n = 2 * (min_len - 1);   /* no need to integrate implicit zeros */
     WS *ws1 = get_workspace(workspace_cache1, n);
     if (!ws1) {
-        XLALPrintError("out of space in the workspace_cache\n");
+        XLALPrintError("unable to allocate workspace\n");
         XLAL_ERROR_REAL8(XLAL_ENOMEM);
     }
     WS *ws2 = get_workspace(workspace_cache2, n);
     if (!ws2) {
-        XLALPrintError("out of space in the workspace_cache\n");
+        XLALPrintError("unable to allocate workspace\n");
         XLAL_ERROR_REAL8(XLAL_ENOMEM);
     }
 
@@ -9,12 +9,27 @@ typedef struct tagWS {
     COMPLEX8FFTPlan *plan;
     COMPLEX8Vector *zf;
     COMPLEX8Vector *zt;
+    struct tagWS *next;
 } WS;
 
 WS *XLALCreateSBankWorkspaceCache(void);
 void XLALDestroySBankWorkspaceCache(WS *workspace_cache);
 REAL8 XLALInspiralSBankComputeMatch(const COMPLEX8FrequencySeries *inj, const COMPLEX8FrequencySeries *tmplt, WS *workspace_cache);
 
+REAL8 XLALInspiralSBankComputeMatchCoarse(const COMPLEX8FrequencySeries *inj, const COMPLEX8FrequencySeries *tmplt, WS *workspace_cache);
+
+#ifndef SWIG /* exclude from SWIG interface; use SBankMatchBatch instead */
+int XLALInspiralSBankComputeMatchBatch(REAL8 *matches, const COMPLEX8FrequencySeries **injs, const COMPLEX8FrequencySeries **tmplts, const size_t num_pairs, const int coarse, WS **workspace_caches, const size_t num_caches);
+#endif
+
+typedef struct tagSBankMatchBatch SBankMatchBatch;
+
+SBankMatchBatch *XLALCreateSBankMatchBatch(const UINT4 num_threads);
+void XLALDestroySBankMatchBatch(SBankMatchBatch *batch);
+int XLALSBankMatchBatchAdd(SBankMatchBatch *batch, const COMPLEX8FrequencySeries *inj, const COMPLEX8FrequencySeries *tmplt);
+int XLALSBankMatchBatchClear(SBankMatchBatch *batch);
+REAL8Vector *XLALSBankMatchBatchCompute(SBankMatchBatch *batch, const int coarse);
+
 REAL8 XLALInspiralSBankComputeRealMatch(const COMPLEX8FrequencySeries *inj, const COMPLEX8FrequencySeries *tmplt, WS *workspace_cache);
 
 REAL8 XLALInspiralSBankComputeMatchMaxSkyLoc(const COMPLEX8FrequencySeries *hp, const COMPLEX8FrequencySeries *hc, const REAL8 hphccorr, const COMPLEX8FrequencySeries *proposal, WS *workspace_cache1, WS *workspace_cache2);
@@ -44,12 +44,18 @@
  * to append stragglers (i.e. clusters of only 1 trigger). Upon success, the
  * return value will be #XLAL_SUCCESS, with the \c SnglInspiralTable having
  * been clustered. At present, the only clustering method implemented is #T0T3Tc.
+ * The triggers are placed in a \c TriggerErrorIndex, and all pairs with
+ * overlapping ellipsoids are found in parallel with
+ * <tt>XLALFindTriggerErrorIndexOverlaps()</tt>. The clusters are the connected
+ * components of this overlap graph, with the triggers of each cluster kept in
+ * time order.
  *
  * <tt>XLALTrigScanCreateCluster()</tt> takes in a \c TriggerErrorList
  * containing the triggers, their position vectors and ellipsoid matrices. It
  * creates the cluster by agglomerating triggers by checking for overlap of
  * ellipsoids. Upon ellipsoid overlap, the trigger is added to the cluster, and
- * removed from the unclustered list.
+ * removed from the unclustered list. It gives the same clusters as
+ * <tt>XLALTrigScanClusterTriggers()</tt>, but compares the triggers serially.
  *
  * <tt>XLALTrigScanRemoveStragglers()</tt> takes in a linked list of
  * \c TrigScanCluster's. It removes all clusters of 1 element from the list.
@@ -71,6 +77,18 @@
  *
  */
 
+/* Find the root of a trigger in the union-find forest, halving the path */
+static UINT4 TrigScanFindRoot( UINT4 *parent, UINT4 i )
+{
+  while ( parent[i] != i )
+  {
+    parent[i] = parent[parent[i]];
+    i = parent[i];
+  }
+  return i;
+}
+
+
 int XLALTrigScanClusterTriggers( SnglInspiralTable **table,
                                  trigScanType      method,
                                  REAL8             scaleFactor,
@@ -83,8 +101,16 @@ int XLALTrigScanClusterTriggers( SnglInspiralTable **table,
   TrigScanCluster   *clusterHead   = NULL;
   TrigScanCluster   *thisCluster   = NULL;
 
-  /* The maximum time difference associated with an ellipsoid */
-  REAL8 tcMax;
+  /* Index and overlapping pairs of the triggers */
+  TriggerErrorIndex *triggerIndex  = NULL;
+  UINT4             *pairs         = NULL;
+  UINT4             numPairs       = 0;
+
+  /* Union-find forest over the index, and the cluster of each root */
+  UINT4             *parent        = NULL;
+  TrigScanCluster   **clusters     = NULL;
+  TriggerErrorList  **lastElement  = NULL;
+  UINT4             i, k;
 
   if ( !table )
   {
@@ -136,50 +162,120 @@ int XLALTrigScanClusterTriggers( SnglInspiralTable **table,
   }
 
   /* Firstly, create the matrices, etc required for the clustering */
-  errorList = XLALCreateTriggerErrorList( tableHead, scaleFactor, &tcMax );
+  errorList = XLALCreateTriggerErrorList( tableHead, scaleFactor, NULL );
   if ( !errorList )
   {
     XLAL_ERROR( XLAL_EFUNC );
   }
 
-  /* Now create the list of clusters. Keep going until errorlist is exhausted */
-  while ( errorList )
+  /* Index the triggers, and find all pairs with overlapping ellipsoids */
+  triggerIndex = XLALCreateTriggerErrorIndex( errorList );
+  if ( !triggerIndex )
   {
-    TrigScanCluster *newCluster = NULL;
+    XLALDestroyTriggerErrorList( errorList );
+    XLAL_ERROR( XLAL_EFUNC );
+  }
 
-    newCluster = XLALTrigScanCreateCluster( &errorList, tcMax );
-    /* The next line is to keep track of memory in case of failure */
-    if ( errorList )
-      *table = errorList->trigger;
-    else
-      *table = NULL;
+  if ( XLALFindTriggerErrorIndexOverlaps( &pairs, &numPairs, triggerIndex, NULL, 0 )
+         == XLAL_FAILURE )
+  {
+    XLALDestroyTriggerErrorIndex( triggerIndex );
+    XLALDestroyTriggerErrorList( errorList );
+    XLAL_ERROR( XLAL_EFUNC );
+  }
 
-    if ( !newCluster )
-    {
+  parent      = LALCalloc( triggerIndex->length, sizeof( UINT4 ) );
+  clusters    = LALCalloc( triggerIndex->length, sizeof( TrigScanCluster * ) );
+  lastElement = LALCalloc( triggerIndex->length, sizeof( TriggerErrorList * ) );
+  if ( !parent || !clusters || !lastElement )
+  {
+    if ( parent ) LALFree( parent );
+    if ( clusters ) LALFree( clusters );
+    if ( lastElement ) LALFree( lastElement );
+    if ( pairs ) LALFree( pairs );
+    XLALDestroyTriggerErrorIndex( triggerIndex );
+    XLALDestroyTriggerErrorList( errorList );
+    XLAL_ERROR( XLAL_ENOMEM );
+  }
 
-      thisCluster = clusterHead;
+  /* The clusters are the connected components of the overlap graph. */
+  /* Each component is labelled by its earliest trigger */
+  for ( i = 0; i < triggerIndex->length; i++ )
+  {
+    parent[i] = i;
+  }
+  for ( k = 0; k < numPairs; k++ )
+  {
+    UINT4 rootA = TrigScanFindRoot( parent, pairs[2*k] );
+    UINT4 rootB = TrigScanFindRoot( parent, pairs[2*k+1] );
 
-      while ( thisCluster )
+    if ( rootA < rootB )
+      parent[rootB] = rootA;
+    else if ( rootB < rootA )
+      parent[rootA] = rootB;
+  }
+  if ( pairs ) LALFree( pairs );
+
+  /* Allocate the clusters before touching the triggers, so that the */
+  /* table is still intact if this fails */
+  for ( i = 0; i < triggerIndex->length; i++ )
+  {
+    if ( TrigScanFindRoot( parent, i ) == i )
+    {
+      clusters[i] = LALCalloc( 1, sizeof( TrigScanCluster ) );
+      if ( !clusters[i] )
       {
-         TrigScanCluster *tmpCluster = thisCluster;
-         thisCluster = thisCluster->next;
-         XLALTrigScanDestroyCluster( tmpCluster, TRIGSCAN_ERROR );
+        for ( k = 0; k < i; k++ )
+          if ( clusters[k] ) LALFree( clusters[k] );
+        LALFree( parent );
+        LALFree( clusters );
+        LALFree( lastElement );
+        XLALDestroyTriggerErrorIndex( triggerIndex );
+        XLALDestroyTriggerErrorList( errorList );
+        XLAL_ERROR( XLAL_ENOMEM );
       }
-      if ( errorList ) XLALDestroyTriggerErrorList( errorList );
-
-      XLAL_ERROR( XLAL_EFUNC );
     }
-    /* Add the cluster to the list */
-    if ( !clusterHead )
+  }
+
+  /* Now move the triggers into their clusters, in time order */
+  for ( i = 0; i < triggerIndex->length; i++ )
+  {
+    TriggerErrorList *thisElement = triggerIndex->element[i];
+    UINT4            root         = TrigScanFindRoot( parent, i );
+    TrigScanCluster  *cluster     = clusters[root];
+
+    thisElement->next          = NULL;
+    thisElement->trigger->next = NULL;
+
+    if ( !cluster->element )
     {
-      clusterHead = thisCluster = newCluster;
+      cluster->element = thisElement;
+      if ( !clusterHead )
+      {
+        clusterHead = thisCluster = cluster;
+      }
+      else
+      {
+        thisCluster = thisCluster->next = cluster;
+      }
     }
     else
     {
-      thisCluster = thisCluster->next = newCluster;
+      lastElement[root]->next          = thisElement;
+      lastElement[root]->trigger->next = thisElement->trigger;
     }
+    lastElement[root] = thisElement;
+    cluster->nelements++;
   }
 
+  /* The triggers now belong to the clusters */
+  *table = NULL;
+
+  LALFree( parent );
+  LALFree( clusters );
+  LALFree( lastElement );
+  XLALDestroyTriggerErrorIndex( triggerIndex );
+
   /* Remove stragglers if necessary */
   if ( !appendStragglers )
   {
@@ -438,6 +534,7 @@ int XLALTrigScanRemoveStragglers( TrigScanCluster **clusters )
   }
 
   /* Loop through the list and remove all clusters containing 1 trigger */
+  thisCluster = *clusters;
   while ( thisCluster )
   {
     if ( thisCluster->nelements == 1 )
@@ -457,6 +554,7 @@ int XLALTrigScanRemoveStragglers( TrigScanCluster **clusters )
       XLALDestroySnglInspiralTableRow( tmpCluster->element->trigger );
       XLAL_CALLGSL( gsl_matrix_free( tmpCluster->element->err_matrix ) );
       XLAL_CALLGSL( gsl_vector_free( tmpCluster->element->position ) );
+      LALFree( tmpCluster->element );
       LALFree( tmpCluster );
     }
     else
@@ -27,9 +27,24 @@
  */
 
 #include <math.h>
+#include <stdlib.h>
+#include <string.h>
 #include <lal/CoincInspiralEllipsoid.h>
+#include <lal/Date.h>
+#include <lal/EllipsoidOverlapTools.h>
 #include <lal/TrigScanEThincaCommon.h>
 
+#include <gsl/gsl_errno.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/* Factor by which the bounding boxes of the ellipsoids are enlarged, so */
+/* that the box test never rejects a pair which XLALCheckOverlapOfEllipsoids() */
+/* would accept within its convergence tolerance */
+#define TRIGGER_INDEX_BOX_SAFETY 1.1
+
 /**
  * \author Robinson, C. A. K.
  * \file
@@ -49,6 +64,28 @@
  * \c SnglInspiralTable's, which will normally still be required after
  * TrigScan and E-thinca have completed.
  *
+ * The function <tt>XLALCreateTriggerErrorIndex()</tt> creates a
+ * \c TriggerErrorIndex over the elements of a \c TriggerErrorList. The
+ * elements are sorted by end time, and the bounding box of each error
+ * ellipsoid is taken from the diagonal of its shape matrix. The list itself
+ * is not modified, and must outlive the index.
+ *
+ * The function <tt>XLALDestroyTriggerErrorIndex()</tt> frees the index, but
+ * not the \c TriggerErrorList it was created from.
+ *
+ * The function <tt>XLALFindTriggerErrorIndexOverlaps()</tt> finds all pairs
+ * of triggers whose error ellipsoids overlap. If \c indexB is \c NULL, the
+ * pairs \f$(i, j)\f$ with \f$i < j\f$ within \c indexA are found, as
+ * needed for TrigScan clustering; otherwise the pairs between \c indexA and
+ * \c indexB are found, as needed for coincidence, with the end times of
+ * \c indexB shifted by \c slideB nanoseconds so that the same indexes can
+ * be reused over many time slides. Each trigger is only compared with
+ * triggers within the time window of the two largest ellipsoids, and the
+ * overlap of the ellipsoids is only checked if their bounding boxes
+ * intersect. The triggers of \c indexA are processed in parallel. On
+ * success, \c pairs holds \c numPairs pairs of positions in the indexes,
+ * sorted in increasing order, and should be freed with <tt>LALFree()</tt>.
+ *
  */
 
 TriggerErrorList * XLALCreateTriggerErrorList( SnglInspiralTable *tableHead,
@@ -141,6 +178,329 @@ void XLALDestroyTriggerErrorList( TriggerErrorList *errorListHead )
 }
 
 
+/* Element of a TriggerErrorList with its end time, for sorting */
+typedef struct
+{
+  INT8             endTime;
+  UINT4            position;
+  TriggerErrorList *element;
+}
+TriggerIndexEntry;
+
+/* Order entries by end time, keeping the list order for equal times */
+static int CompareTriggerIndexEntries( const void *a, const void *b )
+{
+  const TriggerIndexEntry *entryA = (const TriggerIndexEntry *) a;
+  const TriggerIndexEntry *entryB = (const TriggerIndexEntry *) b;
+
+  if ( entryA->endTime != entryB->endTime )
+    return ( entryA->endTime < entryB->endTime ) ? -1 : 1;
+  if ( entryA->position != entryB->position )
+    return ( entryA->position < entryB->position ) ? -1 : 1;
+  return 0;
+}
+
+
+TriggerErrorIndex * XLALCreateTriggerErrorIndex( TriggerErrorList *errorListHead )
+
+{
+  TriggerErrorIndex *triggerIndex = NULL;
+  TriggerErrorList  *thisErrorList = NULL;
+  TriggerIndexEntry *entries = NULL;
+  UINT4             i, k;
+
+  if ( !errorListHead )
+    XLAL_ERROR_NULL( XLAL_EFAULT );
+
+  triggerIndex = (TriggerErrorIndex *) LALCalloc( 1, sizeof(TriggerErrorIndex) );
+  if ( !triggerIndex )
+    XLAL_ERROR_NULL( XLAL_ENOMEM );
+
+  for ( thisErrorList = errorListHead; thisErrorList;
+      thisErrorList = thisErrorList->next )
+  {
+    triggerIndex->length++;
+  }
+
+  triggerIndex->element   = (TriggerErrorList **) LALCalloc( triggerIndex->length, sizeof(TriggerErrorList *) );
+  triggerIndex->endTime   = (INT8 *) LALCalloc( triggerIndex->length, sizeof(INT8) );
+  triggerIndex->center    = (REAL8 *) LALCalloc( 2 * triggerIndex->length, sizeof(REAL8) );
+  triggerIndex->halfWidth = (REAL8 *) LALCalloc( 3 * triggerIndex->length, sizeof(REAL8) );
+  entries          = (TriggerIndexEntry *) LALCalloc( triggerIndex->length, sizeof(TriggerIndexEntry) );
+  if ( !triggerIndex->element || !triggerIndex->endTime || !triggerIndex->center
+      || !triggerIndex->halfWidth || !entries )
+  {
+    if ( entries ) LALFree( entries );
+    XLALDestroyTriggerErrorIndex( triggerIndex );
+    XLAL_ERROR_NULL( XLAL_ENOMEM );
+  }
+
+  /* Sort the elements by end time */
+  for ( i = 0, thisErrorList = errorListHead; thisErrorList;
+      i++, thisErrorList = thisErrorList->next )
+  {
+    entries[i].endTime  = XLALGPSToINT8NS( &(thisErrorList->trigger->end) );
+    entries[i].position = i;
+    entries[i].element  = thisErrorList;
+  }
+  qsort( entries, triggerIndex->length, sizeof(TriggerIndexEntry), CompareTriggerIndexEntries );
+  for ( i = 0; i < triggerIndex->length; i++ )
+  {
+    triggerIndex->element[i] = entries[i].element;
+    triggerIndex->endTime[i] = entries[i].endTime;
+  }
+  LALFree( entries );
+
+  /* The bounding box of the ellipsoid x^T E^-1 x <= 1 has half-widths */
+  /* sqrt(E_kk), where E is the error matrix */
+  for ( i = 0; i < triggerIndex->length; i++ )
+  {
+    thisErrorList = triggerIndex->element[i];
+    for ( k = 0; k < 3; k++ )
+    {
+      REAL8 diag = gsl_matrix_get( thisErrorList->err_matrix, k, k );
+      if ( !( diag > 0.0 ) || !isfinite( diag ) )
+      {
+        XLALPrintError( "Invalid error matrix for trigger at %" LAL_INT8_FORMAT " ns\n",
+            triggerIndex->endTime[i] );
+        XLALDestroyTriggerErrorIndex( triggerIndex );
+        XLAL_ERROR_NULL( XLAL_EINVAL );
+      }
+      triggerIndex->halfWidth[3*i+k] = TRIGGER_INDEX_BOX_SAFETY * sqrt( diag );
+    }
+    triggerIndex->center[2*i]   = gsl_vector_get( thisErrorList->position, 1 );
+    triggerIndex->center[2*i+1] = gsl_vector_get( thisErrorList->position, 2 );
+    if ( triggerIndex->halfWidth[3*i] > triggerIndex->maxTimeWidth )
+      triggerIndex->maxTimeWidth = triggerIndex->halfWidth[3*i];
+  }
+
+  return triggerIndex;
+}
+
+
+void XLALDestroyTriggerErrorIndex( TriggerErrorIndex *triggerIndex )
+
+{
+  if ( !triggerIndex )
+    return;
+
+  if ( triggerIndex->element ) LALFree( triggerIndex->element );
+  if ( triggerIndex->endTime ) LALFree( triggerIndex->endTime );
+  if ( triggerIndex->center ) LALFree( triggerIndex->center );
+  if ( triggerIndex->halfWidth ) LALFree( triggerIndex->halfWidth );
+  LALFree( triggerIndex );
+}
+
+
+/* Order pairs of positions lexicographically */
+static int CompareTriggerIndexPairs( const void *a, const void *b )
+{
+  const UINT4 *pairA = (const UINT4 *) a;
+  const UINT4 *pairB = (const UINT4 *) b;
+
+  if ( pairA[0] != pairB[0] )
+    return ( pairA[0] < pairB[0] ) ? -1 : 1;
+  if ( pairA[1] != pairB[1] )
+    return ( pairA[1] < pairB[1] ) ? -1 : 1;
+  return 0;
+}
+
+
+int XLALFindTriggerErrorIndexOverlaps( UINT4                   **pairs,
+                                       UINT4                   *numPairs,
+                                       const TriggerErrorIndex *indexA,
+                                       const TriggerErrorIndex *indexB,
+                                       INT8                    slideB )
+
+{
+  const TriggerErrorIndex *other;
+  gsl_error_handler_t     *saveGSLErrorHandler = NULL;
+  int                     swapGSLErrorHandler = 0;
+  UINT4                   *allPairs = NULL;
+  size_t                  allLength = 0;
+  int                     errflag = 0;
+  INT4                    i;
+
+  if ( !pairs || !numPairs || !indexA )
+    XLAL_ERROR( XLAL_EFAULT );
+
+  if ( !indexB && slideB != 0 )
+  {
+    XLALPrintError( "A time slide requires two indexes\n" );
+    XLAL_ERROR( XLAL_EINVAL );
+  }
+
+  *pairs    = NULL;
+  *numPairs = 0;
+  other = indexB ? indexB : indexA;
+
+  /* XLALCheckOverlapOfEllipsoids() calls XLAL_CALLGSL(), which saves the */
+  /* global GSL error handler, switches it off and restores it. Threads doing */
+  /* this concurrently could restore each other's saved handler, so when the */
+  /* query runs in parallel, save the caller's handler once here, install the */
+  /* handler XLAL_CALLGSL() switches to, and restore the caller's afterwards */
+#ifdef _OPENMP
+  swapGSLErrorHandler = ( omp_get_max_threads() > 1 && !omp_in_parallel() );
+#endif
+  if ( swapGSLErrorHandler )
+    saveGSLErrorHandler = gsl_set_error_handler_off();
+
+#pragma omp parallel
+  {
+    fContactWorkSpace *workSpace = NULL;
+    gsl_vector        *ra = NULL;
+    gsl_vector        *rb = NULL;
+    UINT4             *localPairs = NULL;
+    size_t            localLength = 0;
+    size_t            localSize = 0;
+    int               failed = 0;
+
+    /* Each thread needs its own workspace and position vectors */
+    workSpace = XLALInitFContactWorkSpace( 3, NULL, NULL, gsl_min_fminimizer_brent, 1.0e-2 );
+    ra = gsl_vector_alloc( 3 );
+    rb = gsl_vector_alloc( 3 );
+    if ( !workSpace || !ra || !rb )
+      failed = XLAL_ENOMEM;
+
+#pragma omp for schedule(dynamic, 16)
+    for ( i = 0; i < (INT4) indexA->length; i++ )
+    {
+      const REAL8 *halfWidthA = indexA->halfWidth + 3*i;
+      const REAL8 *centerA    = indexA->center + 2*i;
+      INT8        timeA       = indexA->endTime[i];
+      INT8        window;
+      UINT4       j;
+
+      if ( failed )
+        continue;
+
+      /* No ellipsoid can reach further than this in time */
+      window = (INT8) ceil( ( halfWidthA[0] + other->maxTimeWidth ) * 1.0e9 );
+
+      /* Find the first trigger within the window */
+      if ( indexB )
+      {
+        UINT4 lo = 0, hi = other->length;
+        while ( lo < hi )
+        {
+          UINT4 mid = lo + ( hi - lo ) / 2;
+          if ( other->endTime[mid] + slideB < timeA - window )
+            lo = mid + 1;
+          else
+            hi = mid;
+        }
+        j = lo;
+      }
+      else
+      {
+        j = (UINT4) i + 1;
+      }
+
+      gsl_vector_set( ra, 0, 0.0 );
+      gsl_vector_set( ra, 1, centerA[0] );
+      gsl_vector_set( ra, 2, centerA[1] );
+
+      for ( ; j < other->length; j++ )
+      {
+        const REAL8 *halfWidthB = other->halfWidth + 3*j;
+        const REAL8 *centerB    = other->center + 2*j;
+        INT8        timeDiff    = other->endTime[j] + slideB - timeA;
+        REAL8       dt;
+        REAL8       fContactValue;
+
+        if ( timeDiff > window )
+          break;
+
+        /* Reject pairs whose bounding boxes do not intersect */
+        dt = (REAL8) timeDiff * 1.0e-9;
+        if ( fabs( dt ) > halfWidthA[0] + halfWidthB[0]
+            || fabs( centerB[0] - centerA[0] ) > halfWidthA[1] + halfWidthB[1]
+            || fabs( centerB[1] - centerA[1] ) > halfWidthA[2] + halfWidthB[2] )
+        {
+          continue;
+        }
+
+        /* Use the relative time to avoid precision problems */
+        gsl_vector_set( rb, 0, dt );
+        gsl_vector_set( rb, 1, centerB[0] );
+        gsl_vector_set( rb, 2, centerB[1] );
+
+        workSpace->invQ1 = indexA->element[i]->err_matrix;
+        workSpace->invQ2 = other->element[j]->err_matrix;
+        fContactValue = XLALCheckOverlapOfEllipsoids( ra, rb, workSpace );
+        if ( XLAL_IS_REAL8_FAIL_NAN( fContactValue ) )
+        {
+          failed = XLAL_EFUNC;
+          break;
+        }
+
+        if ( fContactValue <= 1.0 )
+        {
+          if ( localLength == localSize )
+          {
+            size_t newSize = localSize ? 2 * localSize : 64;
+            UINT4 *tmpPairs = (UINT4 *) LALRealloc( localPairs, 2 * newSize * sizeof(UINT4) );
+            if ( !tmpPairs )
+            {
+              failed = XLAL_ENOMEM;
+              break;
+            }
+            localPairs = tmpPairs;
+            localSize  = newSize;
+          }
+          localPairs[2*localLength]   = (UINT4) i;
+          localPairs[2*localLength+1] = j;
+          localLength++;
+        }
+      }
+    }
+
+    /* Gather the pairs found by each thread */
+#pragma omp critical
+    {
+      if ( !failed && localLength && !errflag )
+      {
+        UINT4 *tmpPairs = (UINT4 *) LALRealloc( allPairs, 2 * ( allLength + localLength ) * sizeof(UINT4) );
+        if ( tmpPairs )
+        {
+          memcpy( tmpPairs + 2 * allLength, localPairs, 2 * localLength * sizeof(UINT4) );
+          allPairs   = tmpPairs;
+          allLength += localLength;
+        }
+        else
+        {
+          failed = XLAL_ENOMEM;
+        }
+      }
+      if ( failed )
+        errflag = failed;
+    }
+
+    if ( localPairs ) LALFree( localPairs );
+    if ( ra ) gsl_vector_free( ra );
+    if ( rb ) gsl_vector_free( rb );
+    if ( workSpace ) XLALFreeFContactWorkSpace( workSpace );
+  }
+
+  if ( swapGSLErrorHandler )
+    gsl_set_error_handler( saveGSLErrorHandler );
+
+  if ( errflag )
+  {
+    if ( allPairs ) LALFree( allPairs );
+    XLAL_ERROR( errflag );
+  }
+
+  /* The order in which threads finish is arbitrary, so sort the pairs */
+  if ( allLength > 1 )
+    qsort( allPairs, allLength, 2 * sizeof(UINT4), CompareTriggerIndexPairs );
+
+  *pairs    = allPairs;
+  *numPairs = (UINT4) allLength;
+  return XLAL_SUCCESS;
+}
+
+
 /**
  * Using the waveform metric components, translate an "e-thinca" treshold
  * into a \f$\Delta t\f$ error interval.
@@ -53,7 +53,8 @@ extern "C" {
  * \endcode
  *
  * This header provides functions used for creating and destroying the
- * linked lists used in TrigScan and E-thinca.
+ * linked lists used in TrigScan and E-thinca, and a spatial index over
+ * those lists for finding triggers with overlapping error ellipsoids.
  *
  */
 /** @{ */
@@ -78,6 +79,33 @@ TriggerErrorList * XLALCreateTriggerErrorList( SnglInspiralTable *tableHead,
 
 void XLALDestroyTriggerErrorList( TriggerErrorList *errorListHead );
 
+/**
+ * The \c TriggerErrorIndex is a time-ordered index over the elements of a
+ * \c TriggerErrorList. It holds the half-widths of the bounding box of each
+ * error ellipsoid in (tc, tau0, tau3), so that neighbour queries only need
+ * to check the overlap of ellipsoids whose boxes intersect.
+ */
+typedef struct tagTriggerErrorIndex
+{
+  UINT4              length;       /**< Number of triggers in the index */
+  TriggerErrorList **element;      /**< Elements of the list in time order */
+  INT8              *endTime;      /**< End time of each trigger in ns */
+  REAL8             *center;       /**< tau0 and tau3 of each trigger */
+  REAL8             *halfWidth;    /**< Bounding box half-widths in (tc, tau0, tau3) */
+  REAL8              maxTimeWidth; /**< Largest tc half-width in the index */
+}
+TriggerErrorIndex;
+
+TriggerErrorIndex * XLALCreateTriggerErrorIndex( TriggerErrorList *errorListHead );
+
+void XLALDestroyTriggerErrorIndex( TriggerErrorIndex *triggerIndex );
+
+int XLALFindTriggerErrorIndexOverlaps( UINT4                   **pairs,
+                                       UINT4                   *numPairs,
+                                       const TriggerErrorIndex *indexA,
+                                       const TriggerErrorIndex *indexB,
+                                       INT8                    slideB );
+
 REAL8 XLALSnglInspiralTimeError(const SnglInspiralTable *table, REAL8 eMatch);
 
 /** @} */ /* end:TrigScanEThincaCommon.h */
@@ -0,0 +1,120 @@
+/*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with with program; see the file COPYING. If not, write to the
+*  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+*  MA  02110-1301  USA
+*/
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/AVFactories.h>
+#include <lal/LALInspiralBank.h>
+
+#define NUM_POINTS 16385
+#define DELTA_F 0.25
+#define NUM_MASSES 40
+
+/* A smooth analytic noise curve with a low-frequency wall */
+static REAL8 psd_datum( REAL8 f )
+{
+  const REAL8 x = f / 150.0;
+  if ( f < 10.0 ) {
+    return 0;
+  }
+  return 1e-46 * ( pow( x, -4.0 ) + 2.0 + x * x );
+}
+
+int main( void )
+{
+
+  /* Create the PSD */
+  REAL8FrequencySeries psd;
+  memset( &psd, 0, sizeof( psd ) );
+  psd.f0 = 0;
+  psd.deltaF = DELTA_F;
+  psd.data = XLALCreateREAL8Vector( NUM_POINTS );
+  XLAL_CHECK_MAIN( psd.data != NULL, XLAL_EFUNC );
+  for ( UINT4 k = 0; k < NUM_POINTS; ++k ) {
+    psd.data->data[k] = psd_datum( k * DELTA_F );
+  }
+
+  /* Create the moment table */
+  const REAL8 ndx = 7.0 / 3.0;
+  InspiralMomentTable *table = XLALCreateInspiralMomentTable( ndx, &psd );
+  XLAL_CHECK_MAIN( table != NULL, XLAL_EFUNC );
+
+  /* Check moments between samples of the PSD against direct integration */
+  const UINT4 limits[][2] = { { 40, 41 }, { 40, 4000 }, { 160, 1600 }, { 1000, NUM_POINTS - 1 } };
+  for ( UINT4 i = 0; i < XLAL_NUM_ELEM( limits ); ++i ) {
+    const REAL8 fLower = limits[i][0] * DELTA_F;
+    const REAL8 fUpper = limits[i][1] * DELTA_F;
+    const REAL8 moment = XLALInspiralMomentTableIntegral( table, fLower, fUpper );
+    XLAL_CHECK_MAIN( !XLAL_IS_REAL8_FAIL_NAN( moment ), XLAL_EFUNC );
+    const REAL8 direct = XLALInspiralMoments( fLower + 0.25 * DELTA_F, fUpper + 0.25 * DELTA_F, ndx, 1.0, &psd );
+    XLAL_CHECK_MAIN( !XLAL_IS_REAL8_FAIL_NAN( direct ), XLAL_EFUNC );
+    XLAL_CHECK_MAIN( fabs( moment - direct ) <= 1e-10 * direct, XLAL_EFAILED, "Moment [%g, %g] = %.16g does not match direct integration %.16g", fLower, fUpper, moment, direct );
+  }
+  printf( "Moment table matches direct integration\n" );
+
+  /* Check moments between arbitrary limits are bracketed by the neighbouring samples */
+  {
+    const REAL8 moment = XLALInspiralMomentTableIntegral( table, 40.1, 1023.9 );
+    const REAL8 inner = XLALInspiralMomentTableIntegral( table, 40.25, 1023.75 );
+    const REAL8 outer = XLALInspiralMomentTableIntegral( table, 40.0, 1024.0 );
+    XLAL_CHECK_MAIN( inner < moment && moment < outer, XLAL_EFAILED, "Moment %.16g is not between %.16g and %.16g", moment, inner, outer );
+  }
+  printf( "Moment table interpolates between samples\n" );
+
+  /* Check the horizon distance of a grid of masses against the moments */
+  {
+    const REAL8 fLower = 20.0, lastOrbit = 6.0, snr = 8.0;
+    REAL8Vector *mass1 = XLALCreateREAL8Vector( NUM_MASSES );
+    REAL8Vector *mass2 = XLALCreateREAL8Vector( NUM_MASSES );
+    REAL8Vector *horizon = XLALCreateREAL8Vector( NUM_MASSES );
+    XLAL_CHECK_MAIN( mass1 != NULL && mass2 != NULL && horizon != NULL, XLAL_EFUNC );
+    for ( UINT4 i = 0; i < NUM_MASSES; ++i ) {
+      mass1->data[i] = 1.0 + 0.75 * i;
+      mass2->data[i] = 1.0 + 0.25 * ( i % 8 );
+    }
+    XLAL_CHECK_MAIN( XLALInspiralHorizonDistances( horizon, mass1, mass2, table, fLower, lastOrbit, snr ) == XLAL_SUCCESS, XLAL_EFUNC );
+    for ( UINT4 i = 0; i < NUM_MASSES; ++i ) {
+      const REAL8 m1 = mass1->data[i], m2 = mass2->data[i];
+      const REAL8 totalMass = m1 + m2;
+      const REAL8 mchirp = pow( m1 * m2, 3.0 / 5.0 ) / pow( totalMass, 1.0 / 5.0 );
+      const REAL8 fUpper = fmin( 1.0 / ( pow( lastOrbit, 1.5 ) * LAL_PI * totalMass * LAL_MTSUN_SI ), ( NUM_POINTS - 1 ) * DELTA_F );
+      const REAL8 moment = XLALInspiralMomentTableIntegral( table, fLower, fUpper );
+      XLAL_CHECK_MAIN( !XLAL_IS_REAL8_FAIL_NAN( moment ), XLAL_EFUNC );
+      const REAL8 expected = sqrt( 5.0 / 6.0 * moment ) * LAL_C_SI * pow( mchirp * LAL_MTSUN_SI, 5.0 / 6.0 ) / ( pow( LAL_PI, 2.0 / 3.0 ) * snr );
+      XLAL_CHECK_MAIN( fabs( horizon->data[i] - expected ) <= 1e-10 * expected, XLAL_EFAILED, "Horizon [%u] = %.16g does not match expected %.16g", i, horizon->data[i], expected );
+      const REAL8 single = XLALInspiralHorizonDistance( table, m1, m2, fLower, fUpper, snr );
+      XLAL_CHECK_MAIN( fabs( single - horizon->data[i] ) <= 1e-12 * single, XLAL_EFAILED, "Horizon [%u] = %.16g does not match single query %.16g", i, horizon->data[i], single );
+    }
+    printf( "Horizon distances match moment integrals\n" );
+    XLALDestroyREAL8Vector( mass1 );
+    XLALDestroyREAL8Vector( mass2 );
+    XLALDestroyREAL8Vector( horizon );
+  }
+
+  /* Cleanup */
+  XLALDestroyInspiralMomentTable( table );
+  XLALDestroyREAL8Vector( psd.data );
+
+  /* Check for memory leaks */
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+
+}
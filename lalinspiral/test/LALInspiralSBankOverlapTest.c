@@ -0,0 +1,147 @@
+/*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with with program; see the file COPYING. If not, write to the
+*  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+*  MA  02110-1301  USA
+*/
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <complex.h>
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/Units.h>
+#include <lal/FrequencySeries.h>
+#include <lal/LALInspiralSBankOverlap.h>
+
+#define LENGTH 4097
+#define DELTA_F 0.5
+#define NUM_TEMPLATES 24
+
+/*
+ * Create a whitened, normalized, positive-frequency stationary-phase chirp,
+ * non-zero between fLower and fUpper, with a chirp time parameter tau.
+ */
+static COMPLEX8FrequencySeries *create_chirp( const REAL8 tau, const REAL8 fLower, const REAL8 fUpper, const UINT4 length )
+{
+  LIGOTimeGPS epoch = LIGOTIMEGPSZERO;
+  COMPLEX8FrequencySeries *h = XLALCreateCOMPLEX8FrequencySeries( "chirp", &epoch, 0, DELTA_F, &lalDimensionlessUnit, length );
+  XLAL_CHECK_NULL( h != NULL, XLAL_EFUNC );
+  REAL8 norm = 0;
+  for ( UINT4 k = 0; k < length; ++k ) {
+    const REAL8 f = k * DELTA_F;
+    if ( f < fLower || f > fUpper ) {
+      h->data->data[k] = 0;
+      continue;
+    }
+    const REAL8 amp = pow( f / fLower, -7.0 / 6.0 );
+    const REAL8 phase = 2.0 * LAL_PI * tau * fLower * pow( f / fLower, -5.0 / 3.0 ) * 3.0 / 5.0;
+    h->data->data[k] = amp * cexp( I * phase );
+    norm += amp * amp;
+  }
+  /* match of a waveform with itself is 4 * deltaF * sum |h|^2 */
+  norm = 1.0 / sqrt( 4.0 * DELTA_F * norm );
+  for ( UINT4 k = 0; k < length; ++k ) {
+    h->data->data[k] *= norm;
+  }
+  return h;
+}
+
+int main( void )
+{
+
+  WS *ws = XLALCreateSBankWorkspaceCache();
+  XLAL_CHECK_MAIN( ws != NULL, XLAL_EFUNC );
+
+  /* Create a proposal and a set of nearby templates, some of them shorter than the proposal */
+  COMPLEX8FrequencySeries *proposal = create_chirp( 2.0, 30.0, 1500.0, LENGTH );
+  XLAL_CHECK_MAIN( proposal != NULL, XLAL_EFUNC );
+  COMPLEX8FrequencySeries *tmplts[NUM_TEMPLATES];
+  for ( UINT4 i = 0; i < NUM_TEMPLATES; ++i ) {
+    const REAL8 tau = 2.0 * ( 1.0 + 0.002 * ( ( INT4 ) i - NUM_TEMPLATES / 2 ) );
+    const REAL8 fUpper = 800.0 + 40.0 * i;
+    tmplts[i] = create_chirp( tau, 30.0 + 0.5 * ( i % 4 ), fUpper, ( i % 3 == 0 ) ? ( UINT4 )( fUpper / DELTA_F ) + 1 : LENGTH );
+    XLAL_CHECK_MAIN( tmplts[i] != NULL, XLAL_EFUNC );
+  }
+
+  /* Check the match of a waveform with itself */
+  {
+    const REAL8 match = XLALInspiralSBankComputeMatch( proposal, proposal, ws );
+    const REAL8 coarse = XLALInspiralSBankComputeMatchCoarse( proposal, proposal, ws );
+    XLAL_CHECK_MAIN( fabs( match - 1.0 ) < 1e-5, XLAL_EFAILED, "Match of proposal with itself = %.9g != 1", match );
+    XLAL_CHECK_MAIN( fabs( coarse - 1.0 ) < 1e-5, XLAL_EFAILED, "Coarse match of proposal with itself = %.9g != 1", coarse );
+  }
+  printf( "Match of a waveform with itself is 1\n" );
+
+  /* Check that the coarse matches approximate the full matches */
+  REAL8 matches[NUM_TEMPLATES], coarse_matches[NUM_TEMPLATES];
+  for ( UINT4 i = 0; i < NUM_TEMPLATES; ++i ) {
+    matches[i] = XLALInspiralSBankComputeMatch( proposal, tmplts[i], ws );
+    XLAL_CHECK_MAIN( !XLAL_IS_REAL8_FAIL_NAN( matches[i] ), XLAL_EFUNC );
+    coarse_matches[i] = XLALInspiralSBankComputeMatchCoarse( proposal, tmplts[i], ws );
+    XLAL_CHECK_MAIN( !XLAL_IS_REAL8_FAIL_NAN( coarse_matches[i] ), XLAL_EFUNC );
+    XLAL_CHECK_MAIN( 0 < matches[i] && matches[i] < 1 + 1e-5, XLAL_EFAILED, "Match [%u] = %.9g is out of range", i, matches[i] );
+    XLAL_CHECK_MAIN( fabs( coarse_matches[i] - matches[i] ) < 0.01, XLAL_EFAILED, "Coarse match [%u] = %.9g does not approximate match %.9g", i, coarse_matches[i], matches[i] );
+  }
+  printf( "Coarse matches approximate full matches\n" );
+
+  /* Check the coarse match of waveforms which overlap in a single frequency bin, where no peak interpolation is possible */
+  {
+    COMPLEX8FrequencySeries *lower = create_chirp( 2.0, 30.0, 100.0, LENGTH );
+    COMPLEX8FrequencySeries *upper = create_chirp( 2.0, 100.0, 200.0, LENGTH );
+    XLAL_CHECK_MAIN( lower != NULL && upper != NULL, XLAL_EFUNC );
+    const REAL8 match = XLALInspiralSBankComputeMatch( lower, upper, ws );
+    const REAL8 coarse = XLALInspiralSBankComputeMatchCoarse( lower, upper, ws );
+    XLAL_CHECK_MAIN( isfinite( coarse ), XLAL_EFAILED, "Coarse match of single-bin overlap = %g is not finite", coarse );
+    XLAL_CHECK_MAIN( fabs( coarse - match ) <= 1e-6 * match, XLAL_EFAILED, "Coarse match of single-bin overlap = %.9g != match %.9g", coarse, match );
+    XLALDestroyCOMPLEX8FrequencySeries( lower );
+    XLALDestroyCOMPLEX8FrequencySeries( upper );
+  }
+  printf( "Coarse match of single-bin overlap is finite\n" );
+
+  /* Check that batches of matches, computed in parallel, are identical to individual matches */
+  {
+    SBankMatchBatch *batch = XLALCreateSBankMatchBatch( 0 );
+    XLAL_CHECK_MAIN( batch != NULL, XLAL_EFUNC );
+    for ( int coarse = 0; coarse < 2; ++coarse ) {
+      XLAL_CHECK_MAIN( XLALSBankMatchBatchClear( batch ) == XLAL_SUCCESS, XLAL_EFUNC );
+      for ( UINT4 i = 0; i < NUM_TEMPLATES; ++i ) {
+        XLAL_CHECK_MAIN( XLALSBankMatchBatchAdd( batch, proposal, tmplts[i] ) == XLAL_SUCCESS, XLAL_EFUNC );
+      }
+      REAL8Vector *batch_matches = XLALSBankMatchBatchCompute( batch, coarse );
+      XLAL_CHECK_MAIN( batch_matches != NULL, XLAL_EFUNC );
+      XLAL_CHECK_MAIN( batch_matches->length == NUM_TEMPLATES, XLAL_EFAILED );
+      for ( UINT4 i = 0; i < NUM_TEMPLATES; ++i ) {
+        const REAL8 expected = coarse ? coarse_matches[i] : matches[i];
+        XLAL_CHECK_MAIN( batch_matches->data[i] == expected, XLAL_EFAILED, "Batch %smatch [%u] = %.17g != %.17g", coarse ? "coarse " : "", i, batch_matches->data[i], expected );
+      }
+      XLALDestroyREAL8Vector( batch_matches );
+    }
+    XLALDestroySBankMatchBatch( batch );
+  }
+  printf( "Batches of matches are identical to individual matches\n" );
+
+  /* Cleanup */
+  for ( UINT4 i = 0; i < NUM_TEMPLATES; ++i ) {
+    XLALDestroyCOMPLEX8FrequencySeries( tmplts[i] );
+  }
+  XLALDestroyCOMPLEX8FrequencySeries( proposal );
+  XLALDestroySBankWorkspaceCache( ws );
+
+  /* Check for memory leaks */
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+
+}
@@ -0,0 +1,306 @@
+/*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with with program; see the file COPYING. If not, write to the
+*  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+*  MA  02110-1301  USA
+*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/Date.h>
+#include <lal/LIGOMetadataTables.h>
+#include <lal/LIGOMetadataUtils.h>
+#include <lal/LIGOMetadataInspiralUtils.h>
+#include <lal/EllipsoidOverlapTools.h>
+#include <lal/TrigScanEThincaCommon.h>
+#include <lal/LALTrigScanCluster.h>
+
+#define NUM_GROUPS 40
+#define MAX_GROUP_SIZE 5
+#define MAX_TRIGGERS ( NUM_GROUPS * MAX_GROUP_SIZE )
+#define GROUP_SPACING_NS 2000000000LL
+#define SLIDE_NS 5000000000LL
+#define SCALE_FACTOR 0.5
+#define F_LOW 40.0
+
+/* Deterministic uniform deviates in [0,1) */
+static UINT4 lcg_state;
+static REAL8 uniform( void )
+{
+  lcg_state = 1664525u * lcg_state + 1013904223u;
+  return ( lcg_state >> 8 ) / 16777216.0;
+}
+
+/*
+ * Create a time-ordered list of triggers in groups spaced far apart in time.
+ * The triggers of a group are a few milliseconds apart, with slightly
+ * different masses, so that some of their ellipsoids overlap and some do not.
+ * Groups of a single trigger give stragglers. Every trigger has a distinct SNR.
+ */
+static SnglInspiralTable *create_triggers( void )
+{
+  SnglInspiralTable *head = NULL;
+  SnglInspiralTable *last = NULL;
+  UINT4 n = 0;
+  lcg_state = 12345;
+  for ( UINT4 g = 0; g < NUM_GROUPS; ++g ) {
+    INT8 endTime = 900000000000000000LL + g * GROUP_SPACING_NS;
+    for ( UINT4 k = 0; k < 1 + g % MAX_GROUP_SIZE; ++k, ++n ) {
+      SnglInspiralTable *row = XLALCreateSnglInspiralTableRow( NULL );
+      XLAL_CHECK_NULL( row != NULL, XLAL_EFUNC );
+      if ( last ) {
+        last->next = row;
+      } else {
+        head = row;
+      }
+      last = row;
+      endTime += ( INT8 )( 15.0e6 * uniform() );
+      XLALINT8NSToGPS( &row->end, endTime );
+      const REAL8 mtotal = 10.0 + 0.1 * ( uniform() - 0.5 );
+      const REAL8 eta = 0.24 + 0.01 * ( uniform() - 0.5 );
+      const REAL8 piMf = LAL_PI * mtotal * LAL_MTSUN_SI * F_LOW;
+      row->mtotal = mtotal;
+      row->eta = eta;
+      row->tau0 = 5.0 / ( 256.0 * LAL_PI * F_LOW * eta ) * pow( piMf, -5.0 / 3.0 );
+      row->tau3 = 1.0 / ( 8.0 * F_LOW * eta ) * pow( piMf, -2.0 / 3.0 );
+      row->snr = 6.0 + 0.01 * ( ( 37 * n ) % 1000 );
+      /* Metric in (tc, tau0, tau3), with correlations between the coordinates */
+      memset( row->Gamma, 0, sizeof( row->Gamma ) );
+      row->Gamma[0] = 5000.0;
+      row->Gamma[1] = 0.3 * sqrt( 5000.0 * 200.0 );
+      row->Gamma[2] = 0.2 * sqrt( 5000.0 * 1250.0 );
+      row->Gamma[3] = 200.0;
+      row->Gamma[4] = 0.4 * sqrt( 200.0 * 1250.0 );
+      row->Gamma[5] = 1250.0;
+    }
+  }
+  return head;
+}
+
+/* Identify a trigger by its end time and SNR */
+typedef struct {
+  INT8 endTime;
+  REAL4 snr;
+} TriggerKey;
+
+static int compare_keys( const void *a, const void *b )
+{
+  const TriggerKey *ka = ( const TriggerKey * ) a;
+  const TriggerKey *kb = ( const TriggerKey * ) b;
+  if ( ka->endTime != kb->endTime ) {
+    return ( ka->endTime < kb->endTime ) ? -1 : 1;
+  }
+  if ( ka->snr != kb->snr ) {
+    return ( ka->snr < kb->snr ) ? -1 : 1;
+  }
+  return 0;
+}
+
+/* Cluster the triggers by repeated calls to XLALTrigScanCreateCluster(), and return the loudest trigger of each cluster */
+static int cluster_serially( TriggerKey *keys, UINT4 *numKeys, INT4 appendStragglers )
+{
+  SnglInspiralTable *table = create_triggers();
+  XLAL_CHECK( table != NULL, XLAL_EFUNC );
+  REAL8 tcMax = 0;
+  TriggerErrorList *errorList = XLALCreateTriggerErrorList( table, SCALE_FACTOR, &tcMax );
+  XLAL_CHECK( errorList != NULL, XLAL_EFUNC );
+  *numKeys = 0;
+  while ( errorList ) {
+    TrigScanCluster *cluster = XLALTrigScanCreateCluster( &errorList, tcMax );
+    XLAL_CHECK( cluster != NULL, XLAL_EFUNC );
+    if ( appendStragglers || cluster->nelements > 1 ) {
+      const SnglInspiralTable *loudest = cluster->element->trigger;
+      for ( const TriggerErrorList *e = cluster->element; e; e = e->next ) {
+        if ( e->trigger->snr > loudest->snr ) {
+          loudest = e->trigger;
+        }
+      }
+      keys[*numKeys].endTime = XLALGPSToINT8NS( &loudest->end );
+      keys[*numKeys].snr = loudest->snr;
+      ++( *numKeys );
+    }
+    XLALTrigScanDestroyCluster( cluster, TRIGSCAN_ERROR );
+  }
+  qsort( keys, *numKeys, sizeof( keys[0] ), compare_keys );
+  return XLAL_SUCCESS;
+}
+
+/* Cluster the triggers with XLALTrigScanClusterTriggers() */
+static int cluster_triggers( TriggerKey *keys, UINT4 *numKeys, INT4 appendStragglers )
+{
+  SnglInspiralTable *table = create_triggers();
+  XLAL_CHECK( table != NULL, XLAL_EFUNC );
+  XLAL_CHECK( XLALTrigScanClusterTriggers( &table, T0T3Tc, SCALE_FACTOR, appendStragglers ) == XLAL_SUCCESS, XLAL_EFUNC );
+  *numKeys = 0;
+  for ( const SnglInspiralTable *row = table; row; row = row->next ) {
+    XLAL_CHECK( *numKeys < MAX_TRIGGERS, XLAL_EFAILED );
+    keys[*numKeys].endTime = XLALGPSToINT8NS( &row->end );
+    keys[*numKeys].snr = row->snr;
+    ++( *numKeys );
+  }
+  XLALDestroySnglInspiralTable( table );
+  qsort( keys, *numKeys, sizeof( keys[0] ), compare_keys );
+  return XLAL_SUCCESS;
+}
+
+/* Check the overlaps found in two indexes (or one, if indexB is NULL) against a brute-force comparison of all pairs */
+static int check_overlaps( const TriggerErrorIndex *indexA, const TriggerErrorIndex *indexB, INT8 slideB, UINT4 *numOverlaps )
+{
+  const TriggerErrorIndex *other = indexB ? indexB : indexA;
+  UINT4 *pairs = NULL;
+  UINT4 numPairs = 0;
+  XLAL_CHECK( XLALFindTriggerErrorIndexOverlaps( &pairs, &numPairs, indexA, indexB, slideB ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  fContactWorkSpace *workSpace = XLALInitFContactWorkSpace( 3, NULL, NULL, gsl_min_fminimizer_brent, 1.0e-2 );
+  XLAL_CHECK( workSpace != NULL, XLAL_EFUNC );
+  gsl_vector *ra = gsl_vector_alloc( 3 );
+  gsl_vector *rb = gsl_vector_alloc( 3 );
+  XLAL_CHECK( ra != NULL && rb != NULL, XLAL_ENOMEM );
+
+  /* Brute-force pairs are found in lexicographic order, as are the pairs of the index */
+  UINT4 k = 0;
+  for ( UINT4 i = 0; i < indexA->length; ++i ) {
+    const TriggerErrorList *a = indexA->element[i];
+    gsl_vector_set( ra, 0, 0.0 );
+    gsl_vector_set( ra, 1, gsl_vector_get( a->position, 1 ) );
+    gsl_vector_set( ra, 2, gsl_vector_get( a->position, 2 ) );
+    for ( UINT4 j = indexB ? 0 : i + 1; j < other->length; ++j ) {
+      const TriggerErrorList *b = other->element[j];
+      const INT8 timeDiff = XLALGPSToINT8NS( &b->trigger->end ) + slideB - XLALGPSToINT8NS( &a->trigger->end );
+      gsl_vector_set( rb, 0, timeDiff * 1.0e-9 );
+      gsl_vector_set( rb, 1, gsl_vector_get( b->position, 1 ) );
+      gsl_vector_set( rb, 2, gsl_vector_get( b->position, 2 ) );
+      workSpace->invQ1 = a->err_matrix;
+      workSpace->invQ2 = b->err_matrix;
+      const REAL8 fContactValue = XLALCheckOverlapOfEllipsoids( ra, rb, workSpace );
+      XLAL_CHECK( !XLAL_IS_REAL8_FAIL_NAN( fContactValue ), XLAL_EFUNC );
+      if ( fContactValue <= 1.0 ) {
+        XLAL_CHECK( k < numPairs, XLAL_EFAILED, "Overlap (%u,%u) was not found in the index", i, j );
+        XLAL_CHECK( pairs[2 * k] == i && pairs[2 * k + 1] == j, XLAL_EFAILED, "Overlap (%u,%u) != index overlap (%u,%u)", i, j, pairs[2 * k], pairs[2 * k + 1] );
+        ++k;
+      }
+    }
+  }
+  XLAL_CHECK( k == numPairs, XLAL_EFAILED, "Index found %u overlaps, brute force found %u", numPairs, k );
+  *numOverlaps = numPairs;
+
+  gsl_vector_free( ra );
+  gsl_vector_free( rb );
+  XLALFreeFContactWorkSpace( workSpace );
+  if ( pairs ) {
+    LALFree( pairs );
+  }
+  return XLAL_SUCCESS;
+}
+
+int main( void )
+{
+
+  /* Check that clustering gives the same clusters as repeated XLALTrigScanCreateCluster(), with and without stragglers */
+  for ( INT4 appendStragglers = 0; appendStragglers < 2; ++appendStragglers ) {
+    TriggerKey expected[MAX_TRIGGERS], clustered[MAX_TRIGGERS];
+    UINT4 numExpected = 0, numClustered = 0;
+    XLAL_CHECK_MAIN( cluster_serially( expected, &numExpected, appendStragglers ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( cluster_triggers( clustered, &numClustered, appendStragglers ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( numExpected > 0, XLAL_EFAILED );
+    XLAL_CHECK_MAIN( numClustered == numExpected, XLAL_EFAILED, "Clustering (appendStragglers=%i) kept %u triggers != %u", appendStragglers, numClustered, numExpected );
+    for ( UINT4 i = 0; i < numExpected; ++i ) {
+      XLAL_CHECK_MAIN( compare_keys( &clustered[i], &expected[i] ) == 0, XLAL_EFAILED, "Clustering (appendStragglers=%i) kept trigger %" LAL_INT8_FORMAT " ns SNR %g != %" LAL_INT8_FORMAT " ns SNR %g",
+                       appendStragglers, clustered[i].endTime, clustered[i].snr, expected[i].endTime, expected[i].snr );
+    }
+    printf( "Clustering (appendStragglers=%i) kept the same %u triggers as XLALTrigScanCreateCluster()\n", appendStragglers, numClustered );
+  }
+
+  /* Check the overlaps found within one index */
+  {
+    SnglInspiralTable *table = create_triggers();
+    XLAL_CHECK_MAIN( table != NULL, XLAL_EFUNC );
+    TriggerErrorList *errorList = XLALCreateTriggerErrorList( table, SCALE_FACTOR, NULL );
+    XLAL_CHECK_MAIN( errorList != NULL, XLAL_EFUNC );
+    TriggerErrorIndex *triggerIndex = XLALCreateTriggerErrorIndex( errorList );
+    XLAL_CHECK_MAIN( triggerIndex != NULL, XLAL_EFUNC );
+    UINT4 numOverlaps = 0;
+    XLAL_CHECK_MAIN( check_overlaps( triggerIndex, NULL, 0, &numOverlaps ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( numOverlaps > 0, XLAL_EFAILED, "No overlapping triggers" );
+    printf( "Index found the same %u overlaps as brute force\n", numOverlaps );
+
+    /* A time slide requires two indexes */
+    int errnum;
+    UINT4 *pairs = NULL;
+    UINT4 numPairs = 0;
+    XLAL_TRY_SILENT( XLALFindTriggerErrorIndexOverlaps( &pairs, &numPairs, triggerIndex, NULL, SLIDE_NS ), errnum );
+    XLAL_CHECK_MAIN( errnum == XLAL_EINVAL && pairs == NULL, XLAL_EFAILED, "Time slide of a single index was not an error" );
+
+    XLALDestroyTriggerErrorIndex( triggerIndex );
+    XLALDestroyTriggerErrorList( errorList );
+    XLALDestroySnglInspiralTable( table );
+  }
+
+  /* Check the overlaps found between two indexes, with the second slid back into coincidence with the first */
+  {
+    SnglInspiralTable *table = create_triggers();
+    XLAL_CHECK_MAIN( table != NULL, XLAL_EFUNC );
+    SnglInspiralTable *tableA = NULL, *tableB = NULL, *lastA = NULL, *lastB = NULL;
+    UINT4 n = 0;
+    while ( table ) {
+      SnglInspiralTable *row = table;
+      table = table->next;
+      row->next = NULL;
+      if ( n++ % 2 == 0 ) {
+        if ( lastA ) {
+          lastA->next = row;
+        } else {
+          tableA = row;
+        }
+        lastA = row;
+      } else {
+        XLALINT8NSToGPS( &row->end, XLALGPSToINT8NS( &row->end ) - SLIDE_NS );
+        if ( lastB ) {
+          lastB->next = row;
+        } else {
+          tableB = row;
+        }
+        lastB = row;
+      }
+    }
+    TriggerErrorList *errorListA = XLALCreateTriggerErrorList( tableA, SCALE_FACTOR, NULL );
+    TriggerErrorList *errorListB = XLALCreateTriggerErrorList( tableB, SCALE_FACTOR, NULL );
+    XLAL_CHECK_MAIN( errorListA != NULL && errorListB != NULL, XLAL_EFUNC );
+    TriggerErrorIndex *indexA = XLALCreateTriggerErrorIndex( errorListA );
+    TriggerErrorIndex *indexB = XLALCreateTriggerErrorIndex( errorListB );
+    XLAL_CHECK_MAIN( indexA != NULL && indexB != NULL, XLAL_EFUNC );
+    UINT4 numOverlaps = 0;
+    XLAL_CHECK_MAIN( check_overlaps( indexA, indexB, SLIDE_NS, &numOverlaps ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( numOverlaps > 0, XLAL_EFAILED, "No overlapping triggers after the time slide" );
+    printf( "Index found the same %u overlaps as brute force after a time slide\n", numOverlaps );
+    XLAL_CHECK_MAIN( check_overlaps( indexA, indexB, 0, &numOverlaps ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( numOverlaps == 0, XLAL_EFAILED, "Found %u overlaps without the time slide", numOverlaps );
+    printf( "Index found no overlaps without the time slide\n" );
+    XLALDestroyTriggerErrorIndex( indexA );
+    XLALDestroyTriggerErrorIndex( indexB );
+    XLALDestroyTriggerErrorList( errorListA );
+    XLALDestroyTriggerErrorList( errorListB );
+    XLALDestroySnglInspiralTable( tableA );
+    XLALDestroySnglInspiralTable( tableB );
+  }
+
+  /* Check for memory leaks */
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+
+}
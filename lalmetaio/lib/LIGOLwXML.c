@@ -52,8 +52,10 @@
  */
 
 
+#include <stdio.h>
 #include <lal/FileIO.h>
 #include <lal/LALMalloc.h>
+#include <lal/LALStdio.h>
 #include <lal/LIGOLwXML.h>
 #include <lal/XLALError.h>
 #include <LIGOLwXMLHeaders.h>
@@ -84,6 +86,7 @@ XLALOpenLIGOLwXMLFile (
     XLALFree(new);
     XLAL_ERROR_NULL( XLAL_EFUNC );
   }
+  new->rowCount = 0;
 
   /* write the XML header */
 
@@ -125,6 +128,195 @@ XLALCloseLIGOLwXMLFile (
   return 0;
 }
 
+/**
+ * LIGO Light Weight XML type name of the values in a ::LIGOLwColumnBuffer.
+ */
+static const char *column_type_name(LIGOLwColumnType type)
+{
+  switch ( type )
+  {
+    case LIGOLW_COLUMN_INT4:
+      return "int_4s";
+    case LIGOLW_COLUMN_INT8:
+      return "int_8s";
+    case LIGOLW_COLUMN_REAL4:
+      return "real_4";
+    case LIGOLW_COLUMN_REAL8:
+      return "real_8";
+    case LIGOLW_COLUMN_STRING:
+      return "lstring";
+  }
+  return NULL;
+}
+
+
+/**
+ * Write the header of a table, declaring the columns described by the
+ * name and type members of the given column buffers, and open its stream.
+ * The data pointers of the column buffers are not used.  Rows are
+ * then added with XLALWriteLIGOLwXMLTableRows(), and the table is closed
+ * with XLALWriteLIGOLwXMLTableFooter().
+ */
+int XLALWriteLIGOLwXMLTableHeader(
+    LIGOLwXMLStream *xml,
+    const char *table_name,
+    const LIGOLwColumnBuffer *columns,
+    unsigned int ncolumns
+)
+{
+  unsigned int i;
+
+  if ( ! xml || ! table_name || ( ncolumns && ! columns ) )
+    XLAL_ERROR( XLAL_EFAULT );
+
+  XLALClearErrno();
+  XLALFilePrintf( xml->fp, "\t<Table Name=\"%s:table\">\n", table_name );
+  for ( i = 0; i < ncolumns; i++ )
+  {
+    const char *type = column_type_name( columns[i].type );
+    if ( ! type )
+      XLAL_ERROR( XLAL_EINVAL, "column \"%s\" has invalid type", columns[i].name );
+    XLALFilePrintf( xml->fp, "\t\t<Column Name=\"%s\" Type=\"%s\"/>\n", columns[i].name, type );
+  }
+  XLALFilePrintf( xml->fp, "\t\t<Stream Name=\"%s:table\" Type=\"Local\" Delimiter=\",\">", table_name );
+  if ( XLALGetBaseErrno() )
+    XLAL_ERROR( XLAL_EFUNC );
+
+  xml->rowCount = 0;
+
+  return 0;
+}
+
+
+/**
+ * Write the first n characters of the string src into dst as the body of a
+ * quoted lstring value, escaping backslashes, quotes and delimiters with a
+ * backslash.  dst must have room for 2 * n characters.  The return value is
+ * the number of characters written;  dst is not nul-terminated.
+ */
+static size_t escape_lstring(char *dst, const char *src, size_t n)
+{
+  size_t len = 0;
+
+  for ( ; n && *src; n--, src++ )
+  {
+    if ( *src == '\\' || *src == '"' || *src == ',' )
+      dst[len++] = '\\';
+    dst[len++] = *src;
+  }
+
+  return len;
+}
+
+
+/**
+ * Append nrows rows, taken from the given column buffers, to the table
+ * opened by XLALWriteLIGOLwXMLTableHeader().  The column buffers must be
+ * the same, and in the same order, as those passed to
+ * XLALWriteLIGOLwXMLTableHeader(), so it may be called once for each
+ * chunk of rows read by XLALLIGOLwReadTableColumns().  Backslashes,
+ * quotes and commas in string values are escaped with a backslash.  The
+ * rows are formatted into a large memory buffer, which is written to the
+ * file in blocks, instead of formatting each row directly to the file.
+ */
+int XLALWriteLIGOLwXMLTableRows(
+    LIGOLwXMLStream *xml,
+    const LIGOLwColumnBuffer *columns,
+    unsigned int ncolumns,
+    unsigned int nrows
+)
+{
+  /* size of the output buffer, and the most characters a single value can
+   * occupy, including its delimiters and the escapes of a string */
+  const size_t bufsize = 1 << 16;
+  const size_t maxvalue = 2 * LIGOLW_COLUMN_STRING_MAX + 32;
+  char *buf;
+  size_t len = 0;
+  unsigned int row, i;
+
+  if ( ! xml || ( ncolumns && ! columns ) )
+    XLAL_ERROR( XLAL_EFAULT );
+  for ( i = 0; i < ncolumns; i++ )
+    if ( nrows && ! columns[i].data )
+      XLAL_ERROR( XLAL_EFAULT, "column \"%s\" has no data", columns[i].name );
+
+  buf = XLALMalloc( bufsize );
+  if ( ! buf )
+    XLAL_ERROR( XLAL_EFUNC );
+
+  for ( row = 0; row < nrows; row++ )
+  {
+    const char *delim = xml->rowCount++ ? ",\n\t\t\t" : "\n\t\t\t";
+
+    for ( i = 0; i < ncolumns; i++ )
+    {
+      /* flush the buffer if the next value might not fit */
+      if ( bufsize - len < maxvalue )
+      {
+        if ( XLALFileWrite( buf, 1, len, xml->fp ) != len )
+        {
+          XLALFree( buf );
+          XLAL_ERROR( XLAL_EIO );
+        }
+        len = 0;
+      }
+
+      switch ( columns[i].type )
+      {
+        case LIGOLW_COLUMN_INT4:
+          len += snprintf( buf + len, bufsize - len, "%s%" LAL_INT4_FORMAT, delim, ( ( const INT4 * ) columns[i].data )[row] );
+          break;
+        case LIGOLW_COLUMN_INT8:
+          len += snprintf( buf + len, bufsize - len, "%s%" LAL_INT8_FORMAT, delim, ( ( const INT8 * ) columns[i].data )[row] );
+          break;
+        case LIGOLW_COLUMN_REAL4:
+          len += snprintf( buf + len, bufsize - len, "%s%.8g", delim, ( ( const REAL4 * ) columns[i].data )[row] );
+          break;
+        case LIGOLW_COLUMN_REAL8:
+          len += snprintf( buf + len, bufsize - len, "%s%.16g", delim, ( ( const REAL8 * ) columns[i].data )[row] );
+          break;
+        case LIGOLW_COLUMN_STRING:
+          len += snprintf( buf + len, bufsize - len, "%s\"", delim );
+          len += escape_lstring( buf + len, ( const char * ) columns[i].data + ( size_t ) row * LIGOLW_COLUMN_STRING_MAX, LIGOLW_COLUMN_STRING_MAX - 1 );
+          buf[len++] = '"';
+          break;
+        default:
+          XLALFree( buf );
+          XLAL_ERROR( XLAL_EINVAL, "column \"%s\" has invalid type", columns[i].name );
+      }
+      delim = ",";
+    }
+  }
+
+  if ( len && XLALFileWrite( buf, 1, len, xml->fp ) != len )
+  {
+    XLALFree( buf );
+    XLAL_ERROR( XLAL_EIO );
+  }
+
+  XLALFree( buf );
+
+  return 0;
+}
+
+
+/**
+ * Close the stream and the table opened by XLALWriteLIGOLwXMLTableHeader().
+ */
+int XLALWriteLIGOLwXMLTableFooter(
+    LIGOLwXMLStream *xml
+)
+{
+  if ( ! xml )
+    XLAL_ERROR( XLAL_EFAULT );
+
+  if ( XLALFilePuts( "\n\t\t</Stream>\n\t</Table>\n", xml->fp ) < 0 )
+    XLAL_ERROR( XLAL_EFUNC );
+
+  return 0;
+}
+
+
 /**
  * Creates a XML filename accordingly to document T050017
  */
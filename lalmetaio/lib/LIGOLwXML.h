@@ -46,6 +46,7 @@
 #include <stdlib.h>
 #include <lal/FileIO.h>
 #include <lal/LALAtomicDatatypes.h>
+#include <lal/LIGOLwXMLRead.h>
 #include <lal/LIGOMetadataTables.h>
 
 #if defined(__cplusplus)
@@ -70,6 +71,7 @@ typedef struct
 tagLIGOLwXMLStream
 {
   LALFILE              *fp;
+  UINT8                 rowCount;
 }
 LIGOLwXMLStream;
 
@@ -134,6 +136,24 @@ int XLALWriteLIGOLwXMLSegmentTable(
 	const SegmentTable *segment_table
 );
 
+int XLALWriteLIGOLwXMLTableHeader(
+	LIGOLwXMLStream *xml,
+	const char *table_name,
+	const LIGOLwColumnBuffer *columns,
+	unsigned int ncolumns
+);
+
+int XLALWriteLIGOLwXMLTableRows(
+	LIGOLwXMLStream *xml,
+	const LIGOLwColumnBuffer *columns,
+	unsigned int ncolumns,
+	unsigned int nrows
+);
+
+int XLALWriteLIGOLwXMLTableFooter(
+	LIGOLwXMLStream *xml
+);
+
 int XLALCreateLIGODataFileName(
         char* filename,
         size_t size,
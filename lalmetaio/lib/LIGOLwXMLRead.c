@@ -57,6 +57,7 @@
 
 #include <lal/Date.h>
 #include <lal/LALConstants.h>
+#include <lal/LALMalloc.h>
 #include <lal/LALStdio.h>
 #include <lal/LIGOLwXMLRead.h>
 #include <lal/LIGOMetadataTables.h>
@@ -197,3 +198,234 @@ long long XLALLIGOLwParseIlwdChar(
 
 	return id;
 }
+
+
+/**
+ * Size in bytes of one value of a ::LIGOLwColumnBuffer.
+ */
+static size_t column_value_size(LIGOLwColumnType type)
+{
+	switch(type) {
+	case LIGOLW_COLUMN_INT4:
+		return sizeof(INT4);
+	case LIGOLW_COLUMN_INT8:
+		return sizeof(INT8);
+	case LIGOLW_COLUMN_REAL4:
+		return sizeof(REAL4);
+	case LIGOLW_COLUMN_REAL8:
+		return sizeof(REAL8);
+	case LIGOLW_COLUMN_STRING:
+		return LIGOLW_COLUMN_STRING_MAX;
+	}
+	return 0;
+}
+
+
+/**
+ * Returns non-zero if values of the metaio type data_type can be stored
+ * in a ::LIGOLwColumnBuffer of the given type without loss.
+ */
+static int column_type_compatible(unsigned int data_type, LIGOLwColumnType type)
+{
+	switch(type) {
+	case LIGOLW_COLUMN_INT4:
+		return data_type == METAIO_TYPE_INT_4S;
+	case LIGOLW_COLUMN_INT8:
+		return data_type == METAIO_TYPE_INT_4S || data_type == METAIO_TYPE_INT_8S || data_type == METAIO_TYPE_INT_8U;
+	case LIGOLW_COLUMN_REAL4:
+		return data_type == METAIO_TYPE_REAL_4;
+	case LIGOLW_COLUMN_REAL8:
+		return data_type == METAIO_TYPE_REAL_4 || data_type == METAIO_TYPE_REAL_8 || data_type == METAIO_TYPE_INT_4S || data_type == METAIO_TYPE_INT_8S || data_type == METAIO_TYPE_INT_8U;
+	case LIGOLW_COLUMN_STRING:
+		return data_type == METAIO_TYPE_LSTRING;
+	}
+	return 0;
+}
+
+
+/**
+ * Copy the value in column column_number of the current row into element
+ * i of a ::LIGOLwColumnBuffer.  The types must have been checked with
+ * column_type_compatible().
+ */
+static void column_copy_value(
+	LIGOLwColumnBuffer *column,
+	unsigned int i,
+	const struct MetaioParseEnvironment *env,
+	int column_number
+)
+{
+	unsigned int data_type = env->ligo_lw.table.col[column_number].data_type;
+	REAL8 value;
+
+	switch(column->type) {
+	case LIGOLW_COLUMN_INT4:
+		((INT4 *) column->data)[i] = env->ligo_lw.table.elt[column_number].data.int_4s;
+		return;
+	case LIGOLW_COLUMN_INT8:
+		if(data_type == METAIO_TYPE_INT_4S)
+			((INT8 *) column->data)[i] = env->ligo_lw.table.elt[column_number].data.int_4s;
+		else if(data_type == METAIO_TYPE_INT_8S)
+			((INT8 *) column->data)[i] = env->ligo_lw.table.elt[column_number].data.int_8s;
+		else
+			((INT8 *) column->data)[i] = env->ligo_lw.table.elt[column_number].data.int_8u;
+		return;
+	case LIGOLW_COLUMN_REAL4:
+		((REAL4 *) column->data)[i] = env->ligo_lw.table.elt[column_number].data.real_4;
+		return;
+	case LIGOLW_COLUMN_REAL8:
+		if(data_type == METAIO_TYPE_REAL_4)
+			value = env->ligo_lw.table.elt[column_number].data.real_4;
+		else if(data_type == METAIO_TYPE_REAL_8)
+			value = env->ligo_lw.table.elt[column_number].data.real_8;
+		else if(data_type == METAIO_TYPE_INT_4S)
+			value = env->ligo_lw.table.elt[column_number].data.int_4s;
+		else if(data_type == METAIO_TYPE_INT_8S)
+			value = env->ligo_lw.table.elt[column_number].data.int_8s;
+		else
+			value = env->ligo_lw.table.elt[column_number].data.int_8u;
+		((REAL8 *) column->data)[i] = value;
+		return;
+	case LIGOLW_COLUMN_STRING: {
+		char *s = (char *) column->data + (size_t) i * LIGOLW_COLUMN_STRING_MAX;
+		strncpy(s, env->ligo_lw.table.elt[column_number].data.lstring.data, LIGOLW_COLUMN_STRING_MAX - 1);
+		s[LIGOLW_COLUMN_STRING_MAX - 1] = '\0';
+		return;
+	}
+	}
+}
+
+
+/**
+ * Read selected columns of a table in a LIGO Light Weight XML file, in
+ * chunks of at most chunk_length rows.
+ *
+ * The columns to be read are described by the name, type and required
+ * members of the ncolumns elements of columns.  The rows are parsed one
+ * at a time by libmetaio, which converts the values of all of the columns
+ * of the table, so this does not reduce the cost of parsing;  only the
+ * values of the requested columns are copied into the data arrays of
+ * columns, which are allocated by this function to hold chunk_length
+ * values each.  Whenever chunk_length rows have been read,
+ * and once more for any remaining rows at the end of the table, callback
+ * is called with the filled column buffers and userdata.  Only one chunk
+ * of rows is held in memory at any time, so tables of any size can be
+ * processed.  Compressed (.xml.gz) files are decompressed as they are
+ * read.
+ *
+ * Non-required columns that are missing from the table have their data
+ * pointers set to NULL.  On return the data arrays have been freed, and
+ * the data pointers are NULL.  Returns 0 on success, or < 0 on failure,
+ * including if callback returns non-zero.
+ */
+int XLALLIGOLwReadTableColumns(
+	const char *filename,
+	const char *table_name,
+	LIGOLwColumnBuffer *columns,
+	unsigned int ncolumns,
+	unsigned int chunk_length,
+	LIGOLwTableChunkFunc callback,
+	void *userdata
+)
+{
+	struct MetaioParseEnvironment env;
+	int *column_pos;
+	unsigned int nrows = 0;
+	unsigned int i;
+	int miostatus;
+
+	if(!filename || !table_name || (ncolumns && !columns) || !callback)
+		XLAL_ERROR(XLAL_EFAULT);
+	if(!chunk_length)
+		XLAL_ERROR(XLAL_EINVAL);
+
+	column_pos = XLALMalloc((ncolumns + 1) * sizeof(*column_pos));
+	if(!column_pos)
+		XLAL_ERROR(XLAL_EFUNC);
+	for(i = 0; i < ncolumns; i++)
+		columns[i].data = NULL;
+
+	/* open the file and find table */
+
+	if(MetaioOpenFile(&env, filename)) {
+		XLALFree(column_pos);
+		XLALPrintError("%s(): error opening \"%s\": %s\n", __func__, filename, env.mierrmsg.data ? env.mierrmsg.data : "unknown reason");
+		XLAL_ERROR(XLAL_EIO);
+	}
+	if(MetaioOpenTableOnly(&env, table_name)) {
+		MetaioAbort(&env);
+		XLALFree(column_pos);
+		XLALPrintError("%s(): cannot find %s table: %s\n", __func__, table_name, env.mierrmsg.data ? env.mierrmsg.data : "unknown reason");
+		XLAL_ERROR(XLAL_EIO);
+	}
+
+	/* find columns, check their types, and allocate the buffers */
+
+	XLALClearErrno();
+	for(i = 0; i < ncolumns; i++) {
+		column_pos[i] = XLALLIGOLwFindColumn(&env, columns[i].name, METAIO_TYPE_UNKNOWN, columns[i].required);
+		if(column_pos[i] < 0)
+			continue;
+		if(!column_type_compatible(env.ligo_lw.table.col[column_pos[i]].data_type, columns[i].type)) {
+			XLALPrintError("%s(): column \"%s\" has wrong type\n", __func__, columns[i].name);
+			XLAL_ERROR_FAIL(XLAL_EDATA);
+		}
+		columns[i].data = XLALMalloc(chunk_length * column_value_size(columns[i].type));
+		if(!columns[i].data)
+			XLAL_ERROR_FAIL(XLAL_EFUNC);
+	}
+	if(XLALGetBaseErrno()) {
+		XLALPrintError("%s(): failure reading %s table\n", __func__, table_name);
+		XLAL_ERROR_FAIL(XLAL_EFUNC);
+	}
+
+	/* loop over the rows in the file, passing them to the callback one
+	 * chunk at a time */
+
+	while((miostatus = MetaioGetRow(&env)) > 0) {
+		for(i = 0; i < ncolumns; i++)
+			if(column_pos[i] >= 0)
+				column_copy_value(&columns[i], nrows, &env, column_pos[i]);
+		if(++nrows == chunk_length) {
+			if(callback(columns, ncolumns, nrows, userdata))
+				XLAL_ERROR_FAIL(XLAL_EFUNC);
+			nrows = 0;
+		}
+	}
+	if(miostatus < 0) {
+		XLALPrintError("%s(): I/O error parsing %s table: %s\n", __func__, table_name, env.mierrmsg.data ? env.mierrmsg.data : "unknown reason");
+		XLAL_ERROR_FAIL(XLAL_EIO);
+	}
+	if(nrows && callback(columns, ncolumns, nrows, userdata))
+		XLAL_ERROR_FAIL(XLAL_EFUNC);
+
+	/* close file */
+
+	if(MetaioClose(&env)) {
+		for(i = 0; i < ncolumns; i++) {
+			XLALFree(columns[i].data);
+			columns[i].data = NULL;
+		}
+		XLALFree(column_pos);
+		XLALPrintError("%s(): error parsing document after %s table: %s\n", __func__, table_name, env.mierrmsg.data ? env.mierrmsg.data : "unknown reason");
+		XLAL_ERROR(XLAL_EIO);
+	}
+
+	/* done */
+
+	for(i = 0; i < ncolumns; i++) {
+		XLALFree(columns[i].data);
+		columns[i].data = NULL;
+	}
+	XLALFree(column_pos);
+	return 0;
+
+XLAL_FAIL:
+	MetaioAbort(&env);
+	for(i = 0; i < ncolumns; i++) {
+		XLALFree(columns[i].data);
+		columns[i].data = NULL;
+	}
+	XLALFree(column_pos);
+	return XLAL_FAILURE;
+}
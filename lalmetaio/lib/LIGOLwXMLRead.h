@@ -55,6 +55,45 @@ extern "C" {
  * an opaque type, here, and is why the forward declaration is neeed. */
 struct MetaioParseEnvironment;
 
+/** Maximum length, including the terminating '\0', of a string read by XLALLIGOLwReadTableColumns() */
+#define LIGOLW_COLUMN_STRING_MAX 256
+
+/** Storage types of the values held in a ::LIGOLwColumnBuffer */
+typedef enum tagLIGOLwColumnType {
+	LIGOLW_COLUMN_INT4,	/**< INT4 values; read from int_4s columns */
+	LIGOLW_COLUMN_INT8,	/**< INT8 values; read from int_4s, int_8s and int_8u columns */
+	LIGOLW_COLUMN_REAL4,	/**< REAL4 values; read from real_4 columns */
+	LIGOLW_COLUMN_REAL8,	/**< REAL8 values; read from real_4, real_8 and integer columns */
+	LIGOLW_COLUMN_STRING	/**< Strings of #LIGOLW_COLUMN_STRING_MAX characters; read from lstring columns */
+} LIGOLwColumnType;
+
+/**
+ * One column of a table stored as a contiguous array of values, as used by
+ * XLALLIGOLwReadTableColumns() and XLALWriteLIGOLwXMLTableRows().  Value i
+ * of the column is element i of data, interpreted according to type; for
+ * #LIGOLW_COLUMN_STRING it is the '\0'-terminated string starting at
+ * (char *) data + i * #LIGOLW_COLUMN_STRING_MAX.
+ */
+typedef struct tagLIGOLwColumnBuffer {
+	const char *name;	/**< Name of the column */
+	LIGOLwColumnType type;	/**< Type of the values in data */
+	int required;		/**< If zero, a column missing from the file is not an error, and data is left NULL */
+	void *data;		/**< Array of column values */
+} LIGOLwColumnBuffer;
+
+/**
+ * Function called by XLALLIGOLwReadTableColumns() for each chunk of rows.
+ * The column buffers hold nrows values each, and are only valid for the
+ * duration of the call.  A non-zero return value stops the reading and is
+ * reported as an error.
+ */
+typedef int (*LIGOLwTableChunkFunc)(
+	const LIGOLwColumnBuffer *columns,
+	unsigned int ncolumns,
+	unsigned int nrows,
+	void *userdata
+);
+
 int
 XLALLIGOLwFindColumn(
     struct MetaioParseEnvironment *env,
@@ -70,6 +109,18 @@ long long XLALLIGOLwParseIlwdChar(
     const char *ilwd_char_column_name
 );
 
+#ifndef SWIG   // exclude from SWIG interface
+int XLALLIGOLwReadTableColumns(
+    const char *filename,
+    const char *table_name,
+    LIGOLwColumnBuffer *columns,
+    unsigned int ncolumns,
+    unsigned int chunk_length,
+    LIGOLwTableChunkFunc callback,
+    void *userdata
+);
+#endif   // SWIG
+
 int
 XLALLIGOLwHasTable(
     const char *filename,
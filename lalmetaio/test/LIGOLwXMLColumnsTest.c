@@ -0,0 +1,160 @@
+/*
+*  This program is free software; you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 2 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with with program; see the file COPYING. If not, write to the
+*  Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+*  MA  02110-1301  USA
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <lal/LALStdlib.h>
+#include <lal/LALConstants.h>
+#include <lal/LIGOLwXML.h>
+#include <lal/LIGOLwXMLRead.h>
+
+#define FILENAME "LIGOLwXMLColumnsTest.xml"
+#define TABLE_NAME "test:table"
+#define NUM_ROWS 23
+#define CHUNK_LENGTH 5
+#define NUM_COLUMNS 4
+
+/* Strings which must be escaped to survive a round trip */
+static const char *const strings[] = {
+  "plain",
+  "",
+  "comma, separated",
+  "a \"quoted\" word",
+  "back\\slash",
+  "trailing backslash\\",
+  "\\\"\\,,\"",
+};
+
+static INT4 row_int4( UINT4 row ) { return 7 * ( INT4 ) row - 50; }
+static INT8 row_int8( UINT4 row ) { return ( INT8 ) 1000000000007LL * row; }
+static REAL8 row_real8( UINT4 row ) { return LAL_PI * row - 1e-3; }
+
+static void row_string( char *s, UINT4 row )
+{
+  snprintf( s, LIGOLW_COLUMN_STRING_MAX, "%s:%u", strings[row % XLAL_NUM_ELEM( strings )], row );
+}
+
+static void init_columns( LIGOLwColumnBuffer *columns )
+{
+  memset( columns, 0, NUM_COLUMNS * sizeof( *columns ) );
+  columns[0].name = "int4";
+  columns[0].type = LIGOLW_COLUMN_INT4;
+  columns[1].name = "int8";
+  columns[1].type = LIGOLW_COLUMN_INT8;
+  columns[2].name = "real8";
+  columns[2].type = LIGOLW_COLUMN_REAL8;
+  columns[3].name = "name";
+  columns[3].type = LIGOLW_COLUMN_STRING;
+  for ( UINT4 i = 0; i < NUM_COLUMNS; ++i ) {
+    columns[i].required = 1;
+  }
+}
+
+/* Check each chunk of rows read back against the values written */
+static int check_chunk( const LIGOLwColumnBuffer *columns, unsigned int ncolumns, unsigned int nrows, void *userdata )
+{
+  UINT4 *nread = ( UINT4 * ) userdata;
+  XLAL_CHECK( ncolumns == NUM_COLUMNS, XLAL_EFAILED );
+  XLAL_CHECK( 0 < nrows && nrows <= CHUNK_LENGTH, XLAL_EFAILED, "Chunk of %u rows", nrows );
+  for ( UINT4 i = 0; i < nrows; ++i ) {
+    const UINT4 row = *nread + i;
+    char expected[LIGOLW_COLUMN_STRING_MAX];
+    const char *name = ( const char * ) columns[3].data + ( size_t ) i * LIGOLW_COLUMN_STRING_MAX;
+    row_string( expected, row );
+    XLAL_CHECK( ( ( const INT4 * ) columns[0].data )[i] == row_int4( row ), XLAL_EFAILED, "Row %u int4 mismatch", row );
+    XLAL_CHECK( ( ( const INT8 * ) columns[1].data )[i] == row_int8( row ), XLAL_EFAILED, "Row %u int8 mismatch", row );
+    XLAL_CHECK( ( ( const REAL8 * ) columns[2].data )[i] == row_real8( row ), XLAL_EFAILED, "Row %u real8 mismatch", row );
+    XLAL_CHECK( strcmp( name, expected ) == 0, XLAL_EFAILED, "Row %u string '%s' != '%s'", row, name, expected );
+  }
+  *nread += nrows;
+  return 0;
+}
+
+int main( void )
+{
+
+  LIGOLwColumnBuffer columns[NUM_COLUMNS];
+  init_columns( columns );
+
+  /* Write the table in two calls, to check the row delimiters between calls */
+  {
+    INT4 *int4 = XLALMalloc( NUM_ROWS * sizeof( *int4 ) );
+    INT8 *int8 = XLALMalloc( NUM_ROWS * sizeof( *int8 ) );
+    REAL8 *real8 = XLALMalloc( NUM_ROWS * sizeof( *real8 ) );
+    char *name = XLALMalloc( NUM_ROWS * LIGOLW_COLUMN_STRING_MAX );
+    XLAL_CHECK_MAIN( int4 != NULL && int8 != NULL && real8 != NULL && name != NULL, XLAL_ENOMEM );
+    for ( UINT4 row = 0; row < NUM_ROWS; ++row ) {
+      int4[row] = row_int4( row );
+      int8[row] = row_int8( row );
+      real8[row] = row_real8( row );
+      row_string( name + ( size_t ) row * LIGOLW_COLUMN_STRING_MAX, row );
+    }
+    columns[0].data = int4;
+    columns[1].data = int8;
+    columns[2].data = real8;
+    columns[3].data = name;
+    LIGOLwXMLStream *xml = XLALOpenLIGOLwXMLFile( FILENAME );
+    XLAL_CHECK_MAIN( xml != NULL, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( XLALWriteLIGOLwXMLTableHeader( xml, TABLE_NAME, columns, NUM_COLUMNS ) == 0, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( XLALWriteLIGOLwXMLTableRows( xml, columns, NUM_COLUMNS, NUM_ROWS / 2 ) == 0, XLAL_EFUNC );
+    columns[0].data = int4 + NUM_ROWS / 2;
+    columns[1].data = int8 + NUM_ROWS / 2;
+    columns[2].data = real8 + NUM_ROWS / 2;
+    columns[3].data = name + ( size_t )( NUM_ROWS / 2 ) * LIGOLW_COLUMN_STRING_MAX;
+    XLAL_CHECK_MAIN( XLALWriteLIGOLwXMLTableRows( xml, columns, NUM_COLUMNS, NUM_ROWS - NUM_ROWS / 2 ) == 0, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( XLALWriteLIGOLwXMLTableFooter( xml ) == 0, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( XLALCloseLIGOLwXMLFile( xml ) == 0, XLAL_EFUNC );
+    XLALFree( int4 );
+    XLALFree( int8 );
+    XLALFree( real8 );
+    XLALFree( name );
+  }
+  printf( "Wrote %u rows to %s\n", NUM_ROWS, FILENAME );
+
+  /* Read the table back in chunks and check every value */
+  {
+    UINT4 nread = 0;
+    init_columns( columns );
+    XLAL_CHECK_MAIN( XLALLIGOLwReadTableColumns( FILENAME, TABLE_NAME, columns, NUM_COLUMNS, CHUNK_LENGTH, check_chunk, &nread ) == 0, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( nread == NUM_ROWS, XLAL_EFAILED, "Read %u rows != %u", nread, NUM_ROWS );
+    for ( UINT4 i = 0; i < NUM_COLUMNS; ++i ) {
+      XLAL_CHECK_MAIN( columns[i].data == NULL, XLAL_EFAILED, "Column %s was not freed", columns[i].name );
+    }
+  }
+  printf( "Read back %u rows from %s\n", NUM_ROWS, FILENAME );
+
+  /* Check that a missing required column is an error */
+  {
+    UINT4 nread = 0;
+    int errnum;
+    LIGOLwColumnBuffer missing[NUM_COLUMNS + 1];
+    init_columns( missing );
+    missing[NUM_COLUMNS].name = "missing";
+    missing[NUM_COLUMNS].type = LIGOLW_COLUMN_REAL8;
+    missing[NUM_COLUMNS].required = 1;
+    XLAL_TRY_SILENT( XLALLIGOLwReadTableColumns( FILENAME, TABLE_NAME, missing, NUM_COLUMNS + 1, CHUNK_LENGTH, check_chunk, &nread ), errnum );
+    XLAL_CHECK_MAIN( errnum != 0 && nread == 0, XLAL_EFAILED, "Missing required column was not an error" );
+  }
+  printf( "Missing required column is an error\n" );
+
+  /* Check for memory leaks */
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+
+}
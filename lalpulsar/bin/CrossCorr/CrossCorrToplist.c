@@ -219,6 +219,21 @@ int insert_into_crossCorrBinary_toplist( toplist_t *tl, CrossCorrBinaryOutputEnt
 }
 
 
+/* Inserts all elements of the toplist src into the toplist dst.
+   Returns the number of elements actually inserted. */
+int merge_crossCorrBinary_toplists( toplist_t *dst, toplist_t *src )
+{
+  int inserted = 0;
+  if ( !dst || !src ) {
+    return 0;
+  }
+  for ( size_t i = 0; i < src->elems; i++ ) {
+    inserted += insert_into_toplist( dst, toplist_elem( src, i ) );
+  }
+  return inserted;
+}
+
+
 
 
 /* (q)sort the toplist according to the sorting function. */
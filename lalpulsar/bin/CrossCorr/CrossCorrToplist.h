@@ -74,6 +74,13 @@ extern int insert_into_crossCorr_toplist( toplist_t *list, CrossCorrOutputEntry
 
 extern int insert_into_crossCorrBinary_toplist( toplist_t *list, CrossCorrBinaryOutputEntry line );
 
+/**
+ * Inserts all elements of the toplist src into the toplist dst,
+ * e.g. to merge toplists filled by separate threads.
+ * Returns the number of elements actually inserted.
+ */
+extern int merge_crossCorrBinary_toplists( toplist_t *dst, toplist_t *src );
+
 /**
  * Writes the toplist to an (already open) filepointer
  * Returns the number of written charactes
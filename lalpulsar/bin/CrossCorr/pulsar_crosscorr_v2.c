@@ -24,6 +24,10 @@
 
 #include "config.h"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <lal/UserInput.h>
 #include <lal/SFTfileIO.h>
 #include <lal/LogPrintf.h>
@@ -151,6 +155,24 @@ typedef struct tagConfigVariables {
   REAL8 mismatchMaxThreeD; /**< mismatch used for 3d lattice */
 } ConfigVariables;
 
+/* per-thread data for the resampling loop over orbital templates */
+typedef struct tagCrossCorrResampThreadData {
+  FstatInput *resampFstatInput; /**< F-statistic input used to produce the resampled time series (a thread copy for all but the first thread) */
+  FstatResults *Fstat_results; /**< F-statistic results (unused, but required by XLALComputeFstat()) */
+  MultiCOMPLEX8TimeSeries *multiTimeSeries_SRC_a; /**< resampled time series a(t)x(t) */
+  MultiCOMPLEX8TimeSeries *multiTimeSeries_SRC_b; /**< resampled time series b(t)x(t) */
+  ResampCrossCorrWorkspace *ws; /**< CrossCorr resampling workspace */
+  COMPLEX8 *ws1KFaX_k; /**< holder for detector 1 Fa */
+  COMPLEX8 *ws1KFbX_k; /**< holder for detector 1 Fb */
+  COMPLEX8 *ws2LFaX_k; /**< holder for detector 2 Fa */
+  COMPLEX8 *ws2LFbX_k; /**< holder for detector 2 Fb */
+  REAL8Vector *ccStatVector; /**< cross-correlation statistic over frequency bins */
+  REAL8Vector *evSquaredVector; /**< (E[rho]/h0^2)^2 over frequency bins */
+  REAL8Vector *numeEquivAve; /**< intermediate average statistic over frequency bins */
+  REAL8Vector *numeEquivCirc; /**< intermediate circular statistic over frequency bins */
+  toplist_t *ccToplist; /**< toplist of candidates found by this thread */
+} CrossCorrResampThreadData;
+
 #define TRUE (1==1)
 #define FALSE (1==0)
 #define MAXFILENAMELENGTH 512
@@ -168,10 +190,10 @@ int XLALInitializeConfigVars( ConfigVariables *config, const UserInput_t *uvar )
 int XLALDestroyConfigVars( ConfigVariables *config );
 int GetNextCrossCorrTemplate( BOOLEAN *binaryParamsFlag, BOOLEAN *firstPoint, PulsarDopplerParams *dopplerpos, PulsarDopplerParams *binaryTemplateSpacings, PulsarDopplerParams *minBinaryTemplate, PulsarDopplerParams *maxBinaryTemplate, UINT8 *fCount, UINT8 *aCount, UINT8 *tCount, UINT8 *pCount, UINT8 fSpacingNum, UINT8 aSpacingNum, UINT8 tSpacingNum, UINT8 pSpacingNum, ConfigVariables *config );
 /* int GetNextCrossCorrTemplateResamp(BOOLEAN *binaryParamsFlag, BOOLEAN *firstPoint, PulsarDopplerParams *dopplerpos, PulsarDopplerParams *binaryTemplateSpacings, PulsarDopplerParams *minBinaryTemplate, PulsarDopplerParams *maxBinaryTemplate, UINT8 *fCount, UINT8 *aCount, UINT8 *tCount, UINT8 *pCount, UINT8 fSpacingNum, UINT8 aSpacingNum, UINT8 tSpacingNum, UINT8 pSpacingNum); */
-int GetNextCrossCorrTemplateForResamp( BOOLEAN *binaryParamsFlag, PulsarDopplerParams *dopplerpos, PulsarDopplerParams *binaryTemplateSpacings, PulsarDopplerParams *minBinaryTemplate, PulsarDopplerParams *maxBinaryTemplate, UINT8 *fCount, UINT8 *aCount, UINT8 *tCount, UINT8 *pCount, ConfigVariables *config );
+int GetCrossCorrTemplateForResampIndex( PulsarDopplerParams *dopplerpos, const PulsarDopplerParams *binaryTemplateSpacings, const PulsarDopplerParams *minBinaryTemplate, UINT8 aCount, UINT8 tCount, UINT8 pCount, const ConfigVariables *config );
 int demodLoopCrossCorr( MultiSSBtimes *multiBinaryTimes, MultiSSBtimes *multiSSBTimes, PulsarDopplerParams dopplerpos, BOOLEAN dopplerShiftFlag, PulsarDopplerParams binaryTemplateSpacings, PulsarDopplerParams minBinaryTemplate, PulsarDopplerParams maxBinaryTemplate, UINT8 fCount, UINT8 aCount, UINT8 tCount, UINT8 pCount, UINT8 fSpacingNum, UINT8 aSpacingNum, UINT8 tSpacingNum, UINT8 pSpacingNum, REAL8Vector *shiftedFreqs, UINT4Vector *lowestBins, COMPLEX8Vector *expSignalPhases, REAL8VectorSequence *sincList, UserInput_t uvar, SFTIndexList *sftIndices, MultiSFTVector *inputSFTs, MultiUINT4Vector *badBins, REAL8 Tsft, MultiNoiseWeights *multiWeights, REAL8 ccStat, REAL8 evSquared, REAL8 estSens, REAL8Vector *GammaAve, SFTPairIndexList *sftPairs, CrossCorrBinaryOutputEntry thisCandidate, toplist_t *ccToplist, int DEMODndim, int DEMODdimf, int DEMODdima, int DEMODdimT, int DEMODdimP, gsl_matrix *metric_ij, int *DEMODnumpoints, int *DEMODnumorb, ConfigVariables *config );
 /* int resampLoopCrossCorr(MultiSSBtimes *multiBinaryTimes, MultiSSBtimes *multiSSBTimes, PulsarDopplerParams dopplerpos, BOOLEAN dopplerShiftFlag, PulsarDopplerParams binaryTemplateSpacings, PulsarDopplerParams minBinaryTemplate, PulsarDopplerParams maxBinaryTemplate, UINT8 fCount, UINT8 aCount, UINT8 tCount, UINT8 pCount, UINT8 fSpacingNum, UINT8 aSpacingNum, UINT8 tSpacingNum, UINT8 pSpacingNum, REAL8Vector *shiftedFreqs, UINT4Vector *lowestBins, COMPLEX8Vector *expSignalPhases, REAL8VectorSequence *sincList, UserInput_t uvar, SFTIndexList *sftIndices, MultiSFTVector *inputSFTs, MultiUINT4Vector *badBins, REAL8 Tsft, MultiNoiseWeights *multiWeights, REAL8 ccStat, REAL8 evSquared, REAL8 estSens, REAL8Vector *GammaAve, SFTPairIndexList *sftPairs, CrossCorrBinaryOutputEntry thisCandidate, toplist_t *ccToplist ); */
-int resampForLoopCrossCorr( PulsarDopplerParams dopplerpos, BOOLEAN dopplerShiftGlag, PulsarDopplerParams binaryTemplateSpacings, PulsarDopplerParams minBinaryTemplate, PulsarDopplerParams maxBinaryTemplate, UINT8 fCount, UINT8 aCount, UINT8 tCount, UINT8 pCount, UINT8 fSpacingNum, UINT8 aSpacingNum, UINT8 tSpacingNum, UINT8 pSpacingNum, UserInput_t uvar, MultiNoiseWeights *multiWeights, UINT4 *numSamplesFFT, REAL8Vector *ccStatVector, REAL8Vector *evSquaredVector, REAL8Vector *numeEquivAve, REAL8Vector *numeEquivCirc, REAL8 estSens, REAL8Vector *resampGammaAve, MultiResampSFTPairMultiIndexList *resampMultiPairs, CrossCorrBinaryOutputEntry thisCandidate, toplist_t *ccToplist, REAL8 tShort, ConfigVariables *config );
+int resampForLoopCrossCorr( PulsarDopplerParams dopplerpos, PulsarDopplerParams binaryTemplateSpacings, PulsarDopplerParams minBinaryTemplate, UINT8 fSpacingNum, UINT8 aSpacingNum, UINT8 tSpacingNum, UINT8 pSpacingNum, UserInput_t uvar, MultiNoiseWeights *multiWeights, UINT4 *numSamplesFFT, REAL8Vector *ccStatVector, REAL8Vector *evSquaredVector, REAL8Vector *numeEquivAve, REAL8Vector *numeEquivCirc, REAL8 estSens, REAL8Vector *resampGammaAve, MultiResampSFTPairMultiIndexList *resampMultiPairs, CrossCorrBinaryOutputEntry thisCandidate, toplist_t *ccToplist, REAL8 tShort, ConfigVariables *config );
 int testShortFunctionsBlock( UserInput_t uvar, MultiSFTVector *inputSFTs, REAL8 Tsft, REAL8 resampTshort, SFTIndexList **sftIndices, SFTPairIndexList **sftPairs, REAL8Vector **GammaAve, REAL8Vector **GammaCirc, MultiResampSFTPairMultiIndexList **resampMultiPairs, MultiLALDetector *multiDetectors, MultiDetectorStateSeries **multiStates, MultiDetectorStateSeries **resampMultiStates, MultiNoiseWeights **multiWeights,  MultiLIGOTimeGPSVector **multiTimes, MultiLIGOTimeGPSVector **resampMultiTimes, MultiSSBtimes **multiSSBTimes, REAL8VectorSequence **phaseDerivs, gsl_matrix **g_ij, gsl_vector **eps_i, REAL8 estSens, SkyPosition *skypos, PulsarDopplerParams *dopplerpos, PulsarDopplerParams *thisBinaryTemplate, ConfigVariables config, const DopplerCoordinateSystem coordSys );
 UINT4 pcc_count_csv( CHAR *csvline );
 INT4 XLALFindBadBins( UINT4Vector *badBinData, INT4 binCount, REAL8 flo, REAL8 fhi, REAL8 f0, REAL8 deltaF, UINT4 length ) ;
@@ -1232,7 +1254,7 @@ int main( int argc, char *argv[] )
     // Resampled loop
     XLALDestroyMultiSFTVector( inputSFTs );
 //returns error code if exists
-    if ( ( resampForLoopCrossCorr( dopplerpos, dopplerShiftFlag, binaryTemplateSpacings, minBinaryTemplate, maxBinaryTemplate, fCount, aCount, tCount, pCount, fSpacingNum, aSpacingNum, tSpacingNum, pSpacingNum, uvar, resampMultiWeights, &numSamplesFFT, ccStatVector, numeEquivAve, numeEquivCirc, evSquaredVector, estSens, resampGammaAve, resampMultiPairs, thisCandidate, ccToplist, resampTshort, &config )  != XLAL_SUCCESS ) ) {
+    if ( ( resampForLoopCrossCorr( dopplerpos, binaryTemplateSpacings, minBinaryTemplate, fSpacingNum, aSpacingNum, tSpacingNum, pSpacingNum, uvar, resampMultiWeights, &numSamplesFFT, ccStatVector, numeEquivAve, numeEquivCirc, evSquaredVector, estSens, resampGammaAve, resampMultiPairs, thisCandidate, ccToplist, resampTshort, &config )  != XLAL_SUCCESS ) ) {
       LogPrintf( LOG_CRITICAL, "%s: resampForLoopCrossCorr() failed with errno=%d\n", __func__, xlalErrno );
       XLAL_ERROR( XLAL_EFUNC );
     }
@@ -1908,7 +1930,7 @@ int GetNextCrossCorrTemplate( BOOLEAN *binaryParamsFlag, BOOLEAN *firstPoint, Pu
 /* } */
 
 
-int GetNextCrossCorrTemplateForResamp( BOOLEAN *binaryParamsFlag, PulsarDopplerParams *dopplerpos, PulsarDopplerParams *binaryTemplateSpacings, PulsarDopplerParams *minBinaryTemplate, PulsarDopplerParams *maxBinaryTemplate, UINT8 *fCount, UINT8 *aCount, UINT8 *tCount, UINT8 *pCount, ConfigVariables *config )
+int GetCrossCorrTemplateForResampIndex( PulsarDopplerParams *dopplerpos, const PulsarDopplerParams *binaryTemplateSpacings, const PulsarDopplerParams *minBinaryTemplate, UINT8 aCount, UINT8 tCount, UINT8 pCount, const ConfigVariables *config )
 {
   /* In the future, this could be replaced with a more efficient lattice
    * than this simple cubic */
@@ -1922,35 +1944,23 @@ int GetNextCrossCorrTemplateForResamp( BOOLEAN *binaryParamsFlag, PulsarDopplerP
     return -1;
   }
 
-  if ( maxBinaryTemplate == NULL ) {
-    return -1;
-  }
-
-  /* check spacings not negative */
-
-  /* Always looping over F: this will be subsumed by resampling */
-  *binaryParamsFlag = FALSE;
-  dopplerpos->fkdot[0] = minBinaryTemplate->fkdot[0] + ( *fCount ) * binaryTemplateSpacings->fkdot[0];
-  if ( *fCount == 0 ) {
-    *binaryParamsFlag = TRUE;
-    dopplerpos->asini = minBinaryTemplate->asini + ( *aCount ) * binaryTemplateSpacings->asini;
-    if ( *aCount == 0 ) {
-      dopplerpos->period = minBinaryTemplate->period + ( *pCount ) * binaryTemplateSpacings->period;
-      if ( *pCount == 0 ) {
-        REAL8 nextGPSTime = XLALGPSGetREAL8( &minBinaryTemplate->tp ) + ( *tCount ) *  XLALGPSGetREAL8( &binaryTemplateSpacings->tp );
-        XLALGPSSetREAL8( &dopplerpos->tp, nextGPSTime );
-      }
-      if ( config->dPorbdTascShear != 0 ) {
-        dopplerpos->period +=
-          ( XLALGPSGetREAL8( &dopplerpos->tp )
-            - config->orbitTimeAscCenterShifted )
-          * config->dPorbdTascShear;
-      }
-    }
+  /* Unlike GetNextCrossCorrTemplate(), every orbital parameter is set
+   * from its count, so that templates can be visited in any order */
+  /* Always starting at the lowest F: this will be subsumed by resampling */
+  dopplerpos->fkdot[0] = minBinaryTemplate->fkdot[0];
+  dopplerpos->asini = minBinaryTemplate->asini + aCount * binaryTemplateSpacings->asini;
+  REAL8 nextGPSTime = XLALGPSGetREAL8( &minBinaryTemplate->tp ) + tCount *  XLALGPSGetREAL8( &binaryTemplateSpacings->tp );
+  XLALGPSSetREAL8( &dopplerpos->tp, nextGPSTime );
+  dopplerpos->period = minBinaryTemplate->period + pCount * binaryTemplateSpacings->period;
+  if ( config->dPorbdTascShear != 0 ) {
+    dopplerpos->period +=
+      ( XLALGPSGetREAL8( &dopplerpos->tp )
+        - config->orbitTimeAscCenterShifted )
+      * config->dPorbdTascShear;
   }
   return 0;
 
-} /* end GetNextCrossCorrTemplateForResamp */
+} /* end GetCrossCorrTemplateForResampIndex */
 
 /* Copied from ppe_utils.c by Matt Pitkin */
 
@@ -2340,12 +2350,16 @@ int demodLoopCrossCorr( MultiSSBtimes *multiBinaryTimes, MultiSSBtimes *multiSSB
 /* } /\* end resampLoopCrossCorr *\/ */
 
 /** For-loop function for resampling */
-int resampForLoopCrossCorr( PulsarDopplerParams dopplerpos, BOOLEAN dopplerShiftFlag, PulsarDopplerParams binaryTemplateSpacings, PulsarDopplerParams minBinaryTemplate, PulsarDopplerParams maxBinaryTemplate, UINT8 fCount, UINT8 aCount, UINT8 tCount, UINT8 pCount, UINT8 fSpacingNum, UINT8 aSpacingNum, UINT8 tSpacingNum, UINT8 pSpacingNum, UserInput_t uvar, MultiNoiseWeights *multiWeights, UINT4 *numSamplesFFT, REAL8Vector *ccStatVector, REAL8Vector *evSquaredVector, REAL8Vector *numeEquivAve, REAL8Vector *numeEquivCirc, REAL8 estSens, REAL8Vector *resampGammaAve, MultiResampSFTPairMultiIndexList *resampMultiPairs, CrossCorrBinaryOutputEntry thisCandidate, toplist_t *ccToplist, REAL8 tShort, ConfigVariables *config )
+int resampForLoopCrossCorr( PulsarDopplerParams dopplerpos, PulsarDopplerParams binaryTemplateSpacings, PulsarDopplerParams minBinaryTemplate, UINT8 fSpacingNum, UINT8 aSpacingNum, UINT8 tSpacingNum, UINT8 pSpacingNum, UserInput_t uvar, MultiNoiseWeights *multiWeights, UINT4 *numSamplesFFT, REAL8Vector *ccStatVector, REAL8Vector *evSquaredVector, REAL8Vector *numeEquivAve, REAL8Vector *numeEquivCirc, REAL8 estSens, REAL8Vector *resampGammaAve, MultiResampSFTPairMultiIndexList *resampMultiPairs, CrossCorrBinaryOutputEntry thisCandidate, toplist_t *ccToplist, REAL8 tShort, ConfigVariables *config )
 {
 
 
   /* Prepare Fstat user input and output array, so remember that
    * we should destroy them later */
+  int retn = XLAL_FAILURE;
+  FstatInput *resampFstatInput = NULL;
+  CrossCorrResampThreadData *threadData = NULL;
+  int numThreads = 1;
 
   /* Setup optional arguments */
   FstatOptionalArgs optionalArgs = FstatOptionalArgsDefaults;
@@ -2358,7 +2372,7 @@ int resampForLoopCrossCorr( PulsarDopplerParams dopplerpos, BOOLEAN dopplerShift
   MultiNoiseFloor *injectSqrtSX = NULL;
   optionalArgs.injectSqrtSX = injectSqrtSX;
   if ( uvar.injectionSources != NULL ) {
-    XLAL_CHECK_MAIN( ( injectSources = XLALPulsarParamsFromUserInput( uvar.injectionSources, NULL ) ) != NULL, XLAL_EFUNC );
+    XLAL_CHECK_FAIL( ( injectSources = XLALPulsarParamsFromUserInput( uvar.injectionSources, NULL ) ) != NULL, XLAL_EFUNC );
   }
   optionalArgs.injectSources = injectSources;
   optionalArgs.injectSqrtSX = injectSqrtSX;
@@ -2370,7 +2384,7 @@ int resampForLoopCrossCorr( PulsarDopplerParams dopplerpos, BOOLEAN dopplerShift
    * CrossCorr workspace instead). If the variable is not set, FFTW measure is
    * used, which takes extremely long, because it repeatedly measures the time
    * for an FFT of length equal to Tobs. */
-  XLAL_CHECK( setenv( "LAL_FSTAT_FFT_PLAN_MODE", "ESTIMATE", 1 ) == XLAL_SUCCESS, ENOMEM );
+  XLAL_CHECK_FAIL( setenv( "LAL_FSTAT_FFT_PLAN_MODE", "ESTIMATE", 1 ) == XLAL_SUCCESS, ENOMEM );
 
   /* Prepare Fstat input, containing SFTs and data used overall */
   //LIGOTimeGPS startTimeGPS = {(INT4)uvar.startTime, 0.0};
@@ -2418,100 +2432,199 @@ int resampForLoopCrossCorr( PulsarDopplerParams dopplerpos, BOOLEAN dopplerShift
    * at 128 Dterms implied that the optimum total cost has about Dterms = 8.
    * To be clear, this is not the same issue as the 16 bin buffer.
    */
-  FstatInput *resampFstatInput = NULL;
-  XLAL_CHECK( ( ( resampFstatInput ) = XLALCreateFstatInput( config->catalog, fCoverMin, fCoverMax, dFreq, config->edat, &optionalArgs ) ) != NULL, XLAL_EFUNC );
+  /* The orbital templates are split between threads. The F-statistic input
+   * (SFTs converted into detector-frame time series) is created once; each
+   * further thread gets a thread copy of it, which shares this read-only data
+   * but has its own resampled time series and FFT workspace. Each thread also
+   * needs its own CrossCorr workspace, statistic vectors and toplist; the
+   * pair lists, noise weights and curly-G amplitudes are shared read-only.
+   * The per-thread toplists are merged into ccToplist at the end. */
+#ifdef _OPENMP
+  numThreads = omp_get_max_threads();
+#endif
+  const UINT8 numOrbTemplates = ( tSpacingNum + 1 ) * ( pSpacingNum + 1 ) * ( aSpacingNum + 1 );
+  if ( ( UINT8 ) numThreads > numOrbTemplates ) {
+    numThreads = ( int ) numOrbTemplates;
+  }
+  LogPrintf( LOG_NORMAL, "Evaluating %" LAL_UINT8_FORMAT " orbital templates using %d thread(s)\n", numOrbTemplates, numThreads );
+
+  /* Thread copies are only supported by the generic resampling method */
+  if ( numThreads > 1 ) {
+    optionalArgs.FstatMethod = FMETHOD_RESAMP_GENERIC;
+  }
+
+  /* Prepare Fstat input, containing SFTs and data used overall */
+  XLAL_CHECK_FAIL( ( resampFstatInput = XLALCreateFstatInput( config->catalog, fCoverMin, fCoverMax, dFreq, config->edat, &optionalArgs ) ) != NULL, XLAL_EFUNC );
 
   /* Free injection parameters if used */
   if ( optionalArgs.injectSources ) {
     XLALDestroyPulsarParamsVector( optionalArgs.injectSources );
+    optionalArgs.injectSources = NULL;
   }
+
+  XLAL_CHECK_FAIL( ( threadData = XLALCalloc( numThreads, sizeof( *threadData ) ) ) != NULL, XLAL_ENOMEM );
+
   /* Set the number of frequencies to look at in resamp,
    * adding one since we are counting from zero */
   UINT8 fCountResamp = fSpacingNum + 1; // Number of frequencies
-
-  /* Take as much preperation as possible outside the hotloop */
-  FstatResults *Fstat_results = NULL;
-  FstatResults **Fstats = &( Fstat_results );
   const UINT4 numFreqBins = fCountResamp;
+  XLAL_CHECK_FAIL( numFreqBins > 0, XLAL_EINVAL );
   /* Only compute the resampled time series*/
   const FstatQuantities whatToCompute = FSTATQ_NONE;
-  XLAL_CHECK( numFreqBins > 0, XLAL_EINVAL );
-  if ( *( Fstats ) == NULL ) {
-    XLAL_CHECK( ( ( *Fstats ) = XLALCalloc( 1, sizeof( **Fstats ) ) ) != NULL, XLAL_ENOMEM );
-  }
-  ( *Fstats )->dFreq = 1.0 / Tobs;
-  ( *Fstats )->numFreqBins = numFreqBins;
-  XLAL_INIT_MEM( ( *Fstats )->detectorNames );
-  ( *Fstats )->whatWasComputed = whatToCompute;
-  /* The aim of the F-stat calls: the time series, a(t)x(t) and b(t)x(t) */
-  MultiCOMPLEX8TimeSeries *multiTimeSeries_SRC_a = NULL;
-  MultiCOMPLEX8TimeSeries *multiTimeSeries_SRC_b = NULL;
-
-  ResampCrossCorrWorkspace *ws = NULL;
-  COMPLEX8 *ws1KFaX_k = NULL;
-  COMPLEX8 *ws1KFbX_k = NULL;
-  COMPLEX8 *ws2LFaX_k = NULL;
-  COMPLEX8 *ws2LFbX_k = NULL;
   REAL8 Tcoh = 2 * resampMultiPairs->maxLag + tShort;
-  if ( ( XLALCreateCrossCorrWorkspace( &ws, &ws1KFaX_k, &ws1KFbX_k, &ws2LFaX_k, &ws2LFbX_k, &multiTimeSeries_SRC_a, &multiTimeSeries_SRC_b, binaryTemplateSpacings, resampFstatInput, numFreqBins, Tcoh, uvar.treatWarningsAsErrors ) != XLAL_SUCCESS ) ) {
-    LogPrintf( LOG_CRITICAL, "%s: XLALCreateCrossCorrWorkspace() failed with errno=%d\n", __func__, xlalErrno );
-    XLAL_ERROR( XLAL_EFUNC );
-  }
 
-  /* printf( "numSamplesFFT: %u\n", ws->numSamplesFFT ); */
-  *numSamplesFFT = ws->numSamplesFFT;
-
-  for ( tCount = 0; tCount <= tSpacingNum; tCount++ ) {
-    for ( pCount = 0; pCount <= pSpacingNum; pCount++ ) {
-      for ( aCount = 0; aCount <= aSpacingNum; aCount++ ) {
+  /* Take as much preperation as possible outside the hotloop */
+  for ( int n = 0; n < numThreads; ++n ) {
+    CrossCorrResampThreadData *td = &threadData[n];
 
-        fCount = 0; /* over orb params, reset to zero b/c output loop increments */
+    /* Thread 0 uses the shared Fstat input, the others a thread copy of it */
+    if ( n == 0 ) {
+      td->resampFstatInput = resampFstatInput;
+    } else {
+      XLAL_CHECK_FAIL( XLALFstatInputThreadCopy( &td->resampFstatInput, resampFstatInput ) == XLAL_SUCCESS, XLAL_EFUNC );
+    }
 
-        if ( ( GetNextCrossCorrTemplateForResamp( &dopplerShiftFlag, &dopplerpos, &binaryTemplateSpacings, &minBinaryTemplate, &maxBinaryTemplate, &fCount, &aCount, &tCount, &pCount, config ) )  != 0 ) {
-          LogPrintf( LOG_CRITICAL, "%s: XLALGetNextCrossCorrTemplateForResamp() failed with errno=%d\n", __func__, xlalErrno );
-          XLAL_ERROR( XLAL_EFUNC );
-        }
+    XLAL_CHECK_FAIL( ( td->Fstat_results = XLALCalloc( 1, sizeof( *td->Fstat_results ) ) ) != NULL, XLAL_ENOMEM );
+    td->Fstat_results->dFreq = 1.0 / Tobs;
+    td->Fstat_results->numFreqBins = numFreqBins;
+    XLAL_INIT_MEM( td->Fstat_results->detectorNames );
+    td->Fstat_results->whatWasComputed = whatToCompute;
 
-        /* Call ComputeFstat to make the resampled time series; given the
-         * "none" whatToCompute flag, will skip the F-stat computation */
-        XLAL_CHECK( ( XLALComputeFstat( Fstats, resampFstatInput, &dopplerpos, fCountResamp, whatToCompute ) == XLAL_SUCCESS ), XLAL_EFUNC );
-        /* Return a resampled time series */
-        XLAL_CHECK( ( XLALExtractResampledTimeseries( &multiTimeSeries_SRC_a, &multiTimeSeries_SRC_b, resampFstatInput ) == XLAL_SUCCESS ), XLAL_EFUNC );
+    /* The aim of the F-stat calls: the time series, a(t)x(t) and b(t)x(t) */
+    XLAL_CHECK_FAIL( XLALCreateCrossCorrWorkspace( &td->ws, &td->ws1KFaX_k, &td->ws1KFbX_k, &td->ws2LFaX_k, &td->ws2LFbX_k, &td->multiTimeSeries_SRC_a, &td->multiTimeSeries_SRC_b, binaryTemplateSpacings, td->resampFstatInput, numFreqBins, Tcoh, uvar.treatWarningsAsErrors ) == XLAL_SUCCESS, XLAL_EFUNC, "XLALCreateCrossCorrWorkspace() failed with errno=%d", xlalErrno );
 
-        /* Calculate the CrossCorr rho statistic using resampling */
-        if ( ( XLALCalculatePulsarCrossCorrStatisticResamp( ccStatVector, evSquaredVector, numeEquivAve, numeEquivCirc, resampGammaAve, resampMultiPairs, multiWeights, &binaryTemplateSpacings, &dopplerpos, multiTimeSeries_SRC_a, multiTimeSeries_SRC_b, ws, ws1KFaX_k, ws1KFbX_k, ws2LFaX_k, ws2LFbX_k )  != XLAL_SUCCESS ) ) {
-          LogPrintf( LOG_CRITICAL, "%s: XLALCalculatePulsarCrossCorrStatisticResamp() failed with errno=%d\n", __func__, xlalErrno );
-          XLAL_ERROR( XLAL_EFUNC );
+    /* Thread 0 uses the caller's output vectors and toplist */
+    if ( n == 0 ) {
+      td->ccStatVector = ccStatVector;
+      td->evSquaredVector = evSquaredVector;
+      td->numeEquivAve = numeEquivAve;
+      td->numeEquivCirc = numeEquivCirc;
+      td->ccToplist = ccToplist;
+    } else {
+      XLAL_CHECK_FAIL( ( td->ccStatVector = XLALCreateREAL8Vector( ccStatVector->length ) ) != NULL, XLAL_EFUNC );
+      XLAL_CHECK_FAIL( ( td->evSquaredVector = XLALCreateREAL8Vector( evSquaredVector->length ) ) != NULL, XLAL_EFUNC );
+      XLAL_CHECK_FAIL( ( td->numeEquivAve = XLALCreateREAL8Vector( numeEquivAve->length ) ) != NULL, XLAL_EFUNC );
+      XLAL_CHECK_FAIL( ( td->numeEquivCirc = XLALCreateREAL8Vector( numeEquivCirc->length ) ) != NULL, XLAL_EFUNC );
+      XLAL_CHECK_FAIL( create_crossCorrBinary_toplist( &td->ccToplist, uvar.numCand ) == 0, XLAL_ENOMEM );
+    }
+  }
+
+  /* printf( "numSamplesFFT: %u\n", threadData[0].ws->numSamplesFFT ); */
+  *numSamplesFFT = threadData[0].ws->numSamplesFFT;
+
+  /* Make sure the sin/cos lookup table is initialised before entering threads */
+  XLALSinCosLUTInit();
+
+  /* Loop over orbital templates; schedule is static so that the assignment
+   * of templates to threads, and hence the merged toplist, is reproducible */
+  int errnum = 0;
+  #pragma omp parallel for schedule(static) num_threads(numThreads)
+  for ( UINT8 orbIndex = 0; orbIndex < numOrbTemplates; ++orbIndex ) {
+    int thread = 0;
+#ifdef _OPENMP
+    thread = omp_get_thread_num();
+#endif
+    CrossCorrResampThreadData *td = &threadData[thread];
+
+    int thisErrnum;
+    #pragma omp atomic read
+    thisErrnum = errnum;
+    if ( thisErrnum != 0 ) {
+      continue;
+    }
+
+    /* Same ordering as the nested loops: tCount slowest, aCount fastest */
+    const UINT8 aCount = orbIndex % ( aSpacingNum + 1 );
+    const UINT8 pCount = ( orbIndex / ( aSpacingNum + 1 ) ) % ( pSpacingNum + 1 );
+    const UINT8 tCount = orbIndex / ( ( aSpacingNum + 1 ) * ( pSpacingNum + 1 ) );
+
+    PulsarDopplerParams orbDopplerpos = dopplerpos;
+    if ( GetCrossCorrTemplateForResampIndex( &orbDopplerpos, &binaryTemplateSpacings, &minBinaryTemplate, aCount, tCount, pCount, config ) != 0 ) {
+      LogPrintf( LOG_CRITICAL, "%s: GetCrossCorrTemplateForResampIndex() failed with errno=%d\n", __func__, xlalErrno );
+      #pragma omp atomic write
+      errnum = XLAL_EFUNC;
+      continue;
+    }
+
+    /* Call ComputeFstat to make the resampled time series; given the
+     * "none" whatToCompute flag, will skip the F-stat computation */
+    if ( XLALComputeFstat( &td->Fstat_results, td->resampFstatInput, &orbDopplerpos, fCountResamp, whatToCompute ) != XLAL_SUCCESS
+         || XLALExtractResampledTimeseries( &td->multiTimeSeries_SRC_a, &td->multiTimeSeries_SRC_b, td->resampFstatInput ) != XLAL_SUCCESS ) {
+      LogPrintf( LOG_CRITICAL, "%s: failed to compute resampled timeseries with errno=%d\n", __func__, xlalErrno );
+      #pragma omp atomic write
+      errnum = XLAL_EFUNC;
+      continue;
+    }
+
+    /* Calculate the CrossCorr rho statistic using resampling */
+    if ( ( XLALCalculatePulsarCrossCorrStatisticResamp( td->ccStatVector, td->evSquaredVector, td->numeEquivAve, td->numeEquivCirc, resampGammaAve, resampMultiPairs, multiWeights, &binaryTemplateSpacings, &orbDopplerpos, td->multiTimeSeries_SRC_a, td->multiTimeSeries_SRC_b, td->ws, td->ws1KFaX_k, td->ws1KFbX_k, td->ws2LFaX_k, td->ws2LFbX_k )  != XLAL_SUCCESS ) ) {
+      LogPrintf( LOG_CRITICAL, "%s: XLALCalculatePulsarCrossCorrStatisticResamp() failed with errno=%d\n", __func__, xlalErrno );
+      #pragma omp atomic write
+      errnum = XLAL_EFUNC;
+      continue;
+    }
+    CrossCorrBinaryOutputEntry orbCandidate = thisCandidate;
+    for ( UINT8 fCount = 0; fCount <= fSpacingNum; fCount++ ) {
+      /* New, adapted for resampling:
+       * fill candidate struct and insert into toplist if necessary */
+      orbCandidate.freq = orbDopplerpos.fkdot[0] + fCount * binaryTemplateSpacings.fkdot[0];
+      orbCandidate.tp = XLALGPSGetREAL8( &orbDopplerpos.tp );
+      orbCandidate.argp = orbDopplerpos.argp;
+      orbCandidate.asini = orbDopplerpos.asini;
+      orbCandidate.ecc = orbDopplerpos.ecc;
+      orbCandidate.period = orbDopplerpos.period;
+      orbCandidate.rho = td->ccStatVector->data[fCount];
+      orbCandidate.evSquared = td->evSquaredVector->data[fCount];
+      orbCandidate.estSens = estSens;
+      insert_into_crossCorrBinary_toplist( td->ccToplist, orbCandidate );
+    } // end fCount for writing toplist
+  } /* end loop over orbital templates */
+  XLAL_CHECK_FAIL( errnum == 0, errnum, "Evaluation of orbital templates failed" );
+
+  /* Merge per-thread toplists, in thread order, into the output toplist */
+  for ( int n = 1; n < numThreads; ++n ) {
+    merge_crossCorrBinary_toplists( ccToplist, threadData[n].ccToplist );
+  }
+
+  retn = XLAL_SUCCESS;
+
+XLAL_FAIL:
+  if ( threadData != NULL ) {
+    for ( int n = 0; n < numThreads; ++n ) {
+      CrossCorrResampThreadData *td = &threadData[n];
+      if ( td->ws != NULL ) {
+        XLALDestroyResampCrossCorrWorkspace( td->ws );
+      }
+      fftw_free( td->ws1KFaX_k );
+      fftw_free( td->ws1KFbX_k );
+      fftw_free( td->ws2LFaX_k );
+      fftw_free( td->ws2LFbX_k );
+
+      /* Destroy resampled input and time structures, which use much memory */
+      XLALDestroyFstatResults( td->Fstat_results );
+
+      if ( n > 0 ) {
+        /* Destroy thread copy of Fstat input, before the shared one */
+        XLALDestroyFstatInput( td->resampFstatInput );
+        XLALDestroyREAL8Vector( td->ccStatVector );
+        XLALDestroyREAL8Vector( td->evSquaredVector );
+        XLALDestroyREAL8Vector( td->numeEquivAve );
+        XLALDestroyREAL8Vector( td->numeEquivCirc );
+        if ( td->ccToplist != NULL ) {
+          free_crossCorr_toplist( &td->ccToplist );
         }
-        for ( fCount = 0; fCount <= fSpacingNum; fCount++ ) {
-          /* New, adapted for resampling:
-           * fill candidate struct and insert into toplist if necessary */
-          thisCandidate.freq = dopplerpos.fkdot[0] + fCount * binaryTemplateSpacings.fkdot[0];
-          thisCandidate.tp = XLALGPSGetREAL8( &dopplerpos.tp );
-          thisCandidate.argp = dopplerpos.argp;
-          thisCandidate.asini = dopplerpos.asini;
-          thisCandidate.ecc = dopplerpos.ecc;
-          thisCandidate.period = dopplerpos.period;
-          thisCandidate.rho = ccStatVector->data[fCount];
-          thisCandidate.evSquared = evSquaredVector->data[fCount];
-          thisCandidate.estSens = estSens;
-          insert_into_crossCorrBinary_toplist( ccToplist, thisCandidate );
-        } // end fCount for writing toplist
-      } // end aCount
-    } // end pCount
-  } /* end tCount, and with it, for loop over templates */
-
-  XLALDestroyResampCrossCorrWorkspace( ws );
-  fftw_free( ws1KFaX_k );
-  fftw_free( ws1KFbX_k );
-  fftw_free( ws2LFaX_k );
-  fftw_free( ws2LFbX_k );
+      }
+    }
+    XLALFree( threadData );
+  }
 
   /* Destroy Fstat input */
   XLALDestroyFstatInput( resampFstatInput );
-  /* Destroy resampled input and time structures, which use much memory */
-  XLALDestroyFstatResults( Fstat_results );
-  return 0;
+  if ( optionalArgs.injectSources ) {
+    XLALDestroyPulsarParamsVector( optionalArgs.injectSources );
+  }
+
+  return retn;
 } /* end resampForLoopCrossCorr */
 
 int testShortFunctionsBlock( UserInput_t uvar, MultiSFTVector *inputSFTs, REAL8 Tsft, REAL8 resampTshort, SFTIndexList **sftIndices, SFTPairIndexList **sftPairs, REAL8Vector **GammaAve, REAL8Vector **GammaCirc, MultiResampSFTPairMultiIndexList **resampMultiPairs, MultiLALDetector *multiDetectors, MultiDetectorStateSeries **multiStates, MultiDetectorStateSeries **resampMultiStates, MultiNoiseWeights **multiWeights, MultiLIGOTimeGPSVector **multiTimes, MultiLIGOTimeGPSVector **resampMultiTimes, MultiSSBtimes **multiSSBTimes, REAL8VectorSequence **phaseDerivs, gsl_matrix **g_ij, gsl_vector **eps_i, REAL8 estSens, SkyPosition *skyPos, PulsarDopplerParams *dopplerpos, PulsarDopplerParams *thisBinaryTemplate, ConfigVariables config, const DopplerCoordinateSystem coordSys )
@@ -85,5 +85,31 @@ else
     echo "OK."
 fi
 
+## ---------- Run PulsarCrossCorr_v2 with resampling, on one and two threads ----------
+for nthreads in 1 2; do
+    cmdline="OMP_NUM_THREADS=$nthreads $pcc_code $pcc_CL --resamp=TRUE --numCand=100 --toplistFilename=./toplist_crosscorr_resamp_${nthreads}.dat"
+    echo $cmdline
+    echo -n "Running ${pcc_code} ... "
+    if ! tmp=`eval $cmdline`; then
+        echo "FAILED:"
+        echo $cmdline
+        exit 1;
+    else
+        echo "OK."
+    fi
+done
+
+## ---------- Check that the multi-threaded toplist matches ----------
+echo -n "Comparing single- and multi-threaded resampling toplists ... "
+sort ./toplist_crosscorr_resamp_1.dat > ./toplist_crosscorr_resamp_1.sorted
+sort ./toplist_crosscorr_resamp_2.dat > ./toplist_crosscorr_resamp_2.sorted
+if ! cmp ./toplist_crosscorr_resamp_1.sorted ./toplist_crosscorr_resamp_2.sorted; then
+    echo "FAILED: toplists differ"
+    exit 1
+else
+    echo "OK."
+fi
+
 rm -rf ./sfts/
 rm -f ./toplist_crosscorr.dat
+rm -f ./toplist_crosscorr_resamp_*
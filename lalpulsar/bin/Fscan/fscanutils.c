@@ -22,6 +22,10 @@
 * \ingroup lalpulsar_bin_Fscan
 */
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <lal/SFTfileIO.h>
 #include <lal/LALStdio.h>
 
@@ -61,3 +65,61 @@ SFTtype *extract_one_sft( const SFTCatalog *full_catalog, const LIGOTimeGPS star
 
   return sft;
 }
+
+/* Number of SFTs to extract and process together with extract_sft_block(): enough to keep all threads busy,
+   while bounding the memory used to a few SFTs per thread */
+UINT4 sft_block_size( void )
+{
+#ifdef _OPENMP
+  return 4 * omp_get_max_threads();
+#else
+  return 1;
+#endif
+}
+
+/* Extract a block of SFTs from an SFTCatalog concurrently: the SFTs indicated by the GPS start times of entries
+   first to first+num-1 of epoch_catalog, with band f_min to f_max. If allow_missing is true, SFTs which could not
+   be extracted are returned as NULL; otherwise it is an error */
+int extract_sft_block( SFTtype **sfts, const SFTCatalog *full_catalog, const SFTCatalog *epoch_catalog, const UINT4 first, const UINT4 num, const REAL8 f_min, const REAL8 f_max, const BOOLEAN allow_missing )
+{
+  XLAL_CHECK( sfts != NULL, XLAL_EFAULT );
+  XLAL_CHECK( full_catalog != NULL, XLAL_EFAULT );
+  XLAL_CHECK( epoch_catalog != NULL, XLAL_EFAULT );
+  XLAL_CHECK( first + num <= epoch_catalog->length, XLAL_EINVAL );
+
+  // Silence errors from SFTs which cannot be extracted, as XLAL_TRY_SILENT() would; the debug level is global, so
+  // it is changed once around the parallel region rather than by each thread
+  const int saveDebugLevel = lalDebugLevel;
+  XLALClobberDebugLevel( saveDebugLevel & ~( LALERRORBIT | LALWARNINGBIT | LALINFOBIT | LALTRACEBIT ) );
+
+  int errflag = 0;
+  #pragma omp parallel for schedule(dynamic)
+  for ( UINT4 k = 0; k < num; ++k ) {
+    int errnum = 0;
+    XLAL_TRY( sfts[k] = extract_one_sft( full_catalog, epoch_catalog->data[first + k].header.epoch, f_min, f_max ), errnum );
+    if ( errnum != 0 ) {
+      sfts[k] = NULL;
+      if ( !allow_missing ) {
+        #pragma omp atomic write
+        errflag = errnum;
+      }
+    }
+  }
+
+  XLALClobberDebugLevel( saveDebugLevel );
+
+  if ( errflag != 0 ) {
+    for ( UINT4 k = 0; k < num; ++k ) {
+      if ( sfts[k] == NULL ) {
+        XLALPrintError( "%s: failed to extract SFT at time %d, [%.9f, %.9f) Hz\n", __func__, epoch_catalog->data[first + k].header.epoch.gpsSeconds, f_min, f_max );
+      }
+    }
+    for ( UINT4 k = 0; k < num; ++k ) {
+      XLALDestroySFT( sfts[k] );
+      sfts[k] = NULL;
+    }
+    XLAL_ERROR( errflag );
+  }
+
+  return XLAL_SUCCESS;
+}
@@ -26,5 +26,7 @@
 #define __FSCANUTILS_H__
 
 SFTtype *extract_one_sft( const SFTCatalog *full_catalog, const LIGOTimeGPS starttime, const REAL8 f_min, const REAL8 f_max );
+UINT4 sft_block_size( void );
+int extract_sft_block( SFTtype **sfts, const SFTCatalog *full_catalog, const SFTCatalog *epoch_catalog, const UINT4 first, const UINT4 num, const REAL8 f_min, const REAL8 f_max, const BOOLEAN allow_missing );
 
 #endif
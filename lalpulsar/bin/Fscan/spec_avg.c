@@ -157,23 +157,37 @@ int main( int argc, char **argv )
   // Need to save the f0 and deltaF from the first SFT
   REAL8 f0 = 0, deltaF = 0;
 
-  // Initialize a temporary frequency series for XLALNormalizeSFT
-  REAL8FrequencySeries *rngmed = NULL;
+  // SFTs are processed in blocks: the SFTs in each block are extracted, and their spectrogram rows
+  // computed and normalized, concurrently; the spectrogram rows and averages are then written/accumulated
+  // in SFT order. Only one block of SFTs is held in memory at any time.
+  const UINT4 blocksize = sft_block_size();
+  SFTtype **sfts = NULL;
+  REAL8FrequencySeries **rngmeds = NULL;
+  REAL8 **specrows = NULL;
+  UINT4 numSpecCols = 0;
+  XLAL_CHECK_MAIN( ( sfts = XLALCalloc( blocksize, sizeof( *sfts ) ) ) != NULL, XLAL_ENOMEM );
+  XLAL_CHECK_MAIN( ( rngmeds = XLALCalloc( blocksize, sizeof( *rngmeds ) ) ) != NULL, XLAL_ENOMEM );
+  XLAL_CHECK_MAIN( ( specrows = XLALCalloc( blocksize, sizeof( *specrows ) ) ) != NULL, XLAL_ENOMEM );
 
   printf( "Looping over SFTs to compute average spectra and spectrograms\n" );
-  for ( UINT4 j = 0; j < catalog->length; j++ ) {
-    fprintf( stderr, "Extracting SFT %d...\n", j );
+  for ( UINT4 j0 = 0; j0 < catalog->length; j0 += blocksize ) {
+    const UINT4 numBlock = ( catalog->length - j0 < blocksize ) ? catalog->length - j0 : blocksize;
+    fprintf( stderr, "Extracting SFTs %d to %d...\n", j0, j0 + numBlock - 1 );
 
-    //Extract one SFT at a time from the catalog
-    //we do this by using a catalog timeslice to get just the current SFT
-    XLAL_CHECK_MAIN( ( sft = extract_one_sft( catalog, catalog->data[j].header.epoch, f_min, f_max ) ) != NULL, XLAL_EFUNC );
+    //Extract a block of SFTs from the catalog
+    //we do this by using a catalog timeslice to get just each SFT
+    XLAL_CHECK_MAIN( extract_sft_block( sfts, catalog, catalog, j0, numBlock, f_min, f_max, 0 ) == XLAL_SUCCESS, XLAL_EFUNC );
 
-    //Make sure the SFTs are the same length as what we're expecting from user input
-    XLAL_CHECK_MAIN( fabs( timebaseline * sft->deltaF - 1.0 ) <= 10.*LAL_REAL8_EPS, XLAL_EINVAL, "Expected SFTs with length %f but got %f", timebaseline, 1 / sft->deltaF );
+    for ( UINT4 k = 0; k < numBlock; k++ ) {
+      //Make sure the SFTs are the same length as what we're expecting from user input
+      XLAL_CHECK_MAIN( fabs( timebaseline * sfts[k]->deltaF - 1.0 ) <= 10.*LAL_REAL8_EPS, XLAL_EINVAL, "Expected SFTs with length %f but got %f", timebaseline, 1 / sfts[k]->deltaF );
+    }
 
-    // first time through the loop need to allocate timeavg, rngmed
+    // first time through the loop need to allocate timeavg, rngmeds, specrows
     // save some scalar values
-    if ( j == 0 ) {
+    if ( j0 == 0 ) {
+      sft = sfts[0];
+
       // Allocate the vector for the normalized data to be averaged together
       XLAL_CHECK_MAIN( ( timeavg = XLALCreateREAL4Vector( sft->data->length ) ) != NULL, XLAL_EFUNC );
       memset( timeavg->data, 0, sizeof( REAL4 )*timeavg->length );
@@ -187,33 +201,23 @@ int main( int argc, char **argv )
       } else {
         NumBinsAvg = ( UINT4 )spectrogram_blocksize;
       }
+      numSpecCols = sft->data->length / NumBinsAvg;
 
       f0 = sft->f0;
       deltaF = sft->deltaF;
 
-      // Allocate frequency series for XLALNormalizeSFT; meta data doesn't matter
-      XLAL_CHECK_MAIN( ( rngmed = XLALCreateREAL8FrequencySeries( sft->name, &catalog->data[j].header.epoch, f0, deltaF, &sft->sampleUnits, sft->data->length ) ) != NULL, XLAL_EFUNC );
+      // Allocate frequency series for XLALNormalizeSFT, and spectrogram rows, for each SFT in a block; meta data doesn't matter
+      for ( UINT4 k = 0; k < blocksize; k++ ) {
+        XLAL_CHECK_MAIN( ( rngmeds[k] = XLALCreateREAL8FrequencySeries( sft->name, &catalog->data[0].header.epoch, f0, deltaF, &sft->sampleUnits, sft->data->length ) ) != NULL, XLAL_EFUNC );
+        XLAL_CHECK_MAIN( ( specrows[k] = XLALCalloc( numSpecCols > 0 ? numSpecCols : 1, sizeof( REAL8 ) ) ) != NULL, XLAL_ENOMEM );
+      }
 
       fprintf( stderr, "SFTs = %d\tSFT bins = %d\tf0 = %f\n", catalog->length, sft->data->length, sft->f0 );
-    }
-
-    // GPS time of the current SFT and print to file
-    cur_epoch = sft->epoch.gpsSeconds;
-    fprintf( fp2, "%d\t%d\n", timestamps->length, cur_epoch );
-
-    // Get the current UTC time from the GPS seconds of the current SFT and print to file
-    XLAL_CHECK_MAIN( XLALGPSToUTC( &date, cur_epoch ) != NULL, XLAL_EFUNC );
-    fprintf( fp4, "%d\t %i\t %i\t %i\t %i\t %i\t %i\n", timestamps->length, ( date.tm_year + 1900 ), date.tm_mon + 1, date.tm_mday, date.tm_hour, date.tm_min, date.tm_sec );
-
-    // Here is where the timestamps vector is resized and this epoch is recorded
-    XLAL_CHECK_MAIN( XLALResizeINT4Vector( timestamps, timestamps->length + 1 ) != NULL, XLAL_EFUNC );
-    timestamps->data[timestamps->length - 1] = cur_epoch;
 
-    /* Spectrogram (course grained) */
-    // First line will be the frequencies of the spectrogram indicating what is in each column
-    // The first value is 0 simply because column 0 are the GPS times. It keeps the entire
-    // output numeric, in case that matters.
-    if ( j == 0 ) {
+      /* Spectrogram (course grained) */
+      // First line will be the frequencies of the spectrogram indicating what is in each column
+      // The first value is 0 simply because column 0 are the GPS times. It keeps the entire
+      // output numeric, in case that matters.
       UINT4 step = 0;
       for ( UINT4 i = NumBinsAvg - 1; i < sft->data->length; i += NumBinsAvg ) {
         if ( step == 0 ) {
@@ -225,62 +229,98 @@ int main( int argc, char **argv )
       fprintf( fp, "\n" );
     }
 
-    // Loop over the number of bins in each SFT, jumping by the average number
-    // Start at the highest bin index and average down. This avoids running off the end of the SFT
-    for ( UINT4 i = NumBinsAvg - 1; i < sft->data->length; i += NumBinsAvg ) {
-      // First value in each row is the GPS time
-      if ( i == NumBinsAvg - 1 ) {
-        fprintf( fp, "%i\t", sft->epoch.gpsSeconds );
+    // Compute the spectrogram row of each SFT, then normalize the SFT
+    int errflag = 0;
+    #pragma omp parallel for schedule(dynamic)
+    for ( UINT4 k = 0; k < numBlock; k++ ) {
+      const SFTtype *this_sft = sfts[k];
+
+      // Loop over the number of bins in each SFT, jumping by the average number
+      // Start at the highest bin index and average down. This avoids running off the end of the SFT
+      for ( UINT4 i = NumBinsAvg - 1, step = 0; i < this_sft->data->length; i += NumBinsAvg, step++ ) {
+        REAL8 avg = 0.0;
+        for ( UINT4 n = 0; n < NumBinsAvg; n++ ) {
+          const REAL8 re = ( REAL8 )crealf( this_sft->data->data[i - n] );
+          const REAL8 im = ( REAL8 )cimagf( this_sft->data->data[i - n] );
+          avg += 2.0 * ( re * re + im * im ) / ( REAL8 )timebaseline;
+        }
+        specrows[k][step] = sqrt( avg / ( REAL8 )NumBinsAvg ); /* 06/15/2017 gam; then take sqrt here. */
       }
-      REAL8 avg = 0.0;
-      for ( UINT4 k = 0; k < NumBinsAvg; k++ ) {
-        const REAL8 re = ( REAL8 )crealf( sft->data->data[i - k] );
-        const REAL8 im = ( REAL8 )cimagf( sft->data->data[i - k] );
-        avg += 2.0 * ( re * re + im * im ) / ( REAL8 )timebaseline;
+
+      /* Normalized, averaged spectra */
+      // Normalize the SFT
+      if ( XLALNormalizeSFT( rngmeds[k], sfts[k], blocksRngMed, 0.0 ) != XLAL_SUCCESS ) {
+        #pragma omp atomic write
+        errflag = 1;
       }
-      fprintf( fp, "%e\t", sqrt( avg / ( REAL8 )NumBinsAvg ) ); /* 06/15/2017 gam; then take sqrt here. */
     }
-    fprintf( fp, "\n" );
-
-    // Fill in gaps where there is no SFT data with zeros
-    if ( j < ( catalog->length - 1 ) ) { /*in all cases except when we are examining the last sft, check that there is no gap to the next sft*/
-      /*test to see if the next SFT immediately follows, if not entries in the matrix until there is one*/
-      while ( cur_epoch + timebaseline < catalog->data[j + 1].header.epoch.gpsSeconds ) {
-        cur_epoch += timebaseline;
-        fprintf( fp2, "%d.\t%d\n", timestamps->length, cur_epoch );
-
-        XLAL_CHECK_MAIN( XLALGPSToUTC( &date, cur_epoch ) != NULL, XLAL_EFUNC );
-        fprintf( fp4, "%d\t %i\t %i\t %i\t %i\t %i\t %i\n", timestamps->length, ( date.tm_year + 1900 ), date.tm_mon + 1, date.tm_mday, date.tm_hour, date.tm_min, date.tm_sec );
-        XLAL_CHECK_MAIN( XLALResizeINT4Vector( timestamps, timestamps->length + 1 ) != NULL, XLAL_EFUNC );
-        timestamps->data[timestamps->length - 1] = cur_epoch;
-
-        for ( UINT4 i = NumBinsAvg - 1; i < sft->data->length; i += NumBinsAvg ) {
-          // First value in each row is the GPS time
-          if ( i == NumBinsAvg - 1 ) {
-            fprintf( fp, "%i\t", cur_epoch );
-          }
-          REAL8 avg = 0.0;
-          fprintf( fp, "%e\t", avg );
+    XLAL_CHECK_MAIN( errflag == 0, XLAL_EFUNC );
+
+    // Accumulate the normalized power; the frequency bins are independent,
+    // and the SFTs are added to each bin in order
+    #pragma omp parallel for schedule(static)
+    for ( UINT4 i = 0; i < timeavg->length; i++ ) {
+      for ( UINT4 k = 0; k < numBlock; k++ ) {
+        const REAL8 re = ( REAL8 )crealf( sfts[k]->data->data[i] );
+        const REAL8 im = ( REAL8 )cimagf( sfts[k]->data->data[i] );
+        timeavg->data[i] += re * re + im * im;
+      }
+    }
+
+    for ( UINT4 k = 0; k < numBlock; k++ ) {
+      const UINT4 j = j0 + k;
+      sft = sfts[k];
+
+      // GPS time of the current SFT and print to file
+      cur_epoch = sft->epoch.gpsSeconds;
+      fprintf( fp2, "%d\t%d\n", timestamps->length, cur_epoch );
+
+      // Get the current UTC time from the GPS seconds of the current SFT and print to file
+      XLAL_CHECK_MAIN( XLALGPSToUTC( &date, cur_epoch ) != NULL, XLAL_EFUNC );
+      fprintf( fp4, "%d\t %i\t %i\t %i\t %i\t %i\t %i\n", timestamps->length, ( date.tm_year + 1900 ), date.tm_mon + 1, date.tm_mday, date.tm_hour, date.tm_min, date.tm_sec );
+
+      // Here is where the timestamps vector is resized and this epoch is recorded
+      XLAL_CHECK_MAIN( XLALResizeINT4Vector( timestamps, timestamps->length + 1 ) != NULL, XLAL_EFUNC );
+      timestamps->data[timestamps->length - 1] = cur_epoch;
+
+      // Write the spectrogram row; first value in each row is the GPS time
+      for ( UINT4 step = 0; step < numSpecCols; step++ ) {
+        if ( step == 0 ) {
+          fprintf( fp, "%i\t", sft->epoch.gpsSeconds );
         }
-        fprintf( fp, "\n" );
+        fprintf( fp, "%e\t", specrows[k][step] );
       }
+      fprintf( fp, "\n" );
 
-    }
+      // Fill in gaps where there is no SFT data with zeros
+      if ( j < ( catalog->length - 1 ) ) { /*in all cases except when we are examining the last sft, check that there is no gap to the next sft*/
+        /*test to see if the next SFT immediately follows, if not entries in the matrix until there is one*/
+        while ( cur_epoch + timebaseline < catalog->data[j + 1].header.epoch.gpsSeconds ) {
+          cur_epoch += timebaseline;
+          fprintf( fp2, "%d.\t%d\n", timestamps->length, cur_epoch );
+
+          XLAL_CHECK_MAIN( XLALGPSToUTC( &date, cur_epoch ) != NULL, XLAL_EFUNC );
+          fprintf( fp4, "%d\t %i\t %i\t %i\t %i\t %i\t %i\n", timestamps->length, ( date.tm_year + 1900 ), date.tm_mon + 1, date.tm_mday, date.tm_hour, date.tm_min, date.tm_sec );
+          XLAL_CHECK_MAIN( XLALResizeINT4Vector( timestamps, timestamps->length + 1 ) != NULL, XLAL_EFUNC );
+          timestamps->data[timestamps->length - 1] = cur_epoch;
+
+          for ( UINT4 i = NumBinsAvg - 1; i < sft->data->length; i += NumBinsAvg ) {
+            // First value in each row is the GPS time
+            if ( i == NumBinsAvg - 1 ) {
+              fprintf( fp, "%i\t", cur_epoch );
+            }
+            REAL8 avg = 0.0;
+            fprintf( fp, "%e\t", avg );
+          }
+          fprintf( fp, "\n" );
+        }
 
-    /* Normalized, averaged spectra */
-    // Normalize the SFT
-    XLAL_CHECK_MAIN( XLALNormalizeSFT( rngmed, sft, blocksRngMed, 0.0 ) == XLAL_SUCCESS, XLAL_EFUNC );
+      }
 
-    // Loop over the frequency bins in the SFT
-    for ( UINT4 i = 0; i < sft->data->length; i++ ) {
-      const REAL8 re = ( REAL8 )crealf( sft->data->data[i] );
-      const REAL8 im = ( REAL8 )cimagf( sft->data->data[i] );
-      timeavg->data[i] += re * re + im * im;
+      // Destroys current SFT
+      XLALDestroySFT( sft );
+      sft = sfts[k] = NULL;
     }
-
-    // Destroys current SFT Vector
-    XLALDestroySFT( sft );
-    sft = NULL;
   }
   fprintf( stderr, "finished checking for missing sfts, l=%d\n", timestamps->length );
 
@@ -322,7 +362,13 @@ int main( int argc, char **argv )
   XLALDestroySFTCatalog( catalog );
   XLALDestroyREAL4Vector( timeavg );
   XLALDestroyINT4Vector( timestamps );
-  XLALDestroyREAL8FrequencySeries( rngmed );
+  for ( UINT4 k = 0; k < blocksize; k++ ) {
+    XLALDestroyREAL8FrequencySeries( rngmeds[k] );
+    XLALFree( specrows[k] );
+  }
+  XLALFree( rngmeds );
+  XLALFree( specrows );
+  XLALFree( sfts );
 
   XLALDestroyUserVars();
 
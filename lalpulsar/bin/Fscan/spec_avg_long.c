@@ -177,20 +177,33 @@ int main( int argc, char **argv )
 
   UINT4 epoch_index = 0;
 
+  // SFTs are processed in blocks: the SFTs in each block are extracted, and the power and noise weights
+  // of their bins computed, concurrently; these are then accumulated in SFT order. Only one block of SFTs
+  // is held in memory at any time.
+  const UINT4 blocksize = sft_block_size();
+  SFTtype **sfts = NULL;
+  REAL8 **sftpower = NULL, **sftweight = NULL;
+  XLAL_CHECK_MAIN( ( sfts = XLALCalloc( blocksize, sizeof( *sfts ) ) ) != NULL, XLAL_ENOMEM );
+  XLAL_CHECK_MAIN( ( sftpower = XLALCalloc( blocksize, sizeof( *sftpower ) ) ) != NULL, XLAL_ENOMEM );
+  XLAL_CHECK_MAIN( ( sftweight = XLALCalloc( blocksize, sizeof( *sftweight ) ) ) != NULL, XLAL_ENOMEM );
+
   printf( "Looping over SFTs to compute average spectra\n" );
-  for ( UINT4 j = 0; j < catalog->length; j++ ) {
-    fprintf( stderr, "Extracting SFT %d...\n", j );
+  for ( UINT4 j0 = 0; j0 < catalog->length; j0 += blocksize ) {
+    const UINT4 numBlock = ( catalog->length - j0 < blocksize ) ? catalog->length - j0 : blocksize;
+    fprintf( stderr, "Extracting SFTs %d to %d...\n", j0, j0 + numBlock - 1 );
 
-    //Extract one SFT at a time from the catalog
-    //we do this by using a catalog timeslice to get just the current SFT
-    SFTtype *sft = NULL;
-    XLAL_CHECK_MAIN( ( sft = extract_one_sft( catalog, catalog->data[j].header.epoch, f_min, f_max ) ) != NULL, XLAL_EFUNC );
+    //Extract a block of SFTs from the catalog
+    //we do this by using a catalog timeslice to get just each SFT
+    XLAL_CHECK_MAIN( extract_sft_block( sfts, catalog, catalog, j0, numBlock, f_min, f_max, 0 ) == XLAL_SUCCESS, XLAL_EFUNC );
 
-    //Make sure the SFTs are the same length as what we're expecting from user input
-    XLAL_CHECK_MAIN( fabs( timebaseline * sft->deltaF - 1.0 ) <= 10.*LAL_REAL8_EPS, XLAL_EINVAL, "Expected SFTs with length %f but got %f", timebaseline, 1 / sft->deltaF );
+    for ( UINT4 k = 0; k < numBlock; k++ ) {
+      //Make sure the SFTs are the same length as what we're expecting from user input
+      XLAL_CHECK_MAIN( fabs( timebaseline * sfts[k]->deltaF - 1.0 ) <= 10.*LAL_REAL8_EPS, XLAL_EINVAL, "Expected SFTs with length %f but got %f", timebaseline, 1 / sfts[k]->deltaF );
+    }
 
     //For the first time through the loop, we allocate some vectors
-    if ( j == 0 ) {
+    if ( j0 == 0 ) {
+      const SFTtype *sft = sfts[0];
       UINT4 numBins = sft->data->length;
       f0 = sft->f0;
       deltaF = sft->deltaF;
@@ -218,108 +231,163 @@ int main( int argc, char **argv )
       // Check that epoch_avg has been fully allocated. This can be problematic over many SFTs
       XLAL_CHECK_MAIN( epoch_avg->data != NULL, XLAL_ENOMEM, "Persistency calculation failed to allocate epoch_avg. Try using a longer epoch averaging with the -E flag or longer -T" );
       XLAL_CHECK_MAIN( ( epoch_avg->length * epoch_avg->vectorLength ) / epoch_gps_times->length == numBins, XLAL_ENOMEM, "Persistency calculation failed to allocate epoch_avg. Try using a longer epoch averaging with the -E flag or longer -T" );
+
+      // Allocate the power and noise weights of the bins of each SFT in a block
+      for ( UINT4 k = 0; k < blocksize; k++ ) {
+        XLAL_CHECK_MAIN( ( sftpower[k] = XLALCalloc( numBins, sizeof( REAL8 ) ) ) != NULL, XLAL_ENOMEM );
+        XLAL_CHECK_MAIN( ( sftweight[k] = XLALCalloc( numBins, sizeof( REAL8 ) ) ) != NULL, XLAL_ENOMEM );
+      }
     }
 
-    //Loop over the SFT bins
-    for ( UINT4 i = 0; i < sft->data->length; i++ ) {
-      REAL8 thispower = POWER( sft->data->data[i] );
-      REAL8 thisavepower = 0.;
-      UINT4 count = 0;
-      for ( INT4 ii = -nside; ii <= nside; ii++ ) {
-        //Only add to the cumulative average power if the variables are in range
-        if ( ( INT4 )i + ii >= 0 && ( INT4 )i + ii < ( INT4 )sft->data->length ) {
-          thisavepower += POWER( sft->data->data[i + ii] );
-          count++;
+    //Compute the power and noise weights of the SFT bins
+    #pragma omp parallel for schedule(dynamic)
+    for ( UINT4 k = 0; k < numBlock; k++ ) {
+      const SFTtype *sft = sfts[k];
+      for ( UINT4 i = 0; i < sft->data->length; i++ ) {
+        REAL8 thisavepower = 0.;
+        UINT4 count = 0;
+        for ( INT4 ii = -nside; ii <= nside; ii++ ) {
+          //Only add to the cumulative average power if the variables are in range
+          if ( ( INT4 )i + ii >= 0 && ( INT4 )i + ii < ( INT4 )sft->data->length ) {
+            thisavepower += POWER( sft->data->data[i + ii] );
+            count++;
+          }
         }
+        thisavepower /= count;
+        sftpower[k][i] = POWER( sft->data->data[i] );
+        sftweight[k][i] = 1. / thisavepower;
       }
-      thisavepower /= count;
-      REAL8 weight = 1. / thisavepower;
+    }
 
-      //For the first SFT, just assign the values to the vector, otherwise accumulate
-      if ( j == 0 ) {
-        timeavg->data[i] = thispower;
-        timeavgwt->data[i] = thispower * weight;
-        sumweight->data[i] = weight;
+    for ( UINT4 k = 0; k < numBlock; k++ ) {
+      const UINT4 j = j0 + k;
+      SFTtype *sft = sfts[k];
 
-        this_epoch_avg->data[i] = thispower * weight;
-        this_epoch_avg_wt->data[i] = weight;
-      } else {
-        timeavg->data[i] += thispower;
-        timeavgwt->data[i] += thispower * weight;
-        sumweight->data[i] += weight;
-
-        // Only accumulate in the epoch average if this SFT is within the current epoch
-        // Otherwise put the values in the new epoch average and weight vector.
-        if ( ( epoch_index < ( epoch_gps_times->length - 1 ) && XLALGPSCmp( &sft->epoch, &epoch_gps_times->data[epoch_index] ) >= 0 && XLALGPSCmp( &sft->epoch, &epoch_gps_times->data[epoch_index + 1] ) < 0 ) || epoch_index == ( epoch_gps_times->length - 1 ) ) {
-          this_epoch_avg->data[i] += thispower * weight;
-          this_epoch_avg_wt->data[i] += weight;
+      //Loop over the SFT bins
+      for ( UINT4 i = 0; i < sft->data->length; i++ ) {
+        REAL8 thispower = sftpower[k][i];
+        REAL8 weight = sftweight[k][i];
+
+        //For the first SFT, just assign the values to the vector, otherwise accumulate
+        if ( j == 0 ) {
+          timeavg->data[i] = thispower;
+          timeavgwt->data[i] = thispower * weight;
+          sumweight->data[i] = weight;
+
+          this_epoch_avg->data[i] = thispower * weight;
+          this_epoch_avg_wt->data[i] = weight;
         } else {
-          new_epoch_avg->data[i] = thispower * weight;
-          new_epoch_wt->data[i] = weight;
+          timeavg->data[i] += thispower;
+          timeavgwt->data[i] += thispower * weight;
+          sumweight->data[i] += weight;
+
+          // Only accumulate in the epoch average if this SFT is within the current epoch
+          // Otherwise put the values in the new epoch average and weight vector.
+          if ( ( epoch_index < ( epoch_gps_times->length - 1 ) && XLALGPSCmp( &sft->epoch, &epoch_gps_times->data[epoch_index] ) >= 0 && XLALGPSCmp( &sft->epoch, &epoch_gps_times->data[epoch_index + 1] ) < 0 ) || epoch_index == ( epoch_gps_times->length - 1 ) ) {
+            this_epoch_avg->data[i] += thispower * weight;
+            this_epoch_avg_wt->data[i] += weight;
+          } else {
+            new_epoch_avg->data[i] = thispower * weight;
+            new_epoch_wt->data[i] = weight;
+          }
+        }
+      } // end loop over this SFT frequency bins
+
+      // If we've started putting new values into the new epoch average, then we should conclude the
+      // last epoch and load the values from the new epoch into the current epoch
+      if ( new_epoch_avg->data[0] != 0.0 ) {
+        // Compute noise weighted power in this epoch average
+        for ( UINT4 i = 0; i < this_epoch_avg->length; i++ ) {
+          this_epoch_avg->data[i] *= 2.0 / this_epoch_avg_wt->data[i] / timebaseline;
         }
-      }
-    } // end loop over this SFT frequency bins
-
-    // If we've started putting new values into the new epoch average, then we should conclude the
-    // last epoch and load the values from the new epoch into the current epoch
-    if ( new_epoch_avg->data[0] != 0.0 ) {
-      // Compute noise weighted power in this epoch average
-      for ( UINT4 i = 0; i < this_epoch_avg->length; i++ ) {
-        this_epoch_avg->data[i] *= 2.0 / this_epoch_avg_wt->data[i] / timebaseline;
-      }
 
-      // Copy to the vector sequence of epoch averages
-      memcpy( &( epoch_avg->data[epoch_index * this_epoch_avg->length] ), this_epoch_avg->data, sizeof( REAL8 )*this_epoch_avg->length );
-      epoch_index++;
+        // Copy to the vector sequence of epoch averages
+        memcpy( &( epoch_avg->data[epoch_index * this_epoch_avg->length] ), this_epoch_avg->data, sizeof( REAL8 )*this_epoch_avg->length );
+        epoch_index++;
 
-      // Copy over the new epoch data into this epoch's average
-      memcpy( this_epoch_avg->data, new_epoch_avg->data, sizeof( REAL8 )*new_epoch_avg->length );
-      memcpy( this_epoch_avg_wt->data, new_epoch_wt->data, sizeof( REAL8 )*new_epoch_wt->length );
+        // Copy over the new epoch data into this epoch's average
+        memcpy( this_epoch_avg->data, new_epoch_avg->data, sizeof( REAL8 )*new_epoch_avg->length );
+        memcpy( this_epoch_avg_wt->data, new_epoch_wt->data, sizeof( REAL8 )*new_epoch_wt->length );
 
-      // Set the new epoch data to be zero again
-      memset( new_epoch_avg->data, 0, sizeof( REAL8 )*new_epoch_avg->length );
-    }
-    // This just repeats the above if we are in the very last SFT
-    if ( j == catalog->length - 1 ) {
-      for ( UINT4 i = 0; i < this_epoch_avg->length; i++ ) {
-        this_epoch_avg->data[i] = 2.*this_epoch_avg->data[i] / this_epoch_avg_wt->data[i] / timebaseline;
+        // Set the new epoch data to be zero again
+        memset( new_epoch_avg->data, 0, sizeof( REAL8 )*new_epoch_avg->length );
       }
+      // This just repeats the above if we are in the very last SFT
+      if ( j == catalog->length - 1 ) {
+        for ( UINT4 i = 0; i < this_epoch_avg->length; i++ ) {
+          this_epoch_avg->data[i] = 2.*this_epoch_avg->data[i] / this_epoch_avg_wt->data[i] / timebaseline;
+        }
 
-      memcpy( &( epoch_avg->data[epoch_index * this_epoch_avg->length] ), this_epoch_avg->data, sizeof( REAL8 )*this_epoch_avg->length );
-    }
+        memcpy( &( epoch_avg->data[epoch_index * this_epoch_avg->length] ), this_epoch_avg->data, sizeof( REAL8 )*this_epoch_avg->length );
+      }
 
-    // Destroys current SFT Vector
-    XLALDestroySFT( sft );
-    sft = NULL;
+      // Destroys current SFT
+      XLALDestroySFT( sft );
+      sfts[k] = NULL;
+    } // end loop over SFTs in this block
   } // end loop over all SFTs
 
+  for ( UINT4 k = 0; k < blocksize; k++ ) {
+    XLALFree( sftpower[k] );
+    XLALFree( sftweight[k] );
+  }
+  XLALFree( sftpower );
+  XLALFree( sftweight );
+  XLALFree( sfts );
+
   XLALDestroyREAL8Vector( this_epoch_avg_wt );
   XLALDestroyREAL8Vector( new_epoch_avg );
   XLALDestroyREAL8Vector( new_epoch_wt );
 
-  // Allocate vectors for running mean and standard deviation of each chunk
-  REAL8Vector *means = NULL, *stds = NULL;
-  XLAL_CHECK_MAIN( ( means = XLALCreateREAL8Vector( epoch_avg->vectorLength - 2 * nside ) ) != NULL, XLAL_EFUNC );
-  XLAL_CHECK_MAIN( ( stds = XLALCreateREAL8Vector( epoch_avg->vectorLength - 2 * nside ) ) != NULL, XLAL_EFUNC );
-
-  //Loop over epochs for persistency calculation
-  for ( UINT4 j = 0; j < epoch_gps_times->length; j++ ) {
-    // Use the mean and standard deviation of data for this epoch
-    memcpy( this_epoch_avg->data, &( epoch_avg->data[j * epoch_avg->vectorLength] ), sizeof( REAL8 )*epoch_avg->vectorLength );
-    XLAL_CHECK_MAIN( rngmean( this_epoch_avg, means, blocksRngMean ) == XLAL_SUCCESS, XLAL_EFUNC );
-    XLAL_CHECK_MAIN( rngstd( this_epoch_avg, means, stds, blocksRngMean ) == XLAL_SUCCESS, XLAL_EFUNC );
-
-    // At the end points of the running mean, we need to re-use the end values
-    // This is slightly sub-optimal
-    for ( UINT4 i = 0; i < epoch_avg->vectorLength; i++ ) {
-      REAL8 mean, std;
-      XLAL_CHECK_MAIN( select_mean_std_from_vect( &mean, &std, means, stds, i, ( UINT4 )nside ) == XLAL_SUCCESS, XLAL_EFUNC );
-      // Compare this SFT frequency data point with the running mean and standard deviation
-      if ( ( epoch_avg->data[j * epoch_avg->vectorLength + i] - mean ) / std > persistSNRthresh ) {
-        persistency->data[i] += 1.0;
+  //Loop over epochs for persistency calculation; epochs are independent, so divide them between threads
+  int errflag = 0;
+  #pragma omp parallel
+  {
+    // Allocate vectors for this epoch and the running mean and standard deviation of each chunk, for each thread
+    REAL8Vector *this_avg = XLALCreateREAL8Vector( epoch_avg->vectorLength );
+    REAL8Vector *means = XLALCreateREAL8Vector( epoch_avg->vectorLength - 2 * nside );
+    REAL8Vector *stds = XLALCreateREAL8Vector( epoch_avg->vectorLength - 2 * nside );
+    if ( this_avg == NULL || means == NULL || stds == NULL ) {
+      #pragma omp atomic write
+      errflag = 1;
+    }
+
+    #pragma omp for schedule(dynamic)
+    for ( UINT4 j = 0; j < epoch_gps_times->length; j++ ) {
+      if ( errflag ) {
+        continue;
       }
-    } // end loop over frequencies
-  } // end loop over epochs
+
+      // Use the mean and standard deviation of data for this epoch
+      memcpy( this_avg->data, &( epoch_avg->data[j * epoch_avg->vectorLength] ), sizeof( REAL8 )*epoch_avg->vectorLength );
+      if ( rngmean( this_avg, means, blocksRngMean ) != XLAL_SUCCESS || rngstd( this_avg, means, stds, blocksRngMean ) != XLAL_SUCCESS ) {
+        #pragma omp atomic write
+        errflag = 1;
+        continue;
+      }
+
+      // At the end points of the running mean, we need to re-use the end values
+      // This is slightly sub-optimal
+      for ( UINT4 i = 0; i < epoch_avg->vectorLength; i++ ) {
+        REAL8 mean, std;
+        if ( select_mean_std_from_vect( &mean, &std, means, stds, i, ( UINT4 )nside ) != XLAL_SUCCESS ) {
+          #pragma omp atomic write
+          errflag = 1;
+          break;
+        }
+        // Compare this SFT frequency data point with the running mean and standard deviation
+        if ( ( epoch_avg->data[j * epoch_avg->vectorLength + i] - mean ) / std > persistSNRthresh ) {
+          #pragma omp atomic update
+          persistency->data[i] += 1.0;
+        }
+      } // end loop over frequencies
+    } // end loop over epochs
+
+    XLALDestroyREAL8Vector( this_avg );
+    XLALDestroyREAL8Vector( means );
+    XLALDestroyREAL8Vector( stds );
+  }
+  XLAL_CHECK_MAIN( errflag == 0, XLAL_EFUNC );
 
   // Normalize persistency to be in range 0 - 1 based on the number of epochs
   for ( UINT4 i = 0; i < persistency->length; i++ ) {
@@ -350,6 +418,11 @@ int main( int argc, char **argv )
       line_freq_bin_in_sft->data[n] = ( INT4 )round( ( freq_vect->data[n] - f0 ) / deltaF );
     }
 
+    // Allocate vectors for running mean and standard deviation of each chunk
+    REAL8Vector *means = NULL, *stds = NULL;
+    XLAL_CHECK_MAIN( ( means = XLALCreateREAL8Vector( epoch_avg->vectorLength - 2 * nside ) ) != NULL, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( ( stds = XLALCreateREAL8Vector( epoch_avg->vectorLength - 2 * nside ) ) != NULL, XLAL_EFUNC );
+
     // Loop over chunks checking if the line frequencies to track are above threshold in each chunk
     for ( UINT4 j = 0; j < epoch_gps_times->length; j++ ) {
       // Use the standard deviation of data for this epoch
@@ -368,10 +441,10 @@ int main( int argc, char **argv )
     } // end loop over chunks of SFT averages
 
     XLALDestroyINT4Vector( line_freq_bin_in_sft );
+    XLALDestroyREAL8Vector( means );
+    XLALDestroyREAL8Vector( stds );
   } // end if line tracking
 
-  XLALDestroyREAL8Vector( means );
-  XLALDestroyREAL8Vector( stds );
   XLALDestroyREAL8Vector( this_epoch_avg );
   XLALDestroyREAL8VectorSequence( epoch_avg );
 
@@ -149,55 +149,88 @@ int main( int argc, char **argv )
 
   UINT4 nAve = 0;
 
-  printf( "Looping over SFTs to compute coherence\n" );
-  for ( UINT4 j = 0; j < catalog_a->length; j++ ) {
-    /* Extract one SFT at a time from the catalog */
-    fprintf( stderr, "Extracting SFT %d...\n", j );
-    XLAL_CHECK_MAIN( ( sft_a = extract_one_sft( catalog_a, catalog_a->data[j].header.epoch, f_min, f_max ) ) != NULL, XLAL_EFUNC );
+  // SFTs are processed in blocks: the SFTs in each block are extracted concurrently, and the cross and
+  // auto spectra of each frequency bin accumulated in SFT order. Only one block of SFTs is held in memory
+  // at any time.
+  const UINT4 blocksize = sft_block_size();
+  SFTtype **sfts_a = NULL, **sfts_b = NULL;
+  XLAL_CHECK_MAIN( ( sfts_a = XLALCalloc( blocksize, sizeof( *sfts_a ) ) ) != NULL, XLAL_ENOMEM );
+  XLAL_CHECK_MAIN( ( sfts_b = XLALCalloc( blocksize, sizeof( *sfts_b ) ) ) != NULL, XLAL_ENOMEM );
 
-    /* If no SFT from the B list was found, then just continue with the next SFT in the A list */
-    XLAL_TRY( sft_b = extract_one_sft( catalog_b, catalog_a->data[j].header.epoch, f_min, f_max ), errnumB );
-    if ( errnumB != 0 ) {
-      LogPrintf( LOG_CRITICAL, "Failed to find B channel SFT at time %d, [%.9f, %.9f) Hz\n", catalog_a->data[j].header.epoch.gpsSeconds, f_min, f_max );
-      continue;
-    }
+  printf( "Looping over SFTs to compute coherence\n" );
+  for ( UINT4 j0 = 0; j0 < catalog_a->length; j0 += blocksize ) {
+    const UINT4 numBlock = ( catalog_a->length - j0 < blocksize ) ? catalog_a->length - j0 : blocksize;
 
-    /* Check time baseline of the SFTs to confirm they match */
-    XLAL_CHECK_MAIN( sft_a->deltaF * timebaseline == 1.0, XLAL_EINVAL, "Time baseline of SFTs and the request do not match" );
-    XLAL_CHECK_MAIN( sft_b->deltaF * timebaseline == 1.0, XLAL_EINVAL, "Time baseline of SFTs and the request do not match" );
+    /* Extract a block of SFTs from the catalog */
+    fprintf( stderr, "Extracting SFTs %d to %d...\n", j0, j0 + numBlock - 1 );
+    XLAL_CHECK_MAIN( extract_sft_block( sfts_a, catalog_a, catalog_a, j0, numBlock, f_min, f_max, 0 ) == XLAL_SUCCESS, XLAL_EFUNC );
 
-    /* For the first time through the loop, we allocate some vectors */
-    if ( nAve == 0 ) {
-      UINT4 numBins = sft_a->data->length;
-      f0 = sft_a->f0;
-      deltaF = sft_a->deltaF;
+    /* If no SFT from the B list was found, then just continue with the next SFT in the A list */
+    XLAL_CHECK_MAIN( extract_sft_block( sfts_b, catalog_b, catalog_a, j0, numBlock, f_min, f_max, 1 ) == XLAL_SUCCESS, XLAL_EFUNC );
+    UINT4 numValid = 0;
+    for ( UINT4 k = 0; k < numBlock; k++ ) {
+      if ( sfts_b[k] == NULL ) {
+        LogPrintf( LOG_CRITICAL, "Failed to find B channel SFT at time %d, [%.9f, %.9f) Hz\n", catalog_a->data[j0 + k].header.epoch.gpsSeconds, f_min, f_max );
+        XLALDestroySFT( sfts_a[k] );
+        sfts_a[k] = NULL;
+        continue;
+      }
+      sft_a = sfts_a[k];
+      sft_b = sfts_b[k];
+
+      /* Check time baseline of the SFTs to confirm they match */
+      XLAL_CHECK_MAIN( sft_a->deltaF * timebaseline == 1.0, XLAL_EINVAL, "Time baseline of SFTs and the request do not match" );
+      XLAL_CHECK_MAIN( sft_b->deltaF * timebaseline == 1.0, XLAL_EINVAL, "Time baseline of SFTs and the request do not match" );
+
+      /* For the first time through the loop, we allocate some vectors */
+      if ( nAve + numValid == 0 ) {
+        UINT4 numBins = sft_a->data->length;
+        f0 = sft_a->f0;
+        deltaF = sft_a->deltaF;
+
+        XLAL_CHECK_MAIN( ( coh = XLALCreateCOMPLEX16Vector( numBins ) ) != NULL, XLAL_EFUNC );
+        XLAL_CHECK_MAIN( ( psd_a = XLALCreateREAL8Vector( numBins ) ) != NULL, XLAL_EFUNC );
+        XLAL_CHECK_MAIN( ( psd_b = XLALCreateREAL8Vector( numBins ) ) != NULL, XLAL_EFUNC );
+      }
 
-      XLAL_CHECK_MAIN( ( coh = XLALCreateCOMPLEX16Vector( numBins ) ) != NULL, XLAL_EFUNC );
-      XLAL_CHECK_MAIN( ( psd_a = XLALCreateREAL8Vector( numBins ) ) != NULL, XLAL_EFUNC );
-      XLAL_CHECK_MAIN( ( psd_b = XLALCreateREAL8Vector( numBins ) ) != NULL, XLAL_EFUNC );
+      /* Move matching SFTs to the front of the block */
+      sfts_a[k] = sfts_b[k] = NULL;
+      sfts_a[numValid] = sft_a;
+      sfts_b[numValid] = sft_b;
+      numValid++;
     }
 
     /* Loop over the SFT bins computing cross spectrum (AB) and auto spectrum (AA and BB) */
-    if ( nAve == 0 ) {
-      for ( UINT4 i = 0; i < sft_a->data->length; i++ ) {
-        coh->data[i] = sft_a->data->data[i] * conj( sft_b->data->data[i] );
-        psd_a->data[i] = sft_a->data->data[i] * conj( sft_a->data->data[i] );
-        psd_b->data[i] = sft_b->data->data[i] * conj( sft_b->data->data[i] );
-      }
-    } else {
-      for ( UINT4 i = 0; i < sft_a->data->length; i++ ) {
-        coh->data[i] += sft_a->data->data[i] * conj( sft_b->data->data[i] );
-        psd_a->data[i] += sft_a->data->data[i] * conj( sft_a->data->data[i] );
-        psd_b->data[i] += sft_b->data->data[i] * conj( sft_b->data->data[i] );
+    if ( numValid > 0 ) {
+      #pragma omp parallel for schedule(static)
+      for ( UINT4 i = 0; i < coh->length; i++ ) {
+        for ( UINT4 k = 0; k < numValid; k++ ) {
+          const COMPLEX8 a = sfts_a[k]->data->data[i], b = sfts_b[k]->data->data[i];
+          if ( nAve + k == 0 ) {
+            coh->data[i] = a * conj( b );
+            psd_a->data[i] = a * conj( a );
+            psd_b->data[i] = b * conj( b );
+          } else {
+            coh->data[i] += a * conj( b );
+            psd_a->data[i] += a * conj( a );
+            psd_b->data[i] += b * conj( b );
+          }
+        }
       }
     }
-    /* Destroys current SFT Vectors */
-    XLALDestroySFT( sft_a );
-    XLALDestroySFT( sft_b );
+
+    /* Destroys current SFTs */
+    for ( UINT4 k = 0; k < numValid; k++ ) {
+      XLALDestroySFT( sfts_a[k] );
+      XLALDestroySFT( sfts_b[k] );
+      sfts_a[k] = sfts_b[k] = NULL;
+    }
     sft_a = sft_b = NULL;
 
-    nAve++;
+    nAve += numValid;
   }
+  XLALFree( sfts_a );
+  XLALFree( sfts_b );
 
   XLAL_CHECK_MAIN( nAve > 0, XLAL_EFAILED, "No SFTs were found to be matching" );
 
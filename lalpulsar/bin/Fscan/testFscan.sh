@@ -323,3 +323,33 @@ for f in 1 2; do
     fi
 done
 echo "OK"
+
+## check that the block-streamed, multi-threaded spectral averages do not depend on the number of threads,
+## using enough SFTs to fill several blocks including a partial last block
+cmdline="lalpulsar_Makefakedata_v5 --outSingleSFT=TRUE --outSFTdir=. --IFOs=H1 --sqrtSX=1e-22 --startTime=${tstart} --duration=37800 --fmin=${fmin} --Band=2 --Tsft=${Tsft} --SFToverlap=0 --randSeed=44"
+if ! eval "$cmdline"; then
+    echo "ERROR: something failed when running '$cmdline'"
+    exit 1
+fi
+MFDv5sft3="./H-21_H1_${Tsft}SFT_mfdv5-${tstart}-37800.sft"
+for nthreads in 1 3; do
+    for prog in spec_avg spec_avg_long; do
+        outdir=threads_${nthreads}/${prog}
+        mkdir -p ${outdir}
+        cmdline="( cd ${outdir} && OMP_NUM_THREADS=${nthreads} ../../lalpulsar_${prog} -p ../../${MFDv5sft3} -I H1 -s 0 -e 2000000000 -f ${fmin} -F 12 -t ${Tsft} )"
+        if ! eval "$cmdline"; then
+            echo "ERROR: something failed when running '$cmdline'"
+            exit 1
+        fi
+    done
+done
+for prog in spec_avg spec_avg_long; do
+    echo -n "Comparing ${prog} output with 1 and 3 threads ... "
+    for file in `cd threads_1/${prog} && ls`; do
+        if ! cmp -s threads_1/${prog}/${file} threads_3/${prog}/${file}; then
+            echo "ERROR: threads_1/${prog}/${file} and threads_3/${prog}/${file} differ"
+            exit 1
+        fi
+    done
+    echo "OK"
+done
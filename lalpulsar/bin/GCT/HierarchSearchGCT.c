@@ -41,17 +41,11 @@
 #include <lal/Segments.h>
 #include <lal/LALString.h>
 #include <lal/LineRobustStats.h>
+#include <lal/SemicoherentSum.h>
 #include <RecalcToplistStats.h>
 
 #include "HierarchSearchGCT.h"
 
-#ifdef GC_SSE2_OPT
-#include <gc_hotloop_sse2.h>
-#else
-#define ALRealloc LALRealloc
-#define ALFree LALFree
-#endif
-
 /* ---------- Defines -------------------- */
 /* #define DIAGNOSISMODE 1 */
 #define NUDGE   10*LAL_REAL8_EPS
@@ -565,22 +559,6 @@ int main( int argc, char *argv[] )
     return ( HIERARCHICALSEARCH_EBAD );
   }
 
-#ifndef EXP_NO_NUM_COUNT
-  /* check that the numbercount can't exceed the data type */
-  {
-    UINT8 maxseg = 1;
-    maxseg = maxseg << ( 8 * sizeof( FINEGRID_NC_T ) );
-    maxseg -= 1;
-    if ( ( UINT8 )uvar_nStacksMax > maxseg ) {
-      fprintf( stderr,
-               "Number of segments exceeds %" LAL_UINT8_FORMAT "!\n"
-               "Compile without GC_SSE2_OPT to extend the available segment range\n",
-               maxseg );
-      return ( HIERARCHICALSEARCH_EBAD );
-    }
-  }
-#endif
-
   if ( uvar_blocksRngMed < 1 ) {
     fprintf( stderr, "Invalid Running Median block size\n" );
     return ( HIERARCHICALSEARCH_EBAD );
@@ -597,9 +575,7 @@ int main( int argc, char *argv[] )
   }
 
   /* 2F threshold for semicoherent stage */
-#ifndef EXP_NO_NUM_COUNT
   REAL4 TwoFthreshold = 2.0 * uvar_ThrF;
-#endif
 
   if ( ( uvar_SortToplist < 0 ) || ( uvar_SortToplist >= SORTBY_LAST ) ) {
     XLALPrintError( "Invalid value %d specified for toplist sorting, must be within [0, %d]\n", uvar_SortToplist, SORTBY_LAST - 1 );
@@ -1333,26 +1309,18 @@ int main( int argc, char *argv[] )
           finegrid.numDetectors = coarsegrid.numDetectors;
 
           /* allocate memory for finegrid points */
-          /* FIXME: The SSE2 optimized code relies on an identical alignment modulo 16 bytes of the
-             arrays finegrid.nc and finegrid.sumTwoF !!
-             MacOS enforces 16 byte alignment of memory blocks with size >= 16 bytes allocated
-             with malloc and realloc, but e.g. for 32 bit Linux this will NOT hold.
-             Alternatives might be using (posix_)memalign under Linux.
-             Windows ==>???
-          */
-
-          finegrid.nc = ( FINEGRID_NC_T * )ALRealloc( finegrid.nc, finegrid.length * sizeof( FINEGRID_NC_T ) );
-          finegrid.sumTwoF = ( REAL4 * )ALRealloc( finegrid.sumTwoF, finegrid.length * sizeof( REAL4 ) );
+          finegrid.nc = ( FINEGRID_NC_T * )LALRealloc( finegrid.nc, finegrid.length * sizeof( FINEGRID_NC_T ) );
+          finegrid.sumTwoF = ( REAL4 * )LALRealloc( finegrid.sumTwoF, finegrid.length * sizeof( REAL4 ) );
           if ( uvar_getMaxFperSeg ) {
-            finegrid.maxTwoFl = ( REAL4 * )ALRealloc( finegrid.maxTwoFl, finegrid.length * sizeof( REAL4 ) );
-            finegrid.maxTwoFlIdx = ( UINT4 * )ALRealloc( finegrid.maxTwoFlIdx, finegrid.length * sizeof( UINT4 ) );
+            finegrid.maxTwoFl = ( REAL4 * )LALRealloc( finegrid.maxTwoFl, finegrid.length * sizeof( REAL4 ) );
+            finegrid.maxTwoFlIdx = ( UINT4 * )LALRealloc( finegrid.maxTwoFlIdx, finegrid.length * sizeof( UINT4 ) );
 
           }
           if ( uvar_computeBSGL ) {
-            finegrid.sumTwoFX = ( REAL4 * )ALRealloc( finegrid.sumTwoFX, finegrid.numDetectors * finegrid.freqlengthAL * sizeof( REAL4 ) );
+            finegrid.sumTwoFX = ( REAL4 * )LALRealloc( finegrid.sumTwoFX, finegrid.numDetectors * finegrid.freqlengthAL * sizeof( REAL4 ) );
             if ( uvar_getMaxFperSeg ) {
-              finegrid.maxTwoFXl = ( REAL4 * )ALRealloc( finegrid.maxTwoFXl, finegrid.numDetectors * finegrid.freqlengthAL * sizeof( REAL4 ) );
-              finegrid.maxTwoFXlIdx = ( UINT4 * )ALRealloc( finegrid.maxTwoFXlIdx, finegrid.numDetectors * finegrid.freqlengthAL * sizeof( UINT4 ) );
+              finegrid.maxTwoFXl = ( REAL4 * )LALRealloc( finegrid.maxTwoFXl, finegrid.numDetectors * finegrid.freqlengthAL * sizeof( REAL4 ) );
+              finegrid.maxTwoFXlIdx = ( UINT4 * )LALRealloc( finegrid.maxTwoFXlIdx, finegrid.numDetectors * finegrid.freqlengthAL * sizeof( UINT4 ) );
             }
           }
 
@@ -1590,89 +1558,38 @@ int main( int argc, char *argv[] )
                   REAL4 *fgrid2F = finegrid.sumTwoF + FG_INDEX( finegrid, 0 );
 #ifndef EXP_NO_NUM_COUNT
                   FINEGRID_NC_T *fgridnc = finegrid.nc + FG_INDEX( finegrid, 0 );
-#endif
-
-#ifdef GC_SSE2_OPT
-                  if ( uvar_getMaxFperSeg ) {
-                    /* disables number count keeping */
-                    REAL4 *fgrid2Fmax = finegrid.maxTwoFl + FG_INDEX( finegrid, 0 );
-                    UINT4 *fgrid2FmaxIdx = finegrid.maxTwoFlIdx + FG_INDEX( finegrid, 0 );
-
-                    gc_hotloop_2Fmax_tracking( fgrid2F, fgrid2Fmax, fgrid2FmaxIdx, cgrid2F, k, finegrid.freqlength );
-                  } else {
-#ifndef EXP_NO_NUM_COUNT
-                    gc_hotloop( fgrid2F, cgrid2F, fgridnc, TwoFthreshold, finegrid.freqlength );
 #else
-                    gc_hotloop_no_nc( fgrid2F, cgrid2F, finegrid.freqlength );
+                  FINEGRID_NC_T *fgridnc = NULL;
 #endif
+                  REAL4 *fgrid2Fmax = NULL;
+                  UINT4 *fgrid2FmaxIdx = NULL;
+                  if ( uvar_getMaxFperSeg ) {
+                    fgrid2Fmax = finegrid.maxTwoFl + FG_INDEX( finegrid, 0 );
+                    fgrid2FmaxIdx = finegrid.maxTwoFlIdx + FG_INDEX( finegrid, 0 );
                   }
-                  if ( uvar_computeBSGL ) {
-                    for ( UINT4 X = 0; X < finegrid.numDetectors; X++ ) {
-                      REAL4 *cgrid2FX = coarsegrid.TwoFX + CG_FX_INDEX( coarsegrid, X, k, U1idx );
-                      REAL4 *fgrid2FX = finegrid.sumTwoFX + FG_FX_INDEX( finegrid, X, 0 );
-
-                      if ( uvar_getMaxFperSeg ) {
-                        REAL4 *fgrid2FXmax = finegrid.maxTwoFXl + FG_FX_INDEX( finegrid, X, 0 );
-                        UINT4 *fgrid2FXmaxIdx = finegrid.maxTwoFXlIdx + FG_FX_INDEX( finegrid, X, 0 );
 
-                        gc_hotloop_2Fmax_tracking( fgrid2FX, fgrid2FXmax, fgrid2FXmaxIdx, cgrid2FX, k, finegrid.freqlength );
-                      } else {
-                        gc_hotloop_no_nc( fgrid2FX, cgrid2FX, finegrid.freqlength );
-                      }
-                    } /* for  X  */
-                  }
-#else // GC_SSE2_OPT
-                  for ( UINT4 ifreq_fg = 0; ifreq_fg < finegrid.freqlength; ifreq_fg++ ) {
-                    fgrid2F[0] += cgrid2F[0];
-#ifndef EXP_NO_NUM_COUNT
-                    fgridnc[0] += ( TwoFthreshold < cgrid2F[0] );
-                    fgridnc++;
-#endif // EXP_NO_NUM_COUNT
-                    fgrid2F++;
-                    cgrid2F++;
+                  /* add this segment to the fine-grid 2F sum, loudest segment, and number count */
+                  if ( XLALVectorSemicoherentAddREAL4( fgrid2F, fgrid2Fmax, fgrid2FmaxIdx, fgridnc, TwoFthreshold, cgrid2F, k, finegrid.freqlength ) != XLAL_SUCCESS ) {
+                    XLALPrintError( "%s: XLALVectorSemicoherentAddREAL4() failed with errno=%d\n", __func__, xlalErrno );
+                    return ( HIERARCHICALSEARCH_EXLAL );
                   }
+
                   if ( uvar_computeBSGL ) {
                     for ( UINT4 X = 0; X < finegrid.numDetectors; X++ ) {
                       REAL4 *cgrid2FX = coarsegrid.TwoFX + CG_FX_INDEX( coarsegrid, X, k, U1idx );
                       REAL4 *fgrid2FX = finegrid.sumTwoFX + FG_FX_INDEX( finegrid, X, 0 );
-                      for ( UINT4 ifreq_fg = 0; ifreq_fg < finegrid.freqlength; ifreq_fg++ ) {
-                        fgrid2FX[0] += cgrid2FX[0];
-                        fgrid2FX++;
-                        cgrid2FX++;
+                      REAL4 *fgrid2FXmax = NULL;
+                      UINT4 *fgrid2FXmaxIdx = NULL;
+                      if ( uvar_getMaxFperSeg ) {
+                        fgrid2FXmax = finegrid.maxTwoFXl + FG_FX_INDEX( finegrid, X, 0 );
+                        fgrid2FXmaxIdx = finegrid.maxTwoFXlIdx + FG_FX_INDEX( finegrid, X, 0 );
                       }
-                    }
-                  }
-
-
-                  if ( uvar_getMaxFperSeg ) {
-                    cgrid2F = coarsegrid.TwoF + CG_INDEX( coarsegrid, k, U1idx );
-                    REAL4 *fgridMax2Fl = finegrid.maxTwoFl + FG_INDEX( finegrid, 0 );
-                    UINT4 *fgrid2FmaxIdx = finegrid.maxTwoFlIdx + FG_INDEX( finegrid, 0 );
-                    int isLouder;
-                    for ( UINT4 ifreq_fg = 0; ifreq_fg < finegrid.freqlength; ifreq_fg++ ) {
-                      isLouder = ( fgridMax2Fl[0] <= cgrid2F[0] );
-                      fgridMax2Fl[0] = fmaxf( fgridMax2Fl[0], cgrid2F[0] );
-                      fgrid2FmaxIdx[0] = isLouder * k + ( 1 - isLouder ) * fgrid2FmaxIdx[0];
-                      fgridMax2Fl++;
-                      fgrid2FmaxIdx++;
-                      cgrid2F++;
-                    }
-                    for ( UINT4 X = 0; X < finegrid.numDetectors; X++ ) {
-                      REAL4 *cgrid2FX = coarsegrid.TwoFX + CG_FX_INDEX( coarsegrid, X, k, U1idx );
-                      REAL4 *fgridMax2FXl = finegrid.maxTwoFXl + FG_FX_INDEX( finegrid, X, 0 );
-                      UINT4 *fgrid2FXmaxIdx = finegrid.maxTwoFXlIdx + FG_FX_INDEX( finegrid, X, 0 );
-
-                      for ( UINT4 ifreq_fg = 0; ifreq_fg < finegrid.freqlength; ifreq_fg++ ) {
-                        isLouder = ( fgridMax2FXl[0] <= cgrid2FX[0] );
-                        fgridMax2FXl[0] = fmaxf( fgridMax2FXl[0], cgrid2FX[0] );
-                        fgrid2FXmaxIdx[0] = isLouder * k + ( 1 - isLouder ) * fgrid2FXmaxIdx[0];
-                        fgrid2FXmaxIdx++;
-                        fgridMax2FXl++;
-                        cgrid2FX++;
+                      if ( XLALVectorSemicoherentAddREAL4( fgrid2FX, fgrid2FXmax, fgrid2FXmaxIdx, NULL, TwoFthreshold, cgrid2FX, k, finegrid.freqlength ) != XLAL_SUCCESS ) {
+                        XLALPrintError( "%s: XLALVectorSemicoherentAddREAL4() failed with errno=%d\n", __func__, xlalErrno );
+                        return ( HIERARCHICALSEARCH_EXLAL );
                       }
-                    }
+                    } /* for  X  */
                   }
-#endif // GC_SSE2_OPT
                   time_SumFine += ( GETTIME() - tic_SumFine );
 
                 } /* end: ------------- MAIN LOOP over Segments --------------------*/
@@ -1946,27 +1863,27 @@ int main( int argc, char *argv[] )
 
   /* free fine grid and coarse grid */
   if ( finegrid.nc ) {
-    ALFree( finegrid.nc );
+    LALFree( finegrid.nc );
   }
   if ( finegrid.sumTwoF ) {
-    ALFree( finegrid.sumTwoF );
+    LALFree( finegrid.sumTwoF );
   }
   if ( finegrid.sumTwoFX ) {
-    ALFree( finegrid.sumTwoFX );
+    LALFree( finegrid.sumTwoFX );
   }
   if ( finegrid.maxTwoFl ) {
-    ALFree( finegrid.maxTwoFl );
+    LALFree( finegrid.maxTwoFl );
   }
   if ( finegrid.maxTwoFlIdx ) {
-    ALFree( finegrid.maxTwoFlIdx );
+    LALFree( finegrid.maxTwoFlIdx );
   }
 
   if ( finegrid.maxTwoFXl ) {
-    ALFree( finegrid.maxTwoFXl );
+    LALFree( finegrid.maxTwoFXl );
   }
 
   if ( finegrid.maxTwoFXlIdx ) {
-    ALFree( finegrid.maxTwoFXlIdx );
+    LALFree( finegrid.maxTwoFXlIdx );
   }
 
   if ( coarsegrid.TwoF ) {
@@ -79,12 +79,10 @@ int main( int argc, char *argv[] )
   Filters iirFilters;
 
   LALFILE *fpin = NULL;
-  FILE *fpout = NULL;
   LALCache *cache = NULL;
   INT4 count = 0;
 
   CHAR outputfile[256] = "";
-  CHAR channel[128] = "";
   const CHAR *psrname;
 
   INT4Vector *starts = NULL, *stops = NULL; /* science segment start and stop times */
@@ -108,12 +106,20 @@ int main( int argc, char *argv[] )
     verbose = 1;
   }
 
+  /* if given a list of pulsars then heterodyne them all from a single read of
+     the frame data */
+  if ( inputParams.pulsarlist[0] != '\0' ) {
+    return heterodyne_pulsar_list( &inputParams, argc, argv );
+  }
+
   hetParams.heterodyneflag = inputParams.heterodyneflag; /* set type of heterodyne */
 
   /* read in pulsar data */
   hetParams.het = XLALReadTEMPOParFile( inputParams.paramfile );
   hetParams.hetUpdate = NULL;
   hetParams.outputPhase = inputParams.outputPhase;
+  hetParams.edat = NULL;
+  hetParams.tdat = NULL;
 
   /* set pulsar name - take from par file if available, or if not get from command line args */
   if ( PulsarCheckParam( hetParams.het, "PSRJ" ) ) {
@@ -321,48 +327,11 @@ data!\n" );
     strloc[0] = '\0';
   }
 
-  /* add header to the files: header information will be a string consisting of several lines starting with %%s.
-   *  - the first line will contain the time and date of the file creation
-   *  - the next set of lines will contain the version and git hash of the lalsuite versions
-   *  - the penulimate line will contain the command line inputs used to create the file
-   *  - the final will contain headers for the three columns in the file: GPS time, Real, Imag */
-  if ( ( fpout = fopen( outputfile, "w" ) ) == NULL ) {
-    fprintf( stderr, "Error... can't open output file %s!\n", outputfile );
+  /* add header to the output file */
+  if ( write_output_header( outputfile, argc, argv ) != XLAL_SUCCESS ) {
     return 0;
   }
 
-  CHAR *headerinfo = XLALStringDuplicate( "%% File created on " );
-  headerinfo = XLALStringAppend( headerinfo, LogTimeToString( XLALGetTimeOfDay() ) );
-  headerinfo = XLALStringAppend( headerinfo, "\n" );
-  headerinfo = XLALStringAppend( headerinfo, XLALVCSInfoString( lalPulsarVCSInfoList, 0, "%% " ) );
-  headerinfo = XLALStringAppend( headerinfo, "%% " );
-  for ( INT4 j = 0; j < argc; j++ ) {
-    headerinfo = XLALStringAppend( headerinfo, argv[j] );
-    headerinfo = XLALStringAppend( headerinfo, " " );
-  }
-  CHAR dataline[] = "\n%% GPS time\tReal\tImag\n";
-  if ( strlen( headerinfo ) + strlen( dataline ) > HEADERSIZE ) {
-    fprintf( stderr, "Error... HEADERSIZE needs to be increased to accommodate information\n" );
-    return 0;
-  } else {
-    /* fill in rest of string with whitespace */
-    for ( INT4 j = strlen( headerinfo ); j < HEADERSIZE; j++ ) {
-      headerinfo = XLALStringAppend( headerinfo, " " );
-    }
-    memcpy( &headerinfo[HEADERSIZE - strlen( dataline )], &dataline[0], sizeof( CHAR )*strlen( dataline ) );
-
-    /* output the header to the file */
-    size_t rc = fwrite( &headerinfo[0], sizeof( CHAR ), HEADERSIZE, fpout );
-    if ( ferror( fpout ) || !rc ) {
-      fprintf( stderr, "Error... problem writing out header data!\n" );
-      exit( 1 );
-    }
-  }
-  XLALFree( headerinfo );
-  fclose( fpout );
-
-  snprintf( channel, sizeof( channel ), "%s", inputParams.channel );
-
 #if TRACKMEMUSE
   fprintf( stderr, "Memory use before entering main loop:\n" );
   printmemuse();
@@ -377,7 +346,6 @@ data!\n" );
      as it should be significantly downsampled */
   do {
     COMPLEX16TimeSeries *data = NULL; /* data for heterodyning */
-    COMPLEX16TimeSeries *resampData = NULL; /* resampled data */
     REAL8Vector *times = NULL; /*times of data read from coarse heterodyne file*/
     INT4 i;
 
@@ -386,51 +354,21 @@ data!\n" );
       REAL8 gpstime;
       INT4 duration;
       REAL8TimeSeries *datareal = NULL;
-      LALCache *smalllist = NULL; /* list of frame files for a science segment */
       LIGOTimeGPS epochdummy;
+      INT4 chunkstatus;
 
       epochdummy.gpsSeconds = 0;
       epochdummy.gpsNanoSeconds = 0;
 
-      /* if the seg list has segment before the start time of the available
-         data frame then increment the segment and continue */
-      if ( stops->data[count] <= cache->list[0].t0 ) {
-        count++;
+      if ( ( chunkstatus = get_data_chunk( &datareal, &gpstime, &duration, cache, starts,
+                                           stops, numSegs, &count, &inputParams ) ) > 0 ) {
         continue;
-      }
-      /* if there are segments after the last available data from then break */
-      if ( cache->list[cache->length - 1].t0 + cache->list[cache->length - 1].dt <=
-           starts->data[count] ) {
+      } else if ( chunkstatus < 0 ) {
         break;
       }
 
-      if ( ( duration = stops->data[count] - starts->data[count] ) > inputParams.datachunklength ) {
-        duration = inputParams.datachunklength;
-      } /* if duration of science segment is large
-                                                   just get part of it */
-
-      fprintf( stderr, "Getting data between %d and %d.\n", starts->data[count],
-               starts->data[count] + duration );
-
-      hetParams.timestamp = ( REAL8 )starts->data[count];
+      hetParams.timestamp = gpstime;
       hetParams.length = inputParams.samplerate * duration;
-      gpstime = ( REAL8 )starts->data[count];
-
-      /* if there was no frame file for that segment move on */
-      if ( ( smalllist = set_frame_files( &starts->data[count], &stops->data[count],
-                                          cache, &count, inputParams.datachunklength ) ) == NULL ) {
-        /* if there was no frame file for that segment move on */
-        fprintf( stderr, "Error... no frame files listed between %d and %d.\n",
-                 ( INT4 )gpstime, ( INT4 )gpstime + duration );
-
-        if ( count < numSegs ) {
-          count++;/*if not finished reading in all data try next set of frames*/
-
-          continue;
-        } else {
-          break;
-        }
-      }
 
       /* make vector (make sure imaginary parts are set to zero) */
       if ( ( data = XLALCreateCOMPLEX16TimeSeries( "", &epochdummy,
@@ -439,27 +377,6 @@ data!\n" );
         XLALPrintError( "Error allocating data memory.\n" );
       }
 
-      /* read in frame data */
-      if ( ( datareal = get_frame_data( smalllist, channel, gpstime,
-                                        inputParams.samplerate * duration, duration, inputParams.samplerate,
-                                        inputParams.scaleFac, inputParams.highPass ) ) == NULL ) {
-        fprintf( stderr, "Error... could not open frame files between %d and \
-%d.\n", ( INT4 )gpstime, ( INT4 )gpstime + duration );
-
-        if ( count < numSegs ) {
-          count++;/*if not finished reading in all data try next set of frames*/
-
-          XLALDestroyCOMPLEX16TimeSeries( data );
-
-          XLALDestroyCache( smalllist );
-
-          continue;
-        } else {
-          XLALDestroyCOMPLEX16TimeSeries( data );
-          break; /* if at the end of data anyway then break */
-        }
-      }
-
       /* if any data has successfully been read-in set flag to 0 */
       nodata = 0;
 
@@ -469,10 +386,6 @@ data!\n" );
       }
 
       XLALDestroyREAL8TimeSeries( datareal );
-
-      XLALDestroyCache( smalllist );
-
-      count++;
     } else if ( inputParams.heterodyneflag == 1 ||
                 inputParams.heterodyneflag == 2 || inputParams.heterodyneflag == 4 ) {
       /* i.e. reading from a heterodyned file */
@@ -621,193 +534,643 @@ data!\n" );
 
     XLALGPSSetREAL8( &data->epoch, hetParams.timestamp );
 
-    /* heterodyne data */
-    heterodyne_data( data, times, hetParams, inputParams.freqfactor, filtresp );
+    /* heterodyne, filter, resample, calibrate and output the data */
+    if ( process_data( data, times, hetParams, &iirFilters, filtresp, starts, stops,
+                       &inputParams, outputfile ) != XLAL_SUCCESS ) {
+      return 0;
+    }
+  } while ( count < numSegs && ( inputParams.heterodyneflag == 0 || inputParams.heterodyneflag == 3 ) );
+
+  /* check if any data has been read - if not exit with an error */
+  if ( nodata && ( inputParams.heterodyneflag == 0 || inputParams.heterodyneflag == 3 ) ) {
+    fprintf( stderr, "Error... no data was read in.\n" );
+    exit( 1 );
+  }
+
+  /* check whether to gzip the output */
+  if ( !inputParams.binaryoutput && inputParams.gzipoutput ) {
+    fprintf( stderr, "Outputing %s to gzipped file\n", outputfile );
+    if ( XLALGzipTextFile( outputfile ) != XLAL_SUCCESS ) { // gzip it
+      XLALPrintError( "Error... problem gzipping the output file.\n" );
+    }
+  }
+
+#if TRACKMEMUSE
+  fprintf( stderr, "Memory usage after completion of main loop:\n" );
+  printmemuse();
+#endif
+
+  fprintf( stderr, "Heterodyning complete.\n" );
+
+  XLALDestroyINT4Vector( stops );
+  XLALDestroyINT4Vector( starts );
+
+  if ( inputParams.heterodyneflag == 0 || inputParams.heterodyneflag == 3 ) {
+    XLALDestroyCache( cache );
+  }
+
+  if ( inputParams.filterknee > 0. ) {
+    destroy_filters( &iirFilters );
+
     if ( verbose ) {
-      fprintf( stderr, "I've heterodyned the data.\n" );
+      fprintf( stderr, "I've destroyed all filters.\n" );
+    }
+  }
+
+  if ( filtresp != NULL ) {
+    destroy_filter_response( filtresp );
+  }
+
+  PulsarFreeParams( hetParams.het );
+  if ( inputParams.heterodyneflag == 2 || inputParams.heterodyneflag == 4 ) {
+    PulsarFreeParams( hetParams.hetUpdate );
+  }
+
+#if TRACKMEMUSE
+  fprintf( stderr, "Memory use at the end of the code:\n" );
+  printmemuse();
+#endif
+
+  return 0;
+}
+
+/* function to heterodyne, low-pass filter, resample, calibrate and output a
+   chunk of data - times can be NULL for data read from frames, and the data and
+   times are destroyed on return */
+INT4 process_data( COMPLEX16TimeSeries *data, REAL8Vector *times,
+                   HeterodyneParams hetParams, Filters *iirFilters, FilterResponse *filtResp,
+                   INT4Vector *starts, INT4Vector *stops, InputParams *inputParams,
+                   CHAR *outputfile )
+{
+  COMPLEX16TimeSeries *resampData = NULL; /* resampled data */
+  FILE *fpout = NULL;
+  INT4 i;
+
+  /* heterodyne data */
+  heterodyne_data( data, times, hetParams, inputParams->freqfactor, filtResp );
+  if ( verbose ) {
+    fprintf( stderr, "I've heterodyned the data.\n" );
+  }
+
+  if ( times == NULL && inputParams->filterknee > 0. &&
+       ( inputParams->heterodyneflag == 0 || inputParams->heterodyneflag == 3 ) ) {
+    /* for coarse heterodyned frame data filter and resample in one pass */
+    if ( ( times = XLALCreateREAL8Vector( data->data->length ) ) == NULL ) {
+      XLALPrintError( "Error creating vector of data times.\n" );
     }
 
+    resampData = filter_resample_data( data, times, iirFilters, inputParams->samplerate,
+                                       inputParams->resamplerate );
+    if ( verbose ) {
+      fprintf( stderr, "I've low pass filtered the data at %.2lf Hz and resampled from %.2lf to %.4lf Hz\n",
+               inputParams->filterknee, inputParams->samplerate, inputParams->resamplerate );
+    }
+  } else {
     /* filter data */
-    if ( inputParams.filterknee > 0. ) { /* filter if knee frequency is not zero */
-      filter_data( data, &iirFilters );
+    if ( inputParams->filterknee > 0. ) { /* filter if knee frequency is not zero */
+      filter_data( data, iirFilters );
 
       if ( verbose ) {
-        fprintf( stderr, "I've low pass filtered the data at %.2lf Hz\n", inputParams.filterknee );
+        fprintf( stderr, "I've low pass filtered the data at %.2lf Hz\n", inputParams->filterknee );
       }
     }
 
-    if ( inputParams.heterodyneflag == 0 || inputParams.heterodyneflag == 3 )
+    if ( times == NULL )
       if ( ( times = XLALCreateREAL8Vector( data->data->length ) ) == NULL ) {
         XLALPrintError( "Error creating vector of data times.\n" );
       }
 
     /* resample data and data times */
     resampData = resample_data( data, times, starts, stops,
-                                inputParams.samplerate, inputParams.resamplerate,
-                                inputParams.heterodyneflag );
+                                inputParams->samplerate, inputParams->resamplerate,
+                                inputParams->heterodyneflag );
     if ( verbose ) {
-      fprintf( stderr, "I've resampled the data from %.2lf to %.4lf Hz\n", inputParams.samplerate, inputParams.resamplerate );
+      fprintf( stderr, "I've resampled the data from %.2lf to %.4lf Hz\n", inputParams->samplerate, inputParams->resamplerate );
     }
+  }
 
-    XLALDestroyCOMPLEX16TimeSeries( data );
+  XLALDestroyCOMPLEX16TimeSeries( data );
 
-    /*perform outlier removal twice incase very large outliers skew the stddev*/
-    if ( inputParams.stddevthresh != 0. ) {
-      INT4 numOutliers = 0;
-      numOutliers = remove_outliers( resampData, times,
-                                     inputParams.stddevthresh );
-      if ( verbose ) {
-        fprintf( stderr, "I've removed %lf%% of data above the threshold %.1lf sigma for 1st time.\n",
-                 100.*( double )numOutliers / ( double )resampData->data->length,
-                 inputParams.stddevthresh );
-      }
+  /*perform outlier removal twice incase very large outliers skew the stddev*/
+  if ( inputParams->stddevthresh != 0. ) {
+    INT4 numOutliers = 0;
+    numOutliers = remove_outliers( resampData, times,
+                                   inputParams->stddevthresh );
+    if ( verbose ) {
+      fprintf( stderr, "I've removed %lf%% of data above the threshold %.1lf sigma for 1st time.\n",
+               100.*( double )numOutliers / ( double )resampData->data->length,
+               inputParams->stddevthresh );
     }
+  }
 
-    /* calibrate */
-    if ( inputParams.calibrate ) {
-      calibrate( resampData, times, inputParams.calibfiles,
-                 inputParams.freqfactor * PulsarGetREAL8VectorParamIndividual( hetParams.het, "F0" ), inputParams.channel );
-      if ( verbose ) {
-        fprintf( stderr, "I've calibrated the data at %.1lf Hz\n", inputParams.freqfactor * PulsarGetREAL8VectorParamIndividual( hetParams.het, "F0" ) );
-      }
+  /* calibrate */
+  if ( inputParams->calibrate ) {
+    calibrate( resampData, times, inputParams->calibfiles,
+               inputParams->freqfactor * PulsarGetREAL8VectorParamIndividual( hetParams.het, "F0" ), inputParams->channel );
+    if ( verbose ) {
+      fprintf( stderr, "I've calibrated the data at %.1lf Hz\n", inputParams->freqfactor * PulsarGetREAL8VectorParamIndividual( hetParams.het, "F0" ) );
     }
+  }
 
-    /* remove outliers above our threshold */
-    if ( inputParams.stddevthresh != 0. ) {
-      INT4 numOutliers = 0;
-      numOutliers = remove_outliers( resampData, times,
-                                     inputParams.stddevthresh );
-      if ( verbose ) {
-        fprintf( stderr, "I've removed %lf%% of data above the threshold %.1lf sigma for 2nd time.\n",
-                 100.*( double )numOutliers / ( double )resampData->data->length,
-                 inputParams.stddevthresh );
-      }
+  /* remove outliers above our threshold */
+  if ( inputParams->stddevthresh != 0. ) {
+    INT4 numOutliers = 0;
+    numOutliers = remove_outliers( resampData, times,
+                                   inputParams->stddevthresh );
+    if ( verbose ) {
+      fprintf( stderr, "I've removed %lf%% of data above the threshold %.1lf sigma for 2nd time.\n",
+               100.*( double )numOutliers / ( double )resampData->data->length,
+               inputParams->stddevthresh );
     }
+  }
 
-    /* output data */
-    if ( inputParams.binaryoutput ) {
-      if ( ( fpout = fopen( outputfile, "ab" ) ) == NULL ) {
-        fprintf( stderr, "Error... can't open output file %s!\n", outputfile );
-        return 0;
+  /* output data */
+  if ( inputParams->binaryoutput ) {
+    if ( ( fpout = fopen( outputfile, "ab" ) ) == NULL ) {
+      fprintf( stderr, "Error... can't open output file %s!\n", outputfile );
+      XLALDestroyCOMPLEX16TimeSeries( resampData );
+      XLALDestroyREAL8Vector( times );
+      return XLAL_FAILURE;
+    }
+  } else {
+    if ( ( fpout = fopen( outputfile, "a" ) ) == NULL ) {
+      fprintf( stderr, "Error... can't open output file %s!\n", outputfile );
+      XLALDestroyCOMPLEX16TimeSeries( resampData );
+      XLALDestroyREAL8Vector( times );
+      return XLAL_FAILURE;
+    }
+  }
+
+  /* buffer the output, so that file system is not thrashed when outputing */
+  /* buffer will be 1Mb */
+  if ( setvbuf( fpout, NULL, _IOFBF, 0x100000 ) ) {
+    fprintf( stderr, "Warning: Unable to set output file buffer!" );
+  }
+
+  for ( i = 0; i < ( INT4 )resampData->data->length; i++ ) {
+    /* if data has been scaled then undo scaling for output */
+
+    if ( inputParams->binaryoutput ) {
+      size_t rc = 0;
+      REAL8 tempreal, tempimag;
+
+      tempreal = creal( resampData->data->data[i] );
+      tempimag = cimag( resampData->data->data[i] );
+
+      /* binary output will be same as ASCII text - time real imag */
+      if ( inputParams->scaleFac > 1.0 ) {
+        tempreal /= inputParams->scaleFac;
+        tempimag /= inputParams->scaleFac;
+      }
+
+      rc = fwrite( &times->data[i], sizeof( REAL8 ), 1, fpout );
+      rc = fwrite( &tempreal, sizeof( REAL8 ), 1, fpout );
+      rc = fwrite( &tempimag, sizeof( REAL8 ), 1, fpout );
+
+      if ( ferror( fpout ) || !rc ) {
+        fprintf( stderr, "Error... problem writing out data to binary file!\n" );
+        exit( 1 );
       }
     } else {
-      if ( ( fpout = fopen( outputfile, "a" ) ) == NULL ) {
-        fprintf( stderr, "Error... can't open output file %s!\n", outputfile );
-        return 0;
+      if ( inputParams->scaleFac > 1.0 ) {
+        fprintf( fpout, "%lf\t%le\t%le\n", times->data[i],
+                 creal( resampData->data->data[i] ) / inputParams->scaleFac,
+                 cimag( resampData->data->data[i] ) / inputParams->scaleFac );
+      } else {
+        fprintf( fpout, "%lf\t%le\t%le\n", times->data[i],
+                 creal( resampData->data->data[i] ), cimag( resampData->data->data[i] ) );
       }
     }
 
-    /* buffer the output, so that file system is not thrashed when outputing */
-    /* buffer will be 1Mb */
-    if ( setvbuf( fpout, NULL, _IOFBF, 0x100000 ) ) {
-      fprintf( stderr, "Warning: Unable to set output file buffer!" );
+  }
+  if ( verbose ) {
+    fprintf( stderr, "I've output the data.\n" );
+  }
+
+  fclose( fpout );
+
+  XLALDestroyCOMPLEX16TimeSeries( resampData );
+
+  XLALDestroyREAL8Vector( times );
+
+  return XLAL_SUCCESS;
+}
+
+/* function to write the header to an output file */
+INT4 write_output_header( CHAR *outputfile, int argc, char *argv[] )
+{
+  FILE *fpout = NULL;
+
+  /* header information will be a string consisting of several lines starting with %%s.
+   *  - the first line will contain the time and date of the file creation
+   *  - the next set of lines will contain the version and git hash of the lalsuite versions
+   *  - the penulimate line will contain the command line inputs used to create the file
+   *  - the final will contain headers for the three columns in the file: GPS time, Real, Imag */
+  if ( ( fpout = fopen( outputfile, "w" ) ) == NULL ) {
+    fprintf( stderr, "Error... can't open output file %s!\n", outputfile );
+    return XLAL_FAILURE;
+  }
+
+  CHAR *headerinfo = XLALStringDuplicate( "%% File created on " );
+  headerinfo = XLALStringAppend( headerinfo, LogTimeToString( XLALGetTimeOfDay() ) );
+  headerinfo = XLALStringAppend( headerinfo, "\n" );
+  headerinfo = XLALStringAppend( headerinfo, XLALVCSInfoString( lalPulsarVCSInfoList, 0, "%% " ) );
+  headerinfo = XLALStringAppend( headerinfo, "%% " );
+  for ( INT4 j = 0; j < argc; j++ ) {
+    headerinfo = XLALStringAppend( headerinfo, argv[j] );
+    headerinfo = XLALStringAppend( headerinfo, " " );
+  }
+  CHAR dataline[] = "\n%% GPS time\tReal\tImag\n";
+  if ( strlen( headerinfo ) + strlen( dataline ) > HEADERSIZE ) {
+    fprintf( stderr, "Error... HEADERSIZE needs to be increased to accommodate information\n" );
+    XLALFree( headerinfo );
+    fclose( fpout );
+    return XLAL_FAILURE;
+  } else {
+    /* fill in rest of string with whitespace */
+    for ( INT4 j = strlen( headerinfo ); j < HEADERSIZE; j++ ) {
+      headerinfo = XLALStringAppend( headerinfo, " " );
     }
+    memcpy( &headerinfo[HEADERSIZE - strlen( dataline )], &dataline[0], sizeof( CHAR )*strlen( dataline ) );
 
-    for ( i = 0; i < ( INT4 )resampData->data->length; i++ ) {
-      /* if data has been scaled then undo scaling for output */
+    /* output the header to the file */
+    size_t rc = fwrite( &headerinfo[0], sizeof( CHAR ), HEADERSIZE, fpout );
+    if ( ferror( fpout ) || !rc ) {
+      fprintf( stderr, "Error... problem writing out header data!\n" );
+      exit( 1 );
+    }
+  }
+  XLALFree( headerinfo );
+  fclose( fpout );
 
-      if ( inputParams.binaryoutput ) {
-        size_t rc = 0;
-        REAL8 tempreal, tempimag;
+  return XLAL_SUCCESS;
+}
 
-        tempreal = creal( resampData->data->data[i] );
-        tempimag = cimag( resampData->data->data[i] );
+/* function to read in the next chunk of frame data for the science segment
+   given by count, which is incremented when the segment has been used - returns
+   0 if data was read in, 1 if this chunk should be skipped, or -1 if there is no
+   more data */
+INT4 get_data_chunk( REAL8TimeSeries **datareal, REAL8 *gpstime, INT4 *duration,
+                     LALCache *cache, INT4Vector *starts, INT4Vector *stops, INT4 numSegs,
+                     INT4 *count, InputParams *inputParams )
+{
+  LALCache *smalllist = NULL; /* list of frame files for a science segment */
 
-        /* binary output will be same as ASCII text - time real imag */
-        if ( inputParams.scaleFac > 1.0 ) {
-          tempreal /= inputParams.scaleFac;
-          tempimag /= inputParams.scaleFac;
-        }
+  /* if the seg list has segment before the start time of the available
+     data frame then increment the segment and continue */
+  if ( stops->data[*count] <= cache->list[0].t0 ) {
+    ( *count )++;
+    return 1;
+  }
+  /* if there are segments after the last available data from then break */
+  if ( cache->list[cache->length - 1].t0 + cache->list[cache->length - 1].dt <=
+       starts->data[*count] ) {
+    return -1;
+  }
 
-        rc = fwrite( &times->data[i], sizeof( REAL8 ), 1, fpout );
-        rc = fwrite( &tempreal, sizeof( REAL8 ), 1, fpout );
-        rc = fwrite( &tempimag, sizeof( REAL8 ), 1, fpout );
+  if ( ( *duration = stops->data[*count] - starts->data[*count] ) > inputParams->datachunklength ) {
+    *duration = inputParams->datachunklength;
+  } /* if duration of science segment is large
+                                               just get part of it */
 
-        if ( ferror( fpout ) || !rc ) {
-          fprintf( stderr, "Error... problem writing out data to binary file!\n" );
-          exit( 1 );
-        }
-      } else {
-        if ( inputParams.scaleFac > 1.0 ) {
-          fprintf( fpout, "%lf\t%le\t%le\n", times->data[i],
-                   creal( resampData->data->data[i] ) / inputParams.scaleFac,
-                   cimag( resampData->data->data[i] ) / inputParams.scaleFac );
-        } else {
-          fprintf( fpout, "%lf\t%le\t%le\n", times->data[i],
-                   creal( resampData->data->data[i] ), cimag( resampData->data->data[i] ) );
+  fprintf( stderr, "Getting data between %d and %d.\n", starts->data[*count],
+           starts->data[*count] + *duration );
+
+  *gpstime = ( REAL8 )starts->data[*count];
+
+  /* if there was no frame file for that segment move on */
+  if ( ( smalllist = set_frame_files( &starts->data[*count], &stops->data[*count],
+                                      cache, count, inputParams->datachunklength ) ) == NULL ) {
+    /* if there was no frame file for that segment move on */
+    fprintf( stderr, "Error... no frame files listed between %d and %d.\n",
+             ( INT4 )*gpstime, ( INT4 )*gpstime + *duration );
+
+    if ( *count < numSegs ) {
+      ( *count )++;/*if not finished reading in all data try next set of frames*/
+      return 1;
+    } else {
+      return -1;
+    }
+  }
+
+  /* read in frame data */
+  if ( ( *datareal = get_frame_data( smalllist, inputParams->channel, *gpstime,
+                                     inputParams->samplerate * *duration, *duration, inputParams->samplerate,
+                                     inputParams->scaleFac, inputParams->highPass ) ) == NULL ) {
+    fprintf( stderr, "Error... could not open frame files between %d and \
+%d.\n", ( INT4 )*gpstime, ( INT4 )*gpstime + *duration );
+
+    XLALDestroyCache( smalllist );
+
+    if ( *count < numSegs ) {
+      ( *count )++;/*if not finished reading in all data try next set of frames*/
+      return 1;
+    } else {
+      return -1; /* if at the end of data anyway then break */
+    }
+  }
+
+  XLALDestroyCache( smalllist );
+
+  ( *count )++;
+
+  return 0;
+}
+
+/* function to heterodyne a list of pulsars, given in a file with a .par file
+   and an output file on each line. Each chunk of frame data is read in only
+   once, and is then heterodyned, filtered and resampled for all the pulsars in
+   parallel, with each pulsar having its own phase model, filters and output
+   file - returns the exit status for the code */
+INT4 heterodyne_pulsar_list( InputParams *inputParams, int argc, char *argv[] )
+{
+  FILE *fp = NULL;
+  LALCache *cache = NULL;
+  CHAR linebuf[1024];
+
+  PulsarHeterodyne *pulsars = NULL;
+  UINT4 npulsars = 0;
+
+  INT4Vector *starts = NULL, *stops = NULL; /* science segment start and stop times */
+  INT4 numSegs = 0, count = 0;
+  INT4 nodata = 1;
+  int errflag = 0;
+
+  EphemerisData *edat = NULL;
+  TimeCorrectionData *tdat = NULL;
+
+  /* read in the pulsar list and set up the parameters, filters and output
+     file for each pulsar */
+  if ( ( fp = fopen( inputParams->pulsarlist, "r" ) ) == NULL ) {
+    fprintf( stderr, "Error... can't open pulsar list file %s!\n", inputParams->pulsarlist );
+    return 1;
+  }
+
+  while ( fgets( linebuf, sizeof( linebuf ), fp ) != NULL ) {
+    CHAR parfile[256], psroutputfile[256];
+    INT4 nread = sscanf( linebuf, "%255s%255s", parfile, psroutputfile );
+
+    /* skip blank and comment lines */
+    if ( nread < 1 || parfile[0] == '%' || parfile[0] == '#' ) {
+      continue;
+    }
+    if ( nread != 2 ) {
+      linebuf[strcspn( linebuf, "\r\n" )] = '\0';
+      fprintf( stderr, "Error... line \"%s\" of pulsar list should contain a .par file and an output file!\n", linebuf );
+      fclose( fp );
+      destroy_pulsar_list( pulsars, npulsars );
+      return 1;
+    }
+
+    PulsarHeterodyne *newpulsars = XLALRealloc( pulsars, ( npulsars + 1 ) * sizeof( *pulsars ) );
+    if ( newpulsars == NULL ) {
+      fprintf( stderr, "Error... can't allocate memory for pulsar %u!\n", npulsars + 1 );
+      fclose( fp );
+      destroy_pulsar_list( pulsars, npulsars );
+      return 1;
+    }
+    pulsars = newpulsars;
+
+    /* zero the new pulsar so that it can be freed at any point */
+    PulsarHeterodyne *psr = &pulsars[npulsars++];
+    HeterodyneParams *hetParams = &psr->hetParams;
+    memset( psr, 0, sizeof( *psr ) );
+
+    hetParams->heterodyneflag = inputParams->heterodyneflag;
+    if ( ( hetParams->het = XLALReadTEMPOParFile( parfile ) ) == NULL ) {
+      fprintf( stderr, "Error... can't read pulsar parameter file %s!\n", parfile );
+      fclose( fp );
+      destroy_pulsar_list( pulsars, npulsars );
+      return 1;
+    }
+
+    /* if there is an epoch given manually then set it here */
+    if ( inputParams->manualEpoch != 0. ) {
+      PulsarSetParam( hetParams->het, "PEPOCH", &inputParams->manualEpoch );
+      PulsarSetParam( hetParams->het, "POSEPOCH", &inputParams->manualEpoch );
+    }
+
+    /* a full heterodyne in one go uses the same parameters for both stages */
+    hetParams->hetUpdate = ( inputParams->heterodyneflag == 3 ) ? hetParams->het : NULL;
+    hetParams->outputPhase = 0;
+    hetParams->samplerate = inputParams->samplerate;
+    hetParams->detector = *XLALGetSiteInfo( inputParams->ifo );
+    hetParams->timeCorrFile = NULL;
+    hetParams->ttype = TIMECORRECTION_ORIGINAL;
+    hetParams->edat = NULL;
+    hetParams->tdat = NULL;
+
+    if ( inputParams->heterodyneflag > 0 ) {
+      snprintf( hetParams->earthfile, sizeof( hetParams->earthfile ), "%s",
+                inputParams->earthfile );
+      snprintf( hetParams->sunfile, sizeof( hetParams->sunfile ), "%s",
+                inputParams->sunfile );
+
+      if ( inputParams->timeCorrFile != NULL ) {
+        hetParams->timeCorrFile = XLALStringDuplicate( inputParams->timeCorrFile );
+
+        if ( PulsarCheckParam( hetParams->hetUpdate, "UNITS" ) ) {
+          if ( !strcmp( PulsarGetStringParam( hetParams->hetUpdate, "UNITS" ), "TDB" ) ) {
+            hetParams->ttype = TIMECORRECTION_TDB;  /* use TDB units i.e. TEMPO standard */
+          } else {
+            hetParams->ttype = TIMECORRECTION_TCB;  /* default to TCB i.e. TEMPO2 standard */
+          }
         }
       }
+    }
 
+    /* set filters - these are held for the whole data set */
+    if ( inputParams->filterknee > 0.0 ) {
+      set_filters( &psr->iirFilters, inputParams->filterknee, inputParams->samplerate );
     }
-    if ( verbose ) {
-      fprintf( stderr, "I've output the data.\n" );
+
+    /* set output file, checking if it should be gzipped due to a ".gz" suffix */
+    snprintf( psr->outputfile, sizeof( psr->outputfile ), "%s", psroutputfile );
+    psr->gzipoutput = inputParams->gzipoutput;
+    if ( XLALStringCaseSubstring( psr->outputfile, ".gz" ) != NULL ) {
+      if ( inputParams->binaryoutput ) {
+        XLALPrintError( "Error... do not use a \".gz\" file extension for a binary output file\n" );
+      }
+
+      psr->gzipoutput = 1;
+      CHAR *strloc = XLALStringCaseSubstring( psr->outputfile, ".gz" );
+      strloc[0] = '\0';
     }
 
-    fclose( fpout );
+    if ( write_output_header( psr->outputfile, argc, argv ) != XLAL_SUCCESS ) {
+      fclose( fp );
+      destroy_pulsar_list( pulsars, npulsars );
+      return 1;
+    }
+  }
 
-    XLALDestroyCOMPLEX16TimeSeries( resampData );
+  fclose( fp );
 
-    XLALDestroyREAL8Vector( times );
-  } while ( count < numSegs && ( inputParams.heterodyneflag == 0 || inputParams.heterodyneflag == 3 ) );
+  if ( npulsars == 0 ) {
+    fprintf( stderr, "Error... no pulsars given in pulsar list file %s!\n", inputParams->pulsarlist );
+    destroy_pulsar_list( pulsars, npulsars );
+    return 1;
+  }
 
-  /* check if any data has been read - if not exit with an error */
-  if ( nodata && ( inputParams.heterodyneflag == 0 || inputParams.heterodyneflag == 3 ) ) {
-    fprintf( stderr, "Error... no data was read in.\n" );
-    exit( 1 );
+  if ( verbose ) {
+    fprintf( stderr, "I've read in the parameters for %u pulsars.\n", npulsars );
   }
 
-  /* check whether to gzip the output */
-  if ( !inputParams.binaryoutput && inputParams.gzipoutput ) {
-    fprintf( stderr, "Outputing %s to gzipped file\n", outputfile );
-    if ( XLALGzipTextFile( outputfile ) != XLAL_SUCCESS ) { // gzip it
-      XLALPrintError( "Error... problem gzipping the output file.\n" );
+  /* read in the ephemerides once and share them between all the pulsars */
+  if ( inputParams->heterodyneflag > 0 ) {
+    if ( ( edat = XLALInitBarycenter( inputParams->earthfile, inputParams->sunfile ) ) == NULL ) {
+      fprintf( stderr, "Error... can't read ephemeris files %s and %s!\n", inputParams->earthfile, inputParams->sunfile );
+      destroy_pulsar_list( pulsars, npulsars );
+      return 1;
     }
-  }
 
-#if TRACKMEMUSE
-  fprintf( stderr, "Memory usage after completion of main loop:\n" );
-  printmemuse();
-#endif
+    if ( inputParams->timeCorrFile != NULL ) {
+      if ( ( tdat = XLALInitTimeCorrections( inputParams->timeCorrFile ) ) == NULL ) {
+        fprintf( stderr, "Error... can't read time correction file %s!\n", inputParams->timeCorrFile );
+        XLALDestroyEphemerisData( edat );
+        destroy_pulsar_list( pulsars, npulsars );
+        return 1;
+      }
+    }
 
-  fprintf( stderr, "Heterodyning complete.\n" );
+    for ( UINT4 j = 0; j < npulsars; j++ ) {
+      pulsars[j].hetParams.edat = edat;
+      pulsars[j].hetParams.tdat = tdat;
+    }
+  }
 
-  XLALDestroyINT4Vector( stops );
-  XLALDestroyINT4Vector( starts );
+  /* get science segment lists - allocate initial memory for starts and stops */
+  if ( ( starts = XLALCreateINT4Vector( 1 ) ) == NULL ||
+       ( stops = XLALCreateINT4Vector( 1 ) ) == NULL ) {
+    XLALPrintError( "Error, allocating segment list memory.\n" );
+  }
+  numSegs = get_segment_list( starts, stops, inputParams->segfile,
+                              inputParams->heterodyneflag );
+  if ( ( starts = XLALResizeINT4Vector( starts, numSegs ) ) == NULL ||
+       ( stops = XLALResizeINT4Vector( stops, numSegs ) ) == NULL ) {
+    XLALPrintError( "Error, re-allocating segment list memory.\n" );
+  }
 
-  if ( inputParams.heterodyneflag == 0 || inputParams.heterodyneflag == 3 ) {
-    XLALDestroyCache( cache );
+  /* read in frame filenames */
+  if ( ( cache = XLALCacheImport( inputParams->datafile ) ) == NULL ) {
+    fprintf( stderr, "Error... There's been a problem reading in the frame \
+data!\n" );
+    XLALDestroyEphemerisData( edat );
+    XLALDestroyTimeCorrectionData( tdat );
+    XLALDestroyINT4Vector( stops );
+    XLALDestroyINT4Vector( starts );
+    destroy_pulsar_list( pulsars, npulsars );
+    return 1;
   }
 
-  if ( inputParams.filterknee > 0. ) {
-    XLALDestroyREAL8IIRFilter( iirFilters.filter1Re );
-    XLALDestroyREAL8IIRFilter( iirFilters.filter1Im );
-    XLALDestroyREAL8IIRFilter( iirFilters.filter2Re );
-    XLALDestroyREAL8IIRFilter( iirFilters.filter2Im );
-    XLALDestroyREAL8IIRFilter( iirFilters.filter3Re );
-    XLALDestroyREAL8IIRFilter( iirFilters.filter3Im );
+  /* read in each chunk of frame data once, and heterodyne it for all pulsars */
+  do {
+    REAL8 gpstime;
+    INT4 duration, chunkstatus;
+    REAL8TimeSeries *datareal = NULL;
 
-    if ( verbose ) {
-      fprintf( stderr, "I've destroyed all filters.\n" );
+    if ( ( chunkstatus = get_data_chunk( &datareal, &gpstime, &duration, cache, starts,
+                                         stops, numSegs, &count, inputParams ) ) > 0 ) {
+      continue;
+    } else if ( chunkstatus < 0 ) {
+      break;
     }
+
+    /* if any data has successfully been read-in set flag to 0 */
+    nodata = 0;
+
+    /* each pulsar works on its own copy of the data */
+    #pragma omp parallel for schedule(dynamic)
+    for ( UINT4 j = 0; j < npulsars; j++ ) {
+      HeterodyneParams hetParams = pulsars[j].hetParams;
+      COMPLEX16TimeSeries *data = NULL;
+      LIGOTimeGPS epochdummy;
+
+      epochdummy.gpsSeconds = 0;
+      epochdummy.gpsNanoSeconds = 0;
+
+      hetParams.timestamp = gpstime;
+      hetParams.length = inputParams->samplerate * duration;
+
+      if ( ( data = XLALCreateCOMPLEX16TimeSeries( "", &epochdummy,
+                    PulsarGetREAL8VectorParamIndividual( hetParams.het, "F0" ), 1. / inputParams->samplerate, &lalSecondUnit,
+                    ( INT4 )inputParams->samplerate * duration ) ) == NULL ) {
+        #pragma omp atomic write
+        errflag = 1;
+        continue;
+      }
+
+      /* put data into COMPLEX16 vector and set imaginary parts to zero */
+      for ( UINT4 i = 0; i < data->data->length; i++ ) {
+        data->data->data[i] = ( REAL8 )datareal->data->data[i];
+      }
+
+      XLALGPSSetREAL8( &data->epoch, hetParams.timestamp );
+
+      if ( process_data( data, NULL, hetParams, &pulsars[j].iirFilters, NULL, starts, stops,
+                         inputParams, pulsars[j].outputfile ) != XLAL_SUCCESS ) {
+        #pragma omp atomic write
+        errflag = 1;
+      }
+    }
+
+    XLALDestroyREAL8TimeSeries( datareal );
+
+    if ( errflag ) {
+      fprintf( stderr, "Error... problem heterodyning data between %d and %d.\n",
+               ( INT4 )gpstime, ( INT4 )gpstime + duration );
+      break;
+    }
+  } while ( count < numSegs );
+
+  XLALDestroyEphemerisData( edat );
+  XLALDestroyTimeCorrectionData( tdat );
+  XLALDestroyCache( cache );
+  XLALDestroyINT4Vector( stops );
+  XLALDestroyINT4Vector( starts );
+
+  if ( errflag ) {
+    destroy_pulsar_list( pulsars, npulsars );
+    return 1;
   }
 
-  if ( filtresp != NULL ) {
-    destroy_filter_response( filtresp );
+  /* check if any data has been read - if not exit with an error */
+  if ( nodata ) {
+    fprintf( stderr, "Error... no data was read in.\n" );
+    destroy_pulsar_list( pulsars, npulsars );
+    return 1;
   }
 
-  PulsarFreeParams( hetParams.het );
-  if ( inputParams.heterodyneflag == 2 || inputParams.heterodyneflag == 4 ) {
-    PulsarFreeParams( hetParams.hetUpdate );
+  for ( UINT4 j = 0; j < npulsars; j++ ) {
+    /* check whether to gzip the output */
+    if ( !inputParams->binaryoutput && pulsars[j].gzipoutput ) {
+      fprintf( stderr, "Outputing %s to gzipped file\n", pulsars[j].outputfile );
+      if ( XLALGzipTextFile( pulsars[j].outputfile ) != XLAL_SUCCESS ) { // gzip it
+        XLALPrintError( "Error... problem gzipping the output file.\n" );
+      }
+    }
   }
 
-#if TRACKMEMUSE
-  fprintf( stderr, "Memory use at the end of the code:\n" );
-  printmemuse();
-#endif
+  fprintf( stderr, "Heterodyning of %u pulsars complete.\n", npulsars );
+
+  destroy_pulsar_list( pulsars, npulsars );
 
   return 0;
 }
 
+/* function to free the parameters, filters and time correction file name of
+   each pulsar in a list, and the list itself */
+void destroy_pulsar_list( PulsarHeterodyne *pulsars, UINT4 npulsars )
+{
+  for ( UINT4 j = 0; j < npulsars; j++ ) {
+    destroy_filters( &pulsars[j].iirFilters );
+    XLALFree( pulsars[j].hetParams.timeCorrFile );
+    PulsarFreeParams( pulsars[j].hetParams.het );
+  }
+
+  XLALFree( pulsars );
+}
+
 /* function to parse the input arguments */
 void get_input_args( InputParams *inputParams, int argc, char *argv[] )
 {
@@ -845,10 +1208,11 @@ void get_input_args( InputParams *inputParams, int argc, char *argv[] )
     { "legacy-input",             no_argument,     NULL, 'L' },
     { "verbose",                  no_argument,     NULL, 'v' },
     { "output-phase",             no_argument,     NULL, 'P' },
+    { "pulsar-list",              required_argument,  0, 'W' },
     { 0, 0, 0, 0 }
   };
 
-  char args[] = "hi:p:z:f:g:k:s:r:d:D:c:o:e:S:t:l:R:C:F:O:T:m:G:H:M:ABbZLvP";
+  char args[] = "hi:p:z:f:g:k:s:r:d:D:c:o:e:S:t:l:R:C:F:O:T:m:G:H:M:W:ABbZLvP";
   char *program = argv[0];
 
   /* set defaults */
@@ -883,6 +1247,9 @@ the pulsar parameter file */
 
   inputParams->timeCorrFile = NULL;
 
+  inputParams->pulsarlist[0] = '\0'; /* default is to heterodyne a single pulsar */
+  inputParams->paramfileupdate[0] = '\0'; /* default is no updated parameter file */
+
   /* get input arguments */
   while ( 1 ) {
     int option_index = 0;
@@ -1073,6 +1440,10 @@ the pulsar parameter file */
     case 'P':
       inputParams->outputPhase = 1;
       break;
+    case 'W': /* list of pulsar parameter and output files */
+      snprintf( inputParams->pulsarlist, sizeof( inputParams->pulsarlist ), "%s",
+                LALoptarg );
+      break;
     case '?':
       fprintf( stderr, "unknown error while parsing options\n" );
       break;
@@ -1121,6 +1492,25 @@ heterodyne!\n" );
       exit( 1 );
     }
   }
+
+  /* check that a list of pulsars is only used when reading frame data */
+  if ( inputParams->pulsarlist[0] != '\0' ) {
+    if ( inputParams->heterodyneflag != 0 && inputParams->heterodyneflag != 3 ) {
+      fprintf( stderr, "Error... a pulsar list can only be used for a coarse \
+heterodyne or a full heterodyne in one go!\n" );
+      exit( 1 );
+    }
+    if ( inputParams->outputPhase ) {
+      fprintf( stderr, "Error... the phase evolution cannot be output when using \
+a pulsar list!\n" );
+      exit( 1 );
+    }
+    if ( inputParams->paramfileupdate[0] != '\0' ) {
+      fprintf( stderr, "Error... an updated parameter file cannot be used with \
+a pulsar list!\n" );
+      exit( 1 );
+    }
+  }
 }
 
 /* heterodyne data function */
@@ -1188,12 +1578,21 @@ void heterodyne_data( COMPLEX16TimeSeries *data, REAL8Vector *times,
 
   /* set up ephemeris files */
   if ( hetParams.heterodyneflag > 0 ) {
-    XLAL_CHECK_VOID( ( edat = XLALInitBarycenter( hetParams.earthfile, hetParams.sunfile ) ) != NULL, XLAL_EFUNC );
+    /* use the ephemerides if already read in, e.g. if shared between pulsars */
+    if ( hetParams.edat != NULL ) {
+      edat = hetParams.edat;
+    } else {
+      XLAL_CHECK_VOID( ( edat = XLALInitBarycenter( hetParams.earthfile, hetParams.sunfile ) ) != NULL, XLAL_EFUNC );
+    }
 
     /* get files containing Einstein delay correction look-up table */
     if ( hetParams.ttype != TIMECORRECTION_ORIGINAL ) {
-      XLAL_CHECK_VOID( ( tdat = XLALInitTimeCorrections(
-                                  hetParams.timeCorrFile ) ) != NULL, XLAL_EFUNC );
+      if ( hetParams.tdat != NULL ) {
+        tdat = hetParams.tdat;
+      } else {
+        XLAL_CHECK_VOID( ( tdat = XLALInitTimeCorrections(
+                                    hetParams.timeCorrFile ) ) != NULL, XLAL_EFUNC );
+      }
     }
 
     /* set up location of detector */
@@ -1610,9 +2009,11 @@ void heterodyne_data( COMPLEX16TimeSeries *data, REAL8Vector *times,
   }
 
   if ( hetParams.heterodyneflag > 0 ) {
-    XLALDestroyEphemerisData( edat );
+    if ( hetParams.edat == NULL ) {
+      XLALDestroyEphemerisData( edat );
+    }
 
-    if ( hetParams.ttype != TIMECORRECTION_ORIGINAL ) {
+    if ( hetParams.ttype != TIMECORRECTION_ORIGINAL && hetParams.tdat == NULL ) {
       XLALDestroyTimeCorrectionData( tdat );
     }
   }
@@ -1752,21 +2153,18 @@ void set_filters( Filters *iirFilters, REAL8 filterKnee, REAL8 samplerate )
   zpg->gain = I * wc * wc * wc;
   XLALWToZCOMPLEX16ZPGFilter( zpg );
 
-  /* create IIR filters */
-  iirFilters->filter1Re = NULL;
-  iirFilters->filter1Im = NULL;
-  iirFilters->filter1Re = XLALCreateREAL8IIRFilter( zpg );
-  iirFilters->filter1Im = XLALCreateREAL8IIRFilter( zpg );
-
-  iirFilters->filter2Re = NULL;
-  iirFilters->filter2Im = NULL;
-  iirFilters->filter2Re = XLALCreateREAL8IIRFilter( zpg );
-  iirFilters->filter2Im = XLALCreateREAL8IIRFilter( zpg );
-
-  iirFilters->filter3Re = NULL;
-  iirFilters->filter3Im = NULL;
-  iirFilters->filter3Re = XLALCreateREAL8IIRFilter( zpg );
-  iirFilters->filter3Im = XLALCreateREAL8IIRFilter( zpg );
+  /* create three identical IIR filters, and a filter bank applying them in
+     turn to the real and imaginary parts of the data */
+  REAL8IIRFilter *stages[3];
+  for ( INT4 i = 0; i < 3; i++ ) {
+    stages[i] = XLALCreateREAL8IIRFilter( zpg );
+  }
+  if ( ( iirFilters->filterBank = XLALCreateREAL8IIRFilterBank( stages, 3, 2 ) ) == NULL ) {
+    XLALPrintError( "Error creating IIR filter bank.\n" );
+  }
+  for ( INT4 i = 0; i < 3; i++ ) {
+    XLALDestroyREAL8IIRFilter( stages[i] );
+  }
 
   /* destroy zpg filter */
   XLALDestroyCOMPLEX16ZPGFilter( zpg );
@@ -1775,22 +2173,55 @@ void set_filters( Filters *iirFilters, REAL8 filterKnee, REAL8 samplerate )
 /* function to low-pass filter the data using three third order Butterworth IIR filters */
 void filter_data( COMPLEX16TimeSeries *data, Filters *iirFilters )
 {
-  COMPLEX16 tempData;
-  INT4 i = 0;
+  if ( XLALIIRFilterBankCOMPLEX16Vector( data->data, iirFilters->filterBank ) != XLAL_SUCCESS ) {
+    XLALPrintError( "Error filtering data.\n" );
+  }
+}
 
-  for ( i = 0; i < ( INT4 )data->data->length; i++ ) {
-    tempData = LALDIIRFilter( creal( data->data->data[i] ), iirFilters->filter1Re ) +
-               I * LALDIIRFilter( cimag( data->data->data[i] ), iirFilters->filter1Im );
+/* function to destroy the low-pass filters */
+void destroy_filters( Filters *iirFilters )
+{
+  XLALDestroyREAL8IIRFilterBank( iirFilters->filterBank );
+  iirFilters->filterBank = NULL;
+}
 
-    data->data->data[i] = LALDIIRFilter( creal( tempData ), iirFilters->filter2Re ) +
-                          I * LALDIIRFilter( cimag( tempData ), iirFilters->filter2Im );
+/* function to low-pass filter and average coarse heterodyned data down to a new
+   sample rate in a single pass, giving the same result as filter_data() followed
+   by resample_data() - the filter state carries over between calls */
+COMPLEX16TimeSeries *filter_resample_data( COMPLEX16TimeSeries *data, REAL8Vector *times,
+    Filters *iirFilters, REAL8 sampleRate, REAL8 resampleRate )
+{
+  COMPLEX16TimeSeries *series = NULL;
+  INT4 size = ( INT4 )ROUND( sampleRate / resampleRate );
+  INT4 length = data->data->length / size;
+  INT4 count = 0;
+  REAL8 t0 = XLALGPSGetREAL8( &data->epoch );
+
+  if ( ( series = XLALCreateCOMPLEX16TimeSeries( "", &data->epoch, 0., 1. / resampleRate,
+                  &lalSecondUnit, length ) ) == NULL ) {
+    XLALPrintError( "Error creating time series for resampled data.\n" );
+    return NULL;
+  }
 
-    tempData = LALDIIRFilter( creal( data->data->data[i] ), iirFilters->filter3Re ) +
-               I * LALDIIRFilter( cimag( data->data->data[i] ), iirFilters->filter3Im );
+  if ( XLALIIRFilterDecimateBankCOMPLEX16Vector( series->data, data->data, size,
+       iirFilters->filterBank ) != XLAL_SUCCESS ) {
+    XLALPrintError( "Error filtering and resampling data.\n" );
+  }
 
-    data->data->data[i] = creal( tempData ) + I * cimag( tempData );
+  for ( count = 0; count < length; count++ ) {
+    if ( sampleRate != resampleRate ) {
+      times->data[count] = t0 + ( 1. / resampleRate ) / 2. + ( ( REAL8 )count / resampleRate );
+    } else {
+      times->data[count] = t0 + ( ( REAL8 )count / resampleRate );
+    }
   }
 
+  if ( ( INT4 )times->length > length )
+    if ( ( times = XLALResizeREAL8Vector( times, length ) ) == NULL ) {
+      XLALPrintError( "Error resizing resampled times.\n" );
+    }
+
+  return series;
 }
 
 /* function to average the data at one sample rate down to a new sample rate */
@@ -2413,24 +2844,15 @@ FilterResponse *create_filter_response( REAL8 filterKnee )
       dataTmpIm = 1.;
     }
 
-    dataTmpRe = LALDIIRFilter( dataTmpRe, testFilters.filter1Re );
-    dataTmpRe = LALDIIRFilter( dataTmpRe, testFilters.filter2Re );
-    dataTmpRe = LALDIIRFilter( dataTmpRe, testFilters.filter3Re );
-
-    dataTmpIm = LALDIIRFilter( dataTmpIm, testFilters.filter1Im );
-    dataTmpIm = LALDIIRFilter( dataTmpIm, testFilters.filter2Im );
-    dataTmpIm = LALDIIRFilter( dataTmpIm, testFilters.filter3Im );
-
     data->data[i] = dataTmpRe + I * dataTmpIm;
   }
 
+  if ( XLALIIRFilterBankCOMPLEX16Vector( data, testFilters.filterBank ) != XLAL_SUCCESS ) {
+    XLALPrintError( "Error filtering data for filter response.\n" );
+  }
+
   /* destroy filters */
-  XLALDestroyREAL8IIRFilter( testFilters.filter1Re );
-  XLALDestroyREAL8IIRFilter( testFilters.filter1Im );
-  XLALDestroyREAL8IIRFilter( testFilters.filter2Re );
-  XLALDestroyREAL8IIRFilter( testFilters.filter2Im );
-  XLALDestroyREAL8IIRFilter( testFilters.filter3Re );
-  XLALDestroyREAL8IIRFilter( testFilters.filter3Im );
+  destroy_filters( &testFilters );
 
   /* FFT the data */
   if ( ( fftplan = XLALCreateForwardCOMPLEX16FFTPlan( srate * ttime, 1 ) ) == NULL ||
@@ -131,6 +131,11 @@ extern "C" {
                           if not this suffix will be appended\n"\
 " --output-phase (-P)      if set, output the phase evolution to a text file\n\
                           (for debugging purposes)\n"\
+" --pulsar-list (-W)       file containing a list of pulsars to heterodyne\n\
+                          from one read of the frame data, with a .par file\n\
+                          and an output file on each line (for coarse or\n\
+                          full heterodynes only; replaces --param-file and\n\
+                          --output-file)\n"\
 "\n"
 
 #define MAXDATALENGTH 256   /* maximum length of data to be read from frames */
@@ -202,6 +207,8 @@ typedef struct tagInputParams {
   INT4 gzipoutput;
   INT4 legacyinput;
   INT4 outputPhase;
+
+  CHAR pulsarlist[256];
 } InputParams;
 
 typedef struct tagHeterodyneParams {
@@ -221,17 +228,24 @@ typedef struct tagHeterodyneParams {
   CHAR *timeCorrFile;
   TimeCorrectionType ttype;
   INT4 outputPhase;
+
+  EphemerisData *edat; /* ephemeris shared between pulsars (read in by heterodyne_data if NULL) */
+  TimeCorrectionData *tdat; /* time correction data shared between pulsars (read in by heterodyne_data if NULL) */
 } HeterodyneParams;
 
 typedef struct tagFilters {
-  REAL8IIRFilter *filter1Re; /* filters for real and imaginary parts of heterodyed data */
-  REAL8IIRFilter *filter1Im;
-  REAL8IIRFilter *filter2Re;
-  REAL8IIRFilter *filter2Im;
-  REAL8IIRFilter *filter3Re;
-  REAL8IIRFilter *filter3Im;
+  REAL8IIRFilterBank *filterBank; /* cascade of three filters applied to the real and
+                                     imaginary parts of heterodyned data as two lanes */
 } Filters;
 
+/* structure holding the state for one pulsar when heterodyning a list of pulsars */
+typedef struct tagPulsarHeterodyne {
+  HeterodyneParams hetParams;
+  Filters iirFilters; /* filters are held for the whole data set for each pulsar */
+  CHAR outputfile[256];
+  INT4 gzipoutput;
+} PulsarHeterodyne;
+
 typedef struct tagFilterResponse {
   REAL8Vector *freqResp;
   REAL8Vector *phaseResp;
@@ -250,9 +264,34 @@ void set_filters( Filters *iirFilters, REAL8 filterKnee, REAL8 samplerate );
 
 void filter_data( COMPLEX16TimeSeries *data, Filters *iirFilters );
 
+void destroy_filters( Filters *iirFilters );
+
+COMPLEX16TimeSeries *filter_resample_data( COMPLEX16TimeSeries *data, REAL8Vector *times,
+    Filters *iirFilters, REAL8 sampleRate, REAL8 resampleRate );
+
 COMPLEX16TimeSeries *resample_data( COMPLEX16TimeSeries *data, REAL8Vector *times, INT4Vector
                                     *starts, INT4Vector *stops, REAL8 sampleRate, REAL8 resampleRate, INT4 heterodyneflag );
 
+/* heterodyne, filter, resample, calibrate and output a chunk of data - the data and times are destroyed */
+INT4 process_data( COMPLEX16TimeSeries *data, REAL8Vector *times, HeterodyneParams hetParams,
+                   Filters *iirFilters, FilterResponse *filtResp, INT4Vector *starts, INT4Vector *stops,
+                   InputParams *inputParams, CHAR *outputfile );
+
+/* write the header to an output file */
+INT4 write_output_header( CHAR *outputfile, int argc, char *argv[] );
+
+/* read in the next chunk of frame data - returns 0 if data was read, 1 to skip to the next chunk,
+or -1 if there is no more data */
+INT4 get_data_chunk( REAL8TimeSeries **datareal, REAL8 *gpstime, INT4 *duration, LALCache *cache,
+                     INT4Vector *starts, INT4Vector *stops, INT4 numSegs, INT4 *count,
+                     InputParams *inputParams );
+
+/* heterodyne a list of pulsars, reading in each chunk of frame data only once */
+INT4 heterodyne_pulsar_list( InputParams *inputParams, int argc, char *argv[] );
+
+/* free a list of pulsars set up by heterodyne_pulsar_list */
+void destroy_pulsar_list( PulsarHeterodyne *pulsars, UINT4 npulsars );
+
 /* function to extract the frame time and duration from the file name */
 void get_frame_times( CHAR *framefile, REAL8 *gpstime, INT4 *duration );
 
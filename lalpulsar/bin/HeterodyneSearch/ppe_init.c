@@ -1117,7 +1117,7 @@ void sum_data( LALInferenceRunState *runState )
   if ( LALInferenceGetProcParamVal( runState->commandLine, "--gaussian-like" ) ) {
     gaussianLike = 1;
   }
-  if ( LALInferenceGetProcParamVal( runState->commandLine, "--roq" ) ) {
+  if ( use_roq( runState ) ) {
     roq = 1;
   }
   if ( LALInferenceGetProcParamVal( runState->commandLine, "--nonGR" ) ) {
@@ -1451,6 +1451,11 @@ void sum_data( LALInferenceRunState *runState )
     check_and_add_fixed_variable( ifomodel->params, "sumData", &sumdat, LALINFERENCE_REAL8Vector_t );
 
     if ( !roq ) {
+      /* remove any ROQ flag set by a previous call (e.g. when creating an injection) */
+      if ( LALInferenceCheckVariable( ifomodel->params, "roq" ) ) {
+        LALInferenceRemoveVariable( ifomodel->params, "roq" );
+      }
+
       check_and_add_fixed_variable( ifomodel->params, "sumP", &sumP, LALINFERENCE_REAL8Vector_t );
       check_and_add_fixed_variable( ifomodel->params, "sumC", &sumC, LALINFERENCE_REAL8Vector_t );
       check_and_add_fixed_variable( ifomodel->params, "sumPC", &sumPC, LALINFERENCE_REAL8Vector_t );
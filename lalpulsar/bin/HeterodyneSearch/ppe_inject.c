@@ -668,7 +668,7 @@ void get_loudest_snr( LALInferenceRunState *runState )
   LALInferenceCopyVariables( runState->livePoints[Nlive - 1], loudestParams );
 
   /* if using ROQ we need to reinstate the full time stamp vector to compute the model for the SNR calculation */
-  if ( LALInferenceGetProcParamVal( runState->commandLine, "--roq" ) ) {
+  if ( use_roq( runState ) ) {
     roq = 1;
 
     while ( ifo_model ) {
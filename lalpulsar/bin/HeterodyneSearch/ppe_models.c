@@ -28,10 +28,22 @@
 
 #include "config.h"
 #include "ppe_models.h"
+#include "ppe_utils.h"
 #include <lal/SinCosLUT.h>
 
 #define SQUARE(x) ( (x) * (x) )
 
+/** Names of parameters that only affect the signal amplitude (these may also have a "_F" suffix) */
+static const CHAR *amplitudeParams[] = { "H0", "Q22", "DIST", "COSIOTA", "IOTA", "PSI", "PHI0", "C21", "C22", "PHI21", "PHI22",
+                                         "I21", "I31", "LAMBDA", "COSTHETA", "THETA", "HPLUS", "HCROSS", "HSCALARB", "HSCALARL",
+                                         "HVECTORX", "HVECTORY", "PHI0SCALAR", "PSISCALAR", "PHI0VECTOR", "PSIVECTOR",
+                                         "PHI0TENSOR", "PSITENSOR", NULL
+                                       };
+
+static UINT4 is_amplitude_parameter( const CHAR *name );
+static REAL8Vector *get_phase_cache_key( PulsarParameters *params, LALInferenceIFOModel *ifo, REAL8 freqFactor );
+static REAL8Vector *get_response_series( LALInferenceIFOModel *ifo, UINT4 nonGR );
+
 /******************************************************************************/
 /*                            MODEL FUNCTIONS                                 */
 /******************************************************************************/
@@ -424,26 +436,41 @@ void pulsar_model( PulsarParameters *params, LALInferenceIFOModel *ifo )
 
     while ( ifomodel2 ) {
       for ( j = 0; j < freqFactors->length; j++ ) {
-        REAL8Vector *dphi = NULL;
-        COMPLEX16 M = 0., expp = 0.;
+        COMPLEX16Vector *expphi = NULL;
 
         length = ifomodel2->compTimeSignal->data->length;
 
-        /* reheterodyne with the phase */
-        if ( ( dphi = get_phase_model( params, ifomodel2, freqFactors->data[j] ) ) != NULL ) {
-          for ( i = 0; i < length; i++ ) {
-            /* phase factor by which to multiply the (almost) DC signal model. NOTE: this does not try to undo
-             * the signal modulation in the data, but instead replicates it in the model, hence the positive
-             * phase rather than a negative phase in the cexp function. */
-            expp = cexp( LAL_TWOPI * I * dphi->data[i] );
+        /* only recompute the phase factors if any of the parameters that affect the phase have changed
+         * since the last call, as they do not depend on the amplitude parameters */
+        REAL8Vector *phasekey = get_phase_cache_key( params, ifomodel2, freqFactors->data[j] );
+        if ( check_and_update_cache_key( ifomodel2->params, "phase_cache_key", phasekey ) ) {
+          expphi = *( COMPLEX16Vector ** )LALInferenceGetVariable( ifomodel2->params, "phase_cache" );
+        } else {
+          REAL8Vector *dphi = NULL;
+
+          if ( ( dphi = get_phase_model( params, ifomodel2, freqFactors->data[j] ) ) != NULL ) {
+            expphi = XLALCreateCOMPLEX16Vector( length );
 
-            M = ifomodel2->compTimeSignal->data->data[i];
+            for ( i = 0; i < length; i++ ) {
+              /* phase factor by which to multiply the (almost) DC signal model. NOTE: this does not try to undo
+               * the signal modulation in the data, but instead replicates it in the model, hence the positive
+               * phase rather than a negative phase in the cexp function. */
+              expphi->data[i] = cexp( LAL_TWOPI * I * dphi->data[i] );
+            }
 
-            /* heterodyne */
-            ifomodel2->compTimeSignal->data->data[i] = M * expp;
+            XLALDestroyREAL8Vector( dphi );
+            check_and_add_fixed_variable( ifomodel2->params, "phase_cache", &expphi, LALINFERENCE_COMPLEX16Vector_t );
+          } else {
+            /* no phase model, so make sure the cache is not used */
+            LALInferenceRemoveVariable( ifomodel2->params, "phase_cache_key" );
           }
+        }
 
-          XLALDestroyREAL8Vector( dphi );
+        /* reheterodyne with the phase */
+        if ( expphi != NULL ) {
+          for ( i = 0; i < length; i++ ) {
+            ifomodel2->compTimeSignal->data->data[i] *= expphi->data[i];
+          }
         }
 
         ifomodel2 = ifomodel2->next;
@@ -934,7 +961,7 @@ void get_amplitude_model( PulsarParameters *pars, LALInferenceIFOModel *ifo )
 {
   UINT4 i = 0, j = 0, length;
 
-  REAL8 T, twopsi;
+  REAL8 twopsi;
   REAL8 cosiota = PulsarGetREAL8ParamOrZero( pars, "COSIOTA" );
   REAL8 siniota = sin( acos( cosiota ) );
   REAL8 s2psi = 0., c2psi = 0., spsi = 0., cpsi = 0.;
@@ -1029,86 +1056,30 @@ void get_amplitude_model( PulsarParameters *pars, LALInferenceIFOModel *ifo )
       }
 
       if ( varyphase || roq ) { /* have to compute the full time domain signal */
-        REAL8Vector *sidDayFrac = NULL;
-        REAL8 tsv, tsteps;
-
-        REAL8Vector *LUfplus = NULL, *LUfcross = NULL, *LUfx = NULL, *LUfy = NULL, *LUfb = NULL, *LUfl = NULL;
-
-        /* set lookup table parameters */
-        tsteps = ( REAL8 )( *( INT4 * )LALInferenceGetVariable( ifo->params, "timeSteps" ) );
-        tsv = LAL_DAYSID_SI / tsteps;
-
-        LUfplus = *( REAL8Vector ** )LALInferenceGetVariable( ifo->params, "a_response_tensor" );
-        LUfcross = *( REAL8Vector ** )LALInferenceGetVariable( ifo->params, "b_response_tensor" );
-
-        if ( nonGR ) {
-          LUfx = *( REAL8Vector ** )LALInferenceGetVariable( ifo->params, "a_response_vector" );
-          LUfy = *( REAL8Vector ** )LALInferenceGetVariable( ifo->params, "b_response_vector" );
-          LUfb = *( REAL8Vector ** )LALInferenceGetVariable( ifo->params, "a_response_scalar" );
-          LUfl = *( REAL8Vector ** )LALInferenceGetVariable( ifo->params, "b_response_scalar" );
-        }
-
-        /* get the sidereal time since the initial data point % sidereal day */
-        sidDayFrac = *( REAL8Vector ** )LALInferenceGetVariable( ifo->params, "siderealDay" );
+        /* get the antenna pattern functions at each time stamp */
+        REAL8Vector *respSeries = get_response_series( ifo, nonGR );
+        UINT4 nresp = ( nonGR ? 6 : 2 );
 
         length = IFO_XTRA_DATA( ifo )->times->length;
 
         for ( i = 0; i < length; i++ ) {
-          REAL8 plus00, plus01, cross00, cross01, plus = 0., cross = 0.;
-          REAL8 x00, x01, y00, y01, b00, b01, l00, l01;
-          REAL8 timeScaled, timeMin, timeMax;
-          REAL8 plusT = 0., crossT = 0., x = 0., y = 0., xT = 0., yT = 0., b = 0., l = 0.;
-          INT4 timebinMin, timebinMax;
-
-          /* set the time bin for the lookup table */
-          /* sidereal day in secs*/
-          T = sidDayFrac->data[i];
-          timebinMin = ( INT4 )fmod( floor( T / tsv ), tsteps );
-          timeMin = timebinMin * tsv;
-          timebinMax = ( INT4 )fmod( timebinMin + 1, tsteps );
-          timeMax = timeMin + tsv;
-
-          /* get values of matrix for linear interpolation */
-          plus00 = LUfplus->data[timebinMin];
-          plus01 = LUfplus->data[timebinMax];
-
-          cross00 = LUfcross->data[timebinMin];
-          cross01 = LUfcross->data[timebinMax];
-
-          /* rescale time for linear interpolation on a unit square */
-          timeScaled = ( T - timeMin ) / ( timeMax - timeMin );
+          const REAL8 *resp = &respSeries->data[nresp * i];
+          REAL8 plusT, crossT;
 
-          plus = plus00 + ( plus01 - plus00 ) * timeScaled;
-          cross = cross00 + ( cross01 - cross00 ) * timeScaled;
-
-          plusT = plus * c2psi + cross * s2psi;
-          crossT = cross * c2psi - plus * s2psi;
-
-          if ( nonGR ) {
-            x00 = LUfx->data[timebinMin];
-            x01 = LUfx->data[timebinMax];
-            y00 = LUfy->data[timebinMin];
-            y01 = LUfy->data[timebinMax];
-            b00 = LUfb->data[timebinMin];
-            b01 = LUfb->data[timebinMax];
-            l00 = LUfl->data[timebinMin];
-            l01 = LUfl->data[timebinMax];
-
-            x = x00 + ( x01 - x00 ) * timeScaled;
-            y = y00 + ( y01 - y00 ) * timeScaled;
-            b = b00 + ( b01 - b00 ) * timeScaled;
-            l = l00 + ( l01 - l00 ) * timeScaled;
-
-            xT = x * cpsi + y * spsi;
-            yT = y * cpsi - x * spsi;
-          }
+          plusT = resp[0] * c2psi + resp[1] * s2psi;
+          crossT = resp[1] * c2psi - resp[0] * s2psi;
 
           /* create the complex signal amplitude model appropriate for the harmonic */
           ifo->compTimeSignal->data->data[i] = ( Cplus * plusT ) + ( Ccross * crossT );
 
           /* add non-GR components if required */
           if ( nonGR ) {
-            ifo->compTimeSignal->data->data[i] += ( Cx * xT ) + ( Cy * yT ) + Cb * b + Cl * l;
+            REAL8 xT, yT;
+
+            xT = resp[2] * cpsi + resp[3] * spsi;
+            yT = resp[3] * cpsi - resp[2] * spsi;
+
+            ifo->compTimeSignal->data->data[i] += ( Cx * xT ) + ( Cy * yT ) + Cb * resp[4] + Cl * resp[5];
           }
         }
       } else { /* just have to calculate the values to multiply the pre-summed data */
@@ -1150,6 +1121,162 @@ void get_amplitude_model( PulsarParameters *pars, LALInferenceIFOModel *ifo )
 }
 
 
+/**
+ * \brief Check whether a parameter only affects the signal amplitude
+ *
+ * \param name [in] The parameter name
+ *
+ * \return 1 if the parameter is an amplitude parameter, 0 otherwise
+ */
+static UINT4 is_amplitude_parameter( const CHAR *name )
+{
+  for ( UINT4 i = 0; amplitudeParams[i] != NULL; i++ ) {
+    size_t len = strlen( amplitudeParams[i] );
+    if ( !strncmp( name, amplitudeParams[i], len ) && ( name[len] == '\0' || !strcmp( &name[len], "_F" ) ) ) {
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+
+/**
+ * \brief Get a key describing the inputs to the phase model
+ *
+ * The key contains the values of all the parameters that can affect the signal phase evolution (i.e. all those
+ * that are not amplitude parameters), along with the frequency factor and the number and range of the time
+ * stamps at which the phase is calculated. If the key is unchanged between calls to \c pulsar_model then the
+ * previously calculated phase factors can be reused.
+ *
+ * \param params [in] A set of pulsar parameters
+ * \param ifo [in] The ifo model structure containing the time stamps
+ * \param freqFactor [in] the multiplicative factor on the pulsar frequency for a particular model
+ *
+ * \return A vector containing the key
+ */
+static REAL8Vector *get_phase_cache_key( PulsarParameters *params, LALInferenceIFOModel *ifo, REAL8 freqFactor )
+{
+  LIGOTimeGPSVector *datatimes = IFO_XTRA_DATA( ifo )->times;
+  UINT4 nkey = 4, idx = 0;
+  PulsarParam *item = NULL;
+
+  /* count the number of values in the key */
+  for ( item = params->head; item != NULL; item = item->next ) {
+    if ( is_amplitude_parameter( item->name ) ) {
+      continue;
+    }
+    if ( item->type == PULSARTYPE_REAL8_t ) {
+      nkey++;
+    } else if ( item->type == PULSARTYPE_REAL8Vector_t ) {
+      nkey += ( *( REAL8Vector ** )item->value )->length;
+    }
+  }
+
+  REAL8Vector *key = XLALCreateREAL8Vector( nkey );
+
+  key->data[idx++] = freqFactor;
+  key->data[idx++] = ( REAL8 )datatimes->length;
+  key->data[idx++] = ( datatimes->length > 0 ? XLALGPSGetREAL8( &datatimes->data[0] ) : 0. );
+  key->data[idx++] = ( datatimes->length > 0 ? XLALGPSGetREAL8( &datatimes->data[datatimes->length - 1] ) : 0. );
+
+  for ( item = params->head; item != NULL; item = item->next ) {
+    if ( is_amplitude_parameter( item->name ) ) {
+      continue;
+    }
+    if ( item->type == PULSARTYPE_REAL8_t ) {
+      key->data[idx++] = *( REAL8 * )item->value;
+    } else if ( item->type == PULSARTYPE_REAL8Vector_t ) {
+      REAL8Vector *vec = *( REAL8Vector ** )item->value;
+      memcpy( &key->data[idx], vec->data, vec->length * sizeof( REAL8 ) );
+      idx += vec->length;
+    }
+  }
+
+  return key;
+}
+
+
+/**
+ * \brief Get the antenna pattern functions at each data time stamp
+ *
+ * The antenna pattern functions at each time stamp are linearly interpolated from the lookup tables created by
+ * \c response_lookup_table. As they do not depend on any of the search parameters they are only calculated once
+ * and stored in the \c response_cache variable, being recalculated only if the lookup tables' number of time
+ * steps or the sidereal times of the data change. The output vector contains the values for each time stamp
+ * consecutively, with the tensor plus and cross responses followed, for non-GR models, by the vector x and y and
+ * scalar breathing and longitudinal responses.
+ *
+ * \param ifo [in] The ifo model containing detector-specific parameters
+ * \param nonGR [in] Set if non-GR antenna pattern functions are required
+ *
+ * \return A vector of the antenna pattern functions
+ */
+static REAL8Vector *get_response_series( LALInferenceIFOModel *ifo, UINT4 nonGR )
+{
+  REAL8Vector *sidDayFrac = *( REAL8Vector ** )LALInferenceGetVariable( ifo->params, "siderealDay" );
+  REAL8 tsteps = ( REAL8 )( *( INT4 * )LALInferenceGetVariable( ifo->params, "timeSteps" ) );
+  REAL8 tsv = LAL_DAYSID_SI / tsteps;
+  UINT4 nresp = ( nonGR ? 6 : 2 ), length = sidDayFrac->length;
+
+  REAL8Vector *key = XLALCreateREAL8Vector( 5 );
+  key->data[0] = tsteps;
+  key->data[1] = ( REAL8 )nresp;
+  key->data[2] = ( REAL8 )length;
+  key->data[3] = ( length > 0 ? sidDayFrac->data[0] : 0. );
+  key->data[4] = ( length > 0 ? sidDayFrac->data[length - 1] : 0. );
+
+  if ( check_and_update_cache_key( ifo->params, "response_cache_key", key ) ) {
+    return *( REAL8Vector ** )LALInferenceGetVariable( ifo->params, "response_cache" );
+  }
+
+  REAL8Vector *LUfplus = NULL, *LUfcross = NULL, *LUfx = NULL, *LUfy = NULL, *LUfb = NULL, *LUfl = NULL;
+
+  LUfplus = *( REAL8Vector ** )LALInferenceGetVariable( ifo->params, "a_response_tensor" );
+  LUfcross = *( REAL8Vector ** )LALInferenceGetVariable( ifo->params, "b_response_tensor" );
+
+  if ( nonGR ) {
+    LUfx = *( REAL8Vector ** )LALInferenceGetVariable( ifo->params, "a_response_vector" );
+    LUfy = *( REAL8Vector ** )LALInferenceGetVariable( ifo->params, "b_response_vector" );
+    LUfb = *( REAL8Vector ** )LALInferenceGetVariable( ifo->params, "a_response_scalar" );
+    LUfl = *( REAL8Vector ** )LALInferenceGetVariable( ifo->params, "b_response_scalar" );
+  }
+
+  REAL8Vector *respSeries = XLALCreateREAL8Vector( nresp * length );
+
+  for ( UINT4 i = 0; i < length; i++ ) {
+    REAL8 *resp = &respSeries->data[nresp * i];
+    REAL8 T, timeScaled, timeMin, timeMax;
+    INT4 timebinMin, timebinMax;
+
+    /* set the time bin for the lookup table */
+    /* sidereal day in secs*/
+    T = sidDayFrac->data[i];
+    timebinMin = ( INT4 )fmod( floor( T / tsv ), tsteps );
+    timeMin = timebinMin * tsv;
+    timebinMax = ( INT4 )fmod( timebinMin + 1, tsteps );
+    timeMax = timeMin + tsv;
+
+    /* rescale time for linear interpolation on a unit square */
+    timeScaled = ( T - timeMin ) / ( timeMax - timeMin );
+
+    resp[0] = LUfplus->data[timebinMin] + ( LUfplus->data[timebinMax] - LUfplus->data[timebinMin] ) * timeScaled;
+    resp[1] = LUfcross->data[timebinMin] + ( LUfcross->data[timebinMax] - LUfcross->data[timebinMin] ) * timeScaled;
+
+    if ( nonGR ) {
+      resp[2] = LUfx->data[timebinMin] + ( LUfx->data[timebinMax] - LUfx->data[timebinMin] ) * timeScaled;
+      resp[3] = LUfy->data[timebinMin] + ( LUfy->data[timebinMax] - LUfy->data[timebinMin] ) * timeScaled;
+      resp[4] = LUfb->data[timebinMin] + ( LUfb->data[timebinMax] - LUfb->data[timebinMin] ) * timeScaled;
+      resp[5] = LUfl->data[timebinMin] + ( LUfl->data[timebinMax] - LUfl->data[timebinMin] ) * timeScaled;
+    }
+  }
+
+  check_and_add_fixed_variable( ifo->params, "response_cache", &respSeries, LALINFERENCE_REAL8Vector_t );
+
+  return respSeries;
+}
+
+
 /**
  * \brief Calculate the phase mismatch between two vectors of phases
  *
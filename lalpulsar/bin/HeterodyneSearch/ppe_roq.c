@@ -104,8 +104,10 @@ void generate_interpolant( LALInferenceRunState *runState )
   }
 
   /* check whether to use ROQ */
-  ppt = LALInferenceGetProcParamVal( runState->commandLine, "--roq" );
-  if ( !ppt ) {
+  if ( !use_roq( runState ) ) {
+    if ( LALInferenceGetProcParamVal( runState->commandLine, "--roq" ) ) {
+      fprintf( stderr, "Only amplitude parameters are being searched over, so the likelihood will be calculated without ROQ\n" );
+    }
     return;
   }
 
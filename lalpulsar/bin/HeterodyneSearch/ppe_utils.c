@@ -784,3 +784,58 @@ void check_and_add_fixed_variable( LALInferenceVariables *vars, const char *name
   }
   LALInferenceAddVariable( vars, name, value, type, LALINFERENCE_PARAM_FIXED );
 }
+
+
+/**
+ * \brief Check whether a cached quantity is still valid, and update the key describing it
+ *
+ * Cached quantities (e.g. model components that only depend on a subset of the parameters) are stored
+ * in a set of variables alongside a key vector holding the values they were computed from. This function
+ * compares \c key with the key stored under \c name. If they are identical it returns 1, otherwise
+ * \c key is stored in place of the old key and 0 is returned, in which case the caller should recompute
+ * the cached quantity. The function takes ownership of \c key.
+ *
+ * \param vars [in] The variables containing the cache
+ * \param name [in] The name of the key variable
+ * \param key [in] The key for the current parameters
+ *
+ * \return 1 if the cached quantity is valid, 0 otherwise
+ */
+UINT4 check_and_update_cache_key( LALInferenceVariables *vars, const char *name, REAL8Vector *key )
+{
+  if ( LALInferenceCheckVariable( vars, name ) ) {
+    REAL8Vector *oldkey = *( REAL8Vector ** )LALInferenceGetVariable( vars, name );
+
+    if ( oldkey->length == key->length && !memcmp( oldkey->data, key->data, key->length * sizeof( REAL8 ) ) ) {
+      XLALDestroyREAL8Vector( key );
+      return 1;
+    }
+  }
+
+  check_and_add_fixed_variable( vars, name, &key, LALINFERENCE_REAL8Vector_t );
+
+  return 0;
+}
+
+
+/**
+ * \brief Check whether the likelihood should be calculated using reduced order quadrature
+ *
+ * Reduced order quadrature (ROQ) is used if it has been requested with \c --roq and the search includes
+ * parameters that affect the signal phase evolution. If only the amplitude parameters are being searched
+ * over then the likelihood can be calculated exactly from sums of products of the antenna pattern and the
+ * data that are computed once (see \c sum_data), which is quicker than evaluating the model at the ROQ
+ * interpolation nodes, so the ROQ is not used.
+ *
+ * \param runState [in] The analysis information structure
+ *
+ * \return 1 if ROQ is to be used, 0 otherwise
+ */
+UINT4 use_roq( LALInferenceRunState *runState )
+{
+  if ( !LALInferenceGetProcParamVal( runState->commandLine, "--roq" ) ) {
+    return 0;
+  }
+
+  return LALInferenceCheckVariable( runState->threads[0].model->ifo->params, "varyphase" ) ? 1 : 0;
+}
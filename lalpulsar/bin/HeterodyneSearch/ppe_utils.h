@@ -48,6 +48,8 @@ void merge_data( COMPLEX16Vector *data, UINT4Vector **segs );
 
 INT4 count_csv( CHAR *csvline );
 void check_and_add_fixed_variable( LALInferenceVariables *vars, const char *name, void *value, LALInferenceVariableType type );
+UINT4 check_and_update_cache_key( LALInferenceVariables *vars, const char *name, REAL8Vector *key );
+UINT4 use_roq( LALInferenceRunState *runState );
 
 TimeCorrectionType XLALAutoSetEphemerisFiles( CHAR **efile, CHAR **sfile,
     CHAR **tfile,
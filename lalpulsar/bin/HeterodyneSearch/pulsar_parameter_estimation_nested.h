@@ -235,7 +235,9 @@ extern "C" {
 "\n"\
 " Reduced order quadrature (ROQ) parameters:\n"\
 " --roq               Set this to use reduced order quadrature to compute the\n\
-                     likelihood\n"\
+                     likelihood. This is only used if phase parameters are\n\
+                     being searched over, as otherwise the exact likelihood\n\
+                     is computed from pre-summed data more quickly\n"\
 " --ntraining         (UINT4) The number of training models used to generate an\n\
                      orthonormal basis of waveform models\n"\
 " --roq-tolerance     (REAL8) The tolerance used during the basis generation\n\
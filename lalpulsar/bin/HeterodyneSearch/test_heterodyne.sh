@@ -223,6 +223,41 @@ fi
 
 mv $COARSEFILE $COARSEFILE.off
 
+# run code in coarse heterodyne mode for both par files at once using a pulsar list
+echo Performing coarse heterodyne - mode 0 - with a pulsar list
+PLIST=pulsarlist.txt
+echo $PFILE $COARSEFILE.list > $PLIST
+echo $PFILEOFF $COARSEFILE.list.off >> $PLIST
+$CODENAME --heterodyne-flag 0 --ifo $DETECTOR --pulsar-list $PLIST --sample-rate $SRATE1 --resample-rate $SRATE2 --filter-knee $FKNEE --data-file $LOCATION/cachefile --seg-file $LOCATION/segfile --channel $CHANNEL --freq-factor 2
+
+# check the exit status of the code
+ret_code=$?
+if [ $ret_code != "0" ]; then
+        echo lalpulsar_heterodyne exited with error $ret_code!
+        exit 2
+fi
+
+# check that the data (i.e. excluding the header) matches that from the single pulsar runs
+for suffix in txt off; do
+  if [ $suffix = txt ]; then
+    LISTFILE=$COARSEFILE.list
+  else
+    LISTFILE=$COARSEFILE.list.off
+  fi
+  if [ ! -f $LISTFILE ]; then
+    echo Error! Code has not output a coarse heterodyne file from the pulsar list
+    exit 2
+  fi
+  grep -v "^%%" $COARSEFILE.$suffix > $LISTFILE.single.data
+  grep -v "^%%" $LISTFILE > $LISTFILE.data
+  if ! cmp -s $LISTFILE.single.data $LISTFILE.data; then
+    echo Error! Coarse heterodyne from the pulsar list does not match the single pulsar output
+    exit 2
+  fi
+  rm -f $LISTFILE.single.data $LISTFILE.data
+done
+rm -f $PLIST
+
 # set calibration files
 RESPFILE=H1response.txt
 
@@ -350,6 +385,60 @@ fi
 # move file
 mv $FINEFILE $FINEFILE.full
 
+# run code in one go for the offset parameter file, to compare with the pulsar list output
+echo Performing entire heterodyne in one go - mode 3 - with offset parameter file
+$CODENAME --ephem-earth-file $EEPHEM --ephem-sun-file $SEPHEM --ephem-time-file $TEPHEM --heterodyne-flag 3 --ifo $DETECTOR --pulsar $PSRNAME --param-file $PFILEOFF --sample-rate $SRATE1 --resample-rate $SRATE3 --filter-knee $FKNEE --data-file $LOCATION/cachefile --output-file $FINEFILE --channel $CHANNEL --seg-file $LOCATION/segfile --freq-factor 2 --calibrate --response-file $RESPFILE --stddev-thresh 5
+
+# check the exit status of the code
+ret_code=$?
+if [ $ret_code != "0" ]; then
+        echo lalpulsar_heterodyne exited with error $ret_code!
+        exit 2
+fi
+
+# check that it produced the right file
+if [ ! -f $FINEFILE ]; then
+        echo Error! Code has not output a fine heterodyned file
+        exit 2
+fi
+
+mv $FINEFILE $FINEFILE.fulloff
+
+# run code in one go for both par files at once using a pulsar list
+echo Performing entire heterodyne in one go - mode 3 - with a pulsar list
+PLIST=pulsarlist.txt
+echo $PFILE $FINEFILE.list > $PLIST
+echo $PFILEOFF $FINEFILE.list.off >> $PLIST
+$CODENAME --ephem-earth-file $EEPHEM --ephem-sun-file $SEPHEM --ephem-time-file $TEPHEM --heterodyne-flag 3 --ifo $DETECTOR --pulsar-list $PLIST --sample-rate $SRATE1 --resample-rate $SRATE3 --filter-knee $FKNEE --data-file $LOCATION/cachefile --channel $CHANNEL --seg-file $LOCATION/segfile --freq-factor 2 --calibrate --response-file $RESPFILE --stddev-thresh 5
+
+# check the exit status of the code
+ret_code=$?
+if [ $ret_code != "0" ]; then
+        echo lalpulsar_heterodyne exited with error $ret_code!
+        exit 2
+fi
+
+# check that the data (i.e. excluding the header) matches that from the single pulsar runs
+for suffix in full fulloff; do
+  if [ $suffix = full ]; then
+    LISTFILE=$FINEFILE.list
+  else
+    LISTFILE=$FINEFILE.list.off
+  fi
+  if [ ! -f $LISTFILE ]; then
+    echo Error! Code has not output a fine heterodyned file from the pulsar list
+    exit 2
+  fi
+  grep -v "^%%" $FINEFILE.$suffix > $LISTFILE.single.data
+  grep -v "^%%" $LISTFILE > $LISTFILE.data
+  if ! cmp -s $LISTFILE.single.data $LISTFILE.data; then
+    echo Error! Heterodyne in one go from the pulsar list does not match the single pulsar output
+    exit 2
+  fi
+  rm -f $LISTFILE.single.data $LISTFILE.data
+done
+rm -f $PLIST
+
 ################### REHETERODYNE THE ALREADY FINE HETERODYNED FILE #####
 echo Performing updating heterodyne of already fine heterodyned data
 $CODENAME --ephem-earth-file $EEPHEM --ephem-sun-file $SEPHEM --ephem-time-file $TEPHEM --heterodyne-flag 4 --ifo $DETECTOR --pulsar $PSRNAME --param-file $PFILEOFF --param-file-update $PFILE --sample-rate $SRATE3 --resample-rate $SRATE3 --filter-knee 0 --data-file $FINEFILE.off2 --output-file $FINEFILE --channel $CHANNEL --seg-file $LOCATION/segfile --freq-factor 2 --stddev-thresh 5
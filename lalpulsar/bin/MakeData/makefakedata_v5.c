@@ -101,6 +101,7 @@ typedef struct {
   UINT4 outPubObsRun;           /**< if >0, names SFTs using the public filename convention with this observing run number */
   UINT4 outPubRevision;         /**< if outPubObsRun>0, names SFTs using the public filename convention with this revision number */
   BOOLEAN outSingleSFT;         /**< use to output a single concatenated SFT */
+  BOOLEAN outSFTstream;         /**< generate and write SFTs one at a time, with bounded memory */
 
   CHAR *TDDfile;                /**< Filename for ASCII output time-series */
   CHAR *logfile;                /**< name of logfile */
@@ -159,6 +160,7 @@ int XLALInitMakefakedata( ConfigVars_t *cfg, UserVariables_t *uvar );
 
 int XLALWriteMFDlog( const char *logfile, const ConfigVars_t *cfg );
 int XLALFreeMem( ConfigVars_t *cfg );
+int XLALWriteStreamedSFTs( const ConfigVars_t *cfg, const UserVariables_t *uvar, const PulsarParamsVector *injectionSources, const CWMFDataParams *dataParams );
 
 BOOLEAN is_directory( const CHAR *fname );
 
@@ -199,6 +201,15 @@ main( int argc, char *argv[] )
   DataParams.fMin               = GV.fminOut;
   DataParams.Band               = GV.BandOut;
 
+  // if requested, generate SFTs one at a time and write them straight to file, then we're done
+  if ( uvar.outSFTstream ) {
+    XLAL_CHECK( XLALWriteStreamedSFTs( &GV, &uvar, injectionSources, &DataParams ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLALDestroyPulsarParamsVector( injectionSources );
+    XLALFreeMem( &GV );
+    LALCheckMemoryLeaks();
+    return 0;
+  }
+
   XLAL_CHECK( XLALCWMakeFakeMultiData( &mSFTs, &mTseries, injectionSources, &DataParams, GV.edat ) == XLAL_SUCCESS, XLAL_EFUNC );
 
   XLALDestroyPulsarParamsVector( injectionSources );
@@ -440,6 +451,13 @@ XLALInitMakefakedata( ConfigVars_t *cfg, UserVariables_t *uvar )
   XLAL_CHECK( !haveOverlap || !( have_noiseSFTs || have_timestampsFiles ), XLAL_EINVAL, "--SFToverlap incompatible with {--noiseSFTs or --timestampsFiles}\n" );
 
 
+  // ----- streaming SFT output only supports generated signals and Gaussian noise
+  if ( uvar->outSFTstream ) {
+    XLAL_CHECK( uvar->outSFTdir != NULL, XLAL_EINVAL, "--outSFTstream requires --outSFTdir\n" );
+    XLAL_CHECK( !( have_noiseSFTs || have_frames ), XLAL_EINVAL, "--outSFTstream incompatible with {--noiseSFTs or --inFrames}\n" );
+    XLAL_CHECK( uvar->TDDfile == NULL && uvar->outFrameDir == NULL, XLAL_EINVAL, "--outSFTstream incompatible with time-series output {--TDDfile or --outFrameDir}\n" );
+  }
+
   // frequency-band either taken here from user-input, or later from noiseSFTs (no defaults)
   UINT4 nSetfminBand = UVAR_SET2( fmin, Band );
   XLAL_CHECK( ( nSetfminBand == 2 ) || ( ( nSetfminBand == 0 ) && have_noiseSFTs ), XLAL_EINVAL, "Need either 'noiseSFTs' or BOTH of 'fmin' and 'Band'!\n" );
@@ -662,6 +680,7 @@ XLALInitUserVars( UserVariables_t *uvar, int argc, char *argv[] )
   /* output options */
   XLALRegisterUvarMember( outSingleSFT,       BOOLEAN, 's', OPTIONAL, "Write a single concatenated SFT file instead of individual files" );
   XLALRegisterUvarMember( outSFTdir,          STRING, 'n', OPTIONAL, "Output SFTs:  directory for output SFTs" );
+  XLALRegisterUvarMember( outSFTstream,       BOOLEAN, 0, OPTIONAL, "Output SFTs:  generate and write SFTs one at a time, using memory independent of the observation time (requires " UVAR_STR( outSFTdir ) "; incompatible with " UVAR_STR( noiseSFTs ) ", time-series input and output)" );
   XLALRegisterUvarMember( outLabel,             STRING, 0, OPTIONAL, "'misc' entry in SFT-filenames or 'description' entry of frame filenames" );
   XLALRegisterUvarMember( outPubObsRun,       UINT4, 'O', OPTIONAL, "if >0, names SFTs using the public filename convention with this observing run number" );
   XLALRegisterUvarMember( outPubRevision,     UINT4, 'R', OPTIONAL, "if " UVAR_STR( outPubObsRun ) ">0, names SFTs using the public filename convention with this revision number" );
@@ -758,6 +777,64 @@ XLALFreeMem( ConfigVars_t *cfg )
 
 } /* XLALFreeMem() */
 
+/**
+ * Generate SFTs one at a time using XLALCWMakeFakeMultiDataToSFTFiles(), and write them
+ * to --outSFTdir using the same filename conventions as the in-memory SFT output.
+ */
+int
+XLALWriteStreamedSFTs( const ConfigVars_t *cfg, const UserVariables_t *uvar, const PulsarParamsVector *injectionSources, const CWMFDataParams *dataParams )
+{
+  XLAL_CHECK( cfg != NULL, XLAL_EINVAL );
+  XLAL_CHECK( uvar != NULL, XLAL_EINVAL );
+  XLAL_CHECK( dataParams != NULL, XLAL_EINVAL );
+  XLAL_CHECK( is_directory( uvar->outSFTdir ), XLAL_EINVAL );
+
+  /* generate comment string */
+  size_t len;
+  CHAR *logstr;
+  XLAL_CHECK( ( logstr = XLALUserVarGetLog( UVAR_LOGFMT_CMDLINE ) ) != NULL, XLAL_EFUNC );
+  char *comment = XLALCalloc( 1, len = strlen( logstr ) + strlen( cfg->VCSInfoString ) + 512 );
+  XLAL_CHECK( comment != NULL, XLAL_ENOMEM, "XLALCalloc(1,%zu) failed.\n", len );
+  sprintf( comment, "Generated by:\n%s\n%s\n", logstr, cfg->VCSInfoString );
+
+  /* default window is rectangular */
+  const char *window_type = ( cfg->window_type != NULL ) ? cfg->window_type : "rectangular";
+  const REAL8 window_param = ( cfg->window_type != NULL ) ? cfg->window_param : 0;
+
+  /* set up SFT filenames for each detector */
+  const UINT4 numDet = cfg->multiIFO.length;
+  SFTFilenameSpec *multiSpec = XLALCalloc( numDet, sizeof( *multiSpec ) );
+  XLAL_CHECK( multiSpec != NULL, XLAL_ENOMEM );
+  for ( UINT4 X = 0; X < numDet; X ++ ) {
+    SFTFilenameSpec *spec = &multiSpec[X];
+    XLAL_CHECK( XLALFillSFTFilenameSpecStrings( spec, uvar->outSFTdir, NULL, NULL, window_type, NULL, NULL, NULL ) == XLAL_SUCCESS, XLAL_EFUNC );
+    spec->window_param = window_param;
+    if ( uvar->outPubObsRun > 0 ) { // public SFT filename; channel name is <IFO>:<outLabel>
+      char channelName[LALNameLength];
+      CHAR *detPrefix = XLALGetChannelPrefix( cfg->multiIFO.sites[X].frDetector.name );
+      XLAL_CHECK( detPrefix != NULL, XLAL_EFUNC );
+      size_t written = snprintf( channelName, sizeof( channelName ), "%c%c:%s", detPrefix[0], detPrefix[1], uvar->outLabel );
+      XLALFree( detPrefix );
+      XLAL_CHECK( written < LALNameLength, XLAL_ESIZE, "Output channel name exceeded max length (%d): '%s'\n", LALNameLength, channelName );
+      XLAL_CHECK( XLALFillSFTFilenameSpecStrings( spec, NULL, NULL, NULL, NULL, NULL, "SIM", channelName ) == XLAL_SUCCESS, XLAL_EFUNC );
+      spec->pubObsRun = uvar->outPubObsRun;
+      spec->pubRevision = uvar->outPubRevision;
+    } else { // private SFT filename; see private description from --outLabel
+      XLAL_CHECK( XLALFillSFTFilenameSpecStrings( spec, NULL, NULL, NULL, NULL, uvar->outLabel, NULL, NULL ) == XLAL_SUCCESS, XLAL_EFUNC );
+    }
+  } // for X < numDet
+
+  /* generate and write SFTs */
+  XLAL_CHECK( XLALCWMakeFakeMultiDataToSFTFiles( injectionSources, dataParams, cfg->edat, multiSpec, comment, uvar->outSingleSFT ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  XLALFree( multiSpec );
+  XLALFree( logstr );
+  XLALFree( comment );
+
+  return XLAL_SUCCESS;
+
+} /* XLALWriteStreamedSFTs() */
+
 /**
  * Log the all relevant parameters of this run into a log-file.
  * The name of the log-file used is uvar_logfile
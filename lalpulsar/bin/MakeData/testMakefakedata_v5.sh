@@ -291,6 +291,33 @@ else
     echo "OK."
 fi
 
+echo
+echo "--------------------------------------------------"
+echo "Comparison of streamed and in-memory SFTs (signals only):"
+echo "--------------------------------------------------"
+outIFOs="--IFOs=${IFO1},${IFO2} --timestampsFiles=${timestamps1},${timestamps2}"
+for label in mfdv5memory mfdv5stream; do
+    cmdline="$mfdv5_CL ${outIFOs} ${sig13} --fmin=$fmin --Band=$Band --SFTWindowType=${window} --SFTWindowParam=${windowParam} --outLabel=${label}"
+    if [ "$label" = "mfdv5stream" ]; then
+        cmdline="${cmdline} --outSFTstream"
+    fi
+    echo $cmdline;
+    if ! eval $cmdline; then
+        echo "Error.. something failed when running '$mfdv5_CODE' ..."
+        exit 1
+    fi
+done
+for X in H L; do
+    cmdline="$cmp_CODE -V -e ${tol} -1 '${testDIR}/${X}-*_mfdv5memory-*.sft' -2 '${testDIR}/${X}-*_mfdv5stream-*.sft'"
+    echo ${cmdline}
+    if ! eval $cmdline; then
+        echo "Failed. SFTs produced by makefakedata_v5 with and without --outSFTstream differ by more than ${tol}!"
+        exit 2
+    else
+        echo "OK."
+    fi
+done
+
 echo
 echo "--------------------------------------------------"
 echo "Test frame in/output and sub-band selection"
@@ -56,6 +56,7 @@
 #include <lal/LALStdlib.h>
 #include <lal/LALHashTbl.h>
 #include <lal/Date.h>
+#include <lal/LogPrintf.h>
 #include <lal/SFTfileIO.h>
 #include <lal/SFTReferenceLibrary.h>
 #include <lal/LALPulsarVCSInfo.h>
@@ -77,6 +78,13 @@ typedef struct {
   time_t last_checked; /**< time we last checked */
 } UNIT_SOURCE;
 
+/** narrow-band SFT to which an input SFT is to be appended */
+typedef struct {
+  char *filename;      /**< name of narrow-band SFT file */
+  unsigned int bin;    /**< first bin of narrow-band SFT */
+  int width;           /**< number of bins in narrow-band SFT */
+} NB_OUTPUT;
+
 /** throtteling settings */
 UNIT_SOURCE read_bandwidth = {0, 0, 0};
 UNIT_SOURCE read_open_rate = {0, 0, 0};
@@ -187,7 +195,6 @@ int main( int argc, char **argv )
   unsigned int bin;               /* current bin */
   struct headertag2 hd, lasthd;   /* header of input SFT */
   FILE *fpin;                     /* currently open input filepointer */
-  FILE *fpout;                    /* currently open output filepointer */
   char *oldcomment;               /* comment of input SFT */
   char *cmdline = NULL;           /* records command-line to add it to comment */
   char *comment = NULL;           /* comment to be written into output SFT file */
@@ -212,6 +219,10 @@ int main( int argc, char **argv )
   int assumeSorted = 0;                /* Are SFT input files chronologically sorted? */
   int sfterrno = 0;                    /* SFT error number return from reference library */
   LALHashTbl *nbsfts = NULL;           /* hash table of existing narrow-band SFTs */
+  int print_throughput = FALSE;        /* print read/write throughput at the end? */
+  NB_OUTPUT *outputs = NULL;           /* narrow-band SFTs to append current input SFT to */
+  unsigned int max_outputs = 0;        /* number of allocated elements of 'outputs' */
+  double bytes_read = 0, bytes_written = 0; /* bytes read/written, for throughput report */
 
   /* initialize throtteling */
   time( &read_bandwidth.last_checked );
@@ -245,6 +256,7 @@ int main( int argc, char **argv )
              "  [-as|--assumeSorted 1|0]\n"
              "  [-m|--factor <factor>]\n"
              "  [-n|--output-directory <outputdirectory>]\n"
+             "  [-p|--print-throughput]\n"
              "  [--] <inputfile> ...\n"
              "\n"
              "  This program reads in binary SFTs and writes out narrow-banded\n"
@@ -305,6 +317,10 @@ int main( int argc, char **argv )
              "  sorted, which means the program will stop as soon as an SFT located after the\n"
              "  specified range is encountered.\n"
              "\n"
+             "  Each input SFT is read once, and the narrow-band SFTs it is split into are written\n"
+             "  concurrently (if compiled with OpenMP; the number of threads is set by OMP_NUM_THREADS).\n"
+             "  The '-p' option prints the amount of data read and written, and the throughput in MB/s.\n"
+             "\n"
              "  After all options (and an optional '--' separator), the input files are given, as many\n"
              "  as you wish (or the OS supports - using xargs should be simple with this command-line\n"
              "  syntax).\n"
@@ -389,6 +405,9 @@ int main( int argc, char **argv )
     } else if ( ( strcmp( argv[arg], "-n" ) == 0 ) ||
                 ( strcmp( argv[arg], "--output-directory" ) == 0 ) ) {
       outdir = argv[++arg];
+    } else if ( ( strcmp( argv[arg], "-p" ) == 0 ) ||
+                ( strcmp( argv[arg], "--print-throughput" ) == 0 ) ) {
+      print_throughput = TRUE;
     } else if ( ( strcmp( argv[arg], "-rb" ) == 0 ) ||
                 ( strcmp( argv[arg], "--read-bandwidth" ) == 0 ) ) {
       read_bandwidth.resource_rate = atoi( argv[++arg] );
@@ -472,6 +491,8 @@ int main( int argc, char **argv )
     XLALFree( pattern );
   }
 
+  const double wallclock_start = XLALGetTimeOfDay();
+
   int stopInputCauseSorted = 0;
   /* loop over all input SFT files */
   for ( ; ( arg < argc ) && !stopInputCauseSorted; arg++ ) {
@@ -604,13 +625,15 @@ int main( int argc, char **argv )
       request_resource( &read_bandwidth, nactivesamples * 8 );
       sfterrno = ReadSFTData( fpin, data, startBin, nactivesamples, NULL, NULL );
       XLAL_CHECK_MAIN( sfterrno == 0, XLAL_EIO, "could not read SFT data: %s", SFTErrorMessage( sfterrno ) );
+      bytes_read += sizeof( struct headertag2 ) + hd.comment_length + nactivesamples * 8;
 
       /* apply mystery factor and possibly normalization factor */
       for ( bin = 0; bin < 2 * nactivesamples; bin++ ) {
         data[bin] *= factor;
       }
 
-      /* loop over start bins for output SFTs */
+      /* loop over start bins for output SFTs, and determine the narrow-band SFTs to append to */
+      unsigned int num_outputs = 0;
       for ( bin = startBin; bin < endBin; bin += width - overlap ) {
         /* determine the number of bins actually to write from the desired 'width',
            given that the remaining number of bin may be odd (especially from overlapping)
@@ -712,23 +735,73 @@ int main( int argc, char **argv )
                        newSFTfilename );
         XLAL_CHECK_MAIN( XLALHashTblAdd( nbsfts, rec ) == XLAL_SUCCESS, XLAL_EFUNC, "XLALHashTblAdd() failed" );
 
-        /* append this SFT */
+        /* add to narrow-band SFTs to append this SFT to */
+        if ( num_outputs == max_outputs ) {
+          max_outputs = 2 * max_outputs + 16;
+          XLAL_CHECK_MAIN( ( outputs = XLALRealloc( outputs, max_outputs * sizeof( *outputs ) ) ) != NULL, XLAL_ENOMEM, "out of memory allocating outputs" );
+        }
+        outputs[num_outputs].filename = newSFTfilename;
+        outputs[num_outputs].bin = bin;
+        outputs[num_outputs].width = this_width;
+        ++num_outputs;
+
+        /* throttle writing */
         request_resource( &write_open_rate, 1 );
-        XLAL_CHECK_MAIN( ( fpout = fopen( newSFTfilename, "a" ) ) != NULL, XLAL_EIO, "could not open SFT for writing" );
+        request_resource( &write_bandwidth, 40 + this_width * 8 );
+
+        XLALFree( existingSFTfilename );
+
+      } /* loop over output SFTs */
+
+      /* write the comment only to the first SFT of a "block", i.e. of a call of this program */
+      const char *this_comment = ( firstfile || allcomments ) ? comment : NULL;
+      const size_t this_comment_length = ( this_comment != NULL ) ? strlen( this_comment ) + 8 : 0;
+
+      /* append this SFT to each narrow-band SFT; since these are all different files, they can be written concurrently */
+      int errflag = 0;
+      #pragma omp parallel for schedule(dynamic) reduction(+:bytes_written)
+      for ( unsigned int i = 0; i < num_outputs; ++i ) {
+        const NB_OUTPUT *out = &outputs[i];
+
+        /* open output SFT file */
+        FILE *fpout = fopen( out->filename, "a" );
+        if ( fpout == NULL ) {
+          XLALPrintError( "could not open SFT '%s' for writing\n", out->filename );
+          #pragma omp atomic write
+          errflag = 1;
+          continue;
+        }
+
+        /* buffer the complete SFT, so that it is appended with a single write */
+        const size_t bufsize = sizeof( struct headertag2 ) + this_comment_length + out->width * 8;
+        char *buf = XLALMalloc( bufsize );
+        if ( buf != NULL ) {
+          setvbuf( fpout, buf, _IOFBF, bufsize );
+        }
 
         /* write the data */
-        /* write the comment only to the first SFT of a "block", i.e. of a call of this program */
-        request_resource( &write_bandwidth, 40 + this_width * 8 );
-        sfterrno = WriteSFT( fpout, hd.gps_sec, hd.gps_nsec, hd.tbase, bin, this_width, detector, hd.windowspec, ( firstfile || allcomments ) ? comment : NULL, data + 2 * ( bin - startBin ) );
-        XLAL_CHECK_MAIN( sfterrno == 0, XLAL_EIO, "could not write SFT data: %s", SFTErrorMessage( sfterrno ) );
+        int this_sfterrno = WriteSFT( fpout, hd.gps_sec, hd.gps_nsec, hd.tbase, out->bin, out->width, detector, hd.windowspec, this_comment, data + 2 * ( out->bin - startBin ) );
+        if ( this_sfterrno != 0 ) {
+          XLALPrintError( "could not write SFT data to '%s': %s\n", out->filename, SFTErrorMessage( this_sfterrno ) );
+          #pragma omp atomic write
+          errflag = 1;
+        }
 
         /* close output SFT file */
-        fclose( fpout );
+        if ( fclose( fpout ) != 0 ) {
+          XLALPrintError( "could not close SFT '%s'\n", out->filename );
+          #pragma omp atomic write
+          errflag = 1;
+        }
+        XLALFree( buf );
 
-        XLALFree( existingSFTfilename );
-        XLALFree( newSFTfilename );
+        bytes_written += bufsize;
 
       } /* loop over output SFTs */
+      XLAL_CHECK_MAIN( errflag == 0, XLAL_EIO, "could not write SFT data" );
+      for ( unsigned int i = 0; i < num_outputs; ++i ) {
+        XLALFree( outputs[i].filename );
+      }
 
       /* cleanup */
       if ( add_comment > CMT_OLD ) {
@@ -751,7 +824,17 @@ int main( int argc, char **argv )
 
   } /* loop over input SFT files */
 
+  /* print throughput */
+  if ( print_throughput ) {
+    const double wallclock = fmax( XLALGetTimeOfDay() - wallclock_start, 1e-6 );
+    const double MB = 1024.0 * 1024.0;
+    printf( "Read %.1f MB and wrote %.1f MB in %.1f seconds: %.1f MB/s read, %.1f MB/s written\n",
+            bytes_read / MB, bytes_written / MB, wallclock,
+            bytes_read / MB / wallclock, bytes_written / MB / wallclock );
+  }
+
   /* cleanup */
+  XLALFree( outputs );
   XLALFree( constraint_str );
   if ( add_comment > CMT_OLD ) {
     XLALFree( cmdline );
@@ -59,7 +59,7 @@ for sft in broadband1b/*.sft; do
     fi
 done
 mkdir -p narrowband1c/
-cmdline="lalpulsar_splitSFTs -fs 10 -fe 95.5 -fb 8 -n narrowband1c/ -- broadband1c/H-5_H1_${Tsft}SFT_${misc}-${start}-${span}.sft"
+cmdline="lalpulsar_splitSFTs -fs 10 -fe 95.5 -fb 8 -p -n narrowband1c/ -- broadband1c/H-5_H1_${Tsft}SFT_${misc}-${start}-${span}.sft"
 if ! eval "$cmdline"; then
     echo "ERROR: something failed when running '$cmdline'"
     exit 1
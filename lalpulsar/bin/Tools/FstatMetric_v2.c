@@ -166,6 +166,7 @@ typedef struct {
   BOOLEAN coordsHelp;   /**< output help-string explaining all the possible Doppler-coordinate names for --cords */
 
   BOOLEAN approxPhase;  /**< use an approximate phase-model, neglecting Roemer delay in spindown coordinates */
+  BOOLEAN fixedQuadrature;      /**< integrate all metric components together on fixed Gauss-Legendre nodes */
 
 } UserVariables_t;
 
@@ -243,6 +244,7 @@ main( int argc, char *argv[] )
   metricParams.signalParams  = config.signalParams;
   metricParams.projectCoord  = uvar.projection - 1;     /* user-input counts from 1, but interally we count 0=1st coord. (-1==no projection) */
   metricParams.approxPhase   = uvar.approxPhase;
+  metricParams.fixedQuadrature = uvar.fixedQuadrature;
 
 
   /* ----- compute metric full metric + Fisher matrix ---------- */
@@ -334,6 +336,7 @@ initUserVars( UserVariables_t *uvar )
   }
 
   uvar->approxPhase = FALSE;
+  uvar->fixedQuadrature = FALSE;
 
   /* register all our user-variables */
 
@@ -375,6 +378,7 @@ initUserVars( UserVariables_t *uvar )
 
   XLALRegisterUvarMember( detMotionStr,  STRING, 0,  DEVELOPER,  "Detector-motion string: S|O|S+O where S=spin|spinz|spinxy and O=orbit|ptoleorbit" );
   XLALRegisterUvarMember( approxPhase,     BOOLEAN, 0,  DEVELOPER,       "Use an approximate phase-model, neglecting Roemer delay in spindown coordinates (or orders >= 1)" );
+  XLALRegisterUvarMember( fixedQuadrature, BOOLEAN, 0,  DEVELOPER,       "Integrate all metric components together on fixed Gauss-Legendre nodes (faster), instead of adaptively one at a time" );
 
   return XLAL_SUCCESS;
 
@@ -17,6 +17,10 @@
 *  MA  02110-1301  USA
 */
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <gsl/gsl_randist.h>
 #include <gsl/gsl_cdf.h>
 
@@ -95,16 +99,14 @@ INT4 runIHS( ihsMaximaStruct *output, const ffdataStruct *input, const ihsfarStr
   INT4 numfprbins = input->numfprbins;
 
   //Allocate memory for the necessary vectors
-  REAL4VectorAligned *row = NULL, *ihss = NULL, *ihsvector = NULL;
+  REAL4VectorAligned *ihss = NULL;
   INT4Vector *locs = NULL;
   ihsVals *ihsvals = NULL;
   REAL4VectorAlignedArray *ihsvectorarray = NULL;
-  XLAL_CHECK( ( row = XLALCreateREAL4VectorAligned( numfprbins, 32 ) ) != NULL, XLAL_EFUNC );
   XLAL_CHECK( ( ihss = XLALCreateREAL4VectorAligned( numfbins, 32 ) ) != NULL, XLAL_EFUNC );
-  XLAL_CHECK( ( ihsvector = XLALCreateREAL4VectorAligned( ( INT4 )floor( ( 1.0 / ( REAL8 )params->ihsfactor ) * numfprbins ) - 5, 32 ) ) != NULL, XLAL_EFUNC );
   XLAL_CHECK( ( locs = XLALCreateINT4Vector( numfbins ) ) != NULL, XLAL_EFUNC );
   XLAL_CHECK( ( ihsvals = createihsVals() ) != NULL, XLAL_EFUNC );
-  XLAL_CHECK( ( ihsvectorarray = createREAL4VectorAlignedArray( numfbins, ihsvector->length, 32 ) ) != NULL, XLAL_EFUNC );
+  XLAL_CHECK( ( ihsvectorarray = createREAL4VectorAlignedArray( numfbins, ( INT4 )floor( ( 1.0 / ( REAL8 )params->ihsfactor ) * numfprbins ) - 5, 32 ) ) != NULL, XLAL_EFUNC );
 
   //We want to ignore daily and sidereal harmonics, so mark the values
   REAL8 dailyharmonic = params->Tobs / ( 24.0 * 3600.0 );
@@ -112,7 +114,7 @@ INT4 runIHS( ihsMaximaStruct *output, const ffdataStruct *input, const ihsfarStr
   REAL8 dailyharmonic2 = dailyharmonic * 2.0, dailyharmonic3 = dailyharmonic * 3.0, dailyharmonic4 = dailyharmonic * 4.0;
   REAL8 siderealharmonic2 = siderealharmonic * 2.0, siderealharmonic3 = siderealharmonic * 3.0, siderealharmonic4 = siderealharmonic * 4.0;
   INT4Vector *markedharmonics = NULL;
-  XLAL_CHECK( ( markedharmonics = XLALCreateINT4Vector( row->length ) ) != NULL, XLAL_EFUNC );
+  XLAL_CHECK( ( markedharmonics = XLALCreateINT4Vector( numfprbins ) ) != NULL, XLAL_EFUNC );
   memset( markedharmonics->data, 0, sizeof( INT4 )*markedharmonics->length );
   //If the user has specified not to notch the harmonics, then we skip the step to mark the notched values
   if ( !params->noNotchHarmonics ) {
@@ -123,8 +125,24 @@ INT4 runIHS( ihsMaximaStruct *output, const ffdataStruct *input, const ihsfarStr
     }
   }
 
+  //Each row is independent, so the rows are split between threads; each thread has its own row buffer and
+  //the IHS vector of each row is written directly into the ihsvectorarray
+  INT4 numThreads = 1;
+#ifdef _OPENMP
+  numThreads = omp_get_max_threads();
+#endif
+  REAL4VectorAlignedArray *rowbuffers = NULL;
+  XLAL_CHECK( ( rowbuffers = createREAL4VectorAlignedArray( numThreads, numfprbins, 32 ) ) != NULL, XLAL_EFUNC );
+
   //Loop through the rows, 1 frequency at a time
-  for ( UINT4 ii = 0; ii < ihss->length; ii++ ) {
+  INT4 errflag = 0;
+  #pragma omp parallel for schedule(static) num_threads(numThreads)
+  for ( INT4 ii = 0; ii < numfbins; ii++ ) {
+    INT4 thread = 0;
+#ifdef _OPENMP
+    thread = omp_get_thread_num();
+#endif
+    REAL4VectorAligned *row = rowbuffers->data[thread];
 
     //For each row, populate it with the data for that frequency bin, excluding harmonics of antenna pattern modulation
     memcpy( row->data, &( input->ffdata->data[ii * numfprbins] ), sizeof( REAL4 )*numfprbins );
@@ -133,25 +151,27 @@ INT4 runIHS( ihsMaximaStruct *output, const ffdataStruct *input, const ihsfarStr
         }
 
     //Run the IHS algorithm on the row
+    INT4 status;
     if ( !params->weightedIHS ) {
-      XLAL_CHECK( incHarmSumVector( ihsvector, row, params->ihsfactor ) == XLAL_SUCCESS, XLAL_EFUNC );
+      status = incHarmSumVector( ihsvectorarray->data[ii], row, params->ihsfactor );
     } else {
-      XLAL_CHECK( incHarmSumVectorWeighted( ihsvector, row, aveNoise, params->ihsfactor ) == XLAL_SUCCESS, XLAL_EFUNC );
+      status = incHarmSumVectorWeighted( ihsvectorarray->data[ii], row, aveNoise, params->ihsfactor );
+    }
+    if ( status != XLAL_SUCCESS ) {
+      #pragma omp atomic write
+      errflag = 1;
     }
 
-    //Copy the result into the ihsvector array
-    memcpy( ihsvectorarray->data[ii]->data, ihsvector->data, sizeof( REAL4 )*ihsvector->length );
-
-  } /* for ii < ihss->length */
+  } /* for ii < numfbins */
+  XLAL_CHECK( errflag == 0, XLAL_EFUNC );
 
   //Now do the summing of the IHS values
   XLAL_CHECK( sumIHSarray( output, ihsfarinput, ihsvectorarray, rows, FbinMean, params ) == XLAL_SUCCESS, XLAL_EFUNC );
 
   //Destroy stuff
   destroyREAL4VectorAlignedArray( ihsvectorarray );
-  XLALDestroyREAL4VectorAligned( row );
+  destroyREAL4VectorAlignedArray( rowbuffers );
   XLALDestroyREAL4VectorAligned( ihss );
-  XLALDestroyREAL4VectorAligned( ihsvector );
   XLALDestroyINT4Vector( locs );
   XLALDestroyINT4Vector( markedharmonics );
   destroyihsVals( ihsvals );
@@ -499,7 +519,7 @@ INT4 sumIHSarrayFAR( ihsfarStruct *outputfar, REAL4VectorAlignedArray *ihsvector
     //Scale the expected IHS vector by the value in FbinMean (in this function, it is 1.0)
     XLAL_CHECK( XLALVectorScaleREAL4( scaledExpectedIHSVectorValues->data, FbinMean->data[ii], outputfar->expectedIHSVector->data, outputfar->expectedIHSVector->length ) == XLAL_SUCCESS, XLAL_EFUNC );
     //subtract the noise from the data
-    XLAL_CHECK( VectorSubtractREAL4( excessabovenoise, ihsvectorarray->data[ii], scaledExpectedIHSVectorValues, params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( VectorSubtractREAL4( excessabovenoise, ihsvectorarray->data[ii], scaledExpectedIHSVectorValues ) == XLAL_SUCCESS, XLAL_EFUNC );
     //Find the location of the maximum IHS value
     ihslocations->data[ii] = max_index_in_range( excessabovenoise, minIndexForIHS, maxIndexForIHS ) + 5;
     //And get the value
@@ -518,27 +538,15 @@ INT4 sumIHSarrayFAR( ihsfarStruct *outputfar, REAL4VectorAlignedArray *ihsvector
     XLAL_CHECK( ( rowarraylocs = XLALCreateINT4Vector( ii ) ) != NULL, XLAL_EFUNC );
     XLAL_CHECK( ( foms = XLALCreateREAL4VectorAligned( ihsvectorarray->length - ( ii - 1 ), 32 ) ) != NULL, XLAL_EFUNC );
 
-    //If the user has specified that we should use SSE operations, then do the nearest neighbor summing.
-    //The result is in the tworows variable
-    if ( params->vectorMath != 0 ) {
-      if ( ii > 2 ) {
-        XLAL_CHECK( VectorArraySum( tworows, tworows, ihsvectorarray, 0, ii - 1, 0, ( INT4 )( ihsvectorarray->length - ( ii - 1 ) ) ) == XLAL_SUCCESS, XLAL_EFUNC );
-      } else {
-        XLAL_CHECK( VectorArraySum( tworows, ihsvectorarray, ihsvectorarray, 0, ii - 1, 0, ( INT4 )( ihsvectorarray->length - ( ii - 1 ) ) ) == XLAL_SUCCESS, XLAL_EFUNC );
-      }
+    //Do the nearest neighbor summing; the result is in the tworows variable
+    if ( ii > 2 ) {
+      XLAL_CHECK( VectorArraySum( tworows, tworows, ihsvectorarray, 0, ii - 1, 0, ( INT4 )( ihsvectorarray->length - ( ii - 1 ) ) ) == XLAL_SUCCESS, XLAL_EFUNC );
+    } else {
+      XLAL_CHECK( VectorArraySum( tworows, ihsvectorarray, ihsvectorarray, 0, ii - 1, 0, ( INT4 )( ihsvectorarray->length - ( ii - 1 ) ) ) == XLAL_SUCCESS, XLAL_EFUNC );
     }
 
     //Now we are going to loop through the input ihsvectorarray up to the number of rows-1
     for ( UINT4 jj = 0; jj < ihsvectorarray->length - ( ii - 1 ); jj++ ) {
-      //A bit tricky here: sum IHS values across SFT frequency bins into the tworows variable only if we didn't do it with SSE above
-      if ( params->vectorMath == 0 ) {
-        if ( ii > 2 ) for ( UINT4 kk = 0; kk < tworows->data[jj]->length; kk++ ) {
-            tworows->data[jj]->data[kk] += ihsvectorarray->data[ii - 1 + jj]->data[kk];
-          } else for ( UINT4 kk = 0; kk < tworows->data[jj]->length; kk++ ) {
-            tworows->data[jj]->data[kk] = ihsvectorarray->data[jj]->data[kk] + ihsvectorarray->data[jj + 1]->data[kk];
-          }
-      }
-
       //Compute IHS FOM value
       memcpy( rowarraylocs->data, &( ihslocations->data[jj] ), sizeof( INT4 )*ii ); //First copy the necessary values
       foms->data[jj] = ihsFOM( rowarraylocs, ( INT4 )outputfar->expectedIHSVector->length ); //then compute the FOM
@@ -666,7 +674,7 @@ INT4 sumIHSarray( ihsMaximaStruct *output, const ihsfarStruct *inputfar, REAL4Ve
     //Scale the expected IHS vector by the FbinMean data value
     XLAL_CHECK( XLALVectorScaleREAL4( scaledExpectedIHSVectorValues->data, FbinMean->data[ii], inputfar->expectedIHSVector->data, inputfar->expectedIHSVector->length ) == XLAL_SUCCESS, XLAL_EFUNC );
     //subtract the noise from the data
-    XLAL_CHECK( VectorSubtractREAL4( excessabovenoise, ihsvectorarray->data[ii], scaledExpectedIHSVectorValues, params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( VectorSubtractREAL4( excessabovenoise, ihsvectorarray->data[ii], scaledExpectedIHSVectorValues ) == XLAL_SUCCESS, XLAL_EFUNC );
 
     //search over the range of Pmin-->Pmax and higher harmonics the user has specified
     for ( INT4 jj = 0; jj < params->harmonicNumToSearch; jj++ ) {
@@ -703,26 +711,15 @@ INT4 sumIHSarray( ihsMaximaStruct *output, const ihsfarStruct *inputfar, REAL4Ve
       REAL4 sumofnoise = 0.0;    //To scale the expected IHS background
       INT4 endloc = ( ( ii - 1 ) * ( ii - 1 ) - ( ii - 1 ) ) / 2;
 
-      //Sum up the IHS vectors using SSE functions
-      if ( params->vectorMath != 0 ) {
-        if ( ii > 2 ) {
-          XLAL_CHECK( VectorArraySum( tworows, tworows, ihsvectorarray, 0, ii - 1, 0, ( INT4 )( ihsvectorarray->length - ( ii - 1 ) ) ) == XLAL_SUCCESS, XLAL_EFUNC );
-        } else {
-          XLAL_CHECK( VectorArraySum( tworows, ihsvectorarray, ihsvectorarray, 0, ii - 1, 0, ( INT4 )( ihsvectorarray->length - ( ii - 1 ) ) ) == XLAL_SUCCESS, XLAL_EFUNC );
-        }
+      //Sum up the IHS vectors
+      if ( ii > 2 ) {
+        XLAL_CHECK( VectorArraySum( tworows, tworows, ihsvectorarray, 0, ii - 1, 0, ( INT4 )( ihsvectorarray->length - ( ii - 1 ) ) ) == XLAL_SUCCESS, XLAL_EFUNC );
+      } else {
+        XLAL_CHECK( VectorArraySum( tworows, ihsvectorarray, ihsvectorarray, 0, ii - 1, 0, ( INT4 )( ihsvectorarray->length - ( ii - 1 ) ) ) == XLAL_SUCCESS, XLAL_EFUNC );
       }
 
       //Loop through the IHS vector neighbor sums
       for ( UINT4 jj = 0; jj < ihsvectorarray->length - ( ii - 1 ); jj++ ) {
-        //If we didn't use SSE to sum the vector array (see lines above)
-        if ( params->vectorMath == 0 ) {
-          if ( ii > 2 ) for ( UINT4 kk = 0; kk < tworows->data[jj]->length; kk++ ) {
-              tworows->data[jj]->data[kk] += ihsvectorarray->data[ii - 1 + jj]->data[kk];
-            } else for ( UINT4 kk = 0; kk < tworows->data[jj]->length; kk++ ) {
-              tworows->data[jj]->data[kk] = ihsvectorarray->data[jj]->data[kk] + ihsvectorarray->data[jj + 1]->data[kk];
-            }
-        }
-
         //To scale the background efficiently
         if ( jj == 0 ) for ( UINT4 kk = 0; kk < ii; kk++ ) {
             sumofnoise += FbinMean->data[kk];
@@ -733,7 +730,7 @@ INT4 sumIHSarray( ihsMaximaStruct *output, const ihsfarStruct *inputfar, REAL4Ve
 
         //If using SSE, scale the expected IHS vector, subtract the noise from the data
         XLAL_CHECK( XLALVectorScaleREAL4( scaledExpectedIHSVectorValues->data, sumofnoise, inputfar->expectedIHSVector->data, inputfar->expectedIHSVector->length ) == XLAL_SUCCESS, XLAL_EFUNC );
-        XLAL_CHECK( VectorSubtractREAL4( excessabovenoise, tworows->data[jj], scaledExpectedIHSVectorValues, params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
+        XLAL_CHECK( VectorSubtractREAL4( excessabovenoise, tworows->data[jj], scaledExpectedIHSVectorValues ) == XLAL_SUCCESS, XLAL_EFUNC );
 
         //Compute the maximum IHS value in the second FFT frequency direction
         //search over the range of Pmin-->Pmax and higher harmonics the user has specified
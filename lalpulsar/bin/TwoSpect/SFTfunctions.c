@@ -206,7 +206,7 @@ REAL4VectorAligned *coherentlyAddSFTs( const MultiSFTVector *multiSFTvector, con
     }
     XLAL_CHECK_NULL( ( scaledSFTfrequencies = createAlignedREAL8Vector( SFTfrequencies->length, 32 ) ) != NULL, XLAL_EFUNC );
   }
-  XLAL_CHECK_NULL( VectorScaleREAL8( GWfrequencyBins, GWfrequencies, params->Tsft, params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_NULL( VectorScaleREAL8( GWfrequencyBins, GWfrequencies, params->Tsft ) == XLAL_SUCCESS, XLAL_EFUNC );
 
   //Pre-allocate delta values for IFO_0 and IFO_X, also 2*pi*f_k*tau
   alignedREAL8Vector *delta0vals = NULL, *deltaXvals = NULL, *delta0valsSubset = NULL, *deltaXvalsSubset = NULL, *floorDelta0valsSubset = NULL, *floorDeltaXvalsSubset = NULL, *diffFloorDeltaValsSubset = NULL, *roundDelta0valsSubset = NULL, *roundDeltaXvalsSubset = NULL, *diffRoundDeltaValsSubset = NULL, *TwoPiGWfrequenciesTau = NULL, *absDiffFloorDeltaValsSubset = NULL;
@@ -244,15 +244,15 @@ REAL4VectorAligned *coherentlyAddSFTs( const MultiSFTVector *multiSFTvector, con
   for ( UINT4 ii = 0; ii < twoPiTauVals->length; ii++ ) {
     memcpy( Tdots->data, multissb->data[ii]->Tdot->data, sizeof( REAL8 )*multissb->data[ii]->Tdot->length );
     memcpy( DeltaTs->data, multissb->data[ii]->DeltaT->data, sizeof( REAL8 )*multissb->data[ii]->DeltaT->length );
-    XLAL_CHECK_NULL( VectorScaleREAL8( twoPiTauVals->data[ii], Tdots, -Tmid, params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
-    XLAL_CHECK_NULL( VectorAddREAL8( twoPiTauVals->data[ii], twoPiTauVals->data[ii], DeltaTs, params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
-    XLAL_CHECK_NULL( VectorShiftREAL8( TdotMinus1s->data[ii], Tdots, -1.0, params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK_NULL( VectorScaleREAL8( twoPiTauVals->data[ii], Tdots, -Tmid ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK_NULL( VectorAddREAL8( twoPiTauVals->data[ii], twoPiTauVals->data[ii], DeltaTs ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK_NULL( VectorShiftREAL8( TdotMinus1s->data[ii], Tdots, -1.0 ) == XLAL_SUCCESS, XLAL_EFUNC );
   }
   for ( UINT4 ii = twoPiTauVals->length; ii > 0; ii-- ) {
-    XLAL_CHECK_NULL( VectorSubtractREAL8( twoPiTauVals->data[ii - 1], twoPiTauVals->data[ii - 1], twoPiTauVals->data[0], params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK_NULL( VectorSubtractREAL8( twoPiTauVals->data[ii - 1], twoPiTauVals->data[ii - 1], twoPiTauVals->data[0] ) == XLAL_SUCCESS, XLAL_EFUNC );
   }
   for ( UINT4 ii = 1; ii < twoPiTauVals->length; ii++ ) {
-    XLAL_CHECK_NULL( VectorScaleREAL8( twoPiTauVals->data[ii], twoPiTauVals->data[ii], LAL_TWOPI, params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK_NULL( VectorScaleREAL8( twoPiTauVals->data[ii], twoPiTauVals->data[ii], LAL_TWOPI ) == XLAL_SUCCESS, XLAL_EFUNC );
   }
   destroyAlignedREAL8Vector( Tdots );
   destroyAlignedREAL8Vector( DeltaTs );
@@ -348,8 +348,8 @@ REAL4VectorAligned *coherentlyAddSFTs( const MultiSFTVector *multiSFTvector, con
       for ( UINT4 jj = 0; jj < GWfrequencies->length; jj++ ) {
         GWfrequencies->data[jj] = GWfreqInSSB->data->data[fftnum2];
       }
-      XLAL_CHECK_NULL( VectorScaleREAL8( GWfrequencyBins, GWfrequencies, params->Tsft, params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
-      XLAL_CHECK_NULL( VectorScaleREAL8( scaledSFTfrequencies, SFTfrequencies, -1.0 / GWfrequencies->data[0], params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK_NULL( VectorScaleREAL8( GWfrequencyBins, GWfrequencies, params->Tsft ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK_NULL( VectorScaleREAL8( scaledSFTfrequencies, SFTfrequencies, -1.0 / GWfrequencies->data[0] ) == XLAL_SUCCESS, XLAL_EFUNC );
     }
 
     BOOLEAN createSFT = 1, computeAntenna0 = 1, computeDelta0vals = 1;
@@ -370,7 +370,7 @@ REAL4VectorAligned *coherentlyAddSFTs( const MultiSFTVector *multiSFTvector, con
         XLAL_CHECK_NULL( fftnum == fftnum2, XLAL_EFAILED );
 
         //First do time of arrival: 2*pi*f*tau where f is the GW frequency either assumed (assumeNSGWfreq) or unassumed (f = fk)
-        XLAL_CHECK_NULL( VectorScaleREAL8( TwoPiGWfrequenciesTau, GWfrequencies, twoPiTauVals->data[jj]->data[fftnum], params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
+        XLAL_CHECK_NULL( VectorScaleREAL8( TwoPiGWfrequenciesTau, GWfrequencies, twoPiTauVals->data[jj]->data[fftnum] ) == XLAL_SUCCESS, XLAL_EFUNC );
 
         //If assumeNSpsi is not given compute Fplus and Fcross for detector ratio
         if ( NSparams->assumeNSpsi == NULL ) {
@@ -511,40 +511,40 @@ REAL4VectorAligned *coherentlyAddSFTs( const MultiSFTVector *multiSFTvector, con
         //Compute scaling values delta*[delta^2 - 1], and Dirichlet scaling = scaling0/scalingX
         if ( computeDelta0vals ) {
           if ( NSparams->assumeNSGWfreq == NULL ) {
-            XLAL_CHECK_NULL( VectorScaleREAL8( delta0vals, GWfrequencyBins, TdotMinus1s->data[0]->data[fftnum], params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
+            XLAL_CHECK_NULL( VectorScaleREAL8( delta0vals, GWfrequencyBins, TdotMinus1s->data[0]->data[fftnum] ) == XLAL_SUCCESS, XLAL_EFUNC );
           } else {
-            XLAL_CHECK_NULL( VectorShiftREAL8( delta0vals, scaledSFTfrequencies, multissb->data[0]->Tdot->data[fftnum], params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
-            XLAL_CHECK_NULL( VectorScaleREAL8( delta0vals, delta0vals, GWfrequencyBins->data[0], params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
+            XLAL_CHECK_NULL( VectorShiftREAL8( delta0vals, scaledSFTfrequencies, multissb->data[0]->Tdot->data[fftnum] ) == XLAL_SUCCESS, XLAL_EFUNC );
+            XLAL_CHECK_NULL( VectorScaleREAL8( delta0vals, delta0vals, GWfrequencyBins->data[0] ) == XLAL_SUCCESS, XLAL_EFUNC );
           }
           memcpy( delta0valsSubset->data, &( delta0vals->data[10] ), sizeof( REAL8 )*delta0valsSubset->length );
           XLAL_CHECK_NULL( VectorFloorREAL8( floorDelta0valsSubset, delta0valsSubset, params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
-          XLAL_CHECK_NULL( VectorRoundREAL8( roundDelta0valsSubset, delta0valsSubset, params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
-          XLAL_CHECK_NULL( VectorMultiplyREAL8( DirichletScaling0, delta0valsSubset, delta0valsSubset, params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
-          XLAL_CHECK_NULL( VectorShiftREAL8( DirichletScaling0, DirichletScaling0, -1.0, params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
-          XLAL_CHECK_NULL( VectorMultiplyREAL8( DirichletScaling0, DirichletScaling0, delta0valsSubset, params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
+          XLAL_CHECK_NULL( VectorRoundREAL8( roundDelta0valsSubset, delta0valsSubset ) == XLAL_SUCCESS, XLAL_EFUNC );
+          XLAL_CHECK_NULL( VectorMultiplyREAL8( DirichletScaling0, delta0valsSubset, delta0valsSubset ) == XLAL_SUCCESS, XLAL_EFUNC );
+          XLAL_CHECK_NULL( VectorShiftREAL8( DirichletScaling0, DirichletScaling0, -1.0 ) == XLAL_SUCCESS, XLAL_EFUNC );
+          XLAL_CHECK_NULL( VectorMultiplyREAL8( DirichletScaling0, DirichletScaling0, delta0valsSubset ) == XLAL_SUCCESS, XLAL_EFUNC );
         }
         if ( computeDelta0vals ) {
           computeDelta0vals = 0;
         }
         if ( NSparams->assumeNSGWfreq == NULL ) {
-          XLAL_CHECK_NULL( VectorScaleREAL8( deltaXvals, GWfrequencyBins, TdotMinus1s->data[jj]->data[fftnum], params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
+          XLAL_CHECK_NULL( VectorScaleREAL8( deltaXvals, GWfrequencyBins, TdotMinus1s->data[jj]->data[fftnum] ) == XLAL_SUCCESS, XLAL_EFUNC );
         } else {
-          XLAL_CHECK_NULL( VectorShiftREAL8( deltaXvals, scaledSFTfrequencies, multissb->data[jj]->Tdot->data[fftnum], params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
-          XLAL_CHECK_NULL( VectorScaleREAL8( deltaXvals, deltaXvals, GWfrequencyBins->data[0], params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
+          XLAL_CHECK_NULL( VectorShiftREAL8( deltaXvals, scaledSFTfrequencies, multissb->data[jj]->Tdot->data[fftnum] ) == XLAL_SUCCESS, XLAL_EFUNC );
+          XLAL_CHECK_NULL( VectorScaleREAL8( deltaXvals, deltaXvals, GWfrequencyBins->data[0] ) == XLAL_SUCCESS, XLAL_EFUNC );
         }
         memcpy( deltaXvalsSubset->data, &( deltaXvals->data[10] ), sizeof( REAL8 )*deltaXvalsSubset->length );
-        XLAL_CHECK_NULL( VectorRoundREAL8( roundDeltaXvalsSubset, deltaXvalsSubset, params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
-        XLAL_CHECK_NULL( VectorSubtractREAL8( diffRoundDeltaValsSubset, roundDelta0valsSubset, roundDeltaXvalsSubset, params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
-        XLAL_CHECK_NULL( VectorAddREAL8( deltaXvalsSubset, deltaXvalsSubset, diffRoundDeltaValsSubset, params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
+        XLAL_CHECK_NULL( VectorRoundREAL8( roundDeltaXvalsSubset, deltaXvalsSubset ) == XLAL_SUCCESS, XLAL_EFUNC );
+        XLAL_CHECK_NULL( VectorSubtractREAL8( diffRoundDeltaValsSubset, roundDelta0valsSubset, roundDeltaXvalsSubset ) == XLAL_SUCCESS, XLAL_EFUNC );
+        XLAL_CHECK_NULL( VectorAddREAL8( deltaXvalsSubset, deltaXvalsSubset, diffRoundDeltaValsSubset ) == XLAL_SUCCESS, XLAL_EFUNC );
         for ( UINT4 kk = 0; kk < diffRoundDeltaValsSubset->length; kk++ ) {
           INT4 shiftVal = ( INT4 )diffRoundDeltaValsSubset->data[kk];
           shiftVector->data[kk] = shiftVal;
         }
         XLAL_CHECK_NULL( VectorFloorREAL8( floorDeltaXvalsSubset, deltaXvalsSubset, params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
-        XLAL_CHECK_NULL( VectorSubtractREAL8( diffFloorDeltaValsSubset, floorDelta0valsSubset, floorDeltaXvalsSubset, params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
-        XLAL_CHECK_NULL( VectorMultiplyREAL8( DirichletScalingX, deltaXvalsSubset, deltaXvalsSubset, params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
-        XLAL_CHECK_NULL( VectorShiftREAL8( DirichletScalingX, DirichletScalingX, -1.0, params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
-        XLAL_CHECK_NULL( VectorMultiplyREAL8( DirichletScalingX, DirichletScalingX, deltaXvalsSubset, params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
+        XLAL_CHECK_NULL( VectorSubtractREAL8( diffFloorDeltaValsSubset, floorDelta0valsSubset, floorDeltaXvalsSubset ) == XLAL_SUCCESS, XLAL_EFUNC );
+        XLAL_CHECK_NULL( VectorMultiplyREAL8( DirichletScalingX, deltaXvalsSubset, deltaXvalsSubset ) == XLAL_SUCCESS, XLAL_EFUNC );
+        XLAL_CHECK_NULL( VectorShiftREAL8( DirichletScalingX, DirichletScalingX, -1.0 ) == XLAL_SUCCESS, XLAL_EFUNC );
+        XLAL_CHECK_NULL( VectorMultiplyREAL8( DirichletScalingX, DirichletScalingX, deltaXvalsSubset ) == XLAL_SUCCESS, XLAL_EFUNC );
 
         for ( UINT4 kk = 0; kk < scaling->length; kk++ ) {
           scaling->data[kk] = DirichletScaling0->data[kk] / DirichletScalingX->data[kk];
@@ -782,8 +782,8 @@ REAL4VectorAligned *convertSFTdataToPowers( const SFTVector *sfts, const UserInp
       SFTtype *sft = &( sfts->data[ii - nonexistantsft] );
       if ( sft->epoch.gpsSeconds == ( INT4 )round( ii * ( params->Tsft - params->SFToverlap ) + starttime ) ) {
         XLAL_CHECK_NULL( VectorCabsCOMPLEX8( normAbsSFTcoeffSq, sft->data, params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
-        XLAL_CHECK_NULL( VectorMultiplyREAL8( normAbsSFTcoeffSq, normAbsSFTcoeffSq, normAbsSFTcoeffSq, params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
-        XLAL_CHECK_NULL( VectorScaleREAL8( normAbsSFTcoeffSq, normAbsSFTcoeffSq, normalization, params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
+        XLAL_CHECK_NULL( VectorMultiplyREAL8( normAbsSFTcoeffSq, normAbsSFTcoeffSq, normAbsSFTcoeffSq ) == XLAL_SUCCESS, XLAL_EFUNC );
+        XLAL_CHECK_NULL( VectorScaleREAL8( normAbsSFTcoeffSq, normAbsSFTcoeffSq, normalization ) == XLAL_SUCCESS, XLAL_EFUNC );
         for ( UINT4 jj = 0; jj < sftlength; jj++ ) {
           tfdata->data[ii * sftlength + jj] = ( REAL4 )normAbsSFTcoeffSq->data[jj];
         } /* for jj < sftLength */
@@ -1398,14 +1398,14 @@ MultiSFTVector *generateSFTdata( UserInput_t *uvar, const MultiLALDetector *dete
         for ( UINT4 jj = 0; jj < oneSignalSFTs->data[0]->length; jj++ ) {
           SFTtype *sft = &( oneSignalSFTs->data[0]->data[jj] );
           XLAL_CHECK_NULL( VectorCabsCOMPLEX8( SFTpower, sft->data, uvar->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
-          XLAL_CHECK_NULL( VectorMultiplyREAL8( SFTpower, SFTpower, SFTpower, uvar->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
-          XLAL_CHECK_NULL( VectorScaleREAL8( SFTpower, SFTpower, 2.0 / uvar->Tsft, uvar->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
+          XLAL_CHECK_NULL( VectorMultiplyREAL8( SFTpower, SFTpower, SFTpower ) == XLAL_SUCCESS, XLAL_EFUNC );
+          XLAL_CHECK_NULL( VectorScaleREAL8( SFTpower, SFTpower, 2.0 / uvar->Tsft ) == XLAL_SUCCESS, XLAL_EFUNC );
           //for (UINT4 kk=0; kk<aveSFTsPower->length; kk++) {
           //   REAL8 powerval = 2.0*(creal(sft->data->data[kk])*creal(sft->data->data[kk]) + cimag(sft->data->data[kk])*cimag(sft->data->data[kk]))/uvar->Tsft;
           //  SFTpower->data[kk] = powerval;
           //  aveSFTsPower->data[kk] += powerval;
           //}
-          XLAL_CHECK_NULL( VectorAddREAL8( aveSFTsPower, aveSFTsPower, SFTpower, uvar->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
+          XLAL_CHECK_NULL( VectorAddREAL8( aveSFTsPower, aveSFTsPower, SFTpower ) == XLAL_SUCCESS, XLAL_EFUNC );
           //UINT4 max_index = max_index_double((REAL8Vector*)SFTpower);
           //fprintf(SIGNALOUT, "%d %.6g\n", max_index, SFTpower->data[max_index]);
         }
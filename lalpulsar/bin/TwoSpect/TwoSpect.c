@@ -1892,7 +1892,7 @@ INT4 readTwoSpectInputParams( UserInput_t *uvar, int argc, char *argv[] )
   XLALRegisterUvarMember( lineDetection,                 REAL8, 0, OPTIONAL,  "Detect stationary lines above threshold, and, if any present, set upper limit only, no template follow-up" );
   XLALRegisterUvarMember( FFTplanFlag,                    INT4, 0, OPTIONAL,  "0=Estimate, 1=Measure, 2=Patient, 3=Exhaustive" );
   XLALRegisterUvarMember( fastchisqinv,                  BOOLEAN, 0, OPTIONAL,  "Use a faster central chi-sq inversion function (roughly float precision instead of double)" );
-  XLALRegisterUvarMember( vectorMath,                     INT4, 0, OPTIONAL,  "Vector math functions: 0=None, 1=SSE, 2=AVX/SSE (Note that user needs to have compiled for SSE or AVX/SSE or program fails)" );
+  XLALRegisterUvarMember( vectorMath,                     INT4, 0, OPTIONAL,  "Vector math functions not provided by LAL VectorMath (which selects its own SIMD instructions): 0=None, 1=SSE, 2=AVX/SSE (Note that user needs to have compiled for SSE or AVX/SSE or program fails)" );
   XLALRegisterUvarMember( followUpOutsideULrange,        BOOLEAN, 0, OPTIONAL,  "Follow up outliers outside the range of the UL values" );
   XLALRegisterUvarMember( timestampsFile,                STRINGVector, 0, OPTIONAL,  "CSV list of files with timestamps, file-format: lines of <GPSsec> <GPSnsec>, conflicts with inputSFTs and segmentFile" );
   XLALRegisterUvarMember( segmentFile,                   STRINGVector, 0, OPTIONAL,  "CSV list of files with segments, file-format: lines with <GPSstart> <GPSend>, conflicts with inputSFTs and timestampsFile" );
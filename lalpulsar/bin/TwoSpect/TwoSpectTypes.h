@@ -244,6 +244,11 @@ typedef struct {
   REAL8 moddepth;
 } TwoSpectTemplate;
 
+typedef struct {
+  REAL4 weight;      //weight
+  INT4 pixelloc;     //pixel location
+} templatePixel;
+
 typedef struct {
   TwoSpectTemplate **data;
   UINT4 length;
@@ -18,6 +18,9 @@
 */
 
 #include <sys/stat.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #include <lal/UserInput.h>
 #include "TwoSpect.h"
 #include "candidates.h"
@@ -1205,6 +1208,28 @@ INT4 testIHScandidates( candidateVector **output, const candidateVector *ihsCand
 } /* testIHScandidates() */
 
 
+/**
+ * Insert a candidate into a candidateVector that is sorted by ascending (log10) probability, dropping the least
+ * significant candidate if the vector is full. Candidates with equal probability keep their insertion order.
+ * \param [in,out] output Pointer to candidateVector
+ * \param [in]     input  Pointer to candidate to be inserted
+ */
+static void insertCandidateByProb( candidateVector *output, const candidate *input )
+{
+  if ( input->prob < output->data[output->length - 1].prob ) {
+    UINT4 insertionPoint = output->length - 1;
+    while ( insertionPoint > 0 && input->prob < output->data[insertionPoint - 1].prob ) {
+      insertionPoint--;
+    }
+    memmove( &( output->data[insertionPoint + 1] ), &( output->data[insertionPoint] ), sizeof( candidate ) * ( output->length - 1 - insertionPoint ) );
+    output->data[insertionPoint] = *input;
+    if ( output->numofcandidates < output->length ) {
+      output->numofcandidates++;
+    }
+  }
+} /* insertCandidateByProb() */
+
+
 /**
  * Test each of the templates in a TwoSpectTemplateVector and keep the top 10
  * This will not check the false alarm probability of any R value less than 0.
@@ -1226,60 +1251,122 @@ INT4 testTwoSpectTemplateVector( candidateVector *output, const TwoSpectTemplate
 
   fprintf( stderr, "Testing TwoSpectTemplateVector... " );
 
-  TwoSpectTemplate *template = NULL;
-  XLAL_CHECK( ( template = createTwoSpectTemplate( templateLen ) ) != NULL, XLAL_EFUNC );
+  //Number of templates in the vector (the vector is terminated by the first empty template)
+  UINT4 numtemplates = 0;
+  while ( numtemplates < templateVec->length && templateVec->data[numtemplates]->templatedata->data[0] != 0.0 ) {
+    numtemplates++;
+  }
 
-  INT4 proberrcode = 0;
+  UINT4 numfbins = ( UINT4 )round( params->fspan * params->Tsft );
 
-  FILE *RVALS = NULL;
+  //R values are stored so that they can be written in order after the threaded loop
+  REAL8Vector *Rvals = NULL;
   if ( XLALUserVarWasSet( &params->saveRvalues ) ) {
-    XLAL_CHECK( ( RVALS = fopen( params->saveRvalues, "w" ) ) != NULL, XLAL_EIO, "Couldn't open %s for writing", params->saveRvalues );
+    XLAL_CHECK( ( Rvals = XLALCreateREAL8Vector( numfbins * numtemplates ) ) != NULL, XLAL_EFUNC );
   }
 
-  UINT4 numfbins = ( UINT4 )round( params->fspan * params->Tsft );
+  //Each thread gets its own template, candidate list, and random number generator.
+  //The random number generator is reseeded for every frequency bin from a single draw of the input rng,
+  //so that the results do not depend on the number of threads
+  INT4 numThreads = 1;
+#ifdef _OPENMP
+  numThreads = omp_get_max_threads();
+#endif
+  TwoSpectTemplate **threadTemplates = NULL;
+  candidateVector **threadCandidates = NULL;
+  gsl_rng **threadRngs = NULL;
+  XLAL_CHECK( ( threadTemplates = XLALCalloc( numThreads, sizeof( *threadTemplates ) ) ) != NULL, XLAL_ENOMEM );
+  XLAL_CHECK( ( threadCandidates = XLALCalloc( numThreads, sizeof( *threadCandidates ) ) ) != NULL, XLAL_ENOMEM );
+  XLAL_CHECK( ( threadRngs = XLALCalloc( numThreads, sizeof( *threadRngs ) ) ) != NULL, XLAL_ENOMEM );
+  for ( INT4 ii = 0; ii < numThreads; ii++ ) {
+    XLAL_CHECK( ( threadTemplates[ii] = createTwoSpectTemplate( templateLen ) ) != NULL, XLAL_EFUNC );
+    XLAL_CHECK( ( threadCandidates[ii] = createcandidateVector( output->length ) ) != NULL, XLAL_EFUNC );
+    XLAL_CHECK( ( threadRngs[ii] = gsl_rng_alloc( gsl_rng_mt19937 ) ) != NULL, XLAL_EFUNC );
+  }
+  unsigned long int rngSeedBase = gsl_rng_get( rng );
+
+  //Frequency bins are split in contiguous blocks (static schedule), so concatenating the thread candidate lists
+  //in thread order visits the templates in the same order as a serial loop
+  INT4 errflag = 0;
+  #pragma omp parallel for schedule(static) num_threads(numThreads)
   for ( UINT4 ii = 0; ii < numfbins; ii++ ) {
+    INT4 thread = 0;
+#ifdef _OPENMP
+    thread = omp_get_thread_num();
+#endif
+    INT4 thisErrflag;
+    #pragma omp atomic read
+    thisErrflag = errflag;
+    if ( thisErrflag != 0 ) {
+      continue;
+    }
+
+    TwoSpectTemplate *template = threadTemplates[thread];
+    candidateVector *candidates = threadCandidates[thread];
+    gsl_rng_set( threadRngs[thread], rngSeedBase + ii );
+
     REAL8 freq = params->fmin + ii / params->Tsft;
-    for ( UINT4 jj = 0; jj < templateVec->length; jj++ ) {
-      if ( templateVec->data[jj]->templatedata->data[0] == 0.0 ) {
+    for ( UINT4 jj = 0; jj < numtemplates; jj++ ) {
+      INT4 proberrcode = 0;
+      if ( convertTemplateForSpecificFbin( template, templateVec->data[jj], freq, params ) != XLAL_SUCCESS ) {
+        #pragma omp atomic write
+        errflag = 1;
         break;
       }
 
-      XLAL_CHECK( convertTemplateForSpecificFbin( template, templateVec->data[jj], freq, params ) == XLAL_SUCCESS, XLAL_EFUNC );
-
       REAL8 R = calculateR( ffdata->ffdata, template, aveNoise, aveTFnoisePerFbinRatio );
-      XLAL_CHECK( xlalErrno == 0, XLAL_EFUNC );
+      if ( xlalErrno != 0 ) {
+        #pragma omp atomic write
+        errflag = 1;
+        break;
+      }
       REAL8 prob = 0.0, h0 = 0.0;
       if ( R > 0.0 ) {
-        prob = probR( template, aveNoise, aveTFnoisePerFbinRatio, R, params, rng, &proberrcode );
-        XLAL_CHECK( xlalErrno == 0, XLAL_EFUNC );
+        prob = probR( template, aveNoise, aveTFnoisePerFbinRatio, R, params, threadRngs[thread], &proberrcode );
+        if ( xlalErrno != 0 ) {
+          #pragma omp atomic write
+          errflag = 1;
+          break;
+        }
         h0 = 2.7426 * pow( R / ( params->Tsft * params->Tobs ), 0.25 );
       }
 
-      if ( XLALUserVarWasSet( &params->saveRvalues ) ) {
-        fprintf( RVALS, "%g\n", R );
+      if ( Rvals != NULL ) {
+        Rvals->data[ii * numtemplates + jj] = R;
       }
 
-      if ( prob < output->data[output->length - 1].prob ) {
-        UINT4 insertionPoint = output->length - 1;
-        while ( insertionPoint > 0 && prob < output->data[insertionPoint - 1].prob ) {
-          insertionPoint--;
-        }
-        for ( INT4 kk = ( INT4 )output->length - 2; kk >= ( INT4 )insertionPoint; kk-- ) {
-          loadCandidateData( &( output->data[kk + 1] ), output->data[kk].fsig, output->data[kk].period, output->data[kk].moddepth, output->data[kk].ra, output->data[kk].dec, output->data[kk].stat, output->data[kk].h0, output->data[kk].prob, output->data[kk].proberrcode, output->data[kk].normalization, output->data[kk].templateVectorIndex, output->data[kk].lineContamination );
-        }
-        loadCandidateData( &( output->data[insertionPoint] ), template->f0, template->period, template->moddepth, skypos.longitude, skypos.latitude, R, h0, prob, proberrcode, ffdata->tfnormalization, jj, 0 );
-        if ( output->numofcandidates < output->length ) {
-          output->numofcandidates++;
-        }
-      }
+      candidate cand;
+      loadCandidateData( &cand, template->f0, template->period, template->moddepth, skypos.longitude, skypos.latitude, R, h0, prob, proberrcode, ffdata->tfnormalization, jj, 0 );
+      insertCandidateByProb( candidates, &cand );
     }
   }
+  XLAL_CHECK( errflag == 0, XLAL_EFUNC );
 
-  destroyTwoSpectTemplate( template );
+  //Merge the per-thread candidates into the output
+  for ( INT4 ii = 0; ii < numThreads; ii++ ) {
+    for ( UINT4 jj = 0; jj < threadCandidates[ii]->numofcandidates; jj++ ) {
+      insertCandidateByProb( output, &( threadCandidates[ii]->data[jj] ) );
+    }
+  }
 
-  if ( XLALUserVarWasSet( &params->saveRvalues ) ) {
+  if ( Rvals != NULL ) {
+    FILE *RVALS = NULL;
+    XLAL_CHECK( ( RVALS = fopen( params->saveRvalues, "w" ) ) != NULL, XLAL_EIO, "Couldn't open %s for writing", params->saveRvalues );
+    for ( UINT4 ii = 0; ii < Rvals->length; ii++ ) {
+      fprintf( RVALS, "%g\n", Rvals->data[ii] );
+    }
     fclose( RVALS );
+    XLALDestroyREAL8Vector( Rvals );
+  }
+
+  for ( INT4 ii = 0; ii < numThreads; ii++ ) {
+    destroyTwoSpectTemplate( threadTemplates[ii] );
+    destroycandidateVector( threadCandidates[ii] );
+    gsl_rng_free( threadRngs[ii] );
   }
+  XLALFree( threadTemplates );
+  XLALFree( threadCandidates );
+  XLALFree( threadRngs );
 
   fprintf( stderr, "done\n" );
 
@@ -569,16 +569,16 @@ INT4 fast_integrate_twospect2( qfvars *vars, INT4 nterm, REAL8 interv, REAL8 tau
   for ( INT4 ii = nterm; ii >= 0; ii-- ) {
     uVector->data[ii] = ( REAL8 )ii;
   }
-  XLAL_CHECK( VectorShiftREAL8( uVector, uVector, 0.5, vars->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
-  XLAL_CHECK( VectorScaleREAL8( oneoverPiTimesiiPlusHalfVector, uVector, LAL_PI, vars->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
-  XLAL_CHECK( VectorScaleREAL8( uVector, uVector, interv, vars->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
-  XLAL_CHECK( VectorScaleREAL8( uVectorTimesThreshold, uVector, vars->c, vars->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
-  XLAL_CHECK( VectorScaleREAL8( twoUvector, uVector, 2.0, vars->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( VectorShiftREAL8( uVector, uVector, 0.5 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( VectorScaleREAL8( oneoverPiTimesiiPlusHalfVector, uVector, LAL_PI ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( VectorScaleREAL8( uVector, uVector, interv ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( VectorScaleREAL8( uVectorTimesThreshold, uVector, vars->c ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( VectorScaleREAL8( twoUvector, uVector, 2.0 ) == XLAL_SUCCESS, XLAL_EFUNC );
   XLAL_CHECK( VectorInvertREAL8( oneoverPiTimesiiPlusHalfVector, oneoverPiTimesiiPlusHalfVector, vars->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
 
   for ( INT4 ii = nterm; ii >= 0; ii-- ) {
-    XLAL_CHECK( VectorScaleREAL8( scaledweightvector, vars->weights, twoUvector->data[ii], vars->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
-    XLAL_CHECK( VectorMultiplyREAL8( scaledweightvectorsq, scaledweightvector, scaledweightvector, vars->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( VectorScaleREAL8( scaledweightvector, vars->weights, twoUvector->data[ii] ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( VectorMultiplyREAL8( scaledweightvectorsq, scaledweightvector, scaledweightvector ) == XLAL_SUCCESS, XLAL_EFUNC );
 
     REAL8 logofproductterm = 0.0, sinetermargumentsum = 0.0, sumofabssinesumargs = 0.0;
     for ( UINT4 jj = 0; jj < scaledweightvector->length; jj++ ) {
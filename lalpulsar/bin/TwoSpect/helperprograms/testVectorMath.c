@@ -82,8 +82,8 @@ int main( void )
   XLAL_CHECK( XLALVectorMultiplyREAL4( floatresult_vecmult->data, floatvalues1->data, floatvalues2->data, floatvalues1->length ) == XLAL_SUCCESS, XLAL_EFUNC );
   XLAL_CHECK( XLALVectorShiftREAL4( floatresult_addscalar->data, ( REAL4 )100.0, floatvalues1->data, floatvalues1->length ) == XLAL_SUCCESS, XLAL_EFUNC );
   XLAL_CHECK( XLALVectorScaleREAL4( floatresult_scale->data, ( REAL4 )100.0, floatvalues1->data, floatvalues1->length ) == XLAL_SUCCESS, XLAL_EFUNC );
-  XLAL_CHECK( sseAddScalarToREAL8Vector( doubleresult_addscalar, doublevalues1, 100.0 ) == XLAL_SUCCESS, XLAL_EFUNC );
-  XLAL_CHECK( sseScaleREAL8Vector( doubleresult_scale, doublevalues1, 100.0 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( VectorShiftREAL8( doubleresult_addscalar, doublevalues1, 100.0 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( VectorScaleREAL8( doubleresult_scale, doublevalues1, 100.0 ) == XLAL_SUCCESS, XLAL_EFUNC );
   XLAL_CHECK( sseSSVectorArraySum( arraysumresult, floatvalues, floatvalues, 0, 1, 0, 1 ) == XLAL_SUCCESS, XLAL_EFUNC );
 
   //clock_gettime(CLOCK_REALTIME, &end);
@@ -180,7 +180,7 @@ TwoSpectTemplateVector *generateTwoSpectTemplateVector( const REAL8 Pmin, const
       if ( !exactflag ) {
         XLAL_CHECK_NULL( makeTemplateGaussians2( vector->data[numtemplatesgenerated], 0.0, P, dfvals->data[ii], Tsft, SFToverlap, Tobs, minTemplateLength, vectormathflag ) == XLAL_SUCCESS, XLAL_EFUNC );
       } else {
-        XLAL_CHECK_NULL( makeTemplate2( vector->data[numtemplatesgenerated], 0.0, P, dfvals->data[ii], Tsft, SFToverlap, Tobs, minTemplateLength, vectormathflag, plan ) == XLAL_SUCCESS, XLAL_EFUNC );
+        XLAL_CHECK_NULL( makeTemplate2( vector->data[numtemplatesgenerated], 0.0, P, dfvals->data[ii], Tsft, SFToverlap, Tobs, minTemplateLength, plan ) == XLAL_SUCCESS, XLAL_EFUNC );
       }
       numtemplatesgenerated++;
       if ( numtemplatesgenerated == vector->length ) {
@@ -190,7 +190,7 @@ TwoSpectTemplateVector *generateTwoSpectTemplateVector( const REAL8 Pmin, const
       if ( !exactflag ) {
         XLAL_CHECK_NULL( makeTemplateGaussians2( vector->data[numtemplatesgenerated], 0.5, P, dfvals->data[ii], Tsft, SFToverlap, Tobs, minTemplateLength, vectormathflag ) == XLAL_SUCCESS, XLAL_EFUNC );
       } else {
-        XLAL_CHECK_NULL( makeTemplate2( vector->data[numtemplatesgenerated], 0.5, P, dfvals->data[ii], Tsft, SFToverlap, Tobs, minTemplateLength, vectormathflag, plan ) == XLAL_SUCCESS, XLAL_EFUNC );
+        XLAL_CHECK_NULL( makeTemplate2( vector->data[numtemplatesgenerated], 0.5, P, dfvals->data[ii], Tsft, SFToverlap, Tobs, minTemplateLength, plan ) == XLAL_SUCCESS, XLAL_EFUNC );
       }
       numtemplatesgenerated++;
       if ( numtemplatesgenerated == vector->length ) {
@@ -592,6 +592,8 @@ INT4 makeTemplateGaussians2( TwoSpectTemplate *output, const REAL8 offset, const
   XLAL_CHECK( ( cos_phi_times_omega_pr = XLALCreateREAL4VectorAligned( omegapr->length, 32 ) ) != NULL, XLAL_EFUNC );
   XLAL_CHECK( ( phi_times_fpr = XLALCreateREAL4VectorAligned( fpr->length, 32 ) ) != NULL, XLAL_EFUNC );
   XLAL_CHECK( ( datavector = XLALCreateREAL4VectorAligned( fpr->length, 32 ) ) != NULL, XLAL_EFUNC );
+  templatePixel *pixelbatch = NULL;
+  XLAL_CHECK( ( pixelbatch = XLALMalloc( sizeof( *pixelbatch )*fpr->length ) ) != NULL, XLAL_ENOMEM );
 
   //Create template. We are going to do exp(log(Eq. 18))
   REAL8 sum = 0.0;
@@ -660,15 +662,20 @@ INT4 makeTemplateGaussians2( TwoSpectTemplate *output, const REAL8 offset, const
     } /* use SSE or not */
 
     //Now loop through the second FFT frequencies, starting with index 4
+    //Pixels larger than the weakest top bins are collected and merged into the template in one batch
+    UINT4 numpixels = 0;
+    REAL4 weakestweight = output->templatedata->data[output->templatedata->length - 1];
     for ( UINT4 jj = 4; jj < omegapr->length; jj++ ) {
       //Sum up the weights in total
       sum += ( REAL8 )( datavector->data[jj] );
 
-      //Compare with weakest top bins and if larger, launch a search to find insertion spot (insertion sort)
-      if ( datavector->data[jj] > output->templatedata->data[output->templatedata->length - 1] ) {
-        insertionSort_template( output, datavector->data[jj], bins2middlebin * fpr->length + jj );
+      if ( datavector->data[jj] > weakestweight ) {
+        pixelbatch[numpixels].weight = datavector->data[jj];
+        pixelbatch[numpixels].pixelloc = bins2middlebin * fpr->length + jj;
+        numpixels++;
       }
     } /* for jj < omegapr->length */
+    mergePixelBatch_template( output, pixelbatch, numpixels );
   } /* for ii < sigmas->length */
 
   //Normalize
@@ -708,6 +715,7 @@ INT4 makeTemplateGaussians2( TwoSpectTemplate *output, const REAL8 offset, const
   XLALDestroyREAL4VectorAligned( sin_phi_times_omega_pr );
   XLALDestroyREAL4VectorAligned( cos_phi_times_omega_pr );
   XLALDestroyREAL4VectorAligned( datavector );
+  XLALFree( pixelbatch );
 
   return XLAL_SUCCESS;
 
@@ -739,7 +747,7 @@ INT4 makeTemplate( TwoSpectTemplate *output, const candidate input, const UserIn
   UINT4 numffts = ( UINT4 )floor( params->Tobs / ( params->Tsft - params->SFToverlap ) - 1 );
   UINT4 numfprbins = ( UINT4 )floorf( 0.5 * numffts ) + 1;
 
-  XLAL_CHECK( makeTemplate2( output, offset, input.period, input.moddepth, params->Tsft, params->SFToverlap, params->Tobs, params->minTemplateLength, ( UINT4 )params->vectorMath, plan ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( makeTemplate2( output, offset, input.period, input.moddepth, params->Tsft, params->SFToverlap, params->Tobs, params->minTemplateLength, plan ) == XLAL_SUCCESS, XLAL_EFUNC );
 
   for ( UINT4 ii = 0; ii < output->pixellocations->length; ii++ ) {
     output->pixellocations->data[ii] += sigbin0 * numfprbins;
@@ -764,11 +772,10 @@ INT4 makeTemplate( TwoSpectTemplate *output, const candidate input, const UserIn
  * \param [in]     SFToverlap        SFT overlap (s)
  * \param [in]     Tobs              Observation time (s)
  * \param [in]     minTemplateLength Minimum number of pixels in a template
- * \param [in]     vectormathflag    Flag indicating to use vector math: 0 = none, 1 = SSE, 2 = AVX (must compile for vector math appropriately and CPU must have those instructions)
  * \param [in]     plan              Pointer to REAL4FFTPlan
  * \return Status value
  */
-INT4 makeTemplate2( TwoSpectTemplate *output, const REAL8 offset, const REAL8 P, const REAL8 deltaf, const REAL8 Tsft, const REAL8 SFToverlap, const REAL8 Tobs, const UINT4 minTemplateLength, const UINT4 vectormathflag, const REAL4FFTPlan *plan )
+INT4 makeTemplate2( TwoSpectTemplate *output, const REAL8 offset, const REAL8 P, const REAL8 deltaf, const REAL8 Tsft, const REAL8 SFToverlap, const REAL8 Tobs, const UINT4 minTemplateLength, const REAL4FFTPlan *plan )
 {
   XLAL_CHECK( output != NULL && plan != NULL, XLAL_EINVAL );
 
@@ -833,7 +840,7 @@ INT4 makeTemplate2( TwoSpectTemplate *output, const REAL8 offset, const REAL8 P,
   XLALDestroyREAL4VectorAligned( cos2PiPeriodfT );
   for ( UINT4 ii = 0; ii < numffts; ii++ ) {
     REAL8 sigbin = sigbin_sin2PiPeriodfT->data[ii];
-    XLAL_CHECK( VectorShiftREAL8( bindiffs, freqbins, -sigbin, vectormathflag ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( VectorShiftREAL8( bindiffs, freqbins, -sigbin ) == XLAL_SUCCESS, XLAL_EFUNC );
     for ( UINT4 jj = 0; jj < templatespan; jj++ ) {
       //Create PSD values organized by f0 => psd1->data[0...numffts-1], sft1 => psd1->data[numffts...2*numffts-1]
       //Restricting to +/- 1.75 bins means >99.9% of the total power is included in the template calculation
@@ -850,6 +857,8 @@ INT4 makeTemplate2( TwoSpectTemplate *output, const REAL8 offset, const REAL8 P,
   REAL4Window *win = NULL;
   XLAL_CHECK( ( x = XLALCreateREAL4VectorAligned( numffts, 32 ) ) != NULL, XLAL_EFUNC );
   XLAL_CHECK( ( psd = XLALCreateREAL4VectorAligned( numfprbins, 32 ) ) != NULL, XLAL_EFUNC );
+  templatePixel *pixelbatch = NULL;
+  XLAL_CHECK( ( pixelbatch = XLALMalloc( sizeof( *pixelbatch )*psd->length ) ) != NULL, XLAL_ENOMEM );
   XLAL_CHECK( ( windowdata = XLALCreateREAL4VectorAligned( x->length, 32 ) ) != NULL, XLAL_EFUNC );
   XLAL_CHECK( ( win = XLALCreateHannREAL4Window( x->length ) ) != NULL, XLAL_EFUNC );
   memcpy( windowdata->data, win->data->data, x->length * sizeof( REAL4 ) );
@@ -886,14 +895,19 @@ INT4 makeTemplate2( TwoSpectTemplate *output, const REAL8 offset, const REAL8 P,
       XLAL_CHECK( XLALVectorScaleREAL4( psd->data, secPSDfactor, psd->data, psd->length ) == XLAL_SUCCESS, XLAL_EFUNC );
 
       //Ignore the DC to 3rd frequency bins in sum
+      UINT4 numpixels = 0;
+      REAL4 weakestweight = output->templatedata->data[output->templatedata->length - 1];
       for ( UINT4 jj = 4; jj < psd->length; jj++ ) {
         sum += ( REAL8 )psd->data[jj];   //sum up the total weight
 
-        //Sort the weights, insertion sort technique
-        if ( psd->data[jj] > output->templatedata->data[output->templatedata->length - 1] ) {
-          insertionSort_template( output, psd->data[jj], bins2middlebin * psd->length + jj );
+        //Collect the weights larger than the weakest top bins, to be sorted into the template in one batch
+        if ( psd->data[jj] > weakestweight ) {
+          pixelbatch[numpixels].weight = psd->data[jj];
+          pixelbatch[numpixels].pixelloc = bins2middlebin * psd->length + jj;
+          numpixels++;
         }
       } /* for jj < psd->length */
+      mergePixelBatch_template( output, pixelbatch, numpixels );
     } /* if doSecondFFT */
   } /* if ii < numfbins */
 
@@ -923,12 +937,81 @@ INT4 makeTemplate2( TwoSpectTemplate *output, const REAL8 offset, const REAL8 P,
   XLALDestroyREAL4VectorAligned( x );
   XLALDestroyREAL4VectorAligned( psd );
   XLALDestroyREAL4VectorAligned( windowdata );
+  XLALFree( pixelbatch );
 
   return XLAL_SUCCESS;
 
 }
 
 
+/**
+ * Compare two templatePixel values for sorting by descending weight, and by ascending pixel location for equal weights
+ * \param [in] a Pointer to first templatePixel
+ * \param [in] b Pointer to second templatePixel
+ * \return -1, 0, or 1
+ */
+static int compareTemplatePixels( const void *a, const void *b )
+{
+  const templatePixel *x = ( const templatePixel * )a;
+  const templatePixel *y = ( const templatePixel * )b;
+  if ( x->weight > y->weight ) {
+    return -1;
+  } else if ( x->weight < y->weight ) {
+    return 1;
+  } else if ( x->pixelloc < y->pixelloc ) {
+    return -1;
+  } else if ( x->pixelloc > y->pixelloc ) {
+    return 1;
+  }
+  return 0;
+} /* compareTemplatePixels() */
+
+
+/**
+ * Merge a batch of pixel weights into the template weights, which are kept sorted in descending order.
+ *
+ * Gives the same result as calling insertionSort_template() for each pixel in turn (in order of increasing
+ * pixel location), but sorts the batch once and merges it in place instead of shifting the template for every pixel.
+ * \param [in,out] output    Pointer to TwoSpectTemplate
+ * \param [in,out] batch     Pointer to array of templatePixel (sorted on output)
+ * \param [in]     numpixels Number of pixels in the batch
+ */
+void mergePixelBatch_template( TwoSpectTemplate *output, templatePixel *batch, const UINT4 numpixels )
+{
+
+  if ( numpixels == 0 ) {
+    return;
+  }
+
+  qsort( batch, numpixels, sizeof( *batch ), compareTemplatePixels );
+
+  //Count how many of the batch pixels end up in the template; existing weights come before equal new weights
+  UINT4 length = output->templatedata->length, numexisting = 0, numnew = 0;
+  while ( numexisting + numnew < length ) {
+    if ( numnew < numpixels && batch[numnew].weight > output->templatedata->data[numexisting] ) {
+      numnew++;
+    } else {
+      numexisting++;
+    }
+  }
+
+  //Merge from the back so that it can be done in place
+  INT4 existing = ( INT4 )numexisting - 1, newpixel = ( INT4 )numnew - 1;
+  for ( INT4 ii = ( INT4 )length - 1; ii >= 0 && newpixel >= 0; ii-- ) {
+    if ( existing < 0 || batch[newpixel].weight <= output->templatedata->data[existing] ) {
+      output->templatedata->data[ii] = batch[newpixel].weight;
+      output->pixellocations->data[ii] = batch[newpixel].pixelloc;
+      newpixel--;
+    } else {
+      output->templatedata->data[ii] = output->templatedata->data[existing];
+      output->pixellocations->data[ii] = output->pixellocations->data[existing];
+      existing--;
+    }
+  }
+
+} /* mergePixelBatch_template() */
+
+
 /**
  * Insertion sort for the template weights
  * \param [out] output        Pointer to TwoSpectTemplate
@@ -36,8 +36,9 @@ INT4 convertTemplateForSpecificFbin( TwoSpectTemplate *output, const TwoSpectTem
 INT4 makeTemplateGaussians( TwoSpectTemplate *output, const candidate input, const UserInput_t *params );
 INT4 makeTemplateGaussians2( TwoSpectTemplate *output, const REAL8 offset, const REAL8 P, const REAL8 deltaf, const REAL8 Tsft, const REAL8 SFToverlap, const REAL8 Tobs, const UINT4 minTemplateLength, const UINT4 vectormathflag );
 INT4 makeTemplate( TwoSpectTemplate *output, const candidate intput, const UserInput_t *params, const REAL4FFTPlan *plan );
-INT4 makeTemplate2( TwoSpectTemplate *output, const REAL8 offset, const REAL8 P, const REAL8 deltaf, const REAL8 Tsft, const REAL8 SFToverlap, const REAL8 Tobs, const UINT4 minTemplateLength, const UINT4 vectormathflag, const REAL4FFTPlan *plan );
+INT4 makeTemplate2( TwoSpectTemplate *output, const REAL8 offset, const REAL8 P, const REAL8 deltaf, const REAL8 Tsft, const REAL8 SFToverlap, const REAL8 Tobs, const UINT4 minTemplateLength, const REAL4FFTPlan *plan );
 void insertionSort_template( TwoSpectTemplate *output, const REAL4 weight, const INT4 pixelloc );
+void mergePixelBatch_template( TwoSpectTemplate *output, templatePixel *batch, const UINT4 numpixels );
 
 REAL8 sincxoverxsqminusone( const REAL8 x );
 REAL8 sqsincxoverxsqminusone( const REAL8 x );
@@ -0,0 +1,47 @@
+## common variables
+t0=1000000000
+Tobs=864000
+Tsft=1800
+SFToverlap=900
+fmin=100.0
+fspan=0.1
+Pmin=7200
+Pmax=172800
+dfmin=0.0002778
+dfmax=0.01
+
+## create a template bank
+cmdline="lalpulsar_TwoSpectTemplateBank --Tobs=${Tobs} --Tsft=${Tsft} --SFToverlap=${SFToverlap} --Pmin=${Pmin} --Pmax=${Pmax} --dfmin=${dfmin} --dfmax=${dfmax} --minTemplateLength=1 --maxTemplateLength=50 --maxVectorLength=50 --filename=templatebank.dat"
+if ! eval "$cmdline"; then
+    echo "ERROR: something failed when running '$cmdline'"
+    exit 1
+fi
+if ! test -f templatebank.dat; then
+    echo "ERROR: could not find file 'templatebank.dat'"
+    exit 1
+fi
+
+## check that the template bank test and the IHS step do not depend on the number of threads;
+## each frequency bin of the template bank test uses random numbers seeded from the same draw of
+## the main random number generator, whichever thread it is assigned to
+for nthreads in 1 3; do
+    outdir=threads_${nthreads}
+    mkdir -p ${outdir}
+    cmdline="OMP_NUM_THREADS=${nthreads} lalpulsar_TwoSpect --outdirectory=${outdir} --IFO=H1 --avesqrtSh=1e-22 --t0=${t0} --Tobs=${Tobs} --Tsft=${Tsft} --SFToverlap=${SFToverlap} --fmin=${fmin} --fspan=${fspan} --Pmin=${Pmin} --Pmax=${Pmax} --dfmin=${dfmin} --dfmax=${dfmax} --skyRegion='(3.14,0.5)' --injRandSeed=42 --randSeed=43 --FFTplanFlag=0 --templatebankfile=templatebank.dat --saveRvalues=${outdir}/Rvalues.dat"
+    if ! eval "$cmdline"; then
+        echo "ERROR: something failed when running '$cmdline'"
+        exit 1
+    fi
+done
+echo -n "Comparing TwoSpect output with 1 and 3 threads ... "
+for file in candidates.dat Rvalues.dat; do
+    if ! test -f threads_1/${file}; then
+        echo "ERROR: could not find file 'threads_1/${file}'"
+        exit 1
+    fi
+    if ! cmp -s threads_1/${file} threads_3/${file}; then
+        echo "ERROR: threads_1/${file} and threads_3/${file} differ"
+        exit 1
+    fi
+done
+echo "OK"
@@ -143,7 +143,7 @@ INT4 DirichletRatioVector( COMPLEX8Vector *output, alignedREAL8Vector *delta0, a
     delta1_int->data[ii] = ( REAL4 )( delta1->data[ii] );
   }
 
-  XLAL_CHECK( VectorRoundREAL4( roundedDelta0_int, delta0_int, params->vectorMath ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( VectorRoundREAL4( roundedDelta0_int, delta0_int ) == XLAL_SUCCESS, XLAL_EFUNC );
   XLAL_CHECK( XLALVectorScaleREAL4( PiDelta->data, ( REAL4 )LAL_PI, delta0_int->data, delta0_int->length ) == XLAL_SUCCESS, XLAL_EFUNC );
   XLAL_CHECK( XLALVectorSinCosREAL4( sinPiDelta0->data, cosPiDelta0->data, PiDelta->data, PiDelta->length ) == XLAL_SUCCESS, XLAL_EFUNC );
   XLAL_CHECK( XLALVectorScaleREAL4( PiDelta->data, ( REAL4 )LAL_PI, delta1_int->data, delta1_int->length ) == XLAL_SUCCESS, XLAL_EFUNC );
@@ -240,81 +240,45 @@ INT4 fastSSVectorMultiply_with_stride_and_offset( REAL4VectorAligned *output, co
 
 } /* SSVectorMultiply_with_stride_and_offset() */
 
-INT4 VectorSubtractREAL4( REAL4VectorAligned *output, REAL4VectorAligned *input1, REAL4VectorAligned *input2, INT4 vectorMath )
+INT4 VectorSubtractREAL4( REAL4VectorAligned *output, REAL4VectorAligned *input1, REAL4VectorAligned *input2 )
 {
   XLAL_CHECK( output != NULL && input1 != NULL && input2 != NULL, XLAL_EINVAL );
-  if ( vectorMath == 1 ) {
-    XLAL_CHECK( sseSSVectorSubtract( output, input1, input2 ) == XLAL_SUCCESS, XLAL_EFUNC );
-  } else if ( vectorMath == 2 ) {
-    XLAL_CHECK( avxSSVectorSubtract( output, input1, input2 ) == XLAL_SUCCESS, XLAL_EFUNC );
-  } else for ( UINT4 ii = 0; ii < input1->length; ii++ ) {
-      output->data[ii] = input1->data[ii] - input2->data[ii];
-    }
+  XLAL_CHECK( XLALVectorSubREAL4( output->data, input1->data, input2->data, input1->length ) == XLAL_SUCCESS, XLAL_EFUNC );
   return XLAL_SUCCESS;
 }
 
-INT4 VectorScaleREAL8( alignedREAL8Vector *output, alignedREAL8Vector *input, REAL8 scale, INT4 vectorMath )
+INT4 VectorScaleREAL8( alignedREAL8Vector *output, alignedREAL8Vector *input, REAL8 scale )
 {
   XLAL_CHECK( output != NULL && input != NULL, XLAL_EINVAL );
-  if ( vectorMath == 1 ) {
-    XLAL_CHECK( sseScaleREAL8Vector( output, input, scale ) == XLAL_SUCCESS, XLAL_EFUNC );
-  } else if ( vectorMath == 2 ) {
-    XLAL_CHECK( avxScaleREAL8Vector( output, input, scale ) == XLAL_SUCCESS, XLAL_EFUNC );
-  } else for ( UINT4 ii = 0; ii < input->length; ii++ ) {
-      output->data[ii] = input->data[ii] * scale;
-    }
+  XLAL_CHECK( XLALVectorScaleREAL8( output->data, scale, input->data, input->length ) == XLAL_SUCCESS, XLAL_EFUNC );
   return XLAL_SUCCESS;
 }
 
-INT4 VectorShiftREAL8( alignedREAL8Vector *output, alignedREAL8Vector *input, REAL8 shift, INT4 vectorMath )
+INT4 VectorShiftREAL8( alignedREAL8Vector *output, alignedREAL8Vector *input, REAL8 shift )
 {
   XLAL_CHECK( output != NULL && input != NULL, XLAL_EINVAL );
-  if ( vectorMath == 1 ) {
-    XLAL_CHECK( sseAddScalarToREAL8Vector( output, input, shift ) == XLAL_SUCCESS, XLAL_EFUNC );
-  } else if ( vectorMath == 2 ) {
-    XLAL_CHECK( avxAddScalarToREAL8Vector( output, input, shift ) == XLAL_SUCCESS, XLAL_EFUNC );
-  } else for ( UINT4 ii = 0; ii < input->length; ii++ ) {
-      output->data[ii] = input->data[ii] + shift;
-    }
+  XLAL_CHECK( XLALVectorShiftREAL8( output->data, shift, input->data, input->length ) == XLAL_SUCCESS, XLAL_EFUNC );
   return XLAL_SUCCESS;
 }
 
-INT4 VectorAddREAL8( alignedREAL8Vector *output, alignedREAL8Vector *input1, alignedREAL8Vector *input2, INT4 vectorMath )
+INT4 VectorAddREAL8( alignedREAL8Vector *output, alignedREAL8Vector *input1, alignedREAL8Vector *input2 )
 {
   XLAL_CHECK( output != NULL && input1 != NULL && input2 != NULL, XLAL_EINVAL );
-  if ( vectorMath == 1 ) {
-    XLAL_CHECK( sseDDVectorSum( output, input1, input2 ) == XLAL_SUCCESS, XLAL_EFUNC );
-  } else if ( vectorMath == 2 ) {
-    XLAL_CHECK( avxDDVectorSum( output, input1, input2 ) == XLAL_SUCCESS, XLAL_EFUNC );
-  } else for ( UINT4 ii = 0; ii < input1->length; ii++ ) {
-      output->data[ii] = input1->data[ii] + input2->data[ii];
-    }
+  XLAL_CHECK( XLALVectorAddREAL8( output->data, input1->data, input2->data, input1->length ) == XLAL_SUCCESS, XLAL_EFUNC );
   return XLAL_SUCCESS;
 }
 
-INT4 VectorSubtractREAL8( alignedREAL8Vector *output, alignedREAL8Vector *input1, alignedREAL8Vector *input2, INT4 vectorMath )
+INT4 VectorSubtractREAL8( alignedREAL8Vector *output, alignedREAL8Vector *input1, alignedREAL8Vector *input2 )
 {
   XLAL_CHECK( output != NULL && input1 != NULL && input2 != NULL, XLAL_EINVAL );
-  if ( vectorMath == 1 ) {
-    XLAL_CHECK( sseDDVectorSubtract( output, input1, input2 ) == XLAL_SUCCESS, XLAL_EFUNC );
-  } else if ( vectorMath == 2 ) {
-    XLAL_CHECK( avxDDVectorSubtract( output, input1, input2 ) == XLAL_SUCCESS, XLAL_EFUNC );
-  } else for ( UINT4 ii = 0; ii < input1->length; ii++ ) {
-      output->data[ii] = input1->data[ii] - input2->data[ii];
-    }
+  XLAL_CHECK( XLALVectorSubREAL8( output->data, input1->data, input2->data, input1->length ) == XLAL_SUCCESS, XLAL_EFUNC );
   return XLAL_SUCCESS;
 }
 
-INT4 VectorMultiplyREAL8( alignedREAL8Vector *output, alignedREAL8Vector *input1, alignedREAL8Vector *input2, INT4 vectorMath )
+INT4 VectorMultiplyREAL8( alignedREAL8Vector *output, alignedREAL8Vector *input1, alignedREAL8Vector *input2 )
 {
   XLAL_CHECK( output != NULL && input1 != NULL && input2 != NULL, XLAL_EINVAL );
-  if ( vectorMath == 1 ) {
-    XLAL_CHECK( sseDDVectorMultiply( output, input1, input2 ) == XLAL_SUCCESS, XLAL_EFUNC );
-  } else if ( vectorMath == 2 ) {
-    XLAL_CHECK( avxDDVectorMultiply( output, input1, input2 ) == XLAL_SUCCESS, XLAL_EFUNC );
-  } else for ( UINT4 ii = 0; ii < input1->length; ii++ ) {
-      output->data[ii] = input1->data[ii] * input2->data[ii];
-    }
+  XLAL_CHECK( XLALVectorMultiplyREAL8( output->data, input1->data, input2->data, input1->length ) == XLAL_SUCCESS, XLAL_EFUNC );
   return XLAL_SUCCESS;
 }
 
@@ -362,65 +326,17 @@ INT4 VectorFloorREAL8( alignedREAL8Vector *output, alignedREAL8Vector *input, IN
   return XLAL_SUCCESS;
 }
 
-INT4 VectorRoundREAL4( REAL4VectorAligned *output, REAL4VectorAligned *input, INT4 vectorMath )
+INT4 VectorRoundREAL4( REAL4VectorAligned *output, REAL4VectorAligned *input )
 {
   XLAL_CHECK( output != NULL && input != NULL, XLAL_EINVAL );
-  if ( vectorMath == 2 ) {
-#ifdef __AVX__
-    _mm256_zeroupper();
-    INT4 roundedvectorlength = ( INT4 )input->length / 8;
-    __m256 *arr, *result;
-    arr = ( __m256 * )( void * )input->data;
-    result = ( __m256 * )( void * )output->data;
-    for ( INT4 ii = 0; ii < roundedvectorlength; ii++ ) {
-      *result = _mm256_round_ps( *arr, _MM_FROUND_TO_NEAREST_INT );
-      arr++;
-      result++;
-    }
-    _mm256_zeroupper();
-    for ( UINT4 ii = 8 * roundedvectorlength; ii < input->length; ii++ ) {
-      output->data[ii] = roundf( input->data[ii] );
-    }
-#else
-    ( void )output;
-    ( void )input;
-    fprintf( stderr, "%s: Failed because AVX is not supported, possibly because -mavx flag wasn't used for compiling.\n", __func__ );
-    XLAL_ERROR( XLAL_EFAILED );
-#endif
-  } else for ( UINT4 ii = 0; ii < input->length; ii++ ) {
-      output->data[ii] = round( input->data[ii] );
-    }
+  XLAL_CHECK( XLALVectorRoundREAL4( output->data, input->data, input->length ) == XLAL_SUCCESS, XLAL_EFUNC );
   return XLAL_SUCCESS;
 }
 
-INT4 VectorRoundREAL8( alignedREAL8Vector *output, alignedREAL8Vector *input, INT4 vectorMath )
+INT4 VectorRoundREAL8( alignedREAL8Vector *output, alignedREAL8Vector *input )
 {
   XLAL_CHECK( output != NULL && input != NULL, XLAL_EINVAL );
-  if ( vectorMath == 2 ) {
-#ifdef __AVX__
-    _mm256_zeroupper();
-    INT4 roundedvectorlength = ( INT4 )input->length / 4;
-    __m256d *arr, *result;
-    arr = ( __m256d * )( void * )input->data;
-    result = ( __m256d * )( void * )output->data;
-    for ( INT4 ii = 0; ii < roundedvectorlength; ii++ ) {
-      *result = _mm256_round_pd( *arr, _MM_FROUND_TO_NEAREST_INT );
-      arr++;
-      result++;
-    }
-    _mm256_zeroupper();
-    for ( UINT4 ii = 4 * roundedvectorlength; ii < input->length; ii++ ) {
-      output->data[ii] = round( input->data[ii] );
-    }
-#else
-    ( void )output;
-    ( void )input;
-    fprintf( stderr, "%s: Failed because AVX is not supported, possibly because -mavx flag wasn't used for compiling.\n", __func__ );
-    XLAL_ERROR( XLAL_EFAILED );
-#endif
-  } else for ( UINT4 ii = 0; ii < input->length; ii++ ) {
-      output->data[ii] = round( input->data[ii] );
-    }
+  XLAL_CHECK( XLALVectorRoundREAL8( output->data, input->data, input->length ) == XLAL_SUCCESS, XLAL_EFUNC );
   return XLAL_SUCCESS;
 }
 
@@ -647,368 +563,6 @@ INT4 VectorCabsCOMPLEX8( alignedREAL8Vector *output, COMPLEX8Vector *input, INT4
   return XLAL_SUCCESS;
 }
 
-/**
- * Sum two alignedREAL8Vector using SSE2
- * \param [out] output Pointer to a alignedREAL8Vector
- * \param [in]  input1 Pointer to a alignedREAL8Vector
- * \param [in]  input2 Pointer to a alignedREAL8Vector
- * \return Status value
- */
-INT4 sseDDVectorSum( alignedREAL8Vector *output, alignedREAL8Vector *input1, alignedREAL8Vector *input2 )
-{
-
-#ifdef __SSE2__
-  INT4 roundedvectorlength = ( INT4 )input1->length / 2;
-
-  __m128d *arr1, *arr2, *result;
-  arr1 = ( __m128d * )( void * )input1->data;
-  arr2 = ( __m128d * )( void * )input2->data;
-  result = ( __m128d * )( void * )output->data;
-
-  //add the two vectors into the output
-  for ( INT4 ii = 0; ii < roundedvectorlength; ii++ ) {
-    *result = _mm_add_pd( *arr1, *arr2 );
-    arr1++;
-    arr2++;
-    result++;
-  }
-
-  //Finish up the remaining part
-  for ( UINT4 ii = 2 * roundedvectorlength; ii < input1->length; ii++ ) {
-    output->data[ii] = input1->data[ii] + input2->data[ii];
-  }
-
-  return XLAL_SUCCESS;
-#else
-  ( void )output;
-  ( void )input1;
-  ( void )input2;
-  fprintf( stderr, "%s: Failed because SSE2 is not supported, possibly because -msse2 flag wasn't used for compiling.\n", __func__ );
-  XLAL_ERROR( XLAL_EFAILED );
-#endif
-
-}
-
-
-/**
- * Sum two alignedREAL8Vector using AVX
- * \param [out] output Pointer to a alignedREAL8Vector
- * \param [in]  input1 Pointer to a alignedREAL8Vector
- * \param [in]  input2 Pointer to a alignedREAL8Vector
- * \return Status value
- */
-INT4 avxDDVectorSum( alignedREAL8Vector *output, alignedREAL8Vector *input1, alignedREAL8Vector *input2 )
-{
-
-#ifdef __AVX__
-  //Need to zero the upper 128 bits in case of an SSE function call after this AVX function
-  _mm256_zeroupper();
-
-  INT4 roundedvectorlength = ( INT4 )input1->length / 4;
-
-  __m256d *arr1, *arr2, *result;
-  arr1 = ( __m256d * )( void * )input1->data;
-  arr2 = ( __m256d * )( void * )input2->data;
-  result = ( __m256d * )( void * )output->data;
-
-  //add the two vectors into the output
-  for ( INT4 ii = 0; ii < roundedvectorlength; ii++ ) {
-    *result = _mm256_add_pd( *arr1, *arr2 );
-    arr1++;
-    arr2++;
-    result++;
-  }
-
-  //Finish up the remaining part
-  for ( UINT4 ii = 4 * roundedvectorlength; ii < input1->length; ii++ ) {
-    output->data[ii] = input1->data[ii] + input2->data[ii];
-  }
-
-  //Need to zero the upper 128 bits in case of an SSE function call after this AVX function
-  _mm256_zeroupper();
-
-  return XLAL_SUCCESS;
-#else
-  ( void )output;
-  ( void )input1;
-  ( void )input2;
-  fprintf( stderr, "%s: Failed because AVX is not supported, possibly because -mavx flag wasn't used for compiling.\n", __func__ );
-  XLAL_ERROR( XLAL_EFAILED );
-#endif
-
-}
-
-/**
- * Subtract two REAL4VectorAligned using SSE
- * \param [out] output Pointer to a REAL4VectorAligned
- * \param [in]  input1 Pointer to a REAL4VectorAligned
- * \param [in]  input2 Pointer to a REAL4VectorAligned
- * \return Status value
- */
-INT4 sseSSVectorSubtract( REAL4VectorAligned *output, REAL4VectorAligned *input1, REAL4VectorAligned *input2 )
-{
-
-#ifdef __SSE__
-  INT4 roundedvectorlength = ( INT4 )input1->length / 4;
-
-  __m128 *arr1, *arr2, *result;
-  arr1 = ( __m128 * )( void * )input1->data;
-  arr2 = ( __m128 * )( void * )input2->data;
-  result = ( __m128 * )( void * )output->data;
-
-  //subtract the two vectors into the output
-  for ( INT4 ii = 0; ii < roundedvectorlength; ii++ ) {
-    *result = _mm_sub_ps( *arr1, *arr2 );
-    arr1++;
-    arr2++;
-    result++;
-  }
-
-  //Finish up the remaining part
-  for ( UINT4 ii = 4 * roundedvectorlength; ii < input1->length; ii++ ) {
-    output->data[ii] = input1->data[ii] - input2->data[ii];
-  }
-
-  return XLAL_SUCCESS;
-#else
-  ( void )output;
-  ( void )input1;
-  ( void )input2;
-  fprintf( stderr, "%s: Failed because SSE is not supported, possibly because -msse flag wasn't used for compiling.\n", __func__ );
-  XLAL_ERROR( XLAL_EFAILED );
-#endif
-
-}
-
-/**
- * Subtract two REAL4VectorAligned using AVX
- * \param [out] output Pointer to a REAL4VectorAligned
- * \param [in]  input1 Pointer to a REAL4VectorAligned
- * \param [in]  input2 Pointer to a REAL4VectorAligned
- * \return Status value
- */
-INT4 avxSSVectorSubtract( REAL4VectorAligned *output, REAL4VectorAligned *input1, REAL4VectorAligned *input2 )
-{
-
-#ifdef __AVX__
-  //Need to zero the upper 128 bits in case of an SSE function call after this AVX function
-  _mm256_zeroupper();
-
-  INT4 roundedvectorlength = ( INT4 )input1->length / 8;
-
-  __m256 *arr1, *arr2, *result;
-  arr1 = ( __m256 * )( void * )input1->data;
-  arr2 = ( __m256 * )( void * )input2->data;
-  result = ( __m256 * )( void * )output->data;
-
-  //subtract the two vectors into the output
-  for ( INT4 ii = 0; ii < roundedvectorlength; ii++ ) {
-    *result = _mm256_sub_ps( *arr1, *arr2 );
-    arr1++;
-    arr2++;
-    result++;
-  }
-
-  //Finish up the remaining part
-  for ( UINT4 ii = 8 * roundedvectorlength; ii < input1->length; ii++ ) {
-    output->data[ii] = input1->data[ii] - input2->data[ii];
-  }
-
-  //Need to zero the upper 128 bits in case of an SSE function call after this AVX function
-  _mm256_zeroupper();
-
-  return XLAL_SUCCESS;
-#else
-  ( void )output;
-  ( void )input1;
-  ( void )input2;
-  fprintf( stderr, "%s: Failed because AVX is not supported, possibly because -mavx flag wasn't used for compiling.\n", __func__ );
-  XLAL_ERROR( XLAL_EFAILED );
-#endif
-
-}
-
-/**
- * Subtract two alignedREAL8Vector using SSE
- * \param [out] output Pointer to a alignedREAL8Vector
- * \param [in]  input1 Pointer to a alignedREAL8Vector
- * \param [in]  input2 Pointer to a alignedREAL8Vector
- * \return Status value
- */
-INT4 sseDDVectorSubtract( alignedREAL8Vector *output, alignedREAL8Vector *input1, alignedREAL8Vector *input2 )
-{
-
-#ifdef __SSE2__
-  INT4 roundedvectorlength = ( INT4 )input1->length / 2;
-
-  __m128d *arr1, *arr2, *result;
-  arr1 = ( __m128d * )( void * )input1->data;
-  arr2 = ( __m128d * )( void * )input2->data;
-  result = ( __m128d * )( void * )output->data;
-
-  //Subtract the two vectors into the output
-  for ( INT4 ii = 0; ii < roundedvectorlength; ii++ ) {
-    *result = _mm_sub_pd( *arr1, *arr2 );
-    arr1++;
-    arr2++;
-    result++;
-  }
-
-  //Finish up the remaining part
-  for ( UINT4 ii = 2 * roundedvectorlength; ii < input1->length; ii++ ) {
-    output->data[ii] = input1->data[ii] - input2->data[ii];
-  }
-
-  return XLAL_SUCCESS;
-#else
-  ( void )output;
-  ( void )input1;
-  ( void )input2;
-  fprintf( stderr, "%s: Failed because SSE2 is not supported, possibly because -msse2 flag wasn't used for compiling.\n", __func__ );
-  XLAL_ERROR( XLAL_EFAILED );
-#endif
-
-}
-
-/**
- * Subtract two alignedREAL8Vector using AVX
- * \param [out] output Pointer to a alignedREAL8Vector
- * \param [in]  input1 Pointer to a alignedREAL8Vector
- * \param [in]  input2 Pointer to a alignedREAL8Vector
- * \return Status value
- */
-INT4 avxDDVectorSubtract( alignedREAL8Vector *output, alignedREAL8Vector *input1, alignedREAL8Vector *input2 )
-{
-
-#ifdef __AVX__
-  //Need to zero the upper 128 bits in case of an SSE function call after this AVX function
-  _mm256_zeroupper();
-
-  INT4 roundedvectorlength = ( INT4 )input1->length / 4;
-
-  __m256d *arr1, *arr2, *result;
-  arr1 = ( __m256d * )( void * )input1->data;
-  arr2 = ( __m256d * )( void * )input2->data;
-  result = ( __m256d * )( void * )output->data;
-
-  //Subtract the two vectors into the output
-  for ( INT4 ii = 0; ii < roundedvectorlength; ii++ ) {
-    *result = _mm256_sub_pd( *arr1, *arr2 );
-    arr1++;
-    arr2++;
-    result++;
-  }
-
-  //Finish up the remaining part
-  for ( UINT4 ii = 4 * roundedvectorlength; ii < input1->length; ii++ ) {
-    output->data[ii] = input1->data[ii] - input2->data[ii];
-  }
-
-  //Need to zero the upper 128 bits in case of an SSE function call after this AVX function
-  _mm256_zeroupper();
-
-  return XLAL_SUCCESS;
-#else
-  ( void )output;
-  ( void )input1;
-  ( void )input2;
-  fprintf( stderr, "%s: Failed because AVX is not supported, possibly because -mavx flag wasn't used for compiling.\n", __func__ );
-  XLAL_ERROR( XLAL_EFAILED );
-#endif
-
-}
-
-/**
- * Multiply two alignedREAL8Vector using SSE
- * \param [out] output Pointer to a alignedREAL8Vector
- * \param [in]  input1 Pointer to a alignedREAL8Vector
- * \param [in]  input2 Pointer to a alignedREAL8Vector
- * \return Status value
- */
-INT4 sseDDVectorMultiply( alignedREAL8Vector *output, alignedREAL8Vector *input1, alignedREAL8Vector *input2 )
-{
-
-#ifdef __SSE2__
-  INT4 roundedvectorlength = ( INT4 )input1->length / 2;
-
-  __m128d *arr1, *arr2, *result;
-  arr1 = ( __m128d * )( void * )input1->data;
-  arr2 = ( __m128d * )( void * )input2->data;
-  result = ( __m128d * )( void * )output->data;
-
-  //multiply the two vectors into the output
-  for ( INT4 ii = 0; ii < roundedvectorlength; ii++ ) {
-    *result = _mm_mul_pd( *arr1, *arr2 );
-    arr1++;
-    arr2++;
-    result++;
-  }
-
-  //Finish up the remaining part
-  for ( INT4 ii = 2 * roundedvectorlength; ii < ( INT4 )input1->length; ii++ ) {
-    output->data[ii] = input1->data[ii] * input2->data[ii];
-  }
-
-  return XLAL_SUCCESS;
-#else
-  ( void )output;
-  ( void )input1;
-  ( void )input2;
-  fprintf( stderr, "%s: Failed because SSE2 is not supported, possibly because -msse2 flag wasn't used for compiling.\n", __func__ );
-  XLAL_ERROR( XLAL_EFAILED );
-#endif
-
-}
-
-
-/**
- * Multiply two alignedREAL8Vector using AVX
- * \param [out] output Pointer to a alignedREAL8Vector
- * \param [in]  input1 Pointer to a alignedREAL8Vector
- * \param [in]  input2 Pointer to a alignedREAL8Vector
- * \return Status value
- */
-INT4 avxDDVectorMultiply( alignedREAL8Vector *output, alignedREAL8Vector *input1, alignedREAL8Vector *input2 )
-{
-
-#ifdef __AVX__
-  //Need to zero the upper 128 bits in case of an SSE function call after this AVX function
-  _mm256_zeroupper();
-
-  INT4 roundedvectorlength = ( INT4 )input1->length / 4;
-
-  __m256d *arr1, *arr2, *result;
-  arr1 = ( __m256d * )( void * )input1->data;
-  arr2 = ( __m256d * )( void * )input2->data;
-  result = ( __m256d * )( void * )output->data;
-
-  //multiply the two vectors into the output
-  for ( INT4 ii = 0; ii < roundedvectorlength; ii++ ) {
-    *result = _mm256_mul_pd( *arr1, *arr2 );
-    arr1++;
-    arr2++;
-    result++;
-  }
-
-  //Finish up the remaining part
-  for ( INT4 ii = 4 * roundedvectorlength; ii < ( INT4 )input1->length; ii++ ) {
-    output->data[ii] = input1->data[ii] * input2->data[ii];
-  }
-
-  //Need to zero the upper 128 bits in case of an SSE function call after this AVX function
-  _mm256_zeroupper();
-
-  return XLAL_SUCCESS;
-#else
-  ( void )output;
-  ( void )input1;
-  ( void )input2;
-  fprintf( stderr, "%s: Failed because AVX is not supported, possibly because -mavx flag wasn't used for compiling.\n", __func__ );
-  XLAL_ERROR( XLAL_EFAILED );
-#endif
-
-}
-
 /**
  * Invert a alignedREAL8Vector using SSE
  * \param [out] output Pointer to a alignedREAL8Vector
@@ -1096,188 +650,6 @@ INT4 avxInvertREAL8Vector( alignedREAL8Vector *output, alignedREAL8Vector *input
 
 }
 
-/**
- * Add a REAL8 scalar value to the elements of a alignedREAL8Vector using SSE
- * \param [out] output Pointer to a alignedREAL8Vector
- * \param [in]  input  Pointer to a alignedREAL8Vector
- * \param [in]  scalar Value to add to the elements of input
- * \return Status value
- */
-INT4 sseAddScalarToREAL8Vector( alignedREAL8Vector *output, alignedREAL8Vector *input, REAL8 scalar )
-{
-
-#ifdef __SSE2__
-  INT4 roundedvectorlength = ( INT4 )input->length / 2;
-
-  __m128d *arr1, *result;
-  arr1 = ( __m128d * )( void * )input->data;
-  result = ( __m128d * )( void * )output->data;
-
-  __m128d scalefactor = _mm_set1_pd( scalar );
-
-  //Add the value to the vector and put in the output
-  for ( INT4 ii = 0; ii < roundedvectorlength; ii++ ) {
-    *result = _mm_add_pd( *arr1, scalefactor );
-    arr1++;
-    result++;
-  }
-
-  //Finish up the remaining part
-  for ( INT4 ii = 2 * roundedvectorlength; ii < ( INT4 )input->length; ii++ ) {
-    output->data[ii] = input->data[ii] + scalar;
-  }
-
-  return XLAL_SUCCESS;
-#else
-  ( void )output;
-  ( void )input;
-  ( void )scalar;
-  fprintf( stderr, "%s: Failed because SSE2 is not supported, possibly because -msse2 flag wasn't used for compiling.\n", __func__ );
-  XLAL_ERROR( XLAL_EFAILED );
-#endif
-
-}
-
-
-/**
- * Add a REAL8 scalar value to the elements of a alignedREAL8Vector using AVX
- * \param [out] output Pointer to a alignedREAL8Vector
- * \param [in]  input  Pointer to a alignedREAL8Vector
- * \param [in]  scalar Value to add to the elements of input
- * \return Status value
- */
-INT4 avxAddScalarToREAL8Vector( alignedREAL8Vector *output, alignedREAL8Vector *input, REAL8 scalar )
-{
-
-#ifdef __AVX__
-  //Need to zero the upper 128 bits in case of an SSE function call after this AVX function
-  _mm256_zeroupper();
-
-  INT4 roundedvectorlength = ( INT4 )input->length / 4;
-
-  __m256d *arr1, *result;
-  arr1 = ( __m256d * )( void * )input->data;
-  result = ( __m256d * )( void * )output->data;
-
-  __m256d scalefactor = _mm256_set1_pd( scalar );
-
-  //Add the value to the vector and put in the output
-  for ( INT4 ii = 0; ii < roundedvectorlength; ii++ ) {
-    *result = _mm256_add_pd( *arr1, scalefactor );
-    arr1++;
-    result++;
-  }
-
-  //Finish up the remaining part
-  for ( INT4 ii = 4 * roundedvectorlength; ii < ( INT4 )input->length; ii++ ) {
-    output->data[ii] = input->data[ii] + scalar;
-  }
-
-  //Need to zero the upper 128 bits in case of an SSE function call after this AVX function
-  _mm256_zeroupper();
-
-  return XLAL_SUCCESS;
-#else
-  ( void )output;
-  ( void )input;
-  ( void )scalar;
-  fprintf( stderr, "%s: Failed because AVX is not supported, possibly because -mavx flag wasn't used for compiling.\n", __func__ );
-  XLAL_ERROR( XLAL_EFAILED );
-#endif
-
-}
-
-/**
- * Scale the elements of a alignedREAL8Vector by a REAL8 value using SSE
- * \param [out] output Pointer to a alignedREAL8Vector
- * \param [in]  input  Pointer to a alignedREAL8Vector
- * \param [in]  scale  Value to scale the elements of input
- * \return Status value
- */
-INT4 sseScaleREAL8Vector( alignedREAL8Vector *output, alignedREAL8Vector *input, REAL8 scale )
-{
-
-#ifdef __SSE2__
-  INT4 roundedvectorlength = ( INT4 )input->length / 2;
-
-  __m128d *arr1, *result;
-  arr1 = ( __m128d * )( void * )input->data;
-  result = ( __m128d * )( void * )output->data;
-
-  __m128d scalefactor = _mm_set1_pd( scale );
-
-  //multiply the vector into the output
-  for ( INT4 ii = 0; ii < roundedvectorlength; ii++ ) {
-    *result = _mm_mul_pd( *arr1, scalefactor );
-    arr1++;
-    result++;
-  }
-
-  //Finish up the remaining part
-  for ( UINT4 ii = 2 * roundedvectorlength; ii < input->length; ii++ ) {
-    output->data[ii] = input->data[ii] * scale;
-  }
-
-  return XLAL_SUCCESS;
-#else
-  ( void )output;
-  ( void )input;
-  ( void )scale;
-  fprintf( stderr, "%s: Failed because SSE2 is not supported, possibly because -msse2 flag wasn't used for compiling.\n", __func__ );
-  XLAL_ERROR( XLAL_EFAILED );
-#endif
-
-}
-
-
-/**
- * Scale the elements of a alignedREAL8Vector by a REAL8 value using AVX
- * \param [out] output Pointer to a alignedREAL8Vector
- * \param [in]  input  Pointer to a alignedREAL8Vector
- * \param [in]  scale  Value to scale the elements of input
- * \return Status value
- */
-INT4 avxScaleREAL8Vector( alignedREAL8Vector *output, alignedREAL8Vector *input, REAL8 scale )
-{
-
-#ifdef __AVX__
-  //Need to zero the upper 128 bits in case of an SSE function call after this AVX function
-  _mm256_zeroupper();
-
-  INT4 roundedvectorlength = ( INT4 )input->length / 4;
-
-  __m256d *arr1, *result;
-  arr1 = ( __m256d * )( void * )input->data;
-  result = ( __m256d * )( void * )output->data;
-
-  __m256d scalefactor = _mm256_set1_pd( scale );
-
-  //multiply the vector into the output
-  for ( INT4 ii = 0; ii < roundedvectorlength; ii++ ) {
-    *result = _mm256_mul_pd( *arr1, scalefactor );
-    arr1++;
-    result++;
-  }
-
-  //Finish up the remaining part
-  for ( UINT4 ii = 4 * roundedvectorlength; ii < input->length; ii++ ) {
-    output->data[ii] = input->data[ii] * scale;
-  }
-
-  //Need to zero the upper 128 bits in case of an SSE function call after this AVX function
-  _mm256_zeroupper();
-
-  return XLAL_SUCCESS;
-#else
-  ( void )output;
-  ( void )input;
-  ( void )scale;
-  fprintf( stderr, "%s: Failed because AVX is not supported, possibly because -mavx flag wasn't used for compiling.\n", __func__ );
-  XLAL_ERROR( XLAL_EFAILED );
-#endif
-
-}
-
 /**
  * Sum vectors from REAL4VectorAlignedArrays into an output REAL4VectorAlignedArray using SIMD
  * \param [out] output          Pointer to REAL4VectorAlignedArray
@@ -41,35 +41,22 @@ INT4 sse_exp_REAL8Vector( alignedREAL8Vector *output, alignedREAL8Vector *input
 
 INT4 fastSSVectorMultiply_with_stride_and_offset( REAL4VectorAligned *output, const REAL4VectorAligned *input1, const REAL4VectorAligned *input2, const INT4 stride1, const INT4 stride2, const INT4 offset1, const INT4 offset2 );
 
-INT4 VectorSubtractREAL4( REAL4VectorAligned *output, REAL4VectorAligned *input1, REAL4VectorAligned *input2, INT4 vectorMath );
-INT4 VectorScaleREAL8( alignedREAL8Vector *output, alignedREAL8Vector *input, REAL8 scale, INT4 vectorMath );
-INT4 VectorShiftREAL8( alignedREAL8Vector *output, alignedREAL8Vector *input, REAL8 shift, INT4 vectorMath );
-INT4 VectorAddREAL8( alignedREAL8Vector *output, alignedREAL8Vector *input1, alignedREAL8Vector *input2, INT4 vectorMath );
-INT4 VectorSubtractREAL8( alignedREAL8Vector *output, alignedREAL8Vector *input1, alignedREAL8Vector *input2, INT4 vectorMath );
-INT4 VectorMultiplyREAL8( alignedREAL8Vector *output, alignedREAL8Vector *input1, alignedREAL8Vector *input2, INT4 vectorMath );
+INT4 VectorSubtractREAL4( REAL4VectorAligned *output, REAL4VectorAligned *input1, REAL4VectorAligned *input2 );
+INT4 VectorScaleREAL8( alignedREAL8Vector *output, alignedREAL8Vector *input, REAL8 scale );
+INT4 VectorShiftREAL8( alignedREAL8Vector *output, alignedREAL8Vector *input, REAL8 shift );
+INT4 VectorAddREAL8( alignedREAL8Vector *output, alignedREAL8Vector *input1, alignedREAL8Vector *input2 );
+INT4 VectorSubtractREAL8( alignedREAL8Vector *output, alignedREAL8Vector *input1, alignedREAL8Vector *input2 );
+INT4 VectorMultiplyREAL8( alignedREAL8Vector *output, alignedREAL8Vector *input1, alignedREAL8Vector *input2 );
 INT4 VectorInvertREAL8( alignedREAL8Vector *output, alignedREAL8Vector *input, INT4 vectorMath );
 
 INT4 VectorFloorREAL8( alignedREAL8Vector *output, alignedREAL8Vector *input, INT4 vectorMath );
-INT4 VectorRoundREAL4( REAL4VectorAligned *output, REAL4VectorAligned *input, INT4 vectorMath );
-INT4 VectorRoundREAL8( alignedREAL8Vector *output, alignedREAL8Vector *input, INT4 vectorMath );
+INT4 VectorRoundREAL4( REAL4VectorAligned *output, REAL4VectorAligned *input );
+INT4 VectorRoundREAL8( alignedREAL8Vector *output, alignedREAL8Vector *input );
 INT4 VectorAbsREAL4( REAL4VectorAligned *output, REAL4VectorAligned *input, INT4 vectorMath );
 INT4 VectorAbsREAL8( alignedREAL8Vector *output, alignedREAL8Vector *input, INT4 vectorMath );
 INT4 VectorCabsfCOMPLEX8( REAL4VectorAligned *output, COMPLEX8Vector *input, INT4 vectorMath );
 INT4 VectorCabsCOMPLEX8( alignedREAL8Vector *output, COMPLEX8Vector *input, INT4 vectorMath );
 
-INT4 sseSSVectorSubtract( REAL4VectorAligned *output, REAL4VectorAligned *input1, REAL4VectorAligned *input2 );
-INT4 avxSSVectorSubtract( REAL4VectorAligned *output, REAL4VectorAligned *input1, REAL4VectorAligned *input2 );
-
-INT4 sseAddScalarToREAL8Vector( alignedREAL8Vector *output, alignedREAL8Vector *input, REAL8 scalar );
-INT4 avxAddScalarToREAL8Vector( alignedREAL8Vector *output, alignedREAL8Vector *input, REAL8 scalar );
-INT4 sseScaleREAL8Vector( alignedREAL8Vector *output, alignedREAL8Vector *input, REAL8 scale );
-INT4 avxScaleREAL8Vector( alignedREAL8Vector *output, alignedREAL8Vector *input, REAL8 scale );
-INT4 sseDDVectorSum( alignedREAL8Vector *output, alignedREAL8Vector *input1, alignedREAL8Vector *input2 );
-INT4 avxDDVectorSum( alignedREAL8Vector *output, alignedREAL8Vector *input1, alignedREAL8Vector *input2 );
-INT4 sseDDVectorSubtract( alignedREAL8Vector *output, alignedREAL8Vector *input1, alignedREAL8Vector *input2 );
-INT4 avxDDVectorSubtract( alignedREAL8Vector *output, alignedREAL8Vector *input1, alignedREAL8Vector *input2 );
-INT4 sseDDVectorMultiply( alignedREAL8Vector *output, alignedREAL8Vector *input1, alignedREAL8Vector *input2 );
-INT4 avxDDVectorMultiply( alignedREAL8Vector *output, alignedREAL8Vector *input1, alignedREAL8Vector *input2 );
 INT4 sseInvertREAL8Vector( alignedREAL8Vector *output, alignedREAL8Vector *input );
 INT4 avxInvertREAL8Vector( alignedREAL8Vector *output, alignedREAL8Vector *input );
 
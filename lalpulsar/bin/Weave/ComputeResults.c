@@ -33,6 +33,7 @@
 
 #include <lal/UserInputPrint.h>
 #include <lal/ExtrapolatePulsarSpins.h>
+#include <lal/SemicoherentSum.h>
 
 #define XLAL_CHECK_CUDA_CALL(...) do { \
   cudaError_t retn; \
@@ -844,8 +845,17 @@ int XLALWeaveSemiResultsComputeSegs(
     }
   }
 
+  // Statistics timed by each pass below; summed F-statistics computed in the same pass as
+  // max-over-segments F-statistics are timed together with them
+  const BOOLEAN fused_sum2F = ( semi_res->coh2F_CUDA == NULL ) && ( mainloop_stats & WEAVE_STATISTIC_MAX2F ) && ( mainloop_stats & WEAVE_STATISTIC_SUM2F );
+  const BOOLEAN fused_sum2F_det = ( mainloop_stats & WEAVE_STATISTIC_MAX2F_DET ) && ( mainloop_stats & WEAVE_STATISTIC_SUM2F_DET );
+  const WeaveStatisticType timed_max2F = fused_sum2F ? ( WEAVE_STATISTIC_MAX2F | WEAVE_STATISTIC_SUM2F ) : WEAVE_STATISTIC_MAX2F;
+  const WeaveStatisticType timed_max2F_det = fused_sum2F_det ? ( WEAVE_STATISTIC_MAX2F_DET | WEAVE_STATISTIC_SUM2F_DET ) : WEAVE_STATISTIC_MAX2F_DET;
+  const WeaveStatisticType timed_sum2F = fused_sum2F ? WEAVE_STATISTIC_NONE : WEAVE_STATISTIC_SUM2F;
+  const WeaveStatisticType timed_sum2F_det = fused_sum2F_det ? WEAVE_STATISTIC_NONE : WEAVE_STATISTIC_SUM2F_DET;
+
   // Start timing of semicoherent results
-  XLAL_CHECK( XLALWeaveSearchTimingStatistic( tim, WEAVE_STATISTIC_NONE, WEAVE_STATISTIC_MAX2F ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( XLALWeaveSearchTimingStatistic( tim, WEAVE_STATISTIC_NONE, timed_max2F ) == XLAL_SUCCESS, XLAL_EFUNC );
 
   // Add to max-over-segments multi-detector F-statistics per frequency
   if ( mainloop_stats & WEAVE_STATISTIC_MAX2F ) {
@@ -860,34 +870,38 @@ int XLALWeaveSemiResultsComputeSegs(
 #endif
     } else {
 
-      // Generic implementation
-      memcpy( semi_res->max2F->data, semi_res->coh2F[0], sizeof( semi_res->max2F->data[0] ) * semi_res->nfreqs );
-      for ( size_t j = 1; j < nsegments; ++j ) {
-        XLAL_CHECK( XLALVectorMaxREAL4( semi_res->max2F->data, semi_res->max2F->data, semi_res->coh2F[j], semi_res->nfreqs ) == XLAL_SUCCESS, XLAL_EFUNC );
-      }
+      // Generic implementation; if also needed, summed F-statistics are computed in the same pass over segments
+      REAL4 *sum2F = ( mainloop_stats & WEAVE_STATISTIC_SUM2F ) ? semi_res->sum2F->data : NULL;
+      XLAL_CHECK( XLALVectorsSemicoherentSumREAL4( sum2F, semi_res->max2F->data, NULL, 0, semi_res->coh2F, nsegments, semi_res->nfreqs ) == XLAL_SUCCESS, XLAL_EFUNC );
 
     }
   }
 
   // Switch timed statistic
-  XLAL_CHECK( XLALWeaveSearchTimingStatistic( tim, WEAVE_STATISTIC_MAX2F, WEAVE_STATISTIC_MAX2F_DET ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( XLALWeaveSearchTimingStatistic( tim, timed_max2F, timed_max2F_det ) == XLAL_SUCCESS, XLAL_EFUNC );
 
   // Add to max-over-segments per-detector F-statistics per frequency
+  // - If also needed, summed per-detector F-statistics are computed in the same pass over segments
   if ( mainloop_stats & WEAVE_STATISTIC_MAX2F_DET ) {
     for ( size_t i = 0; i < semi_res->ndetectors; ++i ) {
+      REAL4 *sum2F_det = ( mainloop_stats & WEAVE_STATISTIC_SUM2F_DET ) ? semi_res->sum2F_det[i]->data : NULL;
+      if ( sum2F_det != NULL ) {
+        memset( sum2F_det, 0, sizeof( sum2F_det[0] ) * semi_res->nfreqs );
+      }
       memset( semi_res->max2F_det[i]->data, 0, sizeof( semi_res->max2F_det[i]->data[0] ) * semi_res->nfreqs );
       for ( size_t j = 0; j < nsegments; ++j ) {
         if ( coh_res[j]->coh2F_det[i] != NULL ) {
-          XLAL_CHECK( XLALVectorMaxREAL4( semi_res->max2F_det[i]->data, semi_res->max2F_det[i]->data, coh_res[j]->coh2F_det[i]->data + coh_offset[j], semi_res->nfreqs ) == XLAL_SUCCESS, XLAL_EFUNC );
+          XLAL_CHECK( XLALVectorSemicoherentAddREAL4( sum2F_det, semi_res->max2F_det[i]->data, NULL, NULL, 0, coh_res[j]->coh2F_det[i]->data + coh_offset[j], j, semi_res->nfreqs ) == XLAL_SUCCESS, XLAL_EFUNC );
         }
       }
     }
   }
 
   // Switch timed statistic
-  XLAL_CHECK( XLALWeaveSearchTimingStatistic( tim, WEAVE_STATISTIC_MAX2F_DET, WEAVE_STATISTIC_SUM2F ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( XLALWeaveSearchTimingStatistic( tim, timed_max2F_det, timed_sum2F ) == XLAL_SUCCESS, XLAL_EFUNC );
 
   // Add to summed multi-detector F-statistics per frequency, and increment number of additions thus far
+  // - Already computed above by the generic implementation if max-over-segments F-statistics are needed
   if ( mainloop_stats & WEAVE_STATISTIC_SUM2F ) {
     if ( semi_res->coh2F_CUDA != NULL ) {
 #ifdef LALPULSAR_CUDA_ENABLED
@@ -898,28 +912,24 @@ int XLALWeaveSemiResultsComputeSegs(
 #else
       XLAL_ERROR( XLAL_EFAILED, "CUDA not enabled" );
 #endif
-    } else {
+    } else if ( !fused_sum2F ) {
 
       // Generic implementation
-      memcpy( semi_res->sum2F->data, semi_res->coh2F[0], sizeof( semi_res->sum2F->data[0] ) * semi_res->nfreqs );
-      for ( size_t j = 1; j < nsegments; ++j ) {
-        XLAL_CHECK( XLALVectorAddREAL4( semi_res->sum2F->data, semi_res->sum2F->data, semi_res->coh2F[j], semi_res->nfreqs ) == XLAL_SUCCESS, XLAL_EFUNC );
-      }
+      XLAL_CHECK( XLALVectorsSemicoherentSumREAL4( semi_res->sum2F->data, NULL, NULL, 0, semi_res->coh2F, nsegments, semi_res->nfreqs ) == XLAL_SUCCESS, XLAL_EFUNC );
 
     }
   }
 
   // Switch timed statistic
-  XLAL_CHECK( XLALWeaveSearchTimingStatistic( tim, WEAVE_STATISTIC_SUM2F, WEAVE_STATISTIC_SUM2F_DET ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( XLALWeaveSearchTimingStatistic( tim, timed_sum2F, timed_sum2F_det ) == XLAL_SUCCESS, XLAL_EFUNC );
 
   // Add to summed per-detector F-statistics per frequency, and increment number of additions thus far
-  for ( size_t i = 0; i < semi_res->ndetectors; ++i ) {
-    if ( mainloop_stats & WEAVE_STATISTIC_SUM2F_DET ) {
+  // - Already computed above if max-over-segments per-detector F-statistics are needed
+  if ( ( mainloop_stats & WEAVE_STATISTIC_SUM2F_DET ) && !fused_sum2F_det ) {
+    for ( size_t i = 0; i < semi_res->ndetectors; ++i ) {
       memset( semi_res->sum2F_det[i]->data, 0, sizeof( semi_res->sum2F_det[i]->data[0] ) * semi_res->nfreqs );
-    }
-    for ( size_t j = 0; j < nsegments; ++j ) {
-      if ( coh_res[j]->coh2F_det[i] != NULL ) {
-        if ( mainloop_stats & WEAVE_STATISTIC_SUM2F_DET ) {
+      for ( size_t j = 0; j < nsegments; ++j ) {
+        if ( coh_res[j]->coh2F_det[i] != NULL ) {
           XLAL_CHECK( XLALVectorAddREAL4( semi_res->sum2F_det[i]->data, semi_res->sum2F_det[i]->data, coh_res[j]->coh2F_det[i]->data + coh_offset[j], semi_res->nfreqs ) == XLAL_SUCCESS, XLAL_EFUNC );
         }
       }
@@ -927,7 +937,7 @@ int XLALWeaveSemiResultsComputeSegs(
   }
 
   // Stop timing of semicoherent results
-  XLAL_CHECK( XLALWeaveSearchTimingStatistic( tim, WEAVE_STATISTIC_SUM2F_DET, WEAVE_STATISTIC_NONE ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK( XLALWeaveSearchTimingStatistic( tim, timed_sum2F_det, WEAVE_STATISTIC_NONE ) == XLAL_SUCCESS, XLAL_EFUNC );
 
   return XLAL_SUCCESS;
 
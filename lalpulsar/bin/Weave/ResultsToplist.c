@@ -70,7 +70,6 @@ static int compare_templates( BOOLEAN *equal, const char *loc_str, const char *t
 static int compare_vectors( BOOLEAN *equal, const VectorComparison *result_tol, const REAL4Vector *res_1, const REAL4Vector *res_2, const UINT4 r1, const UINT4 r2 );
 static double round_to_dp_sf( double x, const UINT4 dp, const UINT4 sf );
 static int toplist_fits_table_init( FITSFile *file, const WeaveResultsToplist *toplist );
-static int toplist_fits_table_write_visitor( void *param, const void *x );
 static int toplist_item_sort_by_semi_phys( const void *x, const void *y );
 static int toplist_item_sort_by_serial( const void *x, const void *y );
 static void toplist_item_destroy( WeaveResultsToplistItem *item );
@@ -472,19 +471,6 @@ int toplist_fill_completionloop_stats(
 
 }
 
-///
-/// Visitor function for writing a toplist to a FITS table
-///
-int toplist_fits_table_write_visitor(
-  void *param,
-  const void *x
-)
-{
-  FITSFile *file = ( FITSFile * ) param;
-  XLAL_CHECK( XLALFITSTableWriteRow( file, x ) == XLAL_SUCCESS, XLAL_EFUNC );
-  return XLAL_SUCCESS;
-}
-
 ///
 /// Sort toplist items by physical coordinates of semicoherent template
 ///
@@ -898,7 +884,13 @@ int XLALWeaveResultsToplistWrite(
   XLAL_CHECK( toplist_fits_table_init( file, toplist ) == XLAL_SUCCESS, XLAL_EFUNC );
 
   // Write all heap items to FITS table
-  XLAL_CHECK( XLALHeapVisit( toplist->heap, toplist_fits_table_write_visitor, file ) == XLAL_SUCCESS, XLAL_EFUNC );
+  const int n = XLALHeapSize( toplist->heap );
+  if ( n > 0 ) {
+    const void **items = XLALHeapElements( toplist->heap );
+    XLAL_CHECK( items != NULL, XLAL_EFUNC );
+    XLAL_CHECK( XLALFITSTableWriteRows( file, items, n ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLALFree( items );
+  }
 
   // Write current toplist item serial
   XLAL_CHECK( XLALFITSHeaderWriteUINT8( file, "serial", toplist->serial, "item serial" ) == XLAL_SUCCESS, XLAL_EFUNC );
@@ -319,6 +319,9 @@ int XLALWeaveSearchTimingSection(
 ///
 /// Change the search statistic currently being timed
 ///
+/// The previous/next statistic may also be a combination of statistics which are computed
+/// together in the same pass; the CPU time of the pass is then split equally between them.
+///
 int XLALWeaveSearchTimingStatistic(
   WeaveSearchTiming *tim,
   const WeaveStatisticType prev_statistic,
@@ -335,18 +338,35 @@ int XLALWeaveSearchTimingStatistic(
   // Get current CPU time
   const double cpu_now = cpu_time();
 
-  // Stop timing previous statistic
-  if ( prev_statistic & tim->statistics_params->all_statistics_to_compute ) {
-    XLAL_CHECK( tim->statistic_section[XLAL_BIT2IDX( prev_statistic )] == tim->curr_section, XLAL_EINVAL );
-    tim->statistic_cpu_times[XLAL_BIT2IDX( tim->curr_statistic )] += cpu_now - tim->curr_statistic_cpu_time;
+  // Stop timing previous statistic(s)
+  const WeaveStatisticType prev_timed = prev_statistic & tim->statistics_params->all_statistics_to_compute;
+  if ( prev_timed ) {
+    int prev_count = 0;
+    for ( int i = 0; i < XLAL_BIT2IDX( WEAVE_STATISTIC_MAX ); ++i ) {
+      if ( prev_timed & XLAL_IDX2BIT( i ) ) {
+        XLAL_CHECK( tim->statistic_section[i] == tim->curr_section, XLAL_EINVAL );
+        ++prev_count;
+      }
+    }
+    const double prev_cpu_time = ( cpu_now - tim->curr_statistic_cpu_time ) / prev_count;
+    for ( int i = 0; i < XLAL_BIT2IDX( WEAVE_STATISTIC_MAX ); ++i ) {
+      if ( prev_timed & XLAL_IDX2BIT( i ) ) {
+        tim->statistic_cpu_times[i] += prev_cpu_time;
+      }
+    }
   }
 
   // Change statistic
   tim->curr_statistic = next_statistic;
 
-  // Start timing next statistic
-  if ( next_statistic & tim->statistics_params->all_statistics_to_compute ) {
-    tim->statistic_section[XLAL_BIT2IDX( next_statistic )] = tim->curr_section;
+  // Start timing next statistic(s)
+  const WeaveStatisticType next_timed = next_statistic & tim->statistics_params->all_statistics_to_compute;
+  if ( next_timed ) {
+    for ( int i = 0; i < XLAL_BIT2IDX( WEAVE_STATISTIC_MAX ); ++i ) {
+      if ( next_timed & XLAL_IDX2BIT( i ) ) {
+        tim->statistic_section[i] = tim->curr_section;
+      }
+    }
     tim->curr_statistic_cpu_time = cpu_now;
   }
 
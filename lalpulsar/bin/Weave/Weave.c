@@ -41,6 +41,9 @@
 #include <lal/UserInput.h>
 #include <lal/Random.h>
 
+// Minimum number of segments for which to query coherent results in parallel
+#define WEAVE_PARALLEL_MIN_SEGMENTS 64
+
 int main( int argc, char *argv[] )
 {
 
@@ -54,7 +57,7 @@ int main( int argc, char *argv[] )
 
   // Initialise user input variables
   struct uvar_type {
-    BOOLEAN validate_sft_files, interpolation, lattice_rand_offset, mean2F_hgrm, segment_info, simulate_search, time_search, cache_all_gc, strict_spindown_bounds;
+    BOOLEAN compress_output, validate_sft_files, interpolation, lattice_rand_offset, mean2F_hgrm, segment_info, simulate_search, time_search, cache_all_gc, strict_spindown_bounds;
     CHAR *setup_file, *sft_files, *output_file, *ckpt_output_file;
     LALStringVector *sft_timestamps_files, *sft_noise_sqrtSX, *injections, *Fstat_assume_sqrtSX, *lrs_oLGX;
     REAL8 sft_timebase, semi_max_mismatch, coh_max_mismatch, ckpt_output_period, ckpt_output_fraction, lrs_Fstar0sc, nc_2Fth;
@@ -93,6 +96,10 @@ int main( int argc, char *argv[] )
     output_file, STRING, 'o', REQUIRED,
     "Output file which stores all quantities computed by lalpulsar_Weave. "
   );
+  XLALRegisterUvarMember(
+    compress_output, BOOLEAN, 0, OPTIONAL,
+    "Store tables in the output file given by " UVAR_STR( output_file ) " as tile-compressed FITS binary tables. "
+  );
   //
   // - SFT input/generation and signal generation
   //
@@ -1028,9 +1035,19 @@ int main( int argc, char *argv[] )
     XLAL_CHECK_MAIN( XLALWeaveCacheQueriesInit( queries, semi_index, semi_rssky, semi_left, semi_right, freq_partition_index ) == XLAL_SUCCESS, XLAL_EFUNC );
 
     // Query for coherent results for each segment
+    // - Queries on different segments use separate caches and locators, and write to separate
+    //   elements of 'queries', so segments are divided between threads
+    // - Each query takes only a few microseconds, so this is done only for many segments, where the
+    //   work outweighs starting a parallel region for every semicoherent point
+    int query_errflag = 0;
+    #pragma omp parallel for schedule(static) if ( nsegments >= WEAVE_PARALLEL_MIN_SEGMENTS )
     for ( size_t i = 0; i < nsegments; ++i ) {
-      XLAL_CHECK_MAIN( XLALWeaveCacheQuery( coh_cache[i], queries, i ) == XLAL_SUCCESS, XLAL_EFUNC );
+      if ( XLALWeaveCacheQuery( coh_cache[i], queries, i ) != XLAL_SUCCESS ) {
+        #pragma omp atomic write
+        query_errflag = 1;
+      }
     }
+    XLAL_CHECK_MAIN( query_errflag == 0, XLAL_EFUNC );
 
     // Finalise cache queries
     PulsarDopplerParams XLAL_INIT_DECL( semi_phys );
@@ -1241,7 +1258,7 @@ int main( int argc, char *argv[] )
 
     // Open output file
     LogPrintf( LOG_NORMAL, "Opening output file '%s' for writing ...\n", uvar->output_file );
-    FITSFile *file = XLALFITSFileOpenWrite( uvar->output_file );
+    FITSFile *file = uvar->compress_output ? XLALFITSFileOpenWriteCompressed( uvar->output_file ) : XLALFITSFileOpenWrite( uvar->output_file );
     XLAL_CHECK_MAIN( file != NULL, XLAL_EFUNC );
     XLAL_CHECK_MAIN( XLALFITSFileWriteVCSInfo( file, lalPulsarVCSInfoList ) == XLAL_SUCCESS, XLAL_EFUNC );
     XLAL_CHECK_MAIN( XLALFITSFileWriteUVarCmdLine( file ) == XLAL_SUCCESS, XLAL_EFUNC );
@@ -191,7 +191,7 @@ int main( int argc, char *argv[] )
   {
     // Open result file #1
     LogPrintf( LOG_NORMAL, "Opening result file '%s' for reading ...\n", uvar->result_file_1 );
-    FITSFile *file = XLALFITSFileOpenRead( uvar->result_file_1 );
+    FITSFile *file = XLALFITSFileOpenReadMapped( uvar->result_file_1 );
     XLAL_CHECK_FAIL( file != NULL, XLAL_EFUNC );
 
     // Read output results
@@ -205,7 +205,7 @@ int main( int argc, char *argv[] )
   {
     // Open result file #2
     LogPrintf( LOG_NORMAL, "Opening result file '%s' for reading ...\n", uvar->result_file_2 );
-    FITSFile *file = XLALFITSFileOpenRead( uvar->result_file_2 );
+    FITSFile *file = XLALFITSFileOpenReadMapped( uvar->result_file_2 );
     XLAL_CHECK_FAIL( file != NULL, XLAL_EFUNC );
 
     // Read output results
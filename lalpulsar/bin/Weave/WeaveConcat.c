@@ -39,6 +39,7 @@ int main( int argc, char *argv[] )
 
   // Initialise user input variables
   struct uvar_type {
+    BOOLEAN compress_output;
     CHAR *output_result_file;
     LALStringVector *input_result_files;
     UINT4 toplist_limit;
@@ -59,6 +60,10 @@ int main( int argc, char *argv[] )
     output_result_file, STRING, 'o', REQUIRED,
     "Output concatenated result file. "
   );
+  XLALRegisterUvarMember(
+    compress_output, BOOLEAN, 0, OPTIONAL,
+    "Store tables in the output concatenated result file as tile-compressed FITS binary tables. "
+  );
   XLALRegisterUvarMember(
     toplist_limit, UINT4, 'n', OPTIONAL,
     "Maximum number of candidates to return in an output toplist; if 0, all candidates are returned. "
@@ -97,7 +102,7 @@ int main( int argc, char *argv[] )
   // Concatenate input result files
   for ( size_t i = 0; i < uvar->input_result_files->length; ++i ) {
     LogPrintf( LOG_NORMAL, "Opening input result file '%s' for reading ...\n", uvar->input_result_files->data[i] );
-    FITSFile *file = XLALFITSFileOpenRead( uvar->input_result_files->data[i] );
+    FITSFile *file = XLALFITSFileOpenReadMapped( uvar->input_result_files->data[i] );
     XLAL_CHECK_MAIN( file != NULL, XLAL_EFUNC, "Could not open input result file '%s'", uvar->input_result_files->data[i] );
     {
       UINT8 coh_nres_i = 0;
@@ -132,7 +137,7 @@ int main( int argc, char *argv[] )
   // Write output concatenated result file
   {
     LogPrintf( LOG_NORMAL, "Opening output result file '%s' for writing ...\n", uvar->output_result_file );
-    FITSFile *file = XLALFITSFileOpenWrite( uvar->output_result_file );
+    FITSFile *file = uvar->compress_output ? XLALFITSFileOpenWriteCompressed( uvar->output_result_file ) : XLALFITSFileOpenWrite( uvar->output_result_file );
     XLAL_CHECK_MAIN( file != NULL, XLAL_EFUNC, "Could not open output result file '%s'", uvar->output_result_file );
     XLAL_CHECK_MAIN( XLALFITSHeaderWriteUINT8( file, "ncohres", coh_nres, "number of computed coherent results" ) == XLAL_SUCCESS, XLAL_EFUNC );
     XLAL_CHECK_MAIN( XLALFITSHeaderWriteUINT8( file, "ncohtpl", coh_ntmpl, "number of coherent templates" ) == XLAL_SUCCESS, XLAL_EFUNC );
@@ -28,8 +28,13 @@
 
 // ---------- includes
 #include <math.h>
+#include <errno.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 // GSL includes
+#include <gsl/gsl_math.h>
 
 // LAL includes
 #include <lal/CWMakeFakeData.h>
@@ -74,6 +79,9 @@ const char *const InjectionSourcesHelpString = "Source parameters to inject for
 
 // ---------- local prototypes
 static UINT4 gcd( UINT4 numer, UINT4 denom );
+static int get_signal_timespan( LIGOTimeGPS *signalStartGPS, LIGOTimeGPS *signalEndGPS, const PulsarParams *pulsarParams, LIGOTimeGPS firstGPS, LIGOTimeGPS lastGPS, REAL8 fSamp );
+static SFTVector *make_fake_sft_block( const PulsarParamsVector *injectionSources, const CWMFDataParams *dataParams, UINT4 detectorIndex, UINT4 iSFT, REAL8 fMin, REAL8 fSamp, const EphemerisData *edat );
+static INT4 sft_noise_seed( UINT4 randSeed, UINT4 detectorIndex, UINT4 iSFT );
 int XLALcorrect_phase( SFTtype *sft, LIGOTimeGPS tHeterodyne );
 int XLALCheckConfigFileWasFullyParsed( const char *fname, const LALParsedDataFile *cfgdata );
 
@@ -258,8 +266,6 @@ XLALCWMakeFakeData( SFTVector **SFTvect,
     XLALGPSAdd( &lastGPS, Tsft );
     duration = XLALGPSDiff( &lastGPS, &firstGPS );
   }
-  REAL8 firstGPS_REAL8 = XLALGPSGetREAL8( &firstGPS );
-  REAL8 lastGPS_REAL8  = XLALGPSGetREAL8( &lastGPS );
 
   // start with an empty output time-series
   REAL4TimeSeries *Tseries_sum;
@@ -281,32 +287,8 @@ XLALCWMakeFakeData( SFTVector **SFTvect,
     // in order to make the generation more efficient, these 'partial timeseries'
     // will then be added to the full timeseries
     const PulsarParams *pulsarParams = &( injectionSources->data[iInj] );
-    UINT4 t0, t1;
-    XLAL_CHECK( XLALGetTransientWindowTimespan( &t0, &t1, pulsarParams->Transient ) == XLAL_SUCCESS, XLAL_EFUNC );
-
-    // use latest possible start-time: max(t0,firstGPS), but not later than than lastGPS
-    LIGOTimeGPS XLAL_INIT_DECL( signalStartGPS );
-    if ( t0 <= firstGPS_REAL8 ) {
-      signalStartGPS = firstGPS;
-    } else if ( t0 >= lastGPS_REAL8 ) {
-      signalStartGPS = lastGPS;
-    } else { // firstGPS < t0 < lastGPS:
-      // make sure signal start-time is an integer multiple of deltaT from timeseries start
-      // to allow safe adding of resulting signal timeseries
-      REAL8 offs0_aligned = round( ( t0 - firstGPS_REAL8 ) * fSamp ) / fSamp;
-      signalStartGPS = firstGPS;
-      XLALGPSAdd( &signalStartGPS, offs0_aligned );
-    }
-
-    // use earliest possible end-time: min(t1,lastGPS), but not earlier than firstGPS
-    LIGOTimeGPS XLAL_INIT_DECL( signalEndGPS );
-    if ( t1 >= lastGPS_REAL8 ) {
-      signalEndGPS = lastGPS;
-    } else if ( t1 <= firstGPS_REAL8 ) {
-      signalEndGPS = firstGPS;
-    } else {
-      signalEndGPS.gpsSeconds = t1;
-    }
+    LIGOTimeGPS signalStartGPS, signalEndGPS;
+    XLAL_CHECK( get_signal_timespan( &signalStartGPS, &signalEndGPS, pulsarParams, firstGPS, lastGPS, fSamp ) == XLAL_SUCCESS, XLAL_EFUNC );
 
     REAL8 fCoverMin, fCoverMax;
     const PulsarSpins *fkdot = &( pulsarParams->Doppler.fkdot );
@@ -383,6 +365,203 @@ XLALCWMakeFakeData( SFTVector **SFTvect,
 
 } // XLALCWMakeFakeData()
 
+/**
+ * Streaming version of XLALCWMakeFakeMultiData(): generate SFTs for all detectors
+ * one SFT at a time, and write them to disk as they are produced, instead of
+ * returning them in memory. The SFT filenames are constructed from 'multiSFTfnspec',
+ * an array of one SFTFilenameSpec per detector, using XLALWriteSFTVector2StandardFile()
+ * conventions: 'merged' writes one concatenated SFT file per detector, otherwise one
+ * file per SFT is written.
+ *
+ * Only the SFT-sized stretch of time-series required for each SFT is generated, so the
+ * memory used is independent of the total observation time and number of injections.
+ * SFTs are generated in parallel (if compiled with OpenMP) and written in timestamp order.
+ *
+ * \note Input time-series ('inputMultiTS') are not supported. The Gaussian noise added to
+ * each SFT of each detector is seeded with a hash of ('randSeed', detector index, SFT index),
+ * so noise realizations differ from those generated by XLALCWMakeFakeMultiData() for the same
+ * random seed, but are reproducible, and unrelated between different non-zero 'randSeed'
+ * (e.g. consecutive seeds of a Monte-Carlo campaign). A 'randSeed' of 0 seeds each SFT
+ * from /dev/urandom.
+ */
+int
+XLALCWMakeFakeMultiDataToSFTFiles( const PulsarParamsVector *injectionSources, ///< [in] (optional) array of sources inject
+                                   const CWMFDataParams *dataParams,           ///< [in] parameters specifying the type of data to generate
+                                   const EphemerisData *edat,                  ///< [in] ephemeris data
+                                   SFTFilenameSpec *multiSFTfnspec,            ///< [in/out] SFT filename specifications, one per detector
+                                   const CHAR *SFTcomment,                     ///< [in] optional comment to add to SFTs
+                                   const BOOLEAN merged                        ///< [in] if true, write a single merged SFT file per detector
+                                 )
+{
+  XLAL_CHECK( dataParams != NULL, XLAL_EINVAL );
+  XLAL_CHECK( edat != NULL, XLAL_EINVAL );
+  XLAL_CHECK( multiSFTfnspec != NULL, XLAL_EFAULT );
+
+  const UINT4 numDet = dataParams->multiIFO.length;
+  XLAL_CHECK( numDet >= 1, XLAL_EINVAL );
+  XLAL_CHECK( dataParams->multiTimestamps->length == numDet, XLAL_EINVAL, "Inconsistent number of IFOs: detInfo says '%d', multiTimestamps says '%d'\n", numDet, dataParams->multiTimestamps->length );
+  XLAL_CHECK( dataParams->multiNoiseFloor.length == numDet, XLAL_EINVAL );
+
+  for ( UINT4 X = 0; X < numDet; X ++ ) {
+    XLAL_CHECK( XLALCWMakeFakeDataToSFTFile( injectionSources, dataParams, X, edat, &multiSFTfnspec[X], SFTcomment, merged ) == XLAL_SUCCESS, XLAL_EFUNC );
+  } // for X < numDet
+
+  return XLAL_SUCCESS;
+
+} // XLALCWMakeFakeMultiDataToSFTFiles()
+
+/**
+ * Single-IFO version of XLALCWMakeFakeMultiDataToSFTFiles(). The 'detectorIndex'
+ * has the index of the detector to be used from the multi-IFO arrays.
+ */
+int
+XLALCWMakeFakeDataToSFTFile( const PulsarParamsVector *injectionSources,
+                             const CWMFDataParams *dataParams,
+                             UINT4 detectorIndex,       /* index for current detector in dataParams */
+                             const EphemerisData *edat,
+                             SFTFilenameSpec *SFTfnspec,
+                             const CHAR *SFTcomment,
+                             const BOOLEAN merged
+                           )
+{
+  XLAL_CHECK( edat != NULL, XLAL_EINVAL );
+  XLAL_CHECK( SFTfnspec != NULL, XLAL_EFAULT );
+
+  XLAL_CHECK( dataParams != NULL, XLAL_EINVAL );
+  XLAL_CHECK( detectorIndex < dataParams->multiIFO.length, XLAL_EINVAL );
+  XLAL_CHECK( detectorIndex < dataParams->multiNoiseFloor.length, XLAL_EINVAL );
+  XLAL_CHECK( detectorIndex < dataParams->multiTimestamps->length, XLAL_EINVAL );
+  XLAL_CHECK( dataParams->inputMultiTS == NULL, XLAL_EINVAL, "Input time-series are not supported when streaming SFTs to file\n" );
+
+  const LIGOTimeGPSVector *timestamps = dataParams->multiTimestamps->data[detectorIndex];
+  XLAL_CHECK( timestamps != NULL && timestamps->length > 0, XLAL_EINVAL );
+  const LALDetector *site = &dataParams->multiIFO.sites[detectorIndex];
+  const REAL8 Tsft = timestamps->deltaT;
+  XLAL_CHECK( Tsft > 0, XLAL_EINVAL, "Got invalid Tsft = %g must be > 0\n", Tsft );
+  const UINT4 numSFTs = timestamps->length;
+
+  // need *effective* fMin and Band consistent with SFT bins; since each SFT is generated from
+  // its own time-series starting at its timestamp, there is no need to increase the sampling
+  // rate to resolve gaps between SFTs, as XLALCWMakeFakeData() has to do
+  UINT4 firstBinEff, numBinsEff;
+  XLAL_CHECK( XLALFindCoveringSFTBins( &firstBinEff, &numBinsEff, dataParams->fMin, dataParams->Band, Tsft ) == XLAL_SUCCESS, XLAL_EFUNC );
+  const REAL8 fMin = firstBinEff / Tsft;
+  const REAL8 fBand = ( numBinsEff - 1.0 ) / Tsft;
+  const REAL8 fSamp = 2.0 * fBand;
+
+  // check that all injections fit into the generated frequency band
+  LIGOTimeGPS firstGPS = timestamps->data[0];
+  LIGOTimeGPS lastGPS = timestamps->data[numSFTs - 1];
+  XLALGPSAdd( &lastGPS, Tsft );
+  UINT4 numPulsars = injectionSources ? injectionSources->length : 0;
+  for ( UINT4 iInj = 0; iInj < numPulsars; iInj ++ ) {
+    const PulsarParams *pulsarParams = &( injectionSources->data[iInj] );
+    LIGOTimeGPS signalStartGPS, signalEndGPS;
+    XLAL_CHECK( get_signal_timespan( &signalStartGPS, &signalEndGPS, pulsarParams, firstGPS, lastGPS, fSamp ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+    REAL8 fCoverMin, fCoverMax;
+    PulsarSpinRange XLAL_INIT_DECL( spinRange );
+    spinRange.refTime = pulsarParams->Doppler.refTime;
+    memcpy( spinRange.fkdot, pulsarParams->Doppler.fkdot, sizeof( spinRange.fkdot ) );
+
+    XLAL_CHECK( XLALCWSignalCoveringBand( &fCoverMin, &fCoverMax, &signalStartGPS, &signalEndGPS, &spinRange, pulsarParams->Doppler.asini, pulsarParams->Doppler.period, pulsarParams->Doppler.ecc ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( ( fCoverMin >= fMin ) && ( fCoverMax < fMin + fBand ), XLAL_EINVAL, "Error: injection signal %d:'%s' needs frequency band [%f,%f]Hz, injecting into [%f,%f]Hz\n",
+                iInj, pulsarParams->name, fCoverMin, fCoverMax, fMin, fMin + fBand );
+  } // for iInj < numPulsars
+
+  // if writing a single merged SFT file, open it now
+  FILE *fp = NULL;
+  if ( merged ) {
+    CHAR *detPrefix = XLALGetChannelPrefix( site->frDetector.name );
+    XLAL_CHECK( detPrefix != NULL, XLAL_EFUNC );
+    const UINT4 Tsft_int = ( UINT4 ) round( Tsft );
+    SFTfnspec->numSFTs         = numSFTs;
+    SFTfnspec->detector[0]     = detPrefix[0];
+    SFTfnspec->detector[1]     = detPrefix[1];
+    SFTfnspec->detector[2]     = 0;
+    SFTfnspec->SFTtimebase     = Tsft_int;
+    SFTfnspec->gpsStart        = firstGPS.gpsSeconds;
+    SFTfnspec->SFTspan         = timestamps->data[numSFTs - 1].gpsSeconds - firstGPS.gpsSeconds + Tsft_int;
+    if ( firstGPS.gpsNanoSeconds > 0 ) {
+      SFTfnspec->SFTspan += 1;
+    }
+    if ( timestamps->data[numSFTs - 1].gpsNanoSeconds > 0 ) {
+      SFTfnspec->SFTspan += 1;
+    }
+    XLALFree( detPrefix );
+    char *SFTfilename = XLALBuildSFTFilenameFromSpec( SFTfnspec );
+    XLAL_CHECK( SFTfilename != NULL, XLAL_EFUNC );
+    fp = fopen( SFTfilename, "wb" );
+    XLAL_CHECK( fp != NULL, XLAL_EIO, "Failed to open '%s' for writing: %s\n\n", SFTfilename, strerror( errno ) );
+    XLALFree( SFTfilename );
+  }
+
+  // generate SFTs in chunks of a few SFTs per thread, then write each chunk in timestamp order;
+  // this bounds the memory used to a few SFT-sized time-series per thread
+  UINT4 numThreads = 1;
+#ifdef _OPENMP
+  numThreads = omp_get_max_threads();
+#endif
+  const UINT4 chunkLen = GSL_MIN( 4 * numThreads, numSFTs );
+  SFTVector **chunk = XLALCalloc( chunkLen, sizeof( *chunk ) );
+  XLAL_CHECK( chunk != NULL, XLAL_ENOMEM );
+  SFTFilenameSpec spec = *SFTfnspec;
+  int retn = XLAL_SUCCESS;
+  for ( UINT4 iStart = 0; iStart < numSFTs && retn == XLAL_SUCCESS; iStart += chunkLen ) {
+    const UINT4 iEnd = GSL_MIN( iStart + chunkLen, numSFTs );
+
+    // generate this chunk of SFTs in parallel
+    int errflag = 0;
+    #pragma omp parallel for schedule(dynamic)
+    for ( UINT4 iSFT = iStart; iSFT < iEnd; ++iSFT ) {
+      if ( errflag ) {
+        continue;
+      }
+      chunk[iSFT - iStart] = make_fake_sft_block( injectionSources, dataParams, detectorIndex, iSFT, fMin, fSamp, edat );
+      if ( chunk[iSFT - iStart] == NULL ) {
+        #pragma omp atomic write
+        errflag = 1;
+      }
+    }
+    if ( errflag ) {
+      XLALPrintError( "%s: failed to generate SFTs %u to %u\n", __func__, iStart, iEnd - 1 );
+      retn = XLAL_EFUNC;
+    }
+
+    // write this chunk of SFTs
+    for ( UINT4 i = 0; i < iEnd - iStart; ++i ) {
+      if ( retn == XLAL_SUCCESS ) {
+        const SFTtype *sft = &chunk[i]->data[0];
+        if ( merged ) {
+          if ( XLALWriteSFT2FilePointer( sft, fp, SFTfnspec->window_type, SFTfnspec->window_param, SFTcomment ) != XLAL_SUCCESS ) {
+            retn = XLAL_EFUNC;
+          }
+        } else {
+          // return spec of first written SFT in 'SFTfnspec'; otherwise use local copy
+          SFTFilenameSpec *p_spec = ( iStart + i == 0 ) ? SFTfnspec : &spec;
+          if ( XLALWriteSFT2StandardFile( sft, p_spec, SFTcomment ) != XLAL_SUCCESS ) {
+            retn = XLAL_EFUNC;
+          }
+        }
+      }
+      XLALDestroySFTVector( chunk[i] );
+      chunk[i] = NULL;
+    }
+
+  } // for iStart < numSFTs
+
+  // cleanup
+  XLALFree( chunk );
+  if ( fp != NULL ) {
+    fclose( fp );
+  }
+  XLAL_CHECK( retn == XLAL_SUCCESS, retn );
+
+  return XLAL_SUCCESS;
+
+} // XLALCWMakeFakeDataToSFTFile()
+
+
 
 /**
  * Generate a (heterodyned) REAL4 timeseries of a CW signal for given pulsarParams,
@@ -715,6 +894,143 @@ gcd( UINT4 numer, UINT4 denom )
   return next_numer;
 } // gcd
 
+/**
+ * Determine the time-span [signalStartGPS, signalEndGPS] over which a (possibly transient) CW signal
+ * overlaps the time-series covering [firstGPS, lastGPS] sampled at fSamp. The start-time is aligned
+ * to an integer number of samples from firstGPS, to allow safe adding of the signal time-series.
+ */
+static int
+get_signal_timespan( LIGOTimeGPS *signalStartGPS, LIGOTimeGPS *signalEndGPS, const PulsarParams *pulsarParams, LIGOTimeGPS firstGPS, LIGOTimeGPS lastGPS, REAL8 fSamp )
+{
+  UINT4 t0, t1;
+  XLAL_CHECK( XLALGetTransientWindowTimespan( &t0, &t1, pulsarParams->Transient ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  REAL8 firstGPS_REAL8 = XLALGPSGetREAL8( &firstGPS );
+  REAL8 lastGPS_REAL8  = XLALGPSGetREAL8( &lastGPS );
+
+  // use latest possible start-time: max(t0,firstGPS), but not later than than lastGPS
+  XLAL_INIT_MEM( *signalStartGPS );
+  if ( t0 <= firstGPS_REAL8 ) {
+    ( *signalStartGPS ) = firstGPS;
+  } else if ( t0 >= lastGPS_REAL8 ) {
+    ( *signalStartGPS ) = lastGPS;
+  } else { // firstGPS < t0 < lastGPS:
+    // make sure signal start-time is an integer multiple of deltaT from timeseries start
+    // to allow safe adding of resulting signal timeseries
+    REAL8 offs0_aligned = round( ( t0 - firstGPS_REAL8 ) * fSamp ) / fSamp;
+    ( *signalStartGPS ) = firstGPS;
+    XLALGPSAdd( signalStartGPS, offs0_aligned );
+  }
+
+  // use earliest possible end-time: min(t1,lastGPS), but not earlier than firstGPS
+  XLAL_INIT_MEM( *signalEndGPS );
+  if ( t1 >= lastGPS_REAL8 ) {
+    ( *signalEndGPS ) = lastGPS;
+  } else if ( t1 <= firstGPS_REAL8 ) {
+    ( *signalEndGPS ) = firstGPS;
+  } else {
+    signalEndGPS->gpsSeconds = t1;
+  }
+
+  return XLAL_SUCCESS;
+
+} // get_signal_timespan()
+
+/**
+ * Generate a single SFT (returned as an SFTVector of length 1) at timestamp 'iSFT' for detector
+ * 'detectorIndex', from a time-series covering only that SFT, heterodyned at fMin and sampled at fSamp.
+ * Used by XLALCWMakeFakeDataToSFTFile(); may be called in parallel for different SFTs.
+ */
+static SFTVector *
+make_fake_sft_block( const PulsarParamsVector *injectionSources, const CWMFDataParams *dataParams, UINT4 detectorIndex, UINT4 iSFT, REAL8 fMin, REAL8 fSamp, const EphemerisData *edat )
+{
+  const LIGOTimeGPSVector *timestamps = dataParams->multiTimestamps->data[detectorIndex];
+  const LALDetector *site = &dataParams->multiIFO.sites[detectorIndex];
+  const REAL8 Tsft = timestamps->deltaT;
+
+  LIGOTimeGPS firstGPS = timestamps->data[iSFT];
+  LIGOTimeGPS lastGPS = firstGPS;
+  XLALGPSAdd( &lastGPS, Tsft );
+
+  // start with an empty time-series covering this SFT
+  REAL4TimeSeries *Tseries_sum;
+  {
+    CHAR *detPrefix = XLALGetChannelPrefix( site->frDetector.name );
+    XLAL_CHECK_NULL( detPrefix != NULL, XLAL_EFUNC );
+    Tseries_sum = XLALCreateREAL4TimeSeries( detPrefix, &firstGPS, fMin, 1.0 / fSamp, &lalStrainUnit, ( UINT4 ) round( Tsft * fSamp ) );
+    XLALFree( detPrefix );
+    XLAL_CHECK_NULL( Tseries_sum != NULL, XLAL_EFUNC );
+    memset( Tseries_sum->data->data, 0, Tseries_sum->data->length * sizeof( Tseries_sum->data->data[0] ) );
+  }
+
+  // add CW signals, if any, truncated to the overlap of each signal with this SFT
+  UINT4 numPulsars = injectionSources ? injectionSources->length : 0;
+  for ( UINT4 iInj = 0; iInj < numPulsars; iInj ++ ) {
+    const PulsarParams *pulsarParams = &( injectionSources->data[iInj] );
+    LIGOTimeGPS signalStartGPS, signalEndGPS;
+    XLAL_CHECK_NULL( get_signal_timespan( &signalStartGPS, &signalEndGPS, pulsarParams, firstGPS, lastGPS, fSamp ) == XLAL_SUCCESS, XLAL_EFUNC );
+    REAL8 signalDuration = XLALGPSDiff( &signalEndGPS, &signalStartGPS );
+    if ( signalDuration > 0 ) {
+      REAL4TimeSeries *Tseries_i = NULL;
+      XLAL_CHECK_NULL( ( Tseries_i = XLALGenerateCWSignalTS( pulsarParams, site, signalStartGPS, signalDuration, fSamp, fMin, edat, dataParams->sourceDeltaT ) ) != NULL, XLAL_EFUNC );
+      XLAL_CHECK_NULL( ( Tseries_sum = XLALAddREAL4TimeSeries( Tseries_sum, Tseries_i ) ) != NULL, XLAL_EFUNC );
+      XLALDestroyREAL4TimeSeries( Tseries_i );
+    }
+  } // for iInj < numPulsars
+
+  // add Gaussian noise if requested, seeding each SFT of each detector differently
+  REAL8 sqrtSn = dataParams->multiNoiseFloor.sqrtSn[detectorIndex];
+  if ( sqrtSn > 0 ) {
+    REAL8 noiseSigma = sqrtSn * sqrt( 0.5 * fSamp );
+    INT4 randSeed = ( dataParams->randSeed == 0 ) ? 0 : sft_noise_seed( dataParams->randSeed, detectorIndex, iSFT ); // seed=0 means to use /dev/urandom, so don't touch it
+    XLAL_CHECK_NULL( XLALAddGaussianNoise( Tseries_sum, noiseSigma, randSeed ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+
+  // convert to REAL8 precision and compute the SFT
+  REAL8TimeSeries *outTS;
+  XLAL_CHECK_NULL( ( outTS = XLALConvertREAL4TimeSeriesToREAL8( Tseries_sum ) ) != NULL, XLAL_EFUNC );
+  XLALDestroyREAL4TimeSeries( Tseries_sum );
+  LIGOTimeGPSVector XLAL_INIT_DECL( timestamp );
+  timestamp.length = 1;
+  timestamp.data = &firstGPS;
+  timestamp.deltaT = Tsft;
+  SFTVector *sftVect;
+  XLAL_CHECK_NULL( ( sftVect = XLALMakeSFTsFromREAL8TimeSeries( outTS, &timestamp, dataParams->SFTWindowType, dataParams->SFTWindowParam ) ) != NULL, XLAL_EFUNC );
+  XLALDestroyREAL8TimeSeries( outTS );
+
+  // extract requested band
+  SFTVector *ret;
+  XLAL_CHECK_NULL( ( ret = XLALExtractStrictBandFromSFTVector( sftVect, dataParams->fMin, dataParams->Band ) ) != NULL, XLAL_EFUNC );
+  XLALDestroySFTVector( sftVect );
+
+  return ret;
+
+} // make_fake_sft_block()
+
+/**
+ * Derive the seed of the Gaussian noise added to SFT 'iSFT' of detector 'detectorIndex' from the
+ * user seed 'randSeed', by hashing all three in turn with the SplitMix64 mixing function. Unlike an offset such
+ * as randSeed + iSFT, the seeds of different (randSeed, detectorIndex, iSFT) are unrelated, so jobs
+ * run with consecutive seeds do not share noise realizations. The returned seed is never 0, which
+ * XLALAddGaussianNoise() would interpret as a request to seed from /dev/urandom.
+ */
+static INT4
+sft_noise_seed( UINT4 randSeed, UINT4 detectorIndex, UINT4 iSFT )
+{
+  const UINT4 input[3] = { randSeed, detectorIndex, iSFT };
+  UINT8 z = 0;
+  for ( int i = 0; i < 3; ++i ) {
+    z ^= input[i];
+    z += 0x9E3779B97F4A7C15ULL;
+    z = ( z ^ ( z >> 30 ) ) * 0xBF58476D1CE4E5B9ULL;
+    z = ( z ^ ( z >> 27 ) ) * 0x94D049BB133111EBULL;
+    z ^= z >> 31;
+  }
+  // keep the seed positive and non-zero
+  const INT4 seed = ( INT4 )( z & 0x7FFFFFFF );
+  return ( seed == 0 ) ? 1 : seed;
+} // sft_noise_seed()
+
 /**
  * Create *zero-initialized* PulsarParamsVector for numPulsars
  */
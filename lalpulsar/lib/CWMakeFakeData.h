@@ -99,6 +99,10 @@ int XLALCWMakeFakeMultiData( MultiSFTVector **multiSFTs, MultiREAL8TimeSeries **
                              const PulsarParamsVector *injectionSources, const CWMFDataParams *dataParams, const EphemerisData *edat );
 int XLALCWMakeFakeData( SFTVector **SFTVect, REAL8TimeSeries **Tseries,
                         const PulsarParamsVector *injectionSources, const CWMFDataParams *dataParams, UINT4 detectorIndex, const EphemerisData *edat );
+int XLALCWMakeFakeMultiDataToSFTFiles( const PulsarParamsVector *injectionSources, const CWMFDataParams *dataParams, const EphemerisData *edat,
+                                       SFTFilenameSpec *multiSFTfnspec, const CHAR *SFTcomment, const BOOLEAN merged );
+int XLALCWMakeFakeDataToSFTFile( const PulsarParamsVector *injectionSources, const CWMFDataParams *dataParams, UINT4 detectorIndex, const EphemerisData *edat,
+                                 SFTFilenameSpec *SFTfnspec, const CHAR *SFTcomment, const BOOLEAN merged );
 
 REAL4TimeSeries *
 XLALGenerateCWSignalTS( const PulsarParams *pulsarParams, const LALDetector *site, LIGOTimeGPS startTime, REAL8 duration, REAL8 fSamp, REAL8 fHet, const EphemerisData *edat, REAL8 sourceDeltaT );
@@ -63,6 +63,7 @@ void XLALDestroyFstatInputTimeslice_Demod( void *method_data );
 int XLALSetupFstatResampGeneric( void **method_data, FstatCommon *common, FstatMethodFuncs *funcs, MultiSFTVector *multiSFTs, const FstatOptionalArgs *optArgs );
 int XLALExtractResampledTimeseries_ResampGeneric( MultiCOMPLEX8TimeSeries **multiTimeSeries_SRC_a, MultiCOMPLEX8TimeSeries **multiTimeSeries_SRC_b, void *method_data );
 int XLALGetFstatTiming_ResampGeneric( const void *method_data, FstatTimingGeneric *timingGeneric, FstatTimingModel *timingModel );
+void *XLALFstatInputThreadCopy_ResampGeneric( FstatCommon *common, const void *method_data );
 
 #ifdef LALPULSAR_CUDA_ENABLED
 int XLALSetupFstatResampCUDA( void **method_data, FstatCommon *common, FstatMethodFuncs *funcs, MultiSFTVector *multiSFTs, const FstatOptionalArgs *optArgs );
@@ -896,6 +897,15 @@ XLALDestroyFstatInput( FstatInput *input        ///< [in] \c FstatInput structur
     XLALFree( input );
     return;
   }
+  if ( input->common.isThreadCopy ) {
+    // A thread copy owns only its method data and workspace; the 'common' data belong to the original FstatInput
+    if ( input->common.workspace != NULL ) {
+      ( input->method_funcs.workspace_destroy_func )( input->common.workspace );
+    }
+    ( input->method_funcs.method_data_destroy_func )( input->method_data );
+    XLALFree( input );
+    return;
+  }
 
   XLALDestroyMultiTimestamps( input->common.multiTimestamps );
   XLALDestroyMultiNoiseWeights( input->common.multiNoiseWeights );
@@ -1435,6 +1445,50 @@ XLALFstatInputTimeslice( FstatInput **slice,                 ///< [out] Address
 } // XLALFstatInputTimeslice()
 
 
+///
+/// Create and return an FstatInput 'thread copy' of the given input FstatInput object [must be using the generic Resamp Fstat method!],
+/// so that XLALComputeFstat() can be called on the copy and the original (or other copies) from different threads at the same time.
+///
+/// The returned FstatInput structure references the detector-frame timeseries, detector states and noise weights
+/// of the original FstatInput object, which XLALComputeFstat() only reads, so these are held in memory only once.
+/// It has its own buffered SRC-frame timeseries, workspace and FFT plan, which XLALComputeFstat() overwrites.
+/// A special flag is set in the FstatInput object to notify the destructor to only free these.
+///
+/// Note: the original FstatInput object must not be destroyed before its thread copies.
+///
+int
+XLALFstatInputThreadCopy( FstatInput **copy,                 ///< [out] Address of a pointer to a \c FstatInput structure
+                          const FstatInput *input            ///< [in] Input data structure
+                        )
+{
+  XLAL_CHECK( input != NULL, XLAL_EINVAL );
+  XLAL_CHECK( copy != NULL && ( *copy ) == NULL, XLAL_EINVAL );
+
+  // only supported for the generic 'Resamp' Fstat method
+  XLAL_CHECK( input->method == FMETHOD_RESAMP_GENERIC, XLAL_EINVAL, "This function is not available for the chosen FstatMethod '%s'!", XLALGetFstatInputMethodName( input ) );
+  XLAL_CHECK( !input->common.isTimeslice, XLAL_EINVAL, "Cannot create a thread copy of an FstatInput timeslice" );
+
+  // allocate memory and copy the original FstatInput struct
+  FstatInput *threadCopy = NULL;
+  XLAL_CHECK( ( threadCopy = XLALCalloc( 1, sizeof( *input ) ) ) != NULL, XLAL_ENOMEM );
+  memcpy( threadCopy, input, sizeof( *input ) );
+
+  threadCopy->common.isThreadCopy = ( 1 == 1 ); // This is a thread copy
+  threadCopy->common.workspace    = NULL;       // a new workspace is allocated for this copy
+  threadCopy->workspace_refcount  = NULL;
+
+  threadCopy->method_data = XLALFstatInputThreadCopy_ResampGeneric( &threadCopy->common, input->method_data );
+  if ( threadCopy->method_data == NULL ) {
+    XLALFree( threadCopy );
+    XLAL_ERROR( XLAL_EFUNC );
+  }
+
+  ( *copy ) = threadCopy;
+  return XLAL_SUCCESS;
+
+} // XLALFstatInputThreadCopy()
+
+
 static void
 XLALDestroyFstatInputTimeslice_common( FstatCommon *common )
 {
@@ -369,6 +369,7 @@ int  XLALExtractResampledTimeseries( MultiCOMPLEX8TimeSeries **multiTimeSeries_S
 int XLALGetFstatTiming( const FstatInput *input, FstatTimingGeneric *timingGeneric, FstatTimingModel *timingModel );
 int XLALAppendFstatTiming2File( const FstatInput *input, FILE *fp, BOOLEAN printHeader );
 int XLALFstatInputTimeslice( FstatInput **slice, const FstatInput *input, const LIGOTimeGPS *minStartGPS, const LIGOTimeGPS *maxStartGPS );
+int XLALFstatInputThreadCopy( FstatInput **copy, const FstatInput *input );
 
 #ifdef SWIG // SWIG interface directives
 SWIGLAL( INOUT_STRUCTS( FstatResults **, Fstats ) );
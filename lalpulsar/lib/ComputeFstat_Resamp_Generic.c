@@ -91,6 +91,7 @@ typedef struct {
 
   UINT4 numSamplesFFT;                                  // length of zero-padded SRC-frame timeseries (related to dFreq)
   UINT4 decimateFFT;                                    // output every n-th frequency bin, with n>1 iff (dFreq > 1/Tspan), and was internally decreased by n
+  BOOLEAN isThreadCopy;                                 // flag whether 'multiTimeSeries_DET' belongs to another FstatInput, see XLALFstatInputThreadCopy()
   fftwf_plan fftplan;                                   // FFT plan
 
   // ----- timing -----
@@ -106,6 +107,7 @@ typedef struct {
 int XLALSetupFstatResampGeneric( void **method_data, FstatCommon *common, FstatMethodFuncs *funcs, MultiSFTVector *multiSFTs, const FstatOptionalArgs *optArgs );
 int XLALExtractResampledTimeseries_ResampGeneric( MultiCOMPLEX8TimeSeries **multiTimeSeries_SRC_a, MultiCOMPLEX8TimeSeries **multiTimeSeries_SRC_b, void *method_data );
 int XLALGetFstatTiming_ResampGeneric( const void *method_data, FstatTimingGeneric *timingGeneric, FstatTimingModel *timingModel );
+void *XLALFstatInputThreadCopy_ResampGeneric( FstatCommon *common, const void *method_data );
 
 static int XLALComputeFstatResampGeneric( FstatResults *Fstats, const FstatCommon *common, void *method_data );
 static int XLALApplySpindownAndFreqShiftGeneric( COMPLEX8 *xOut, const COMPLEX8TimeSeries *xIn, const PulsarDopplerParams *doppler, REAL8 freqShift );
@@ -143,7 +145,9 @@ static void XLALDestroyResampGenericMethodData( void *method_data )
 
   ResampGenericMethodData *resamp = ( ResampGenericMethodData * ) method_data;
 
-  XLALDestroyMultiCOMPLEX8TimeSeries( resamp->multiTimeSeries_DET );
+  if ( !resamp->isThreadCopy ) {
+    XLALDestroyMultiCOMPLEX8TimeSeries( resamp->multiTimeSeries_DET );
+  }
 
   // ----- free buffer
   XLALDestroyMultiCOMPLEX8TimeSeries( resamp->multiTimeSeries_SRC_a );
@@ -152,9 +156,11 @@ static void XLALDestroyResampGenericMethodData( void *method_data )
   XLALDestroyMultiSSBtimes( resamp->multiSSBtimes );
   XLALDestroyMultiSSBtimes( resamp->multiBinaryTimes );
 
-  LAL_FFTW_WISDOM_LOCK;
-  fftwf_destroy_plan( resamp->fftplan );
-  LAL_FFTW_WISDOM_UNLOCK;
+  if ( resamp->fftplan != NULL ) {
+    LAL_FFTW_WISDOM_LOCK;
+    fftwf_destroy_plan( resamp->fftplan );
+    LAL_FFTW_WISDOM_UNLOCK;
+  }
 
   XLALFree( resamp );
 
@@ -354,6 +360,93 @@ XLALSetupFstatResampGeneric( void **method_data,
 } // XLALSetupFstatResampGeneric()
 
 
+///
+/// Create the method data of a thread copy of a generic Resamp FstatInput, see XLALFstatInputThreadCopy():
+/// the detector-frame timeseries are shared with 'method_data', while the buffered SRC-frame timeseries,
+/// the workspace (stored in 'common') and the FFT plan are newly allocated with the same sizes.
+///
+void *
+XLALFstatInputThreadCopy_ResampGeneric( FstatCommon *common, const void *method_data )
+{
+  XLAL_CHECK_NULL( common != NULL, XLAL_EFAULT );
+  XLAL_CHECK_NULL( common->workspace == NULL, XLAL_EINVAL );
+  XLAL_CHECK_NULL( method_data != NULL, XLAL_EFAULT );
+
+  const ResampGenericMethodData *orig = ( const ResampGenericMethodData * ) method_data;
+  const UINT4 numDetectors = orig->multiTimeSeries_DET->length;
+
+  ResampGenericMethodData *resamp = NULL;
+  ResampGenericWorkspace *ws = NULL;
+  XLAL_CHECK_NULL( ( resamp = XLALCalloc( 1, sizeof( *resamp ) ) ) != NULL, XLAL_ENOMEM );
+
+  resamp->isThreadCopy        = ( 1 == 1 );
+  resamp->Dterms              = orig->Dterms;
+  resamp->multiTimeSeries_DET = orig->multiTimeSeries_DET;
+  resamp->numSamplesFFT       = orig->numSamplesFFT;
+  resamp->decimateFFT         = orig->decimateFFT;
+
+  // ----- allocate buffer Memory, with the same sizes as the original ----------
+  XLAL_CHECK_FAIL( ( resamp->multiTimeSeries_SRC_a = XLALCalloc( 1, sizeof( MultiCOMPLEX8TimeSeries ) ) ) != NULL, XLAL_ENOMEM );
+  XLAL_CHECK_FAIL( ( resamp->multiTimeSeries_SRC_a->data = XLALCalloc( numDetectors, sizeof( COMPLEX8TimeSeries ) ) ) != NULL, XLAL_ENOMEM );
+  resamp->multiTimeSeries_SRC_a->length = numDetectors;
+
+  XLAL_CHECK_FAIL( ( resamp->multiTimeSeries_SRC_b = XLALCalloc( 1, sizeof( MultiCOMPLEX8TimeSeries ) ) ) != NULL, XLAL_ENOMEM );
+  XLAL_CHECK_FAIL( ( resamp->multiTimeSeries_SRC_b->data = XLALCalloc( numDetectors, sizeof( COMPLEX8TimeSeries ) ) ) != NULL, XLAL_ENOMEM );
+  resamp->multiTimeSeries_SRC_b->length = numDetectors;
+
+  UINT4 numSamplesMax_SRC = 0;
+  for ( UINT4 X = 0; X < numDetectors; X ++ ) {
+    const COMPLEX8TimeSeries *origX = orig->multiTimeSeries_SRC_a->data[X];
+    XLAL_CHECK_FAIL( ( resamp->multiTimeSeries_SRC_a->data[X] = XLALCreateCOMPLEX8TimeSeries( origX->name, &origX->epoch, origX->f0, origX->deltaT, &lalDimensionlessUnit, origX->data->length ) ) != NULL, XLAL_EFUNC );
+    XLAL_CHECK_FAIL( ( resamp->multiTimeSeries_SRC_b->data[X] = XLALCreateCOMPLEX8TimeSeries( origX->name, &origX->epoch, origX->f0, origX->deltaT, &lalDimensionlessUnit, origX->data->length ) ) != NULL, XLAL_EFUNC );
+    numSamplesMax_SRC = MYMAX( numSamplesMax_SRC, origX->data->length );
+  } // for X < numDetectors
+
+  // ----- allocate workspace ----------
+  XLAL_CHECK_FAIL( ( ws = XLALCalloc( 1, sizeof( *ws ) ) ) != NULL, XLAL_ENOMEM );
+  XLAL_CHECK_FAIL( ( ws->TStmp1_SRC   = XLALCreateCOMPLEX8Vector( numSamplesMax_SRC ) ) != NULL, XLAL_EFUNC );
+  XLAL_CHECK_FAIL( ( ws->TStmp2_SRC   = XLALCreateCOMPLEX8Vector( numSamplesMax_SRC ) ) != NULL, XLAL_EFUNC );
+  XLAL_CHECK_FAIL( ( ws->SRCtimes_DET = XLALCreateREAL8Vector( numSamplesMax_SRC ) ) != NULL, XLAL_EFUNC );
+  XLAL_CHECK_FAIL( ( ws->FabX_Raw = fftw_malloc( resamp->numSamplesFFT * sizeof( COMPLEX8 ) ) ) != NULL, XLAL_ENOMEM );
+  XLAL_CHECK_FAIL( ( ws->TS_FFT   = fftw_malloc( resamp->numSamplesFFT * sizeof( COMPLEX8 ) ) ) != NULL, XLAL_ENOMEM );
+  ws->numSamplesFFTAlloc = resamp->numSamplesFFT;
+
+  // ----- compute FFT plan for the new workspace ----------
+  {
+    int fft_plan_flags = FFTW_MEASURE;
+    double fft_plan_timeout = FFTW_NO_TIMELIMIT ;
+    LAL_FFTW_WISDOM_LOCK;
+    XLALGetFFTPlanHints( & fft_plan_flags, & fft_plan_timeout );
+    fftw_set_timelimit( fft_plan_timeout );
+    resamp->fftplan = fftwf_plan_dft_1d( resamp->numSamplesFFT, ws->TS_FFT, ws->FabX_Raw, FFTW_FORWARD, fft_plan_flags );
+    LAL_FFTW_WISDOM_UNLOCK;
+    XLAL_CHECK_FAIL( resamp->fftplan != NULL, XLAL_EFAILED, "fftwf_plan_dft_1d() failed\n" );
+  }
+
+  // ----- timing collection, with the same invariant 'meta' quantities as the original ----------
+  resamp->collectTiming = orig->collectTiming;
+  if ( resamp->collectTiming ) {
+    XLAL_INIT_MEM( resamp->timingGeneric );
+    resamp->timingGeneric.Ndet = orig->timingGeneric.Ndet;
+
+    XLAL_INIT_MEM( resamp->timingResamp );
+    resamp->timingResamp.Resolution = orig->timingResamp.Resolution;
+    resamp->timingResamp.NsampFFT0  = orig->timingResamp.NsampFFT0;
+    resamp->timingResamp.NsampFFT   = orig->timingResamp.NsampFFT;
+  }
+
+  common->workspace = ws;
+  return resamp;
+
+XLAL_FAIL:
+  if ( ws != NULL ) {
+    XLALDestroyResampGenericWorkspace( ws );
+  }
+  XLALDestroyResampGenericMethodData( resamp );
+  return NULL;
+
+} // XLALFstatInputThreadCopy_ResampGeneric()
+
 static int
 XLALComputeFstatResampGeneric( FstatResults *Fstats,
                                const FstatCommon *common,
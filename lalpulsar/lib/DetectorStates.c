@@ -392,6 +392,27 @@ XLALGetDetectorStates( const LIGOTimeGPSVector *timestamps,     /**< array of GP
     ret->system = COORDINATESYSTEM_EQUATORIAL;
   }
 
+  /* shift timestamps by tOffset, and get earth-states for all timestamps at once */
+  LIGOTimeGPS *tgpsV = XLALMalloc( numSteps * sizeof( *tgpsV ) );
+  EarthState *earthV = XLALMalloc( numSteps * sizeof( *earthV ) );
+  if ( ( numSteps > 0 ) && ( tgpsV == NULL || earthV == NULL ) ) {
+    XLALFree( tgpsV );
+    XLALFree( earthV );
+    XLALDestroyDetectorStateSeries( ret );
+    XLAL_ERROR_NULL( XLAL_ENOMEM );
+  }
+  for ( UINT4 i = 0; i < numSteps; i++ ) {
+    tgpsV[i] = timestamps->data[i];
+    XLALGPSAdd( &tgpsV[i], tOffset );
+  }
+  if ( XLALBarycenterEarthVector( earthV, tgpsV, numSteps, edat ) != XLAL_SUCCESS ) {
+    XLALFree( tgpsV );
+    XLALFree( earthV );
+    XLALDestroyDetectorStateSeries( ret );
+    XLALPrintError( "%s: XLALBarycenterEarthVector() failed with xlalErrno=%d\n", __func__, xlalErrno );
+    XLAL_ERROR_NULL( XLAL_EFAILED );
+  }
+
   /* now fill all the vector-entries corresponding to different timestamps */
   UINT4 i;
   for ( i = 0; i < numSteps; i++ ) {
@@ -399,18 +420,10 @@ XLALGetDetectorStates( const LIGOTimeGPSVector *timestamps,     /**< array of GP
     EmissionTime emit;
     DetectorState *state = &( ret->data[i] );
     EarthState *earth = &( state->earthState );
-    LIGOTimeGPS tgps;
-
-    /* shift timestamp by tOffset */
-    tgps = timestamps->data[i];
-    XLALGPSAdd( &tgps, tOffset );
+    LIGOTimeGPS tgps = tgpsV[i];
 
     /*----- first get earth-state */
-    if ( XLALBarycenterEarth( earth, &tgps, edat ) != XLAL_SUCCESS ) {
-      XLALDestroyDetectorStateSeries( ret );
-      XLALPrintError( "%s: XLALBarycenterEarth() failed with xlalErrno=%d\n", __func__, xlalErrno );
-      XLAL_ERROR_NULL( XLAL_EFAILED );
-    }
+    ( *earth ) = earthV[i];
 
     /*----- then get detector-specific info */
     baryinput.tgps = tgps;
@@ -422,6 +435,8 @@ XLALGetDetectorStates( const LIGOTimeGPSVector *timestamps,     /**< array of GP
     baryinput.dInv = 0;
 
     if ( XLALBarycenter( &emit, &baryinput, earth ) != XLAL_SUCCESS ) {
+      XLALFree( tgpsV );
+      XLALFree( earthV );
       XLALDestroyDetectorStateSeries( ret );
       XLALPrintError( "%s: XLALBarycenterEarth() failed with xlalErrno=%d\n", __func__, xlalErrno );
       XLAL_ERROR_NULL( XLAL_EFAILED );
@@ -445,6 +460,8 @@ XLALGetDetectorStates( const LIGOTimeGPSVector *timestamps,     /**< array of GP
      * [EQUATORIAL for Earth-based, ECLIPTIC for LISA]
      */
     if ( XLALFillDetectorTensor( state, detector ) != 0 ) {
+      XLALFree( tgpsV );
+      XLALFree( earthV );
       XLALDestroyDetectorStateSeries( ret );
       XLALPrintError( "%s: XLALFillDetectorTensor() failed ... errno = %d\n\n", __func__, xlalErrno );
       XLAL_ERROR_NULL( XLAL_EFUNC );
@@ -452,6 +469,9 @@ XLALGetDetectorStates( const LIGOTimeGPSVector *timestamps,     /**< array of GP
 
   } /* for i < numSteps */
 
+  XLALFree( tgpsV );
+  XLALFree( earthV );
+
   /* return result */
   return ret;
 
@@ -29,6 +29,9 @@
 
 #if defined(HAVE_LIBCFITSIO)
 
+#include <sys/mman.h>
+#include <sys/stat.h>
+
 // disable -Wstrict-prototypes flag for this header file as this causes
 // a build failure for cfitsio-3.440+
 #pragma GCC diagnostic ignored "-Wstrict-prototypes"
@@ -50,6 +53,8 @@ int fffree( void *, int * );
 
 #endif // defined(HAVE_LIBCFITSIO)
 
+#include <gsl/gsl_math.h>
+
 #include <lal/FITSFileIO.h>
 #include <lal/LALString.h>
 #include <lal/StringVector.h>
@@ -116,8 +121,16 @@ struct tagFITSFile {
     LONGLONG nrows;                             // Number of rows in table
     LONGLONG irow;                              // Index of current row in table
   } table;
-  char *buf;                            // Buffer for reading/writing table columns
-  size_t buf_size;                      // Current length of the buffer
+  struct {                              // Buffered rows of current table, stored column-wise
+    char *col[FFIO_MAX];                        // Buffered data for each column in table
+    size_t stride[FFIO_MAX];                    // Size of one buffered row for each column in table
+    LONGLONG max;                               // Maximum number of buffered rows
+    LONGLONG first;                             // Index of first buffered row in table
+    LONGLONG n;                                 // Number of buffered rows
+  } rows;
+  CHAR *compress_file_name;             // If non-NULL, file to which to write a copy of the FITS file with compressed tables
+  void *map;                            // If non-NULL, memory-mapped contents of FITS file opened for reading
+  size_t map_size;                      // Length of memory-mapped contents of FITS file
 };
 
 ///
@@ -240,31 +253,287 @@ XLAL_FAIL:
 
 }
 
-#endif // defined(HAVE_LIBCFITSIO)
+///
+/// Return a pointer to the field in a table row record which stores the given table column
+///
+static void *TableRecordField( const FITSFile *file, const int i, const void *record )
+{
+  union {
+    const void *cv;
+    void *v;
+  } bad_cast = { .cv = record };
+  void *value = bad_cast.v;
+  for ( size_t n = 0; n < file->table.noffsets[i]; ++n ) {
+    if ( n > 0 ) {
+      value = *( ( void ** ) value );
+    }
+    value = ( void * )( ( ( intptr_t ) value ) + file->table.offsets[i][n] );
+  }
+  return value;
+}
 
-void XLALFITSFileClose( FITSFile UNUSED *file )
+///
+/// Allocate buffers for table rows, sized to the number of rows which CFITSIO can transfer most efficiently
+///
+static int InitTableRows( FITSFile *file )
 {
-#if !defined(HAVE_LIBCFITSIO)
-  XLAL_ERROR_VOID( XLAL_EFAILED, "CFITSIO is not available" );
-#else // defined(HAVE_LIBCFITSIO)
 
   int UNUSED status = 0;
-  if ( file != NULL ) {
-    if ( file->ff != NULL ) {
-      fits_close_file( file->ff, &status );
+
+  // Get optimal number of rows to buffer
+  long max = 0;
+  CALL_FITS( fits_get_rowsize, file->ff, &max );
+  file->rows.max = GSL_MAX( max, 1 );
+  file->rows.first = file->rows.n = 0;
+
+  // Allocate column buffers
+  // - String columns store an additional terminating null character
+  // - Allocate an additional row to allow for buffer overruns in CFITSIO
+  for ( int i = 0; i < file->table.tfields; ++i ) {
+    file->rows.stride[i] = file->table.field_size[i] + ( ( file->table.datatype[i] == TSTRING ) ? 1 : 0 );
+    file->rows.col[i] = XLALRealloc( file->rows.col[i], ( file->rows.max + 1 ) * file->rows.stride[i] );
+    XLAL_CHECK_FAIL( file->rows.col[i] != NULL, XLAL_ENOMEM );
+  }
+
+  return XLAL_SUCCESS;
+
+XLAL_FAIL:
+  return XLAL_FAILURE;
+
+}
+
+///
+/// Write any buffered table rows to the current table
+///
+static int FlushTableRows( FITSFile *file )
+{
+
+  int UNUSED status = 0;
+  char **strs = NULL;
+
+  // Return if there are no buffered rows
+  if ( !file->write || file->hdutype != BINARY_TBL || file->rows.n == 0 ) {
+    return XLAL_SUCCESS;
+  }
+
+  // Write buffered rows to each table column
+  for ( int i = 0; i < file->table.tfields; ++i ) {
+    if ( file->table.datatype[i] == TSTRING ) {
+      strs = XLALRealloc( strs, file->rows.n * sizeof( *strs ) );
+      XLAL_CHECK_FAIL( strs != NULL, XLAL_ENOMEM );
+      for ( LONGLONG j = 0; j < file->rows.n; ++j ) {
+        strs[j] = file->rows.col[i] + j * file->rows.stride[i];
+      }
+      CALL_FITS( fits_write_col, file->ff, TSTRING, file->table.colnum[i], file->rows.first + 1, 1, file->rows.n, strs );
+    } else {
+      CALL_FITS( fits_write_col, file->ff, file->table.datatype[i], file->table.colnum[i], file->rows.first + 1, 1, file->rows.n * file->table.nelements[i], file->rows.col[i] );
     }
-    XLALFree( file->buf );
-    XLALFree( file );
   }
 
-#endif // !defined(HAVE_LIBCFITSIO)
+  // Empty buffer
+  file->rows.first += file->rows.n;
+  file->rows.n = 0;
+
+  XLALFree( strs );
+  return XLAL_SUCCESS;
+
+XLAL_FAIL:
+  XLALFree( strs );
+  return XLAL_FAILURE;
+
 }
 
-FITSFile *XLALFITSFileOpenWrite( const CHAR UNUSED *file_name )
+///
+/// Read the next block of table rows from the current table into the buffer
+///
+static int FillTableRows( FITSFile *file )
+{
+
+  int UNUSED status = 0;
+  char **strs = NULL;
+
+  // Read rows following those last buffered
+  file->rows.first = file->table.irow;
+  file->rows.n = GSL_MIN( file->rows.max, file->table.nrows - file->table.irow );
+
+  // Read buffered rows from each table column
+  for ( int i = 0; i < file->table.tfields; ++i ) {
+    if ( file->table.datatype[i] == TSTRING ) {
+      memset( file->rows.col[i], 0, file->rows.n * file->rows.stride[i] );
+      strs = XLALRealloc( strs, file->rows.n * sizeof( *strs ) );
+      XLAL_CHECK_FAIL( strs != NULL, XLAL_ENOMEM );
+      for ( LONGLONG j = 0; j < file->rows.n; ++j ) {
+        strs[j] = file->rows.col[i] + j * file->rows.stride[i];
+      }
+      CALL_FITS( fits_read_col, file->ff, TSTRING, file->table.colnum[i], file->rows.first + 1, 1, file->rows.n, NULL, strs, NULL );
+    } else {
+      CALL_FITS( fits_read_col, file->ff, file->table.datatype[i], file->table.colnum[i], file->rows.first + 1, 1, file->rows.n * file->table.nelements[i], NULL, file->rows.col[i], NULL );
+    }
+  }
+
+  XLALFree( strs );
+  return XLAL_SUCCESS;
+
+XLAL_FAIL:
+  file->rows.n = 0;
+  XLALFree( strs );
+  return XLAL_FAILURE;
+
+}
+
+///
+/// Return whether the current HDU is a tile-compressed binary table
+///
+static int IsCompressedTable( FITSFile *file, int *ztable )
+{
+
+  int UNUSED status = 0;
+
+  *ztable = 0;
+  fits_read_key_log( file->ff, "ZTABLE", ztable, NULL, &status );
+  if ( status == KEY_NO_EXIST ) {
+    status = 0;
+    fits_clear_errmsg();
+    *ztable = 0;
+  }
+  CHECK_FITS( fits_read_key_log );
+
+  return XLAL_SUCCESS;
+
+XLAL_FAIL:
+  return XLAL_FAILURE;
+
+}
+
+///
+/// Write a copy of a FITS file, built in memory, to disk with all non-empty binary tables tile-compressed
+///
+static int WriteCompressedFile( FITSFile *file )
+{
+
+  int UNUSED status = 0;
+  fitsfile *ff = NULL;
+  CHAR *url = NULL;
+
+  // Create FITS file URL which will overwrite any existing file
+  url = XLALStringAppendFmt( NULL, "!file://%s", file->compress_file_name );
+  XLAL_CHECK_FAIL( url != NULL, XLAL_EFUNC );
+
+  // Open FITS file for writing
+  CALL_FITS_VAL( XLAL_ESYS, fits_create_file, &ff, url );
+
+  // Copy each HDU, compressing non-empty binary tables
+  int nhdus = 0;
+  CALL_FITS( fits_get_num_hdus, file->ff, &nhdus );
+  for ( int h = 1; h <= nhdus; ++h ) {
+    int hdutype = 0;
+    CALL_FITS( fits_movabs_hdu, file->ff, h, &hdutype );
+    LONGLONG nrows = 0;
+    if ( hdutype == BINARY_TBL ) {
+      CALL_FITS( fits_get_num_rowsll, file->ff, &nrows );
+    }
+    if ( nrows > 0 ) {
+#if defined(HAVE_FITS_COMPRESS_TABLE)
+      CALL_FITS( fits_compress_table, file->ff, ff );
+#else
+      XLAL_ERROR_FAIL( XLAL_EFAILED, "CFITSIO does not support compressed tables" );
+#endif
+    } else {
+      CALL_FITS( fits_copy_hdu, file->ff, ff, 0 );
+    }
+  }
+
+  CALL_FITS( fits_close_file, ff );
+
+  XLALFree( url );
+  return XLAL_SUCCESS;
+
+XLAL_FAIL:
+
+  // Delete FITS file on error
+  if ( ff != NULL ) {
+    fits_delete_file( ff, &status );
+  }
+
+  XLALFree( url );
+  return XLAL_FAILURE;
+
+}
+
+///
+/// If a FITS file opened for reading contains any tile-compressed binary tables, replace it with an
+/// uncompressed copy held in memory
+///
+static int UncompressFile( FITSFile *file )
+{
+
+  int UNUSED status = 0;
+  fitsfile *ff = NULL;
+
+  // Check for any compressed tables
+  int nhdus = 0, ncompressed = 0;
+  CALL_FITS( fits_get_num_hdus, file->ff, &nhdus );
+  for ( int h = 1; h <= nhdus; ++h ) {
+    CALL_FITS( fits_movabs_hdu, file->ff, h, NULL );
+    int ztable = 0;
+    XLAL_CHECK_FAIL( IsCompressedTable( file, &ztable ) == XLAL_SUCCESS, XLAL_EFUNC );
+    ncompressed += ztable ? 1 : 0;
+  }
+
+  if ( ncompressed > 0 ) {
+
+    // Create an in-memory FITS file
+    CALL_FITS( fits_create_file, &ff, "mem://" );
+
+    // Copy each HDU, uncompressing compressed tables
+    for ( int h = 1; h <= nhdus; ++h ) {
+      CALL_FITS( fits_movabs_hdu, file->ff, h, NULL );
+      int ztable = 0;
+      XLAL_CHECK_FAIL( IsCompressedTable( file, &ztable ) == XLAL_SUCCESS, XLAL_EFUNC );
+      if ( ztable ) {
+#if defined(HAVE_FITS_COMPRESS_TABLE)
+        CALL_FITS( fits_uncompress_table, file->ff, ff );
+#else
+        XLAL_ERROR_FAIL( XLAL_EFAILED, "CFITSIO does not support compressed tables" );
+#endif
+      } else {
+        CALL_FITS( fits_copy_hdu, file->ff, ff, 0 );
+      }
+    }
+
+    // Replace FITS file with in-memory copy; the original file is no longer needed
+    CALL_FITS( fits_close_file, file->ff );
+    file->ff = ff;
+    ff = NULL;
+    if ( file->map != NULL ) {
+      munmap( file->map, file->map_size );
+      file->map = NULL;
+    }
+
+  }
+
+  // Return to primary HDU
+  CALL_FITS( fits_movabs_hdu, file->ff, 1, NULL );
+
+  return XLAL_SUCCESS;
+
+XLAL_FAIL:
+
+  // Close in-memory FITS file on error
+  if ( ff != NULL ) {
+    fits_close_file( ff, &status );
+  }
+
+  return XLAL_FAILURE;
+
+}
+
+///
+/// Open a FITS file for writing; if \p compress is true, the FITS file is built in memory, and
+/// written to disk with compressed tables when closed
+///
+static FITSFile *FITSFileOpenWrite( const CHAR *file_name, const int compress )
 {
-#if !defined(HAVE_LIBCFITSIO)
-  XLAL_ERROR_NULL( XLAL_EFAILED, "CFITSIO is not available" );
-#else // defined(HAVE_LIBCFITSIO)
 
   int UNUSED status = 0;
   FITSFile *file = NULL;
@@ -280,12 +549,25 @@ FITSFile *XLALFITSFileOpenWrite( const CHAR UNUSED *file_name )
   // Set FITSFile fields
   file->write = 1;
 
-  // Create FITS file URL which will overwrite any existing file
-  url = XLALStringAppendFmt( NULL, "!file://%s", file_name );
-  XLAL_CHECK_FAIL( url != NULL, XLAL_EFUNC );
+  if ( compress ) {
 
-  // Open FITS file for writing
-  CALL_FITS_VAL( XLAL_ESYS, fits_create_file, &file->ff, url );
+    // Save name of FITS file, which is written when closed
+    file->compress_file_name = XLALStringDuplicate( file_name );
+    XLAL_CHECK_FAIL( file->compress_file_name != NULL, XLAL_EFUNC );
+
+    // Open in-memory FITS file for writing
+    CALL_FITS_VAL( XLAL_ESYS, fits_create_file, &file->ff, "mem://" );
+
+  } else {
+
+    // Create FITS file URL which will overwrite any existing file
+    url = XLALStringAppendFmt( NULL, "!file://%s", file_name );
+    XLAL_CHECK_FAIL( url != NULL, XLAL_EFUNC );
+
+    // Open FITS file for writing
+    CALL_FITS_VAL( XLAL_ESYS, fits_create_file, &file->ff, url );
+
+  }
 
   // By convention, create an empty image for the first HDU,
   // so that the correct FITS header 'SIMPLE = T' is written
@@ -308,20 +590,21 @@ XLAL_FAIL:
     if ( file->ff != NULL ) {
       fits_delete_file( file->ff, &status );
     }
+    XLALFree( file->compress_file_name );
     XLALFree( file );
   }
 
   XLALFree( url );
   return NULL;
 
-#endif // !defined(HAVE_LIBCFITSIO)
 }
 
-FITSFile *XLALFITSFileOpenRead( const CHAR UNUSED *file_name )
+///
+/// Open a FITS file for reading; if \p mapped is true, the FITS file is memory-mapped instead of
+/// being read through CFITSIO's disk file driver
+///
+static FITSFile *FITSFileOpenRead( const CHAR *file_name, const int mapped )
 {
-#if !defined(HAVE_LIBCFITSIO)
-  XLAL_ERROR_NULL( XLAL_EFAILED, "CFITSIO is not available" );
-#else // defined(HAVE_LIBCFITSIO)
 
   int UNUSED status = 0;
   FITSFile *file = NULL;
@@ -349,8 +632,33 @@ FITSFile *XLALFITSFileOpenRead( const CHAR UNUSED *file_name )
     }
   }
 
-  // Open FITS file for reading
-  CALL_FITS_VAL( XLAL_ESYS, fits_open_diskfile, &file->ff, file_name, READONLY );
+  if ( mapped ) {
+
+    // Memory-map FITS file
+    const int fd = fileno( f );
+    struct stat st;
+    XLAL_CHECK_FAIL( fstat( fd, &st ) == 0, XLAL_ESYS, "Could not stat file '%s'", file_name );
+    XLAL_CHECK_FAIL( st.st_size > 0, XLAL_EIO, "File '%s' is empty", file_name );
+    file->map_size = st.st_size;
+    file->map = mmap( NULL, file->map_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+    if ( file->map == MAP_FAILED ) {
+      file->map = NULL;
+      XLAL_ERROR_FAIL( XLAL_ESYS, "Could not memory-map file '%s'", file_name );
+    }
+    madvise( file->map, file->map_size, MADV_WILLNEED );
+
+    // Open memory-mapped FITS file for reading
+    CALL_FITS_VAL( XLAL_ESYS, fits_open_memfile, &file->ff, file_name, READONLY, &file->map, &file->map_size, 0, NULL );
+
+  } else {
+
+    // Open FITS file for reading
+    CALL_FITS_VAL( XLAL_ESYS, fits_open_diskfile, &file->ff, file_name, READONLY );
+
+  }
+
+  // Uncompress any compressed tables
+  XLAL_CHECK_FAIL( UncompressFile( file ) == XLAL_SUCCESS, XLAL_EFUNC );
 
   if ( f != NULL ) {
     fclose( f );
@@ -364,6 +672,9 @@ XLAL_FAIL:
     if ( file->ff != NULL ) {
       fits_close_file( file->ff, &status );
     }
+    if ( file->map != NULL ) {
+      munmap( file->map, file->map_size );
+    }
     XLALFree( file );
   }
 
@@ -372,6 +683,94 @@ XLAL_FAIL:
   }
   return NULL;
 
+}
+
+#endif // defined(HAVE_LIBCFITSIO)
+
+void XLALFITSFileClose( FITSFile UNUSED *file )
+{
+#if !defined(HAVE_LIBCFITSIO)
+  XLAL_ERROR_VOID( XLAL_EFAILED, "CFITSIO is not available" );
+#else // defined(HAVE_LIBCFITSIO)
+
+  int UNUSED status = 0;
+  int errnum = 0;
+  if ( file != NULL ) {
+    if ( file->ff != NULL ) {
+      if ( FlushTableRows( file ) != XLAL_SUCCESS ) {
+        errnum = XLAL_EFUNC;
+      } else if ( file->compress_file_name != NULL && WriteCompressedFile( file ) != XLAL_SUCCESS ) {
+        errnum = XLAL_EFUNC;
+      }
+      fits_close_file( file->ff, &status );
+    }
+    if ( file->map != NULL ) {
+      munmap( file->map, file->map_size );
+    }
+    for ( int i = 0; i < FFIO_MAX; ++i ) {
+      XLALFree( file->rows.col[i] );
+    }
+    XLALFree( file->compress_file_name );
+    XLALFree( file );
+  }
+  if ( errnum != 0 ) {
+    XLAL_ERROR_VOID( errnum );
+  }
+
+#endif // !defined(HAVE_LIBCFITSIO)
+}
+
+FITSFile *XLALFITSFileOpenWrite( const CHAR UNUSED *file_name )
+{
+#if !defined(HAVE_LIBCFITSIO)
+  XLAL_ERROR_NULL( XLAL_EFAILED, "CFITSIO is not available" );
+#else // defined(HAVE_LIBCFITSIO)
+
+  FITSFile *file = FITSFileOpenWrite( file_name, 0 );
+  XLAL_CHECK_NULL( file != NULL, XLAL_EFUNC );
+  return file;
+
+#endif // !defined(HAVE_LIBCFITSIO)
+}
+
+FITSFile *XLALFITSFileOpenWriteCompressed( const CHAR UNUSED *file_name )
+{
+#if !defined(HAVE_LIBCFITSIO)
+  XLAL_ERROR_NULL( XLAL_EFAILED, "CFITSIO is not available" );
+#elif !defined(HAVE_FITS_COMPRESS_TABLE)
+  XLAL_ERROR_NULL( XLAL_EFAILED, "CFITSIO does not support compressed tables" );
+#else // defined(HAVE_LIBCFITSIO)
+
+  FITSFile *file = FITSFileOpenWrite( file_name, 1 );
+  XLAL_CHECK_NULL( file != NULL, XLAL_EFUNC );
+  return file;
+
+#endif // !defined(HAVE_LIBCFITSIO)
+}
+
+FITSFile *XLALFITSFileOpenRead( const CHAR UNUSED *file_name )
+{
+#if !defined(HAVE_LIBCFITSIO)
+  XLAL_ERROR_NULL( XLAL_EFAILED, "CFITSIO is not available" );
+#else // defined(HAVE_LIBCFITSIO)
+
+  FITSFile *file = FITSFileOpenRead( file_name, 0 );
+  XLAL_CHECK_NULL( file != NULL, XLAL_EFUNC );
+  return file;
+
+#endif // !defined(HAVE_LIBCFITSIO)
+}
+
+FITSFile *XLALFITSFileOpenReadMapped( const CHAR UNUSED *file_name )
+{
+#if !defined(HAVE_LIBCFITSIO)
+  XLAL_ERROR_NULL( XLAL_EFAILED, "CFITSIO is not available" );
+#else // defined(HAVE_LIBCFITSIO)
+
+  FITSFile *file = FITSFileOpenRead( file_name, 1 );
+  XLAL_CHECK_NULL( file != NULL, XLAL_EFUNC );
+  return file;
+
 #endif // !defined(HAVE_LIBCFITSIO)
 }
 
@@ -386,6 +785,9 @@ int XLALFITSFileSeekPrimaryHDU( FITSFile UNUSED *file )
   // Check input
   XLAL_CHECK_FAIL( file != NULL, XLAL_EFAULT );
 
+  // Write any buffered table rows
+  XLAL_CHECK_FAIL( FlushTableRows( file ) == XLAL_SUCCESS, XLAL_EFUNC );
+
   // Seek primary HDU
   CALL_FITS( fits_movabs_hdu, file->ff, 1, NULL );
 
@@ -410,6 +812,9 @@ int XLALFITSFileSeekNamedHDU( FITSFile UNUSED *file, const CHAR UNUSED *name )
   XLAL_CHECK_FAIL( name != NULL, XLAL_EFAULT );
   XLAL_CHECK( strlen( name ) < FLEN_VALUE, XLAL_EINVAL, "HDU name '%s' is too long", name );
 
+  // Write any buffered table rows to the current HDU, before it changes
+  XLAL_CHECK_FAIL( FlushTableRows( file ) == XLAL_SUCCESS, XLAL_EFUNC );
+
   // Set current HDU
   file->hdutype = ANY_HDU;
   strncpy( file->hduname, name, sizeof( file->hduname ) - 1 );
@@ -439,6 +844,9 @@ int XLALFITSFileWriteHistory( FITSFile UNUSED *file, const CHAR UNUSED *format,
   XLAL_CHECK_FAIL( file->write, XLAL_EINVAL, "FITS file is not open for writing" );
   XLAL_CHECK_FAIL( format != NULL, XLAL_EFAULT );
 
+  // Write any buffered table rows
+  XLAL_CHECK_FAIL( FlushTableRows( file ) == XLAL_SUCCESS, XLAL_EFUNC );
+
   // Seek primary HDU
   CALL_FITS( fits_movabs_hdu, file->ff, 1, NULL );
 
@@ -476,6 +884,9 @@ int XLALFITSFileWriteVCSInfo( FITSFile UNUSED *file, const LALVCSInfoList UNUSED
   XLAL_CHECK_FAIL( file->write, XLAL_EINVAL, "FITS file is not open for writing" );
   XLAL_CHECK_FAIL( vcs_list != NULL, XLAL_EFAULT );
 
+  // Write any buffered table rows
+  XLAL_CHECK_FAIL( FlushTableRows( file ) == XLAL_SUCCESS, XLAL_EFUNC );
+
   // Seek primary HDU
   CALL_FITS( fits_movabs_hdu, file->ff, 1, NULL );
 
@@ -518,6 +929,9 @@ int XLALFITSFileWriteUVarCmdLine( FITSFile UNUSED *file )
   XLAL_CHECK_FAIL( file != NULL, XLAL_EFAULT );
   XLAL_CHECK_FAIL( file->write, XLAL_EINVAL, "FITS file is not open for writing" );
 
+  // Write any buffered table rows
+  XLAL_CHECK_FAIL( FlushTableRows( file ) == XLAL_SUCCESS, XLAL_EFUNC );
+
   // Seek primary HDU
   CALL_FITS( fits_movabs_hdu, file->ff, 1, NULL );
 
@@ -1599,6 +2013,9 @@ int XLALFITSArrayOpenWrite( FITSFile UNUSED *file, const CHAR UNUSED *name, cons
   XLAL_CHECK_FAIL( ndim <= FFIO_MAX, XLAL_ESIZE );
   XLAL_CHECK_FAIL( dims != NULL, XLAL_EFAULT );
 
+  // Write any buffered table rows
+  XLAL_CHECK_FAIL( FlushTableRows( file ) == XLAL_SUCCESS, XLAL_EFUNC );
+
   // Set current HDU
   file->hdutype = IMAGE_HDU;
   strncpy( file->hduname, name, sizeof( file->hduname ) - 1 );
@@ -2172,6 +2589,9 @@ int XLALFITSTableOpenWrite( FITSFile UNUSED *file, const CHAR UNUSED *name, cons
   XLAL_CHECK_FAIL( file->write, XLAL_EINVAL, "FITS file is not open for writing" );
   XLAL_CHECK_FAIL( name != NULL, XLAL_EFAULT );
 
+  // Write any buffered table rows
+  XLAL_CHECK_FAIL( FlushTableRows( file ) == XLAL_SUCCESS, XLAL_EFUNC );
+
   // Set current HDU
   file->hdutype = BINARY_TBL;
   strncpy( file->hduname, name, sizeof( file->hduname ) - 1 );
@@ -2179,6 +2599,7 @@ int XLALFITSTableOpenWrite( FITSFile UNUSED *file, const CHAR UNUSED *name, cons
 
   // Set current HDU data
   XLAL_INIT_MEM( file->table );
+  file->rows.max = file->rows.first = file->rows.n = 0;
 
   return XLAL_SUCCESS;
 
@@ -2214,6 +2635,7 @@ int XLALFITSTableOpenRead( FITSFile UNUSED *file, const CHAR UNUSED *name, UINT8
 
   // Set current HDU data
   XLAL_INIT_MEM( file->table );
+  file->rows.max = file->rows.first = file->rows.n = 0;
 
   // Seek table HDU with given name, starting from primary HDU
   CALL_FITS( fits_movabs_hdu, file->ff, 1, NULL );
@@ -2549,6 +2971,18 @@ int XLALFITSTableColumnAddGPSTime( FITSFile UNUSED *file, const CHAR UNUSED *col
 
 int XLALFITSTableWriteRow( FITSFile UNUSED *file, const void UNUSED *record )
 {
+#if !defined(HAVE_LIBCFITSIO)
+  XLAL_ERROR( XLAL_EFAILED, "CFITSIO is not available" );
+#else // defined(HAVE_LIBCFITSIO)
+
+  XLAL_CHECK( XLALFITSTableWriteRows( file, &record, 1 ) == XLAL_SUCCESS, XLAL_EFUNC );
+  return XLAL_SUCCESS;
+
+#endif // !defined(HAVE_LIBCFITSIO)
+}
+
+int XLALFITSTableWriteRows( FITSFile UNUSED *file, const void UNUSED *const *records, const size_t UNUSED nrecords )
+{
 #if !defined(HAVE_LIBCFITSIO)
   XLAL_ERROR( XLAL_EFAILED, "CFITSIO is not available" );
 #else // defined(HAVE_LIBCFITSIO)
@@ -2558,11 +2992,19 @@ int XLALFITSTableWriteRow( FITSFile UNUSED *file, const void UNUSED *record )
   // Check input
   XLAL_CHECK_FAIL( file != NULL, XLAL_EFAULT );
   XLAL_CHECK_FAIL( file->write, XLAL_EINVAL, "FITS file is not open for writing" );
-  XLAL_CHECK_FAIL( record != NULL, XLAL_EFAULT );
+  XLAL_CHECK_FAIL( records != NULL, XLAL_EFAULT );
+  for ( size_t r = 0; r < nrecords; ++r ) {
+    XLAL_CHECK_FAIL( records[r] != NULL, XLAL_EFAULT );
+  }
 
   // Check that we are at a table
   XLAL_CHECK_FAIL( file->hdutype == BINARY_TBL, XLAL_EIO, "Current FITS file HDU is not a table" );
 
+  // Return if there are no rows to write
+  if ( nrecords == 0 ) {
+    return XLAL_SUCCESS;
+  }
+
   // Create new table if required
   if ( file->table.irow == 0 ) {
     CHAR *ttype_ptr[FFIO_MAX], *tform_ptr[FFIO_MAX], *tunit_ptr[FFIO_MAX];
@@ -2574,31 +3016,37 @@ int XLALFITSTableWriteRow( FITSFile UNUSED *file, const void UNUSED *record )
     CALL_FITS( fits_create_tbl, file->ff, file->hdutype, 0, file->table.tfields, ttype_ptr, tform_ptr, tunit_ptr, NULL );
     CALL_FITS( fits_write_key_str, file->ff, "HDUNAME", file->hduname, file->hducomment );
     CALL_FITS( fits_write_key_str, file->ff, "EXTNAME", file->hduname, file->hducomment );   /* synonym of HDUNAME */
+    XLAL_CHECK_FAIL( InitTableRows( file ) == XLAL_SUCCESS, XLAL_EFUNC );
   }
 
-  // Advance to next row
-  ++file->table.irow;
-
-  // Write next table row
-  for ( int i = 0; i < file->table.tfields; ++i ) {
-
-    // Work out pointer to correct place in record
-    union {
-      const void *cv;
-      void *v;
-    } bad_cast = { .cv = record };
-    void *value = bad_cast.v;
-    for ( size_t n = 0; n < file->table.noffsets[i]; ++n ) {
-      if ( n > 0 ) {
-        value = *( ( void ** ) value );
+  // Copy records into buffered table rows, writing out the buffer whenever it is full
+  size_t r = 0;
+  while ( r < nrecords ) {
+
+    // Number of records to copy into the buffer
+    const LONGLONG m = GSL_MIN( ( LONGLONG )( nrecords - r ), file->rows.max - file->rows.n );
+
+    // Copy data in records to buffered table columns
+#pragma omp parallel for if ( m > 1 ) schedule(static)
+    for ( LONGLONG j = 0; j < m; ++j ) {
+      const LONGLONG k = file->rows.n + j;
+      for ( int i = 0; i < file->table.tfields; ++i ) {
+        char *buf = file->rows.col[i] + k * file->rows.stride[i];
+        memcpy( buf, TableRecordField( file, i, records[r + j] ), file->table.field_size[i] );
+        if ( file->table.datatype[i] == TSTRING ) {
+          buf[file->table.field_size[i]] = '\0';
+        }
       }
-      value = ( void * )( ( ( intptr_t ) value ) + file->table.offsets[i][n] );
     }
 
-    // Write data in record to table column
-    {
-      void *pvalue = ( file->table.datatype[i] == TSTRING ) ? ( void * ) &value : value;
-      CALL_FITS( fits_write_col, file->ff, file->table.datatype[i], file->table.colnum[i], file->table.irow, 1, file->table.nelements[i], pvalue );
+    // Advance to next rows
+    file->rows.n += m;
+    file->table.irow += m;
+    r += m;
+
+    // Write buffered table rows if buffer is full
+    if ( file->rows.n == file->rows.max ) {
+      XLAL_CHECK_FAIL( FlushTableRows( file ) == XLAL_SUCCESS, XLAL_EFUNC );
     }
 
   }
@@ -2620,6 +3068,26 @@ XLAL_FAIL:
 
 int XLALFITSTableReadRow( FITSFile UNUSED *file, void UNUSED *record, UINT8 UNUSED *rem_nrows )
 {
+#if !defined(HAVE_LIBCFITSIO)
+  XLAL_ERROR( XLAL_EFAILED, "CFITSIO is not available" );
+#else // defined(HAVE_LIBCFITSIO)
+
+  // Check input
+  XLAL_CHECK( file != NULL, XLAL_EFAULT );
+
+  // Return if there are no more rows
+  if ( file->table.irow == file->table.nrows ) {
+    return XLAL_SUCCESS;
+  }
+
+  XLAL_CHECK( XLALFITSTableReadRows( file, &record, 1, rem_nrows ) == XLAL_SUCCESS, XLAL_EFUNC );
+  return XLAL_SUCCESS;
+
+#endif // !defined(HAVE_LIBCFITSIO)
+}
+
+int XLALFITSTableReadRows( FITSFile UNUSED *file, void UNUSED *const *records, const size_t UNUSED nrecords, UINT8 UNUSED *rem_nrows )
+{
 #if !defined(HAVE_LIBCFITSIO)
   XLAL_ERROR( XLAL_EFAILED, "CFITSIO is not available" );
 #else // defined(HAVE_LIBCFITSIO)
@@ -2629,55 +3097,54 @@ int XLALFITSTableReadRow( FITSFile UNUSED *file, void UNUSED *record, UINT8 UNUS
   // Check input
   XLAL_CHECK_FAIL( file != NULL, XLAL_EFAULT );
   XLAL_CHECK_FAIL( !file->write, XLAL_EINVAL, "FITS file is not open for reading" );
-  XLAL_CHECK_FAIL( record != NULL, XLAL_EFAULT );
+  XLAL_CHECK_FAIL( records != NULL, XLAL_EFAULT );
+  for ( size_t r = 0; r < nrecords; ++r ) {
+    XLAL_CHECK_FAIL( records[r] != NULL, XLAL_EFAULT );
+  }
 
   // Check that we are at a table
   XLAL_CHECK_FAIL( file->hdutype == BINARY_TBL, XLAL_EIO, "Current FITS file HDU is not a table" );
 
-  // Return if there are no more rows
-  if ( file->table.irow == file->table.nrows ) {
-    return XLAL_SUCCESS;
-  }
+  // Check that there are enough rows remaining in the table
+  XLAL_CHECK_FAIL( ( LONGLONG ) nrecords <= file->table.nrows - file->table.irow, XLAL_ERANGE, "Cannot read %zu rows; only %lli rows remain in table", nrecords, file->table.nrows - file->table.irow );
 
-  // Advance to next row, and return number of remaining rows
-  ++file->table.irow;
-  if ( rem_nrows != NULL ) {
-    *rem_nrows = file->table.nrows - file->table.irow;
+  // Allocate buffered table rows if required
+  if ( file->rows.max == 0 && nrecords > 0 ) {
+    XLAL_CHECK_FAIL( InitTableRows( file ) == XLAL_SUCCESS, XLAL_EFUNC );
   }
 
-  // Read next table row
-  for ( int i = 0; i < file->table.tfields; ++i ) {
+  // Copy buffered table rows into records, reading in the next rows whenever the buffer is exhausted
+  size_t r = 0;
+  while ( r < nrecords ) {
 
-    // Resize temporary buffer, if required
-    // - Require double the field size to allow for buffer overruns in CFITSIO
-    const size_t req_buf_size = 2 * file->table.field_size[i];
-    if ( file->buf_size < req_buf_size ) {
-      file->buf = XLALRealloc( file->buf, req_buf_size );
-      XLAL_CHECK( file->buf != NULL, XLAL_ENOMEM );
-      file->buf_size = req_buf_size;
+    // Read next buffered table rows if buffer is exhausted
+    if ( file->table.irow == file->rows.first + file->rows.n ) {
+      XLAL_CHECK_FAIL( FillTableRows( file ) == XLAL_SUCCESS, XLAL_EFUNC );
     }
-    memset( file->buf, 0, req_buf_size );
 
-    // Read data from table column into temporary buffer
-    {
-      void *pbuf = ( file->table.datatype[i] == TSTRING ) ? ( void * ) &file->buf : file->buf;
-      CALL_FITS( fits_read_col, file->ff, file->table.datatype[i], file->table.colnum[i], file->table.irow, 1, file->table.nelements[i], NULL, pbuf, NULL );
-    }
+    // Number of records to copy from the buffer
+    const LONGLONG m = GSL_MIN( ( LONGLONG )( nrecords - r ), file->rows.first + file->rows.n - file->table.irow );
 
-    // Work out pointer to correct place in record
-    void *value = record;
-    for ( size_t n = 0; n < file->table.noffsets[i]; ++n ) {
-      if ( n > 0 ) {
-        value = *( ( void ** ) value );
+    // Copy data in buffered table columns to records
+#pragma omp parallel for if ( m > 1 ) schedule(static)
+    for ( LONGLONG j = 0; j < m; ++j ) {
+      const LONGLONG k = file->table.irow - file->rows.first + j;
+      for ( int i = 0; i < file->table.tfields; ++i ) {
+        memcpy( TableRecordField( file, i, records[r + j] ), file->rows.col[i] + k * file->rows.stride[i], file->table.field_size[i] );
       }
-      value = ( void * )( ( ( intptr_t ) value ) + file->table.offsets[i][n] );
     }
 
-    // Copy the required length of the temporary buffer into the record
-    memcpy( value, file->buf, file->table.field_size[i] );
+    // Advance to next rows
+    file->table.irow += m;
+    r += m;
 
   }
 
+  // Return number of remaining rows
+  if ( rem_nrows != NULL ) {
+    *rem_nrows = file->table.nrows - file->table.irow;
+  }
+
   return XLAL_SUCCESS;
 
 XLAL_FAIL:
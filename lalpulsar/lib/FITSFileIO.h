@@ -63,10 +63,18 @@ typedef struct tagFITSFile FITSFile;
 /// named HDU or by returning to the primary (first) HDU. History information may also be written to
 /// the primary HDU.
 ///
+/// XLALFITSFileOpenWriteCompressed() builds the FITS file in memory, and when it is closed writes
+/// it to \p file_name with all non-empty tables stored as tile-compressed binary tables.
+/// XLALFITSFileOpenRead() transparently uncompresses any such tables into memory.
+/// XLALFITSFileOpenReadMapped() memory-maps the FITS file instead of reading it through
+/// CFITSIO's disk file driver, which is faster when reading large tables.
+///
 /// @{
 void XLALFITSFileClose( FITSFile *file );
 FITSFile *XLALFITSFileOpenWrite( const CHAR *file_name );
+FITSFile *XLALFITSFileOpenWriteCompressed( const CHAR *file_name );
 FITSFile *XLALFITSFileOpenRead( const CHAR *file_name );
+FITSFile *XLALFITSFileOpenReadMapped( const CHAR *file_name );
 int XLALFITSFileSeekPrimaryHDU( FITSFile *file );
 int XLALFITSFileSeekNamedHDU( FITSFile *file, const CHAR *name );
 int XLALFITSFileWriteHistory( FITSFile *file, const CHAR *format, ... ) _LAL_GCC_PRINTF_FORMAT_( 2, 3 );
@@ -213,7 +221,11 @@ int XLALFITSArrayReadGSLMatrix( FITSFile *file, const size_t idx[], gsl_matrix *
 /// square brackets after the column name, e.g. "freq [Hz]".
 ///
 /// Finally, XLALFITSTableWriteRow() or XLALFITSTableReadRow() are called to write/read table rows;
-/// the latter returns the number of rows remaining in the table \p rem_nrows, if needed.
+/// the latter returns the number of rows remaining in the table \p rem_nrows, if needed. Table rows
+/// are buffered, and written/read in blocks of columns. XLALFITSTableWriteRows() and
+/// XLALFITSTableReadRows() write/read an array of \p nrecords records at once, and copy records
+/// to/from the buffer in parallel; the latter requires that at least \p nrecords rows remain in
+/// the table.
 ///
 /// @{
 int XLALFITSTableOpenWrite( FITSFile *file, const CHAR *name, const CHAR *comment );
@@ -286,6 +298,10 @@ int XLALFITSTableColumnAddGPSTime( FITSFile *file, const CHAR *col_name, const s
 
 int XLALFITSTableWriteRow( FITSFile *file, const void *record );
 int XLALFITSTableReadRow( FITSFile *file, void *record, UINT8 *rem_nrows );
+#ifndef SWIG /* exclude from SWIG interface */
+int XLALFITSTableWriteRows( FITSFile *file, const void *const *records, const size_t nrecords );
+int XLALFITSTableReadRows( FITSFile *file, void *const *records, const size_t nrecords, UINT8 *rem_nrows );
+#endif /* SWIG */
 /// @}
 
 /// @}
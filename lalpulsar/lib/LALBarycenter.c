@@ -21,6 +21,8 @@
 #include <lal/Date.h>
 #include <lal/LALBarycenter.h>
 
+#include "LALBarycenter_internal.h"
+
 #define OBLQ 0.40909280422232891e0; /* obliquity of ecliptic at JD 245145.0* in radians */;
 
 /// ---------- internal buffer type for optimized Barycentering function ----------
@@ -56,6 +58,7 @@ struct tagBarycenterBuffer {
 /* Internal functions */
 static void precessionMatrix( REAL8 prn[3][3], REAL8 mjd, REAL8 dpsi, REAL8 deps );
 static void observatoryEarth( REAL8 obsearth[3], const LALDetector det, const LIGOTimeGPS *tgps, REAL8 gmst, REAL8 dpsi, REAL8 deps );
+static void chebyshevPosVel( REAL8 pos[3], REAL8 vel[3], const EphemerisChebyshevBody *body, const UINT4 order, const LIGOTimeGPS *tGPS );
 
 /// \addtogroup LALBarycenter_h
 /// @{
@@ -150,14 +153,18 @@ XLALBarycenterEarth( EarthState *earth,                /**< [out] the earth's st
    */
   {
 
-    REAL8 *pos = edat->ephemE[ientryE].pos; /*Cartesian coords of center of Earth
-                                             from DE405 ephem, in sec. 0=x,1=y,2=z */
-    REAL8 *vel = edat->ephemE[ientryE].vel;
-    REAL8 *acc = edat->ephemE[ientryE].acc;
+    if ( edat->cheb != NULL ) { /* evaluate Chebyshev series, if available */
+      chebyshevPosVel( earth->posNow, earth->velNow, &edat->cheb->earth, edat->cheb->order, tGPS );
+    } else {
+      REAL8 *pos = edat->ephemE[ientryE].pos; /*Cartesian coords of center of Earth
+                                               from DE405 ephem, in sec. 0=x,1=y,2=z */
+      REAL8 *vel = edat->ephemE[ientryE].vel;
+      REAL8 *acc = edat->ephemE[ientryE].acc;
 
-    for ( j = 0; j < 3; j++ ) {
-      earth->posNow[j] = pos[j] + vel[j] * tdiffE + 0.5 * acc[j] * tdiff2E;
-      earth->velNow[j] = vel[j] + acc[j] * tdiffE;
+      for ( j = 0; j < 3; j++ ) {
+        earth->posNow[j] = pos[j] + vel[j] * tdiffE + 0.5 * acc[j] * tdiff2E;
+        earth->velNow[j] = vel[j] + acc[j] * tdiffE;
+      }
     }
   }
 
@@ -448,10 +455,16 @@ XLALBarycenterEarth( EarthState *earth,                /**< [out] the earth's st
     REAL8 *sunAcc = edat->ephemS[ientryS].acc;
     REAL8 sunPosNow[3], sunVelNow[3];
 
+    if ( edat->cheb != NULL ) { /* evaluate Chebyshev series, if available */
+      chebyshevPosVel( sunPosNow, sunVelNow, &edat->cheb->sun, edat->cheb->order, tGPS );
+    }
+
     rse2 = earth->drse = 0.0;
     for ( j = 0; j < 3; j++ ) {
-      sunPosNow[j] = sunPos[j] + sunVel[j] * tdiffS + 0.5 * sunAcc[j] * tdiff2S;
-      sunVelNow[j] = sunVel[j] + sunAcc[j] * tdiffS;
+      if ( edat->cheb == NULL ) {
+        sunPosNow[j] = sunPos[j] + sunVel[j] * tdiffS + 0.5 * sunAcc[j] * tdiff2S;
+        sunVelNow[j] = sunVel[j] + sunAcc[j] * tdiffS;
+      }
 
       earth->se[j] = earth->posNow[j] - sunPosNow[j];
       earth->dse[j] = earth->velNow[j] - sunVelNow[j];
@@ -467,6 +480,39 @@ XLALBarycenterEarth( EarthState *earth,                /**< [out] the earth's st
 
 } /* XLALBarycenterEarth() */
 
+/**
+ * Computes the position and orientation of the Earth, as per XLALBarycenterEarth(),
+ * for a vector of arrival times \f$ t_a \f$. Times are processed in parallel if
+ * OpenMP is available; this is most efficient when the ephemeris \p edat holds a
+ * Chebyshev-coefficient representation (see XLALFitEphemerisDataChebyshev()).
+ */
+int
+XLALBarycenterEarthVector( EarthState *earth,           /**< [out] array of earth states at times tGPS */
+                           const LIGOTimeGPS *tGPS,     /**< [in] array of GPS times */
+                           const UINT4 length,          /**< [in] length of arrays earth and tGPS */
+                           const EphemerisData *edat )  /**< [in] ephemeris-files */
+{
+
+  // Check input
+  XLAL_CHECK( length == 0 || earth != NULL, XLAL_EFAULT );
+  XLAL_CHECK( length == 0 || tGPS != NULL, XLAL_EFAULT );
+  XLAL_CHECK( edat != NULL, XLAL_EFAULT );
+
+  // Compute earth state at each time
+  int errflag = 0;
+  #pragma omp parallel for schedule(static)
+  for ( INT4 i = 0; i < ( INT4 ) length; ++i ) {
+    if ( XLALBarycenterEarth( &earth[i], &tGPS[i], edat ) != XLAL_SUCCESS ) {
+      #pragma omp atomic write
+      errflag = 1;
+    }
+  }
+  XLAL_CHECK( errflag == 0, XLAL_EFUNC, "XLALBarycenterEarth() failed" );
+
+  return XLAL_SUCCESS;
+
+} /* XLALBarycenterEarthVector() */
+
 
 /**
  * \brief Computes the position and orientation of the Earth, at some arrival
@@ -521,7 +567,7 @@ XLALBarycenterEarthNew( EarthState *earth,                /**< [out] the earth's
   REAL8 tdiffS;
   REAL8 tdiff2S;
 
-  static REAL8 scorr; /* SI second/metre correction factor */
+  REAL8 scorr; /* SI second/metre correction factor */
 
   INT4 j; /*dummy index */
 
@@ -573,14 +619,22 @@ XLALBarycenterEarthNew( EarthState *earth,                /**< [out] the earth's
    *---------------------------------------------------------------------
    */
   {
-    REAL8 *pos = edat->ephemE[ientryE].pos; /*Cartesian coords of center of Earth
-                                              from ephem, in sec. 0=x,1=y,2=z */
-    REAL8 *vel = edat->ephemE[ientryE].vel;
-    REAL8 *acc = edat->ephemE[ientryE].acc;
+    if ( edat->cheb != NULL ) { /* evaluate Chebyshev series, if available */
+      chebyshevPosVel( earth->posNow, earth->velNow, &edat->cheb->earth, edat->cheb->order, tGPS );
+      for ( j = 0; j < 3; j++ ) {
+        earth->posNow[j] *= scorr;
+        earth->velNow[j] *= scorr;
+      }
+    } else {
+      REAL8 *pos = edat->ephemE[ientryE].pos; /*Cartesian coords of center of Earth
+                                                from ephem, in sec. 0=x,1=y,2=z */
+      REAL8 *vel = edat->ephemE[ientryE].vel;
+      REAL8 *acc = edat->ephemE[ientryE].acc;
 
-    for ( j = 0; j < 3; j++ ) {
-      earth->posNow[j] = scorr * ( pos[j] + vel[j] * tdiffE + 0.5 * acc[j] * tdiff2E );
-      earth->velNow[j] = scorr * ( vel[j] + acc[j] * tdiffE );
+      for ( j = 0; j < 3; j++ ) {
+        earth->posNow[j] = scorr * ( pos[j] + vel[j] * tdiffE + 0.5 * acc[j] * tdiff2E );
+        earth->velNow[j] = scorr * ( vel[j] + acc[j] * tdiffE );
+      }
     }
   }
 
@@ -793,10 +847,19 @@ XLALBarycenterEarthNew( EarthState *earth,                /**< [out] the earth's
     REAL8 *sunAcc = edat->ephemS[ientryS].acc;
     REAL8 sunPosNow[3], sunVelNow[3];
 
+    if ( edat->cheb != NULL ) { /* evaluate Chebyshev series, if available */
+      chebyshevPosVel( sunPosNow, sunVelNow, &edat->cheb->sun, edat->cheb->order, tGPS );
+    }
+
     rse2 = earth->drse = 0.0;
     for ( j = 0; j < 3; j++ ) {
-      sunPosNow[j] = scorr * ( sunPos[j] + sunVel[j] * tdiffS + 0.5 * sunAcc[j] * tdiff2S );
-      sunVelNow[j] = scorr * ( sunVel[j] + sunAcc[j] * tdiffS );
+      if ( edat->cheb != NULL ) {
+        sunPosNow[j] *= scorr;
+        sunVelNow[j] *= scorr;
+      } else {
+        sunPosNow[j] = scorr * ( sunPos[j] + sunVel[j] * tdiffS + 0.5 * sunAcc[j] * tdiff2S );
+        sunVelNow[j] = scorr * ( sunVel[j] + sunAcc[j] * tdiffS );
+      }
 
       earth->se[j] = earth->posNow[j] - sunPosNow[j];
       earth->dse[j] = earth->velNow[j] - sunVelNow[j];
@@ -1533,9 +1596,9 @@ void observatoryEarth( REAL8 obsEarth[3],     /**< [out] The x, y, z coordinates
                        REAL8 deps             /**< [in] deps for Earth nutation */
                      )
 {
-  static REAL8 erad; /* observatory distance from Earth centre */
-  static REAL8 hlt;  /* observatory latitude */
-  static REAL8 alng; /* observatory longitude */
+  REAL8 erad; /* observatory distance from Earth centre */
+  REAL8 hlt;  /* observatory latitude */
+  REAL8 alng; /* observatory longitude */
   REAL8 tmjd = 44244. + ( XLALGPSGetREAL8( tgps ) + 51.184 ) / 86400.;
 
   INT4 j = 0;
@@ -1552,7 +1615,7 @@ void observatoryEarth( REAL8 obsEarth[3],     /**< [out] The x, y, z coordinates
 
   alng = atan2( -det.location[1], det.location[0] );
 
-  static REAL8 siteCoord[3];
+  REAL8 siteCoord[3];
   REAL8 eeq[3], prn[3][3];
 
   siteCoord[0] = erad * cos( hlt );
@@ -1582,3 +1645,56 @@ void observatoryEarth( REAL8 obsEarth[3],     /**< [out] The x, y, z coordinates
 }
 
 /// @}
+
+/**
+ * Evaluate the position and velocity of a body (Earth or Sun) at time \p tGPS
+ * from its Chebyshev-coefficient representation.
+ */
+void chebyshevPosVel( REAL8 pos[3],                       /**< [out] position, in sec */
+                      REAL8 vel[3],                       /**< [out] velocity, dimensionless */
+                      const EphemerisChebyshevBody *body, /**< [in] Chebyshev coefficients of body */
+                      const UINT4 order,                  /**< [in] order of Chebyshev series */
+                      const LIGOTimeGPS *tGPS             /**< [in] GPS time */
+                    )
+{
+  const REAL8 tsec = ( REAL8 )tGPS->gpsSeconds;
+
+  /* find granule containing tGPS; times just outside the first/last granules
+     (which the table-range checks still admit) are extrapolated slightly */
+  INT4 g = ( INT4 ) floor( ( tsec - body->tstart ) / body->span );
+  if ( g < 0 ) {
+    g = 0;
+  } else if ( g >= ( INT4 ) body->ngranules ) {
+    g = body->ngranules - 1;
+  }
+  const REAL8 *rec = body->coeffs + ( size_t ) g * EPHEM_CHEB_RECORD( order );
+
+  /* map time onto [-1, 1] about the granule midpoint; subtract the (integer)
+     midpoint before adding nanoseconds, as for the table lookup */
+  const REAL8 halfspan = 0.5 * body->span;
+  const REAL8 x = ( ( tsec - rec[0] ) + tGPS->gpsNanoSeconds * 1.e-9 ) / halfspan;
+
+  /* Chebyshev polynomials T_k(x) and their derivatives T'_k(x) */
+  REAL8 T[EPHEM_CHEB_MAX_ORDER + 1], dT[EPHEM_CHEB_MAX_ORDER + 1];
+  T[0] = 1.0;
+  dT[0] = 0.0;
+  T[1] = x;
+  dT[1] = 1.0;
+  for ( UINT4 k = 1; k < order; ++k ) {
+    T[k + 1] = 2.0 * x * T[k] - T[k - 1];
+    dT[k + 1] = 2.0 * T[k] + 2.0 * x * dT[k] - dT[k - 1];
+  }
+
+  /* sum series for each coordinate */
+  for ( UINT4 j = 0; j < 3; ++j ) {
+    const REAL8 *c = rec + 1 + j * ( order + 1 );
+    REAL8 p = 0, v = 0;
+    for ( UINT4 k = 0; k <= order; ++k ) {
+      p += c[k] * T[k];
+      v += c[k] * dT[k];
+    }
+    pos[j] = p;
+    vel[j] = v / halfspan;
+  }
+
+} /* chebyshevPosVel() */
@@ -119,11 +119,20 @@ typedef struct tagPosVelAcc {
 }
 PosVelAcc;
 
+/**
+ * Opaque type holding a compact Chebyshev-coefficient representation of the
+ * Earth and Sun ephemerides; see XLALFitEphemerisDataChebyshev().
+ */
+typedef struct tagEphemerisChebyshev EphemerisChebyshev;
+
 /**
  * This structure contains all information about the
  * center-of-mass positions of the Earth and Sun, listed at regular
  * time intervals.
  */
+#ifdef SWIG /* SWIG interface directives */
+SWIGLAL( IGNORE_MEMBERS( tagEphemerisData, cheb ) );
+#endif /* SWIG */
 typedef struct tagEphemerisData {
   CHAR *filenameE;      /**< File containing Earth's position.  */
   CHAR *filenameS;      /**< File containing Sun's position. */
@@ -143,6 +152,9 @@ typedef struct tagEphemerisData {
   PosVelAcc *ephemS;    /**< Array with pos, vel and acc for the sun (see ephemE) */
 
   EphemerisType etype;  /**< The ephemeris type e.g. DE405 */
+
+  EphemerisChebyshev *cheb;     /**< Optional Chebyshev-coefficient representation of ephemE and ephemS;
+                                 * if not NULL, used instead of the Taylor expansion about the nearest table entry */
 }
 EphemerisData;
 
@@ -262,6 +274,9 @@ typedef struct tagBarycenterBuffer BarycenterBuffer;
 
 /* Function prototypes. */
 int XLALBarycenterEarth( EarthState *earth, const LIGOTimeGPS *tGPS, const EphemerisData *edat );
+#ifndef SWIG /* exclude from SWIG interface */
+int XLALBarycenterEarthVector( EarthState *earth, const LIGOTimeGPS *tGPS, const UINT4 length, const EphemerisData *edat );
+#endif /* SWIG */
 int XLALBarycenter( EmissionTime *emit, const BarycenterInput *baryinput, const EarthState *earth );
 int XLALBarycenterOpt( EmissionTime *emit, const BarycenterInput *baryinput, const EarthState *earth, BarycenterBuffer **buffer );
 
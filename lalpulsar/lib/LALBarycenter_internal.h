@@ -0,0 +1,64 @@
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with with program; see the file COPYING. If not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+// MA  02110-1301  USA
+//
+
+#ifndef _LALBARYCENTER_INTERNAL_H
+#define _LALBARYCENTER_INTERNAL_H
+
+#include <lal/LALBarycenter.h>
+
+// ============================================================================================ //
+//                                                                                              //
+// This file should **ONLY** contain definitions that **MUST** be shared between LALBarycenter.c //
+// and LALInitBarycenter.c                                                                      //
+//                                                                                              //
+// ============================================================================================ //
+
+// ---------- Shared constants/defines ---------- //
+
+// Default number of ephemeris table intervals spanned by each Chebyshev granule
+#define EPHEM_CHEB_GRANULE      8
+
+// Default order of the Chebyshev series in each granule
+#define EPHEM_CHEB_ORDER        12
+
+// Maximum supported order of the Chebyshev series
+#define EPHEM_CHEB_MAX_ORDER    32
+
+// Number of REAL8s stored per granule: midpoint time, and 3 series of (order + 1) coefficients
+#define EPHEM_CHEB_RECORD(order) ( 1 + 3 * ( ( order ) + 1 ) )
+
+// ---------- Shared struct definitions ---------- //
+
+// Chebyshev-coefficient representation of one body (Earth or Sun)
+typedef struct tagEphemerisChebyshevBody {
+  REAL8 tstart;                 // GPS time of start of first granule
+  REAL8 span;                   // Duration in seconds of each granule
+  UINT4 ngranules;              // Number of granules
+  const REAL8 *coeffs;          // Array of 'ngranules' records of 'EPHEM_CHEB_RECORD(order)' REAL8s
+} EphemerisChebyshevBody;
+
+struct tagEphemerisChebyshev {
+  UINT4 order;                  // Order of the Chebyshev series in each granule
+  UINT4 granule;                // Number of ephemeris table intervals spanned by each granule
+  EphemerisChebyshevBody earth; // Earth coefficients
+  EphemerisChebyshevBody sun;   // Sun coefficients
+  REAL8 *alloc;                 // Coefficients allocated by XLALFitEphemerisDataChebyshev(), or NULL
+  void *map;                    // Memory-mapped binary ephemeris file holding the coefficients, or NULL
+  size_t map_size;              // Size of memory-mapped binary ephemeris file
+};
+
+#endif // _LALBARYCENTER_INTERNAL_H
@@ -18,6 +18,16 @@
 *  MA  02110-1301  USA
 */
 
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_linalg.h>
+
 #include <lal/FileIO.h>
 #include <lal/LALBarycenter.h>
 #include <lal/LALInitBarycenter.h>
@@ -25,6 +35,8 @@
 #include <lal/LALString.h>
 #include <lal/Date.h>
 
+#include "LALBarycenter_internal.h"
+
 /** \cond DONT_DOXYGEN */
 
 /* ----- defines and macros ---------- */
@@ -32,6 +44,10 @@
 #define NORM3D(x) ( SQ( (x)[0]) + SQ( (x)[1] ) + SQ ( (x)[2] ) )
 #define LENGTH3D(x) ( sqrt( NORM3D ( (x) ) ) )
 
+#define EPHEM_BINARY_MAGIC      "LALEPHEM"      /* magic string identifying binary ephemeris files */
+#define EPHEM_BINARY_VERSION    1               /* version of binary ephemeris file format */
+#define EPHEM_BINARY_ENDIAN     0x01020304      /* used to check byte order of binary ephemeris files */
+
 /** \endcond */
 
 /* ----- local type definitions ---------- */
@@ -48,6 +64,33 @@ typedef struct {
 }
 EphemerisVector;
 
+/**
+ * Header of binary ephemeris files written by XLALWriteEphemerisDataBinary().
+ * The header is followed by the Earth and Sun ephemeris tables (as arrays of
+ * \c PosVelAcc) and then the Earth and Sun Chebyshev coefficients; all sections
+ * are multiples of 8 bytes, so that the memory-mapped coefficients are aligned.
+ */
+typedef struct {
+  CHAR magic[8];        /**< magic string EPHEM_BINARY_MAGIC (not null-terminated) */
+  UINT4 version;        /**< file format version EPHEM_BINARY_VERSION */
+  UINT4 endian;         /**< EPHEM_BINARY_ENDIAN in byte order of writing machine */
+  INT4 etype;           /**< ephemeris type */
+  UINT4 order;          /**< order of the Chebyshev series */
+  UINT4 granule;        /**< number of table intervals spanned by each Chebyshev granule */
+  INT4 nentriesE;       /**< number of entries in Earth ephemeris table */
+  INT4 nentriesS;       /**< number of entries in Sun ephemeris table */
+  UINT4 ngranulesE;     /**< number of Earth Chebyshev granules */
+  UINT4 ngranulesS;     /**< number of Sun Chebyshev granules */
+  UINT4 reserved;       /**< reserved; pads header to a multiple of 8 bytes */
+  REAL8 dtEtable;       /**< spacing in seconds of Earth ephemeris table */
+  REAL8 dtStable;       /**< spacing in seconds of Sun ephemeris table */
+  REAL8 tstartE;        /**< GPS start time of Earth Chebyshev granules */
+  REAL8 tstartS;        /**< GPS start time of Sun Chebyshev granules */
+  REAL8 spanE;          /**< duration in seconds of Earth Chebyshev granules */
+  REAL8 spanS;          /**< duration in seconds of Sun Chebyshev granules */
+}
+EphemerisBinaryHeader;
+
 /* ----- internal prototypes ---------- */
 EphemerisVector *XLALCreateEphemerisVector( UINT4 length );
 void XLALDestroyEphemerisVector( EphemerisVector *ephemV );
@@ -55,6 +98,11 @@ void XLALDestroyEphemerisVector( EphemerisVector *ephemV );
 EphemerisVector *XLALReadEphemerisFile( const CHAR *fname );
 int XLALCheckEphemerisRanges( const EphemerisVector *ephemEarth, REAL8 avg[3], REAL8 range[3] );
 
+static EphemerisData *ReadEphemerisBinary( const CHAR *fname );
+static void DestroyEphemerisChebyshev( EphemerisChebyshev *cheb );
+static void FitEphemerisChebyshevBody( EphemerisChebyshevBody *body, REAL8 *coeffs, const PosVelAcc *ephem, const INT4 nentries, const REAL8 dt,
+                                       const gsl_matrix *pinv, const UINT4 order, const UINT4 granule );
+
 /* ----- function definitions ---------- */
 
 /* ========== exported API ========== */
@@ -200,6 +248,12 @@ XLALDestroyTimeCorrectionData( TimeCorrectionData *tcd )
  * at that instant.  All in units of seconds; e.g. positions have
  * units of seconds, and accelerations have units 1/sec.
  *
+ * Alternatively, \p earthEphemerisFile may name a binary ephemeris file
+ * written by XLALWriteEphemerisDataBinary(), in which case \p sunEphemerisFile
+ * must be either \c NULL or the same file name. Binary files are memory-mapped
+ * rather than parsed, and carry a Chebyshev-coefficient representation of the
+ * ephemerides which is used by XLALBarycenterEarth().
+ *
  * \ingroup LALBarycenter_h
  */
 EphemerisData *
@@ -209,6 +263,13 @@ XLALInitBarycenter( const CHAR *earthEphemerisFile,         /**< File containing
 {
   EphemerisType sun_etype, earth_etype, etype;
 
+  /* load binary ephemeris file, if given; this holds both Earth and Sun ephemerides */
+  if ( earthEphemerisFile && ( !sunEphemerisFile || strcmp( earthEphemerisFile, sunEphemerisFile ) == 0 ) ) {
+    EphemerisData *edat = ReadEphemerisBinary( earthEphemerisFile );
+    XLAL_CHECK_NULL( edat != NULL, XLAL_EFUNC, "ReadEphemerisBinary('%s') failed\n", earthEphemerisFile );
+    return edat;
+  }
+
   /* check user input consistency */
   if ( !earthEphemerisFile || !sunEphemerisFile ) {
     XLAL_ERROR_NULL( XLAL_EINVAL, "Invalid NULL input earthEphemerisFile=%p, sunEphemerisFile=%p\n", earthEphemerisFile, sunEphemerisFile );
@@ -341,6 +402,8 @@ XLALDestroyEphemerisData( EphemerisData *edat )
     XLALFree( edat->ephemS );
   }
 
+  DestroyEphemerisChebyshev( edat->cheb );
+
   XLALFree( edat );
 
   return;
@@ -411,6 +474,198 @@ int XLALRestrictEphemerisData( EphemerisData *edat, const LIGOTimeGPS *startGPS,
 } /* XLALRestrictEphemerisData() */
 
 
+/**
+ * Fit a compact Chebyshev-coefficient representation to the Earth and Sun
+ * ephemeris tables in \p edat, and attach it to \p edat. Subsequent calls to
+ * XLALBarycenterEarth() then evaluate the Chebyshev series instead of a Taylor
+ * expansion about the nearest table entry.
+ *
+ * Each Chebyshev granule spans a fixed number of table intervals, and its
+ * coefficients are the least-squares fit to the tabulated positions,
+ * velocities and accelerations of all table entries within the granule.
+ *
+ * \ingroup LALBarycenter_h
+ */
+int XLALFitEphemerisDataChebyshev( EphemerisData *edat )
+{
+
+  // Check input
+  XLAL_CHECK( edat != NULL, XLAL_EFAULT );
+  XLAL_CHECK( edat->ephemE != NULL && edat->ephemS != NULL, XLAL_EINVAL );
+  const UINT4 order = EPHEM_CHEB_ORDER, granule = EPHEM_CHEB_GRANULE;
+  XLAL_CHECK( edat->nentriesE > ( INT4 ) granule && edat->nentriesS > ( INT4 ) granule, XLAL_EINVAL,
+              "Need more than %u entries in Earth and Sun ephemeris tables, got %d and %d", granule, edat->nentriesE, edat->nentriesS );
+
+  int retn = XLAL_FAILURE;
+  EphemerisChebyshev *cheb = NULL;
+
+  // Build design matrix: rows are the Chebyshev polynomials T_k(x) and their first and second
+  // derivatives, evaluated at the 'granule + 1' table entries within a granule, x in [-1, 1]
+  const size_t nnodes = granule + 1, nrows = 3 * nnodes, ncols = order + 1;
+  gsl_matrix *A = gsl_matrix_calloc( nrows, ncols );
+  gsl_matrix *V = gsl_matrix_alloc( ncols, ncols );
+  gsl_vector *S = gsl_vector_alloc( ncols );
+  gsl_vector *work = gsl_vector_alloc( ncols );
+  gsl_matrix *pinv = gsl_matrix_calloc( ncols, nrows );
+  XLAL_CHECK_FAIL( A != NULL && V != NULL && S != NULL && work != NULL && pinv != NULL, XLAL_ENOMEM );
+  for ( size_t i = 0; i < nnodes; ++i ) {
+    const double x = -1.0 + 2.0 * i / granule;
+    double T[EPHEM_CHEB_MAX_ORDER + 1], dT[EPHEM_CHEB_MAX_ORDER + 1], d2T[EPHEM_CHEB_MAX_ORDER + 1];
+    T[0] = 1.0;
+    dT[0] = d2T[0] = 0.0;
+    T[1] = x;
+    dT[1] = 1.0;
+    d2T[1] = 0.0;
+    for ( size_t k = 1; k < order; ++k ) {
+      T[k + 1] = 2.0 * x * T[k] - T[k - 1];
+      dT[k + 1] = 2.0 * T[k] + 2.0 * x * dT[k] - dT[k - 1];
+      d2T[k + 1] = 4.0 * dT[k] + 2.0 * x * d2T[k] - d2T[k - 1];
+    }
+    for ( size_t k = 0; k < ncols; ++k ) {
+      gsl_matrix_set( A, i, k, T[k] );
+      gsl_matrix_set( A, nnodes + i, k, dT[k] );
+      gsl_matrix_set( A, 2 * nnodes + i, k, d2T[k] );
+    }
+  }
+
+  // Compute pseudo-inverse of design matrix from its singular value decomposition A = U * S * V^T
+  XLAL_CHECK_FAIL( gsl_linalg_SV_decomp( A, V, S, work ) == 0, XLAL_EFAILED );
+  for ( size_t k = 0; k < ncols; ++k ) {
+    const double s_k = gsl_vector_get( S, k );
+    if ( s_k <= 1e-12 * gsl_vector_get( S, 0 ) ) {
+      continue;
+    }
+    for ( size_t l = 0; l < ncols; ++l ) {
+      const double v_lk = gsl_matrix_get( V, l, k ) / s_k;
+      for ( size_t i = 0; i < nrows; ++i ) {
+        *gsl_matrix_ptr( pinv, l, i ) += v_lk * gsl_matrix_get( A, i, k );
+      }
+    }
+  }
+
+  // Allocate Chebyshev-coefficient representation
+  XLAL_CHECK_FAIL( ( cheb = XLALCalloc( 1, sizeof( *cheb ) ) ) != NULL, XLAL_ENOMEM );
+  cheb->order = order;
+  cheb->granule = granule;
+  const UINT4 ngranulesE = ( edat->nentriesE - 1 + granule - 1 ) / granule;
+  const UINT4 ngranulesS = ( edat->nentriesS - 1 + granule - 1 ) / granule;
+  cheb->alloc = XLALMalloc( ( ngranulesE + ngranulesS ) * EPHEM_CHEB_RECORD( order ) * sizeof( *cheb->alloc ) );
+  XLAL_CHECK_FAIL( cheb->alloc != NULL, XLAL_ENOMEM );
+
+  // Fit Chebyshev coefficients to Earth and Sun ephemeris tables
+  FitEphemerisChebyshevBody( &cheb->earth, cheb->alloc, edat->ephemE, edat->nentriesE, edat->dtEtable, pinv, order, granule );
+  FitEphemerisChebyshevBody( &cheb->sun, cheb->alloc + ngranulesE * EPHEM_CHEB_RECORD( order ), edat->ephemS, edat->nentriesS, edat->dtStable, pinv, order, granule );
+
+  // Replace any existing Chebyshev-coefficient representation
+  DestroyEphemerisChebyshev( edat->cheb );
+  edat->cheb = cheb;
+  cheb = NULL;
+
+  retn = XLAL_SUCCESS;
+
+XLAL_FAIL:
+  // Cleanup
+  if ( A ) {
+    gsl_matrix_free( A );
+  }
+  if ( V ) {
+    gsl_matrix_free( V );
+  }
+  if ( S ) {
+    gsl_vector_free( S );
+  }
+  if ( work ) {
+    gsl_vector_free( work );
+  }
+  if ( pinv ) {
+    gsl_matrix_free( pinv );
+  }
+  DestroyEphemerisChebyshev( cheb );
+
+  return retn;
+
+} /* XLALFitEphemerisDataChebyshev() */
+
+
+/**
+ * Write the Earth and Sun ephemerides in \p edat to a binary ephemeris file,
+ * which can subsequently be loaded by XLALInitBarycenter(). The file contains
+ * both the ephemeris tables and their Chebyshev-coefficient representation;
+ * the latter is fitted with XLALFitEphemerisDataChebyshev() if not already
+ * present in \p edat.
+ *
+ * Binary ephemeris files are written in the byte order of the writing machine,
+ * and are intended as a fast-loading local cache of the text ephemeris files.
+ *
+ * \ingroup LALBarycenter_h
+ */
+int XLALWriteEphemerisDataBinary( const CHAR *fname, const EphemerisData *edat )
+{
+
+  // Check input
+  XLAL_CHECK( fname != NULL, XLAL_EFAULT );
+  XLAL_CHECK( edat != NULL, XLAL_EFAULT );
+  XLAL_CHECK( edat->ephemE != NULL && edat->ephemS != NULL, XLAL_EINVAL );
+
+  // Fit Chebyshev coefficients to a shallow copy of 'edat', if needed
+  EphemerisData edat_cheb = *edat;
+  if ( edat_cheb.cheb == NULL ) {
+    XLAL_CHECK( XLALFitEphemerisDataChebyshev( &edat_cheb ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+  const EphemerisChebyshev *cheb = edat_cheb.cheb;
+
+  // Fill header
+  EphemerisBinaryHeader header;
+  memset( &header, 0, sizeof( header ) );
+  memcpy( header.magic, EPHEM_BINARY_MAGIC, sizeof( header.magic ) );
+  header.version = EPHEM_BINARY_VERSION;
+  header.endian = EPHEM_BINARY_ENDIAN;
+  header.etype = edat->etype;
+  header.order = cheb->order;
+  header.granule = cheb->granule;
+  header.nentriesE = edat->nentriesE;
+  header.nentriesS = edat->nentriesS;
+  header.ngranulesE = cheb->earth.ngranules;
+  header.ngranulesS = cheb->sun.ngranules;
+  header.dtEtable = edat->dtEtable;
+  header.dtStable = edat->dtStable;
+  header.tstartE = cheb->earth.tstart;
+  header.tstartS = cheb->sun.tstart;
+  header.spanE = cheb->earth.span;
+  header.spanS = cheb->sun.span;
+
+  // Write header, ephemeris tables, and Chebyshev coefficients
+  const size_t reclen = EPHEM_CHEB_RECORD( cheb->order );
+  int errnum = 0;
+  FILE *fp = fopen( fname, "wb" );
+  if ( fp == NULL ) {
+    errnum = errno;
+  } else {
+    if ( fwrite( &header, sizeof( header ), 1, fp ) != 1
+         || fwrite( edat->ephemE, sizeof( *edat->ephemE ), edat->nentriesE, fp ) != ( size_t ) edat->nentriesE
+         || fwrite( edat->ephemS, sizeof( *edat->ephemS ), edat->nentriesS, fp ) != ( size_t ) edat->nentriesS
+         || fwrite( cheb->earth.coeffs, sizeof( REAL8 ), cheb->earth.ngranules * reclen, fp ) != cheb->earth.ngranules * reclen
+         || fwrite( cheb->sun.coeffs, sizeof( REAL8 ), cheb->sun.ngranules * reclen, fp ) != cheb->sun.ngranules * reclen ) {
+      errnum = errno;
+    }
+    if ( fclose( fp ) != 0 && errnum == 0 ) {
+      errnum = errno;
+    }
+  }
+
+  // Cleanup
+  if ( edat->cheb == NULL ) {
+    DestroyEphemerisChebyshev( edat_cheb.cheb );
+  }
+
+  XLAL_CHECK( fp != NULL, XLAL_EIO, "Failed to open '%s' for writing: %s", fname, strerror( errnum ) );
+  XLAL_CHECK( errnum == 0, XLAL_EIO, "Failed to write '%s': %s", fname, strerror( errnum ) );
+
+  return XLAL_SUCCESS;
+
+} /* XLALWriteEphemerisDataBinary() */
+
+
 /* ========== internal function definitions ========== */
 
 /** simple creator function for EphemerisVector type */
@@ -453,6 +708,170 @@ XLALDestroyEphemerisVector( EphemerisVector *ephemV )
 
 } /* XLALDestroyEphemerisVector() */
 
+/**
+ * Load a binary ephemeris file written by XLALWriteEphemerisDataBinary().
+ * The file is memory-mapped; the ephemeris tables are copied into the returned
+ * \a EphemerisData, while the Chebyshev coefficients are used in place.
+ */
+static EphemerisData *
+ReadEphemerisBinary( const CHAR *fname )
+{
+  /* check input consistency */
+  XLAL_CHECK_NULL( fname != NULL, XLAL_EINVAL );
+
+  // resolve path to binary ephemeris file
+  char *fname_path = XLAL_FILE_RESOLVE_PATH( fname );
+  XLAL_CHECK_NULL( fname_path != NULL, XLAL_EINVAL, "Failed to find binary ephemeris-file '%s'\n", fname );
+
+  // memory-map binary ephemeris file
+  const int fd = open( fname_path, O_RDONLY );
+  XLALFree( fname_path );
+  XLAL_CHECK_NULL( fd >= 0, XLAL_EIO, "Failed to open '%s': %s\n", fname, strerror( errno ) );
+  struct stat st;
+  if ( fstat( fd, &st ) != 0 || ( size_t ) st.st_size < sizeof( EphemerisBinaryHeader ) ) {
+    close( fd );
+    XLAL_ERROR_NULL( XLAL_EINVAL, "'%s' is not a binary ephemeris-file\n", fname );
+  }
+  const size_t map_size = st.st_size;
+  void *map = mmap( NULL, map_size, PROT_READ, MAP_SHARED, fd, 0 );
+  close( fd );
+  XLAL_CHECK_NULL( map != MAP_FAILED, XLAL_EIO, "Failed to memory-map '%s': %s\n", fname, strerror( errno ) );
+
+  // prepare output ephemeris struct, which takes ownership of the memory map
+  EphemerisData *edat = XLALCalloc( 1, sizeof( *edat ) );
+  if ( edat == NULL ) {
+    munmap( map, map_size );
+    XLAL_ERROR_NULL( XLAL_ENOMEM, "XLALCalloc ( 1, %zu ) failed.\n", sizeof( *edat ) );
+  }
+  EphemerisChebyshev *cheb = XLALCalloc( 1, sizeof( *cheb ) );
+  if ( cheb == NULL ) {
+    XLALFree( edat );
+    munmap( map, map_size );
+    XLAL_ERROR_NULL( XLAL_ENOMEM, "XLALCalloc ( 1, %zu ) failed.\n", sizeof( *cheb ) );
+  }
+  cheb->map = map;
+  cheb->map_size = map_size;
+  edat->cheb = cheb;
+
+  // check header
+  const EphemerisBinaryHeader *header = map;
+  XLAL_CHECK_FAIL( memcmp( header->magic, EPHEM_BINARY_MAGIC, sizeof( header->magic ) ) == 0, XLAL_EINVAL, "'%s' is not a binary ephemeris-file\n", fname );
+  XLAL_CHECK_FAIL( header->endian == EPHEM_BINARY_ENDIAN, XLAL_EINVAL, "Binary ephemeris-file '%s' was written on a machine with different byte order\n", fname );
+  XLAL_CHECK_FAIL( header->version == EPHEM_BINARY_VERSION, XLAL_EINVAL, "Binary ephemeris-file '%s' has unsupported version %u\n", fname, header->version );
+  XLAL_CHECK_FAIL( 1 <= header->order && header->order <= EPHEM_CHEB_MAX_ORDER && header->granule > 0, XLAL_EDOM, "Invalid Chebyshev order %u or granule %u in '%s'\n", header->order, header->granule, fname );
+  XLAL_CHECK_FAIL( header->nentriesE > 0 && header->nentriesS > 0 && header->ngranulesE > 0 && header->ngranulesS > 0, XLAL_EDOM, "Invalid number of entries in '%s'\n", fname );
+  const size_t reclen = EPHEM_CHEB_RECORD( header->order );
+  const size_t expect_size = sizeof( *header )
+                             + ( ( size_t ) header->nentriesE + header->nentriesS ) * sizeof( PosVelAcc )
+                             + ( ( size_t ) header->ngranulesE + header->ngranulesS ) * reclen * sizeof( REAL8 );
+  XLAL_CHECK_FAIL( map_size == expect_size, XLAL_EIO, "Binary ephemeris-file '%s' has size %zu, expected %zu\n", fname, map_size, expect_size );
+
+  // copy ephemeris tables; these may subsequently be modified, e.g. by XLALRestrictEphemerisData()
+  const PosVelAcc *ephemE = ( const PosVelAcc * )( header + 1 );
+  const PosVelAcc *ephemS = ephemE + header->nentriesE;
+  edat->nentriesE = header->nentriesE;
+  edat->nentriesS = header->nentriesS;
+  edat->dtEtable = header->dtEtable;
+  edat->dtStable = header->dtStable;
+  edat->etype = header->etype;
+  XLAL_CHECK_FAIL( ( edat->ephemE = XLALMalloc( edat->nentriesE * sizeof( *edat->ephemE ) ) ) != NULL, XLAL_ENOMEM );
+  XLAL_CHECK_FAIL( ( edat->ephemS = XLALMalloc( edat->nentriesS * sizeof( *edat->ephemS ) ) ) != NULL, XLAL_ENOMEM );
+  memcpy( edat->ephemE, ephemE, edat->nentriesE * sizeof( *edat->ephemE ) );
+  memcpy( edat->ephemS, ephemS, edat->nentriesS * sizeof( *edat->ephemS ) );
+
+  // point Chebyshev coefficients into memory map
+  const REAL8 *coeffs = ( const REAL8 * )( ephemS + header->nentriesS );
+  cheb->order = header->order;
+  cheb->granule = header->granule;
+  cheb->earth.tstart = header->tstartE;
+  cheb->earth.span = header->spanE;
+  cheb->earth.ngranules = header->ngranulesE;
+  cheb->earth.coeffs = coeffs;
+  cheb->sun.tstart = header->tstartS;
+  cheb->sun.span = header->spanS;
+  cheb->sun.ngranules = header->ngranulesS;
+  cheb->sun.coeffs = coeffs + header->ngranulesE * reclen;
+
+  // store *copy* of ephemeris-file name in output structure
+  XLAL_CHECK_FAIL( ( edat->filenameE = XLALStringDuplicate( fname ) ) != NULL, XLAL_EFUNC );
+  XLAL_CHECK_FAIL( ( edat->filenameS = XLALStringDuplicate( fname ) ) != NULL, XLAL_EFUNC );
+
+  return edat;
+
+XLAL_FAIL:
+  XLALDestroyEphemerisData( edat );
+  return NULL;
+
+} /* ReadEphemerisBinary() */
+
+/**
+ * Destructor for EphemerisChebyshev, NULL robust.
+ */
+static void
+DestroyEphemerisChebyshev( EphemerisChebyshev *cheb )
+{
+  if ( !cheb ) {
+    return;
+  }
+
+  if ( cheb->alloc ) {
+    XLALFree( cheb->alloc );
+  }
+
+  if ( cheb->map ) {
+    munmap( cheb->map, cheb->map_size );
+  }
+
+  XLALFree( cheb );
+
+  return;
+
+} /* DestroyEphemerisChebyshev() */
+
+/**
+ * Fit Chebyshev coefficients to the ephemeris table of one body, given the
+ * pseudo-inverse \a pinv of the design matrix built by XLALFitEphemerisDataChebyshev().
+ * Granules are laid end-to-end from the start of the table, except that the last
+ * granule is anchored to the end of the table, and may overlap the previous granule.
+ */
+static void
+FitEphemerisChebyshevBody( EphemerisChebyshevBody *body, REAL8 *coeffs, const PosVelAcc *ephem, const INT4 nentries, const REAL8 dt,
+                           const gsl_matrix *pinv, const UINT4 order, const UINT4 granule )
+{
+  const UINT4 ngranules = ( nentries - 1 + granule - 1 ) / granule;
+  const size_t reclen = EPHEM_CHEB_RECORD( order ), nnodes = granule + 1;
+  const REAL8 halfspan = 0.5 * granule * dt;
+
+  body->tstart = ephem[0].gps;
+  body->span = granule * dt;
+  body->ngranules = ngranules;
+  body->coeffs = coeffs;
+
+  #pragma omp parallel for schedule(static)
+  for ( INT4 g = 0; g < ( INT4 ) ngranules; ++g ) {
+    INT4 first = g * granule;
+    if ( first + ( INT4 ) granule > nentries - 1 ) {
+      first = nentries - 1 - granule;
+    }
+    REAL8 *rec = coeffs + g * reclen;
+    rec[0] = ephem[first].gps + halfspan;
+    for ( UINT4 j = 0; j < 3; ++j ) {
+      REAL8 *c = rec + 1 + j * ( order + 1 );
+      for ( UINT4 k = 0; k <= order; ++k ) {
+        REAL8 sum = 0;
+        for ( size_t i = 0; i < nnodes; ++i ) {
+          const PosVelAcc *e = &ephem[first + i];
+          sum += gsl_matrix_get( pinv, k, i ) * e->pos[j];
+          sum += gsl_matrix_get( pinv, k, nnodes + i ) * e->vel[j] * halfspan;
+          sum += gsl_matrix_get( pinv, k, 2 * nnodes + i ) * e->acc[j] * halfspan * halfspan;
+        }
+        c[k] = sum;
+      }
+    }
+  }
+
+} /* FitEphemerisChebyshevBody() */
+
 
 /** \cond DONT_DOXYGEN */
 /* Simple wrapper to XLAL_FILE_RESOLVE_PATH(), using hardcoded fallbackdir for LALPulsar
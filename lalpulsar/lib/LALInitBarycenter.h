@@ -34,6 +34,9 @@ void XLALDestroyEphemerisData( EphemerisData *edat );
 
 int XLALRestrictEphemerisData( EphemerisData *edat, const LIGOTimeGPS *startGPS, const LIGOTimeGPS *endGPS );
 
+int XLALFitEphemerisDataChebyshev( EphemerisData *edat );
+int XLALWriteEphemerisDataBinary( const CHAR *fname, const EphemerisData *edat );
+
 TimeCorrectionData *XLALInitTimeCorrections( const CHAR *timeCorrectionFile );
 void XLALDestroyTimeCorrectionData( TimeCorrectionData *tcd );
 
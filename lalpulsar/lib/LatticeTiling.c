@@ -26,6 +26,7 @@
 
 #include <lal/LatticeTiling.h>
 #include <lal/LALStdio.h>
+#include <lal/LALConstants.h>
 #include <lal/LogPrintf.h>
 #include <lal/LALHashFunc.h>
 #include <lal/MetricUtils.h>
@@ -43,6 +44,12 @@
 // Number of cached values which can be stored per dimension
 #define LT_CACHE_MAX_SIZE 6
 
+// Minimum number of points for which to find nearest points in parallel
+#define LT_PARALLEL_MIN_POINTS 256
+
+// Maximum number of rounded cubic lattice coordinates stored on the stack when finding nearest points
+#define LT_CUBIC_NEAREST_STACK_SIZE 256
+
 // Determine if parameter-space bound has strict padding
 #define STRICT_BOUND_PADDING( b ) \
   ( ( (b)->lower_bbox_pad == 0 ) && ( (b)->upper_bbox_pad == 0 ) && ( (b)->lower_intp_pad == 0 ) && ( (b)->upper_intp_pad == 0 ) )
@@ -132,6 +139,9 @@ struct tagLatticeTilingIterator {
   INT4 *int_upper;                      ///< Current upper parameter-space bound in generating integers
   INT4 *direction;                      ///< Direction of iteration in each tiled parameter-space dimension
   UINT8 index;                          ///< Index of current lattice tiling point
+  const LatticeTilingLocator *loc;      ///< Lattice tiling locator used to seek to the first point of a shard
+  UINT8 index_begin;                    ///< Index of first lattice tiling point to iterate over
+  UINT8 index_end;                      ///< Index of one past the last lattice tiling point to iterate over
 };
 
 struct tagLatticeTilingLocator {
@@ -511,6 +521,243 @@ static void LT_PrintIndexTrie(
 
 }
 
+///
+/// Find the nearest point in a lattice tiling to the point in column 'j' of 'nearest_points', which
+/// has been transformed to generating integers, and return the outputs of LT_FindNearestPoints() for
+/// this point. For the cubic lattice, 'cubic_nearest' gives the nearest points in Zn, found by
+/// rounding all points in each tiled dimension. Only column 'j' of 'nearest_points' is accessed.
+///
+static int LT_FindNearestPoint(
+  const LatticeTilingLocator *loc,      ///< [in] Lattice tiling locator
+  gsl_matrix *nearest_points,           ///< [in/out] Columns are set of points in generating integers, replaced by nearest points
+  const size_t j,                       ///< [in] Column of point for which to find nearest point
+  const INT4 *cubic_nearest,            ///< [in] Nearest points in Zn, stored by tiled dimension
+  UINT8VectorSequence *nearest_indexes, ///< [out] Vectors are unique sequential indexes of the nearest points
+  INT4VectorSequence *nearest_lefts,    ///< [out] Vectors are indexes of left-most points of blocks relative to nearest points
+  INT4VectorSequence *nearest_rights    ///< [out] Vectors are indexes of right-most points of blocks relative to nearest points
+)
+{
+
+  const size_t n = loc->ndim;
+  const size_t tn = loc->tiled_ndim;
+  const size_t num_points = nearest_points->size2;
+
+  // If there are tiled dimensions:
+  INT4 nearest[n];
+  if ( tn > 0 ) {
+
+    // Find the nearest point to 'nearest_points[:,j]', the tiled dimensions of which are generating integers
+    switch ( loc->tiling->lattice ) {
+
+    case TILING_LATTICE_CUBIC:    // Cubic ( \f$ Z_n \f$ ) lattice
+
+    {
+
+      // Nearest point in Zn has been found by rounding each dimension in LT_FindNearestPoints()
+      for ( size_t ti = 0; ti < tn; ++ti ) {
+        const size_t i = loc->tiling->tiled_idx[ti];
+        nearest[i] = cubic_nearest[ti * num_points + j];
+      }
+
+    }
+    break;
+
+    case TILING_LATTICE_ANSTAR:   // An-star ( \f$ A_n^* \f$ ) lattice
+
+    {
+
+      // The nearest point algorithm used below embeds the An* lattice in tn+1 dimensions,
+      // however 'nearest_points[:,j]' has only 'tn' tiled dimensional. The algorithm is only
+      // sensitive to the differences between the 'ti'th and 'ti+1'th dimension, so we can
+      // freely set one of the dimensions to a constant value. We choose to set the 0th
+      // dimension to zero, i.e. the (tn+1)-dimensional lattice point is
+      //   y = (0, tiled dimensions of 'nearest_points[:,j]').
+      double y[tn + 1];
+      y[0] = 0;
+      for ( size_t ti = 0; ti < tn; ++ti ) {
+        const size_t i = loc->tiling->tiled_idx[ti];
+        y[ti + 1] = gsl_matrix_get( nearest_points, i, j );
+      }
+
+      // Find the nearest point in An* to the point 'y', using the O(tn) Algorithm 2 given in:
+      //   McKilliam et.al., "A linear-time nearest point algorithm for the lattice An*"
+      //   in "International Symposium on Information Theory and Its Applications", ISITA2008,
+      //   Auckland, New Zealand, 7-10 Dec. 2008. DOI: 10.1109/ISITA.2008.4895596
+      // Notes:
+      //   * Since Algorithm 2 uses 1-based arrays, we have to translate, e.g.:
+      //       z_t in paper <---> z[tn-1] in C code
+      //   * Line 6 in Algorithm 2 as written in the paper is in error, see correction below.
+      //   * We are only interested in 'k', the generating integers of the nearest point
+      //     'x = Q * k', therefore line 26 in Algorithm 2 is not included.
+      INT4 k[tn + 1];
+      {
+
+        // Lines 1--4, 20
+        double z[tn + 1], alpha = 0, beta = 0;
+        size_t bucket[tn + 1], link[tn + 1];
+        feclearexcept( FE_ALL_EXCEPT );
+        for ( size_t ti = 1; ti <= tn + 1; ++ti ) {
+          k[ti - 1] = lround( y[ti - 1] ); // Line 20, moved here to avoid duplicate round
+          z[ti - 1] = y[ti - 1] - k[ti - 1];
+          alpha += z[ti - 1];
+          beta += z[ti - 1] * z[ti - 1];
+          bucket[ti - 1] = 0;
+        }
+        if ( fetestexcept( FE_INVALID ) != 0 ) {
+          XLALPrintError( "Rounding failed while finding nearest point #%zu:", j );
+          for ( size_t ti = 1; ti <= tn + 1; ++ti ) {
+            XLALPrintError( " %0.2e", y[ti - 1] );
+          }
+          XLALPrintError( "\n" );
+          XLAL_ERROR( XLAL_EFAILED );
+        }
+
+        // Lines 5--8
+        // Notes:
+        //   * Correction to line 6, as as written in McKilliam et.al.:
+        //       ti = tn + 1 - (tn + 1)*floor(z_t + 0.5)
+        //     should instead read
+        //       ti = tn + 1 - floor((tn + 1)*(z_t + 0.5))
+        //   * We also convert the floor() operation into an lround():
+        //       ti = tn + 1 - lround((tn + 1)*(z_t + 0.5) - 0.5)
+        //     to avoid a casting operation. Rewriting the line as:
+        //       ti = lround((tn + 1)*(0.5 - z_t) + 0.5)
+        //     appears to improve numerical robustness in some cases.
+        //   * No floating-point exception checking needed for lround()
+        //     here since its argument will be of order 'tn'.
+        for ( size_t tt = 1; tt <= tn + 1; ++tt ) {
+          const INT4 ti = lround( ( tn + 1 ) * ( 0.5 - z[tt - 1] ) + 0.5 );
+          link[tt - 1] = bucket[ti - 1];
+          bucket[ti - 1] = tt;
+        }
+
+        // Lines 9--10
+        double D = beta - alpha * alpha / ( tn + 1 );
+        size_t tm = 0;
+
+        // Lines 11--19
+        for ( size_t ti = 1; ti <= tn + 1; ++ti ) {
+          size_t tt = bucket[ti - 1];
+          while ( tt != 0 ) {
+            alpha = alpha - 1;
+            beta = beta - 2 * z[tt - 1] + 1;
+            tt = link[tt - 1];
+          }
+          double d = beta - alpha * alpha / ( tn + 1 );
+          if ( d < D ) {
+            D = d;
+            tm = ti;
+          }
+        }
+
+        // Lines 21--25
+        for ( size_t ti = 1; ti <= tm; ++ti ) {
+          size_t tt = bucket[ti - 1];
+          while ( tt != 0 ) {
+            k[tt - 1] = k[tt - 1] + 1;
+            tt = link[tt - 1];
+          }
+        }
+
+      }
+
+      // The nearest point in An* is the tn differences between k[1]...k[tn] and k[0]
+      for ( size_t ti = 0; ti < tn; ++ti ) {
+        const size_t i = loc->tiling->tiled_idx[ti];
+        nearest[i] = k[ti + 1] - k[0];
+      }
+
+    }
+    break;
+
+    default:
+      XLAL_ERROR( XLAL_EFAILED, "Invalid lattice" );
+    }
+
+    // Bound generating integers
+    {
+      const LT_IndexTrie *trie = loc->index_trie;
+      size_t ti = 0;
+      while ( ti < tn ) {
+        const size_t i = loc->tiling->tiled_idx[ti];
+
+        // If 'nearest[i]' is outside parameter-space bounds:
+        if ( nearest[i] < trie->int_lower || nearest[i] > trie->int_upper ) {
+          XLALPrintInfo( "%s: failed %" LAL_INT4_FORMAT " <= %" LAL_INT4_FORMAT " <= %" LAL_INT4_FORMAT " in dimension #%zu\n",
+                         __func__, trie->int_lower, nearest[i], trie->int_upper, i );
+
+          // Find the nearest point within the parameter-space bounds of the lattice tiling
+          gsl_vector_view point_int_view = gsl_matrix_column( nearest_points, j );
+          INT4 poll_nearest[n];
+          double poll_min_distance = GSL_POSINF;
+          feclearexcept( FE_ALL_EXCEPT );
+          LT_PollIndexTrie( loc->tiling, loc->index_trie, 0, &point_int_view.vector, poll_nearest, &poll_min_distance, nearest );
+          XLAL_CHECK( fetestexcept( FE_INVALID ) == 0, XLAL_EFAILED, "Rounding failed while calling LT_PollIndexTrie() for nearest point #%zu", j );
+
+          // Reset 'trie', given that 'nearest' may have changed in any dimension
+          trie = loc->index_trie;
+          ti = 0;
+          continue;
+
+        }
+
+        // If we are below the highest dimension, jump to the next dimension based on 'nearest[i]'
+        if ( ti + 1 < tn ) {
+          trie = &trie->next[nearest[i] - trie->int_lower];
+        }
+
+        ++ti;
+
+      }
+    }
+
+  }
+
+  // Return various outputs
+  {
+    const LT_IndexTrie *trie = loc->index_trie;
+    UINT8 nearest_index = 0;
+    for ( size_t ti = 0, i = 0; i < n; ++i ) {
+      const bool is_tiled = loc->tiling->bounds[i].is_tiled;
+
+      // Return nearest point
+      if ( is_tiled ) {
+        gsl_matrix_set( nearest_points, i, j, nearest[i] );
+      }
+
+      // Return sequential indexes of nearest point
+      // - Non-tiled dimensions inherit value of next-lowest dimension
+      if ( is_tiled ) {
+        nearest_index = trie->index + nearest[i] - trie->int_lower;
+      }
+      if ( nearest_indexes != NULL ) {
+        nearest_indexes->data[n * j + i] = nearest_index;
+      }
+
+      // Return indexes of left/right-most points in block relative to nearest point
+      if ( nearest_lefts != NULL ) {
+        nearest_lefts->data[n * j + i] = is_tiled ? trie->int_lower - nearest[i] : 0;
+      }
+      if ( nearest_rights != NULL ) {
+        nearest_rights->data[n * j + i] = is_tiled ? trie->int_upper - nearest[i] : 0;
+      }
+
+      // If we are below the highest dimension, jump to the next dimension based on 'nearest[i]'
+      if ( is_tiled ) {
+        if ( ti + 1 < tn ) {
+          trie = &trie->next[nearest[i] - trie->int_lower];
+        }
+        ++ti;
+      }
+
+    }
+  }
+
+
+  return XLAL_SUCCESS;
+
+}
+
 ///
 /// Locate the nearest points in a lattice tiling to a given set of points. Return the nearest
 /// points in 'nearest_points', and optionally: unique sequential indexes to the nearest points in
@@ -550,257 +797,332 @@ static int LT_FindNearestPoints(
   }
   gsl_blas_dtrmm( CblasLeft, CblasLower, CblasNoTrans, CblasNonUnit, 1.0, loc->tiling->int_from_phys, nearest_points );
 
+  // For the cubic lattice, round each tiled dimension of 'nearest_points' to the nearest integer to
+  // find the nearest points in Zn; rows of 'nearest_points' are contiguous, so all points are rounded
+  // together, one dimension at a time
+  // - Small sets of points, e.g. single points queried by XLALWeaveCacheQuery(), use stack storage,
+  //   so that nothing is allocated in the common case
+  INT4 cubic_nearest_stack[LT_CUBIC_NEAREST_STACK_SIZE];
+  INT4 *cubic_nearest_heap = NULL;
+  INT4 *cubic_nearest = NULL;
+  if ( tn > 0 && loc->tiling->lattice == TILING_LATTICE_CUBIC ) {
+    if ( tn * num_points <= XLAL_NUM_ELEM( cubic_nearest_stack ) ) {
+      cubic_nearest = cubic_nearest_stack;
+    } else {
+      cubic_nearest = cubic_nearest_heap = XLALMalloc( tn * num_points * sizeof( *cubic_nearest ) );
+      XLAL_CHECK( cubic_nearest != NULL, XLAL_ENOMEM );
+    }
+    for ( size_t ti = 0; ti < tn; ++ti ) {
+      const size_t i = loc->tiling->tiled_idx[ti];
+      const double *nearest_points_i = gsl_matrix_const_ptr( nearest_points, i, 0 );
+      INT4 *cubic_nearest_ti = &cubic_nearest[ti * num_points];
+      feclearexcept( FE_ALL_EXCEPT );
+      for ( size_t j = 0; j < num_points; ++j ) {
+        cubic_nearest_ti[j] = lround( nearest_points_i[j] );
+      }
+      if ( fetestexcept( FE_INVALID ) != 0 ) {
+        XLALFree( cubic_nearest_heap );
+        XLAL_ERROR( XLAL_EFAILED, "Rounding failed while finding nearest points in dimension #%zu", i );
+      }
+    }
+  }
+
   // Find the nearest points in the lattice tiling to the points in 'nearest_points'
+  // - Each point only accesses its own column of 'nearest_points', so large sets of points are
+  //   divided between threads
+  int errflag = 0;
+  #pragma omp parallel for schedule(static) if ( num_points >= LT_PARALLEL_MIN_POINTS )
   for ( size_t j = 0; j < num_points; ++j ) {
+    if ( LT_FindNearestPoint( loc, nearest_points, j, cubic_nearest, nearest_indexes, nearest_lefts, nearest_rights ) != XLAL_SUCCESS ) {
+      #pragma omp atomic write
+      errflag = 1;
+    }
+  }
+  XLALFree( cubic_nearest_heap );
+  XLAL_CHECK( errflag == 0, XLAL_EFUNC );
 
-    // If there are tiled dimensions:
-    INT4 nearest[n];
-    if ( tn > 0 ) {
+  // Transform 'nearest_points' from generating integers to physical coordinates
+  gsl_blas_dtrmm( CblasLeft, CblasLower, CblasNoTrans, CblasNonUnit, 1.0, loc->tiling->phys_from_int, nearest_points );
+  for ( size_t i = 0; i < n; ++i ) {
+    const double phys_origin = gsl_vector_get( loc->tiling->phys_origin, i );
+    gsl_vector_view nearest_points_row = gsl_matrix_row( nearest_points, i );
+    gsl_vector_add_constant( &nearest_points_row.vector, phys_origin );
+  }
 
-      // Find the nearest point to 'nearest_points[:,j]', the tiled dimensions of which are generating integers
-      switch ( loc->tiling->lattice ) {
+  // Create local cache for computing physical bounds
+  double local_cache_array[n * LT_CACHE_MAX_SIZE];
+  gsl_matrix_view local_cache_view = gsl_matrix_view_array( local_cache_array, n, LT_CACHE_MAX_SIZE );
+  gsl_matrix *local_cache = &local_cache_view.matrix;
+  gsl_matrix_set_all( local_cache, GSL_NAN );
 
-      case TILING_LATTICE_CUBIC:    // Cubic ( \f$ Z_n \f$ ) lattice
+  // Set any non-tiled dimensions in 'nearest_points'
+  for ( size_t j = 0; j < num_points; ++j ) {
+    gsl_vector_view nearest_points_col = gsl_matrix_column( nearest_points, j );
+    for ( size_t i = 0; i < n; ++i ) {
+      double phys_point = gsl_vector_get( &nearest_points_col.vector, i );
+      if ( !loc->tiling->bounds[i].is_tiled ) {
+        LT_CallBoundFunc( loc->tiling, i, local_cache, &nearest_points_col.vector, &phys_point, NULL );
+      }
+      LT_SetPhysPoint( loc->tiling, local_cache, &nearest_points_col.vector, i, phys_point );
+    }
+  }
 
-      {
+  return XLAL_SUCCESS;
 
-        // Round each dimension of 'nearest_points[:,j]' to nearest integer to find the nearest point in Zn
-        feclearexcept( FE_ALL_EXCEPT );
-        for ( size_t ti = 0; ti < tn; ++ti ) {
-          const size_t i = loc->tiling->tiled_idx[ti];
-          nearest[i] = lround( gsl_matrix_get( nearest_points, i, j ) );
-        }
-        if ( fetestexcept( FE_INVALID ) != 0 ) {
-          XLALPrintError( "Rounding failed while finding nearest point #%zu:", j );
-          for ( size_t ti = 0; ti < tn; ++ti ) {
-            const size_t i = loc->tiling->tiled_idx[ti];
-            XLALPrintError( " %0.2e", gsl_matrix_get( nearest_points, i, j ) );
-          }
-          XLALPrintError( "\n" );
-          XLAL_ERROR( XLAL_EFAILED );
-        }
+}
 
-      }
-      break;
+///
+/// Reset the parameter-space bounds of a lattice tiling iterator in tiled dimensions 'reset_ti' and
+/// higher, and recompute its current point in tiled dimensions 'changed_ti' and higher. If given,
+/// iterated-over dimensions are set to the generating integers in 'seek_int_point' instead of to
+/// their lower/upper bounds.
+///
+static int LT_ResetIteratorPoint(
+  LatticeTilingIterator *itr,           ///< [in] Lattice tiling iterator
+  const size_t changed_ti,              ///< [in] Index of first tiled dimension to have changed
+  const size_t reset_ti,                ///< [in] Index of first tiled dimension to be reset
+  const INT4 *seek_int_point            ///< [in] Optional generating integers to seek to in iterated-over dimensions
+)
+{
 
-      case TILING_LATTICE_ANSTAR:   // An-star ( \f$ A_n^* \f$ ) lattice
+  const size_t n = itr->tiling->ndim;
+  const size_t tn = itr->tiling->tiled_ndim;
 
-      {
+  for ( size_t i = 0, ti = 0; i < n; ++i ) {
 
-        // The nearest point algorithm used below embeds the An* lattice in tn+1 dimensions,
-        // however 'nearest_points[:,j]' has only 'tn' tiled dimensional. The algorithm is only
-        // sensitive to the differences between the 'ti'th and 'ti+1'th dimension, so we can
-        // freely set one of the dimensions to a constant value. We choose to set the 0th
-        // dimension to zero, i.e. the (tn+1)-dimensional lattice point is
-        //   y = (0, tiled dimensions of 'nearest_points[:,j]').
-        double y[tn + 1];
-        y[0] = 0;
-        for ( size_t ti = 0; ti < tn; ++ti ) {
-          const size_t i = loc->tiling->tiled_idx[ti];
-          y[ti + 1] = gsl_matrix_get( nearest_points, i, j );
-        }
+    // Get bound information for this dimension
+    const LT_Bound *bound = &itr->tiling->bounds[i];
 
-        // Find the nearest point in An* to the point 'y', using the O(tn) Algorithm 2 given in:
-        //   McKilliam et.al., "A linear-time nearest point algorithm for the lattice An*"
-        //   in "International Symposium on Information Theory and Its Applications", ISITA2008,
-        //   Auckland, New Zealand, 7-10 Dec. 2008. DOI: 10.1109/ISITA.2008.4895596
-        // Notes:
-        //   * Since Algorithm 2 uses 1-based arrays, we have to translate, e.g.:
-        //       z_t in paper <---> z[tn-1] in C code
-        //   * Line 6 in Algorithm 2 as written in the paper is in error, see correction below.
-        //   * We are only interested in 'k', the generating integers of the nearest point
-        //     'x = Q * k', therefore line 26 in Algorithm 2 is not included.
-        INT4 k[tn + 1];
-        {
-
-          // Lines 1--4, 20
-          double z[tn + 1], alpha = 0, beta = 0;
-          size_t bucket[tn + 1], link[tn + 1];
-          feclearexcept( FE_ALL_EXCEPT );
-          for ( size_t ti = 1; ti <= tn + 1; ++ti ) {
-            k[ti - 1] = lround( y[ti - 1] ); // Line 20, moved here to avoid duplicate round
-            z[ti - 1] = y[ti - 1] - k[ti - 1];
-            alpha += z[ti - 1];
-            beta += z[ti - 1] * z[ti - 1];
-            bucket[ti - 1] = 0;
-          }
-          if ( fetestexcept( FE_INVALID ) != 0 ) {
-            XLALPrintError( "Rounding failed while finding nearest point #%zu:", j );
-            for ( size_t ti = 1; ti <= tn + 1; ++ti ) {
-              XLALPrintError( " %0.2e", y[ti - 1] );
-            }
-            XLALPrintError( "\n" );
-            XLAL_ERROR( XLAL_EFAILED );
-          }
+    // Get physical parameter-space origin in the current dimension
+    const double phys_origin_i = gsl_vector_get( itr->tiling->phys_origin, i );
 
-          // Lines 5--8
-          // Notes:
-          //   * Correction to line 6, as as written in McKilliam et.al.:
-          //       ti = tn + 1 - (tn + 1)*floor(z_t + 0.5)
-          //     should instead read
-          //       ti = tn + 1 - floor((tn + 1)*(z_t + 0.5))
-          //   * We also convert the floor() operation into an lround():
-          //       ti = tn + 1 - lround((tn + 1)*(z_t + 0.5) - 0.5)
-          //     to avoid a casting operation. Rewriting the line as:
-          //       ti = lround((tn + 1)*(0.5 - z_t) + 0.5)
-          //     appears to improve numerical robustness in some cases.
-          //   * No floating-point exception checking needed for lround()
-          //     here since its argument will be of order 'tn'.
-          for ( size_t tt = 1; tt <= tn + 1; ++tt ) {
-            const INT4 ti = lround( ( tn + 1 ) * ( 0.5 - z[tt - 1] ) + 0.5 );
-            link[tt - 1] = bucket[ti - 1];
-            bucket[ti - 1] = tt;
-          }
+    // If not tiled, set current physical point to non-tiled parameter-space bound
+    if ( !bound->is_tiled && ti >= reset_ti ) {
+      double phys_lower = 0, phys_upper = 0;
+      LT_CallBoundFunc( itr->tiling, i, itr->phys_point_cache, itr->phys_point, &phys_lower, &phys_upper );
+      LT_SetPhysPoint( itr->tiling, itr->phys_point_cache, itr->phys_point, i, phys_lower );
+    }
 
-          // Lines 9--10
-          double D = beta - alpha * alpha / ( tn + 1 );
-          size_t tm = 0;
+    // If tiled, reset parameter-space bounds
+    if ( bound->is_tiled && ti >= reset_ti ) {
 
-          // Lines 11--19
-          for ( size_t ti = 1; ti <= tn + 1; ++ti ) {
-            size_t tt = bucket[ti - 1];
-            while ( tt != 0 ) {
-              alpha = alpha - 1;
-              beta = beta - 2 * z[tt - 1] + 1;
-              tt = link[tt - 1];
-            }
-            double d = beta - alpha * alpha / ( tn + 1 );
-            if ( d < D ) {
-              D = d;
-              tm = ti;
-            }
-          }
+      // Find the parameter-space bounds on the current dimension
+      gsl_vector_memcpy( itr->phys_sampl, itr->phys_point );
+      double phys_lower = GSL_POSINF, phys_upper = GSL_NEGINF;
+      if ( STRICT_BOUND_PADDING( bound ) || !bound->find_bound_extrema ) {
+        LT_CallBoundFunc( itr->tiling, i, itr->phys_point_cache, itr->phys_sampl, &phys_lower, &phys_upper );
+      } else {
+        LT_FindBoundExtrema( itr->tiling, 0, i, itr->phys_sampl_cache, itr->phys_sampl, &phys_lower, &phys_upper );
+      }
 
-          // Lines 21--25
-          for ( size_t ti = 1; ti <= tm; ++ti ) {
-            size_t tt = bucket[ti - 1];
-            while ( tt != 0 ) {
-              k[tt - 1] = k[tt - 1] + 1;
-              tt = link[tt - 1];
-            }
-          }
+      // Add padding of a multiple of the extext of the metric ellipse bounding box, if requested
+      {
+        const double phys_bbox_i = gsl_vector_get( itr->tiling->phys_bbox, i );
+        phys_lower -= bound->lower_bbox_pad * phys_bbox_i;
+        phys_upper += bound->upper_bbox_pad * phys_bbox_i;
+      }
 
-        }
+      // Transform physical point in lower dimensions to generating integer offset
+      double int_from_phys_point_i = 0;
+      for ( size_t j = 0; j < i; ++j ) {
+        const double int_from_phys_i_j = gsl_matrix_get( itr->tiling->int_from_phys, i, j );
+        const double phys_point_j = gsl_vector_get( itr->phys_point, j );
+        const double phys_origin_j = gsl_vector_get( itr->tiling->phys_origin, j );
+        int_from_phys_point_i += int_from_phys_i_j * ( phys_point_j - phys_origin_j );
+      }
 
-        // The nearest point in An* is the tn differences between k[1]...k[tn] and k[0]
-        for ( size_t ti = 0; ti < tn; ++ti ) {
-          const size_t i = loc->tiling->tiled_idx[ti];
-          nearest[i] = k[ti + 1] - k[0];
-        }
+      {
+        // Transform physical bounds to generating integers
+        const double int_from_phys_i_i = gsl_matrix_get( itr->tiling->int_from_phys, i, i );
+        const double dbl_int_lower_i = int_from_phys_point_i + int_from_phys_i_i * ( phys_lower - phys_origin_i );
+        const double dbl_int_upper_i = int_from_phys_point_i + int_from_phys_i_i * ( phys_upper - phys_origin_i );
+
+        // Compute integer lower/upper bounds, rounded up/down to avoid extra boundary points
+        feclearexcept( FE_ALL_EXCEPT );
+        const INT4 int_lower_i = lround( ceil( dbl_int_lower_i ) );
+        const INT4 int_upper_i = lround( floor( dbl_int_upper_i ) );
+        XLAL_CHECK( fetestexcept( FE_INVALID ) == 0, XLAL_EFAILED, "Integer bounds on dimension #%zu are too large: %0.2e to %0.2e", i, dbl_int_lower_i, dbl_int_upper_i );
 
+        // Set integer lower/upper bounds
+        itr->int_lower[ti] = int_lower_i;
+        itr->int_upper[ti] = GSL_MAX( int_lower_i, int_upper_i );
+
+        // Add padding as a multiple of integer points, if requested
+        itr->int_lower[ti] -= bound->lower_intp_pad;
+        itr->int_upper[ti] += bound->upper_intp_pad;
       }
-      break;
+      const INT4 int_lower_i = itr->int_lower[ti];
+      const INT4 int_upper_i = itr->int_upper[ti];
+
+      // Get iteration direction
+      INT4 direction = itr->direction[ti];
 
-      default:
-        XLAL_ERROR( XLAL_EFAILED, "Invalid lattice" );
+      // Only switch iteration direction:
+      // - if this is an alternating iterator
+      // - if iterator is in progress
+      // - for iterated-over dimensions
+      // - if there is more than one point in this dimension
+      if ( itr->alternating && ( itr->state > 0 ) && ( ti < itr->tiled_itr_ndim ) && ( int_lower_i < int_upper_i ) ) {
+        direction = -direction;
+        itr->direction[ti] = direction;
       }
 
-      // Bound generating integers
-      {
-        const LT_IndexTrie *trie = loc->index_trie;
-        size_t ti = 0;
-        while ( ti < tn ) {
-          const size_t i = loc->tiling->tiled_idx[ti];
-
-          // If 'nearest[i]' is outside parameter-space bounds:
-          if ( nearest[i] < trie->int_lower || nearest[i] > trie->int_upper ) {
-            XLALPrintInfo( "%s: failed %" LAL_INT4_FORMAT " <= %" LAL_INT4_FORMAT " <= %" LAL_INT4_FORMAT " in dimension #%zu\n",
-                           __func__, trie->int_lower, nearest[i], trie->int_upper, i );
-
-            // Find the nearest point within the parameter-space bounds of the lattice tiling
-            gsl_vector_view point_int_view = gsl_matrix_column( nearest_points, j );
-            INT4 poll_nearest[n];
-            double poll_min_distance = GSL_POSINF;
-            feclearexcept( FE_ALL_EXCEPT );
-            LT_PollIndexTrie( loc->tiling, loc->index_trie, 0, &point_int_view.vector, poll_nearest, &poll_min_distance, nearest );
-            XLAL_CHECK( fetestexcept( FE_INVALID ) == 0, XLAL_EFAILED, "Rounding failed while calling LT_PollIndexTrie() for nearest point #%zu", j );
-
-            // Reset 'trie', given that 'nearest' may have changed in any dimension
-            trie = loc->index_trie;
-            ti = 0;
-            continue;
+      // Set integer point to:
+      // - seek point, if given, for iterated-over dimensions
+      // - lower or upper bound (depending on current direction) for iterated-over dimensions
+      // - mid-point of integer bounds for non-iterated dimensions
+      if ( ti < itr->tiled_itr_ndim && seek_int_point != NULL ) {
+        XLAL_CHECK( int_lower_i <= seek_int_point[ti] && seek_int_point[ti] <= int_upper_i, XLAL_EFAILED, "Seek point %i on dimension #%zu is outside integer bounds %i to %i", seek_int_point[ti], i, int_lower_i, int_upper_i );
+        itr->int_point[ti] = seek_int_point[ti];
+      } else if ( ti < itr->tiled_itr_ndim ) {
+        itr->int_point[ti] = ( direction > 0 ) ? int_lower_i : int_upper_i;
+      } else {
+        itr->int_point[ti] = ( int_lower_i + int_upper_i ) / 2;
+      }
 
-          }
+    }
 
-          // If we are below the highest dimension, jump to the next dimension based on 'nearest[i]'
-          if ( ti + 1 < tn ) {
-            trie = &trie->next[nearest[i] - trie->int_lower];
-          }
+    // If tiled, recompute current physical point from integer point
+    if ( bound->is_tiled && ti >= changed_ti ) {
+      double phys_point_i = phys_origin_i;
+      for ( size_t tj = 0; tj < tn; ++tj ) {
+        const size_t j = itr->tiling->tiled_idx[tj];
+        const double phys_from_int_i_j = gsl_matrix_get( itr->tiling->phys_from_int, i, j );
+        const INT4 int_point_tj = itr->int_point[tj];
+        phys_point_i += phys_from_int_i_j * int_point_tj;
+      }
+      LT_SetPhysPoint( itr->tiling, itr->phys_point_cache, itr->phys_point, i, phys_point_i );
+    }
 
-          ++ti;
+    // Handle strict parameter space boundaries
+    if ( STRICT_BOUND_PADDING( bound ) && ti >= changed_ti ) {
 
-        }
+      // Get current physical point and bounds
+      double phys_point_i = gsl_vector_get( itr->phys_point, i );
+      double phys_lower = 0, phys_upper = 0;
+      LT_CallBoundFunc( itr->tiling, i, itr->phys_point_cache, itr->phys_point, &phys_lower, &phys_upper );
+
+      // If physical point outside lower bound, try to move just inside
+      if ( phys_point_i < phys_lower ) {
+        const double phys_from_int_i_i = gsl_matrix_get( itr->tiling->phys_from_int, i, i );
+        const INT4 di = lround( ceil( ( phys_lower - phys_point_i ) / phys_from_int_i_i ) );
+        itr->int_point[ti] += di;
+        phys_point_i += phys_from_int_i_i * di;
+      }
+
+      // If physical point now outside upper bound, parameter space is narrower than step size:
+      // - Set physical point to mid-point of parameter space bounds
+      // - Set integer point to upper bound, so that next iteration will reset
+      if ( phys_point_i > phys_upper ) {
+        phys_point_i = 0.5 * ( phys_lower + phys_upper );
+        itr->int_point[ti] = itr->int_upper[ti];
       }
 
+      // Set physical point
+      LT_SetPhysPoint( itr->tiling, itr->phys_point_cache, itr->phys_point, i, phys_point_i );
+
     }
 
-    // Return various outputs
-    {
-      const LT_IndexTrie *trie = loc->index_trie;
-      UINT8 nearest_index = 0;
-      for ( size_t ti = 0, i = 0; i < n; ++i ) {
-        const bool is_tiled = loc->tiling->bounds[i].is_tiled;
+    // Increment tiled dimension index
+    if ( bound->is_tiled ) {
+      ++ti;
+    }
 
-        // Return nearest point
-        if ( is_tiled ) {
-          gsl_matrix_set( nearest_points, i, j, nearest[i] );
-        }
+  }
 
-        // Return sequential indexes of nearest point
-        // - Non-tiled dimensions inherit value of next-lowest dimension
-        if ( is_tiled ) {
-          nearest_index = trie->index + nearest[i] - trie->int_lower;
-        }
-        if ( nearest_indexes != NULL ) {
-          nearest_indexes->data[n * j + i] = nearest_index;
-        }
+  return XLAL_SUCCESS;
 
-        // Return indexes of left/right-most points in block relative to nearest point
-        if ( nearest_lefts != NULL ) {
-          nearest_lefts->data[n * j + i] = is_tiled ? trie->int_lower - nearest[i] : 0;
-        }
-        if ( nearest_rights != NULL ) {
-          nearest_rights->data[n * j + i] = is_tiled ? trie->int_upper - nearest[i] : 0;
-        }
+}
 
-        // If we are below the highest dimension, jump to the next dimension based on 'nearest[i]'
-        if ( is_tiled ) {
-          if ( ti + 1 < tn ) {
-            trie = &trie->next[nearest[i] - trie->int_lower];
-          }
-          ++ti;
-        }
+///
+/// Return the sequential index of the first point in the subtree of an index trie, counting
+/// points up to tiled dimension 'ti_end'.
+///
+static UINT8 LT_IndexTrieFirstIndex(
+  const LT_IndexTrie *trie,             ///< [in] Lattice tiling index trie
+  const size_t ti,                      ///< [in] Current depth of the trie
+  const size_t ti_end                   ///< [in] Depth of the trie at which indexes are counted
+)
+{
+  for ( size_t tj = ti; tj < ti_end; ++tj ) {
+    trie = &trie->next[0];
+  }
+  return trie->index;
+}
+
+///
+/// Find the generating integers of the point with sequential index 'index' in a lattice tiling
+/// iterated up to tiled dimension 'ti_end', by descending a lattice tiling index trie. At each depth
+/// of the trie, the child containing the point is found by binary search.
+///
+static int LT_SeekIndexTrie(
+  const LT_IndexTrie *trie,             ///< [in] Lattice tiling index trie
+  const size_t ti_end,                  ///< [in] Depth of the trie at which indexes are counted
+  const UINT8 index,                    ///< [in] Sequential index of point to find
+  INT4 *seek_int_point                  ///< [out] Generating integers of point
+)
+{
+
+  for ( size_t ti = 0; ti < ti_end; ++ti ) {
 
+    // Find the last child whose first point has an index no greater than 'index'
+    size_t lo = 0, hi = trie->int_upper - trie->int_lower;
+    while ( lo < hi ) {
+      const size_t mid = lo + ( hi - lo + 1 ) / 2;
+      if ( LT_IndexTrieFirstIndex( &trie->next[mid], ti + 1, ti_end ) <= index ) {
+        lo = mid;
+      } else {
+        hi = mid - 1;
       }
     }
+    seek_int_point[ti] = trie->int_lower + ( INT4 ) lo;
+    trie = &trie->next[lo];
 
   }
 
-  // Transform 'nearest_points' from generating integers to physical coordinates
-  gsl_blas_dtrmm( CblasLeft, CblasLower, CblasNoTrans, CblasNonUnit, 1.0, loc->tiling->phys_from_int, nearest_points );
-  for ( size_t i = 0; i < n; ++i ) {
-    const double phys_origin = gsl_vector_get( loc->tiling->phys_origin, i );
-    gsl_vector_view nearest_points_row = gsl_matrix_row( nearest_points, i );
-    gsl_vector_add_constant( &nearest_points_row.vector, phys_origin );
+  // Point lies in the block of points in the last dimension
+  XLAL_CHECK( trie->index <= index && index - trie->index <= ( UINT8 )( trie->int_upper - trie->int_lower ), XLAL_EDOM, "Index %" LAL_UINT8_FORMAT " is outside lattice tiling", index );
+  seek_int_point[ti_end] = trie->int_lower + ( INT4 )( index - trie->index );
+
+  return XLAL_SUCCESS;
+
+}
+
+///
+/// Move a lattice tiling iterator to the point with sequential index 'index', using the index trie
+/// of a lattice tiling locator.
+///
+static int LT_SeekIterator(
+  LatticeTilingIterator *itr,           ///< [in] Lattice tiling iterator
+  const LatticeTilingLocator *loc,      ///< [in] Lattice tiling locator
+  const UINT8 index                     ///< [in] Sequential index of point to seek to
+)
+{
+
+  const size_t tn = itr->tiling->tiled_ndim;
+
+  // Find generating integers of point in iterated-over dimensions
+  INT4 seek_int_point[GSL_MAX( tn, 1 )];
+  if ( itr->tiled_itr_ndim > 0 ) {
+    XLAL_CHECK( loc->index_trie != NULL, XLAL_EFAULT );
+    XLAL_CHECK( LT_SeekIndexTrie( loc->index_trie, itr->tiled_itr_ndim - 1, index, seek_int_point ) == XLAL_SUCCESS, XLAL_EFUNC );
+  } else {
+    XLAL_CHECK( index == 0, XLAL_EDOM, "Index %" LAL_UINT8_FORMAT " is outside lattice tiling", index );
+  }
+
+  // Initialise lattice point and iteration direction
+  gsl_vector_set_zero( itr->phys_point );
+  for ( size_t ti = 0; ti < tn; ++ti ) {
+    itr->int_point[ti] = 0;
+    itr->direction[ti] = 1;
   }
 
-  // Create local cache for computing physical bounds
-  double local_cache_array[n * LT_CACHE_MAX_SIZE];
-  gsl_matrix_view local_cache_view = gsl_matrix_view_array( local_cache_array, n, LT_CACHE_MAX_SIZE );
-  gsl_matrix *local_cache = &local_cache_view.matrix;
-  gsl_matrix_set_all( local_cache, GSL_NAN );
+  // Recompute parameter-space bounds and physical point in all dimensions
+  XLAL_CHECK( LT_ResetIteratorPoint( itr, 0, 0, seek_int_point ) == XLAL_SUCCESS, XLAL_EFUNC );
 
-  // Set any non-tiled dimensions in 'nearest_points'
-  for ( size_t j = 0; j < num_points; ++j ) {
-    gsl_vector_view nearest_points_col = gsl_matrix_column( nearest_points, j );
-    for ( size_t i = 0; i < n; ++i ) {
-      double phys_point = gsl_vector_get( &nearest_points_col.vector, i );
-      if ( !loc->tiling->bounds[i].is_tiled ) {
-        LT_CallBoundFunc( loc->tiling, i, local_cache, &nearest_points_col.vector, &phys_point, NULL );
-      }
-      LT_SetPhysPoint( loc->tiling, local_cache, &nearest_points_col.vector, i, phys_point );
-    }
-  }
+  // Iterator is in progress at the given point
+  itr->index = index;
+  itr->state = 1;
 
   return XLAL_SUCCESS;
 
@@ -1757,6 +2079,9 @@ LatticeTilingIterator *XLALCreateLatticeTilingIterator(
   itr->alternating = false;
   itr->state = 0;
   itr->index = 0;
+  itr->loc = NULL;
+  itr->index_begin = 0;
+  itr->index_end = LAL_UINT8_MAX;
 
   // Determine the maximum tiled dimension to iterate over
   itr->tiled_itr_ndim = 0;
@@ -1826,6 +2151,38 @@ int XLALSetLatticeTilingAlternatingIterator(
 
 }
 
+int XLALSetLatticeTilingIteratorShard(
+  LatticeTilingIterator *itr,
+  const LatticeTilingLocator *loc,
+  const UINT4 nshards,
+  const UINT4 shard
+)
+{
+
+  // Check input
+  XLAL_CHECK( itr != NULL, XLAL_EFAULT );
+  XLAL_CHECK( itr->state == 0, XLAL_EINVAL );
+  XLAL_CHECK( !itr->alternating, XLAL_EINVAL, "Alternating iterators cannot be sharded" );
+  XLAL_CHECK( loc != NULL, XLAL_EFAULT );
+  XLAL_CHECK( loc->tiling == itr->tiling, XLAL_EINVAL );
+  XLAL_CHECK( nshards > 0, XLAL_EINVAL );
+  XLAL_CHECK( shard < nshards, XLAL_EINVAL );
+
+  // Get total number of points covered by the iterator
+  const UINT8 total = XLALTotalLatticeTilingPoints( itr );
+  XLAL_CHECK( total > 0, XLAL_EFUNC );
+
+  // Divide points between shards, such that shard sizes differ by at most one point
+  const UINT8 shard_size = total / nshards;
+  const UINT8 shard_rem = total % nshards;
+  itr->loc = loc;
+  itr->index_begin = shard * shard_size + GSL_MIN( shard, shard_rem );
+  itr->index_end = itr->index_begin + shard_size + ( shard < shard_rem ? 1 : 0 );
+
+  return XLAL_SUCCESS;
+
+}
+
 int XLALResetLatticeTilingIterator(
   LatticeTilingIterator *itr
 )
@@ -1851,14 +2208,27 @@ int XLALNextLatticeTilingPoint(
   XLAL_CHECK( itr != NULL, XLAL_EFAULT );
   XLAL_CHECK( point == NULL || point->size == itr->tiling->ndim, XLAL_EINVAL );
 
-  const size_t n = itr->tiling->ndim;
   const size_t tn = itr->tiling->tiled_ndim;
 
-  // If iterator is finished, we're done
-  if ( itr->state > 1 ) {
+  // If iterator is finished, or has reached the end of its shard, we're done
+  if ( itr->state > 1 || ( itr->state == 1 && itr->index + 1 >= itr->index_end ) ) {
+    itr->state = 2;
     return 0;
   }
 
+  // If iterator has been initialised to a shard which starts after the first point, seek to its first point
+  if ( itr->state == 0 && itr->index_begin > 0 ) {
+    if ( itr->index_begin >= itr->index_end ) {
+      itr->state = 2;
+      return 0;
+    }
+    XLAL_CHECK( LT_SeekIterator( itr, itr->loc, itr->index_begin ) == XLAL_SUCCESS, XLAL_EFUNC );
+    if ( point != NULL ) {
+      gsl_vector_memcpy( point, itr->phys_point );
+    }
+    return 1;
+  }
+
   // Which dimensions have changed?
   size_t changed_ti;
 
@@ -1942,143 +2312,7 @@ int XLALNextLatticeTilingPoint(
   }
 
   // Reset parameter-space bounds and recompute physical point
-  for ( size_t i = 0, ti = 0; i < n; ++i ) {
-
-    // Get bound information for this dimension
-    const LT_Bound *bound = &itr->tiling->bounds[i];
-
-    // Get physical parameter-space origin in the current dimension
-    const double phys_origin_i = gsl_vector_get( itr->tiling->phys_origin, i );
-
-    // If not tiled, set current physical point to non-tiled parameter-space bound
-    if ( !bound->is_tiled && ti >= reset_ti ) {
-      double phys_lower = 0, phys_upper = 0;
-      LT_CallBoundFunc( itr->tiling, i, itr->phys_point_cache, itr->phys_point, &phys_lower, &phys_upper );
-      LT_SetPhysPoint( itr->tiling, itr->phys_point_cache, itr->phys_point, i, phys_lower );
-    }
-
-    // If tiled, reset parameter-space bounds
-    if ( bound->is_tiled && ti >= reset_ti ) {
-
-      // Find the parameter-space bounds on the current dimension
-      gsl_vector_memcpy( itr->phys_sampl, itr->phys_point );
-      double phys_lower = GSL_POSINF, phys_upper = GSL_NEGINF;
-      if ( STRICT_BOUND_PADDING( bound ) || !bound->find_bound_extrema ) {
-        LT_CallBoundFunc( itr->tiling, i, itr->phys_point_cache, itr->phys_sampl, &phys_lower, &phys_upper );
-      } else {
-        LT_FindBoundExtrema( itr->tiling, 0, i, itr->phys_sampl_cache, itr->phys_sampl, &phys_lower, &phys_upper );
-      }
-
-      // Add padding of a multiple of the extext of the metric ellipse bounding box, if requested
-      {
-        const double phys_bbox_i = gsl_vector_get( itr->tiling->phys_bbox, i );
-        phys_lower -= bound->lower_bbox_pad * phys_bbox_i;
-        phys_upper += bound->upper_bbox_pad * phys_bbox_i;
-      }
-
-      // Transform physical point in lower dimensions to generating integer offset
-      double int_from_phys_point_i = 0;
-      for ( size_t j = 0; j < i; ++j ) {
-        const double int_from_phys_i_j = gsl_matrix_get( itr->tiling->int_from_phys, i, j );
-        const double phys_point_j = gsl_vector_get( itr->phys_point, j );
-        const double phys_origin_j = gsl_vector_get( itr->tiling->phys_origin, j );
-        int_from_phys_point_i += int_from_phys_i_j * ( phys_point_j - phys_origin_j );
-      }
-
-      {
-        // Transform physical bounds to generating integers
-        const double int_from_phys_i_i = gsl_matrix_get( itr->tiling->int_from_phys, i, i );
-        const double dbl_int_lower_i = int_from_phys_point_i + int_from_phys_i_i * ( phys_lower - phys_origin_i );
-        const double dbl_int_upper_i = int_from_phys_point_i + int_from_phys_i_i * ( phys_upper - phys_origin_i );
-
-        // Compute integer lower/upper bounds, rounded up/down to avoid extra boundary points
-        feclearexcept( FE_ALL_EXCEPT );
-        const INT4 int_lower_i = lround( ceil( dbl_int_lower_i ) );
-        const INT4 int_upper_i = lround( floor( dbl_int_upper_i ) );
-        XLAL_CHECK( fetestexcept( FE_INVALID ) == 0, XLAL_EFAILED, "Integer bounds on dimension #%zu are too large: %0.2e to %0.2e", i, dbl_int_lower_i, dbl_int_upper_i );
-
-        // Set integer lower/upper bounds
-        itr->int_lower[ti] = int_lower_i;
-        itr->int_upper[ti] = GSL_MAX( int_lower_i, int_upper_i );
-
-        // Add padding as a multiple of integer points, if requested
-        itr->int_lower[ti] -= bound->lower_intp_pad;
-        itr->int_upper[ti] += bound->upper_intp_pad;
-      }
-      const INT4 int_lower_i = itr->int_lower[ti];
-      const INT4 int_upper_i = itr->int_upper[ti];
-
-      // Get iteration direction
-      INT4 direction = itr->direction[ti];
-
-      // Only switch iteration direction:
-      // - if this is an alternating iterator
-      // - if iterator is in progress
-      // - for iterated-over dimensions
-      // - if there is more than one point in this dimension
-      if ( itr->alternating && ( itr->state > 0 ) && ( ti < itr->tiled_itr_ndim ) && ( int_lower_i < int_upper_i ) ) {
-        direction = -direction;
-        itr->direction[ti] = direction;
-      }
-
-      // Set integer point to:
-      // - lower or upper bound (depending on current direction) for iterated-over dimensions
-      // - mid-point of integer bounds for non-iterated dimensions
-      if ( ti < itr->tiled_itr_ndim ) {
-        itr->int_point[ti] = ( direction > 0 ) ? int_lower_i : int_upper_i;
-      } else {
-        itr->int_point[ti] = ( int_lower_i + int_upper_i ) / 2;
-      }
-
-    }
-
-    // If tiled, recompute current physical point from integer point
-    if ( bound->is_tiled && ti >= changed_ti ) {
-      double phys_point_i = phys_origin_i;
-      for ( size_t tj = 0; tj < tn; ++tj ) {
-        const size_t j = itr->tiling->tiled_idx[tj];
-        const double phys_from_int_i_j = gsl_matrix_get( itr->tiling->phys_from_int, i, j );
-        const INT4 int_point_tj = itr->int_point[tj];
-        phys_point_i += phys_from_int_i_j * int_point_tj;
-      }
-      LT_SetPhysPoint( itr->tiling, itr->phys_point_cache, itr->phys_point, i, phys_point_i );
-    }
-
-    // Handle strict parameter space boundaries
-    if ( STRICT_BOUND_PADDING( bound ) && ti >= changed_ti ) {
-
-      // Get current physical point and bounds
-      double phys_point_i = gsl_vector_get( itr->phys_point, i );
-      double phys_lower = 0, phys_upper = 0;
-      LT_CallBoundFunc( itr->tiling, i, itr->phys_point_cache, itr->phys_point, &phys_lower, &phys_upper );
-
-      // If physical point outside lower bound, try to move just inside
-      if ( phys_point_i < phys_lower ) {
-        const double phys_from_int_i_i = gsl_matrix_get( itr->tiling->phys_from_int, i, i );
-        const INT4 di = lround( ceil( ( phys_lower - phys_point_i ) / phys_from_int_i_i ) );
-        itr->int_point[ti] += di;
-        phys_point_i += phys_from_int_i_i * di;
-      }
-
-      // If physical point now outside upper bound, parameter space is narrower than step size:
-      // - Set physical point to mid-point of parameter space bounds
-      // - Set integer point to upper bound, so that next iteration will reset
-      if ( phys_point_i > phys_upper ) {
-        phys_point_i = 0.5 * ( phys_lower + phys_upper );
-        itr->int_point[ti] = itr->int_upper[ti];
-      }
-
-      // Set physical point
-      LT_SetPhysPoint( itr->tiling, itr->phys_point_cache, itr->phys_point, i, phys_point_i );
-
-    }
-
-    // Increment tiled dimension index
-    if ( bound->is_tiled ) {
-      ++ti;
-    }
-
-  }
+  XLAL_CHECK( LT_ResetIteratorPoint( itr, changed_ti, reset_ti, NULL ) == XLAL_SUCCESS, XLAL_EFUNC );
 
   // Iterator is in progress
   itr->state = 1;
@@ -2128,6 +2362,34 @@ int XLALNextLatticeTilingPoints(
 
 }
 
+int XLALSeekLatticeTilingIterator(
+  LatticeTilingIterator *itr,
+  const LatticeTilingLocator *loc,
+  const UINT8 index,
+  gsl_vector *point
+)
+{
+
+  // Check input
+  XLAL_CHECK( itr != NULL, XLAL_EFAULT );
+  XLAL_CHECK( !itr->alternating, XLAL_EINVAL, "Alternating iterators cannot seek" );
+  XLAL_CHECK( loc != NULL, XLAL_EFAULT );
+  XLAL_CHECK( loc->tiling == itr->tiling, XLAL_EINVAL );
+  XLAL_CHECK( itr->index_begin <= index && index < itr->index_end, XLAL_EDOM, "Index %" LAL_UINT8_FORMAT " is outside iterator range", index );
+  XLAL_CHECK( point == NULL || point->size == itr->tiling->ndim, XLAL_EINVAL );
+
+  // Move iterator to point
+  XLAL_CHECK( LT_SeekIterator( itr, loc, index ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  // Optionally, copy current physical point
+  if ( point != NULL ) {
+    gsl_vector_memcpy( point, itr->phys_point );
+  }
+
+  return XLAL_SUCCESS;
+
+}
+
 UINT8 XLALTotalLatticeTilingPoints(
   const LatticeTilingIterator *itr
 )
@@ -2176,6 +2438,31 @@ UINT8 XLALCurrentLatticeTilingIndex(
 
 }
 
+int XLALLatticeTilingIteratorRange(
+  const LatticeTilingIterator *itr,
+  UINT8 *index_begin,
+  UINT8 *index_end
+)
+{
+
+  // Check input
+  XLAL_CHECK( itr != NULL, XLAL_EFAULT );
+  XLAL_CHECK( index_begin != NULL, XLAL_EFAULT );
+  XLAL_CHECK( index_end != NULL, XLAL_EFAULT );
+
+  // Return range of indexes, which is the whole lattice tiling if iterator is not sharded
+  *index_begin = itr->index_begin;
+  if ( itr->index_end < LAL_UINT8_MAX ) {
+    *index_end = itr->index_end;
+  } else {
+    *index_end = XLALTotalLatticeTilingPoints( itr );
+    XLAL_CHECK( *index_end > 0, XLAL_EFUNC );
+  }
+
+  return XLAL_SUCCESS;
+
+}
+
 int XLALCurrentLatticeTilingBlock(
   const LatticeTilingIterator *itr,
   const size_t dim,
@@ -2355,6 +2642,7 @@ int XLALRestoreLatticeTilingIterator(
     UINT8 indx;
     XLAL_CHECK( XLALFITSHeaderReadUINT8( file, "index", &indx ) == XLAL_SUCCESS, XLAL_EFUNC );
     XLAL_CHECK( indx < count_ref, XLAL_EIO, "Could not restore iterator; invalid HDU '%s'", name );
+    XLAL_CHECK( itr->index_begin <= indx && indx < itr->index_end, XLAL_EIO, "Could not restore iterator; index %" LAL_UINT8_FORMAT " is outside iterator range", indx );
     itr->index = indx;
   }
 
@@ -2683,6 +2971,83 @@ int XLALNearestLatticeTilingBlock(
 
 }
 
+int XLALNearestLatticeTilingBlocks(
+  const LatticeTilingLocator *loc,
+  const gsl_matrix *points,
+  const size_t dim,
+  gsl_matrix **nearest_points,
+  UINT8Vector **nearest_indexes,
+  INT4Vector **nearest_lefts,
+  INT4Vector **nearest_rights
+)
+{
+
+  // Check input
+  XLAL_CHECK( loc != NULL, XLAL_EFAULT );
+  XLAL_CHECK( points != NULL, XLAL_EFAULT );
+  XLAL_CHECK( points->size1 == loc->ndim, XLAL_EINVAL );
+  XLAL_CHECK( dim < loc->ndim, XLAL_EINVAL );
+  XLAL_CHECK( nearest_points != NULL, XLAL_EFAULT );
+  XLAL_CHECK( nearest_indexes != NULL, XLAL_EFAULT );
+  XLAL_CHECK( nearest_lefts != NULL, XLAL_EFAULT );
+  XLAL_CHECK( nearest_rights != NULL, XLAL_EFAULT );
+
+  const size_t n = loc->ndim;
+  const size_t num_points = points->size2;
+
+  // Resize or allocate nearest points matrix, if required, and create view of correct size
+  if ( *nearest_points != NULL ) {
+    if ( ( *nearest_points )->size1 != n || ( *nearest_points )->size2 < num_points ) {
+      GFMAT( *nearest_points );
+      *nearest_points = NULL;
+    }
+  }
+  if ( *nearest_points == NULL ) {
+    GAMAT( *nearest_points, n, num_points );
+  }
+  gsl_matrix_view nearest_points_view = gsl_matrix_submatrix( *nearest_points, 0, 0, n, num_points );
+
+  // Resize or allocate nearest block index and left/right-most point vectors, if required
+  if ( *nearest_indexes == NULL || ( *nearest_indexes )->length < num_points ) {
+    *nearest_indexes = XLALResizeUINT8Vector( *nearest_indexes, num_points );
+    XLAL_CHECK( *nearest_indexes != NULL, XLAL_ENOMEM );
+  }
+  if ( *nearest_lefts == NULL || ( *nearest_lefts )->length < num_points ) {
+    *nearest_lefts = XLALResizeINT4Vector( *nearest_lefts, num_points );
+    XLAL_CHECK( *nearest_lefts != NULL, XLAL_ENOMEM );
+  }
+  if ( *nearest_rights == NULL || ( *nearest_rights )->length < num_points ) {
+    *nearest_rights = XLALResizeINT4Vector( *nearest_rights, num_points );
+    XLAL_CHECK( *nearest_rights != NULL, XLAL_ENOMEM );
+  }
+
+  // Create vector sequences for sequential indexes and number of left/right points in all dimensions
+  UINT8VectorSequence *all_indexes = XLALCreateUINT8VectorSequence( num_points, n );
+  XLAL_CHECK( all_indexes != NULL, XLAL_ENOMEM );
+  INT4VectorSequence *all_lefts = XLALCreateINT4VectorSequence( num_points, n );
+  XLAL_CHECK( all_lefts != NULL, XLAL_ENOMEM );
+  INT4VectorSequence *all_rights = XLALCreateINT4VectorSequence( num_points, n );
+  XLAL_CHECK( all_rights != NULL, XLAL_ENOMEM );
+
+  // Call LT_FindNearestPoints()
+  XLAL_CHECK( LT_FindNearestPoints( loc, points, &nearest_points_view.matrix, all_indexes, all_lefts, all_rights ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  // Return sequential indexes in dimension 'dim-1', and number of left/right points in dimension 'dim'
+  for ( size_t j = 0; j < num_points; ++j ) {
+    ( *nearest_indexes )->data[j] = ( dim > 0 ) ? all_indexes->data[n * j + dim - 1] : 0;
+    ( *nearest_lefts )->data[j] = all_lefts->data[n * j + dim];
+    ( *nearest_rights )->data[j] = all_rights->data[n * j + dim];
+  }
+
+  // Cleanup
+  XLALDestroyUINT8VectorSequence( all_indexes );
+  XLALDestroyINT4VectorSequence( all_lefts );
+  XLALDestroyINT4VectorSequence( all_rights );
+
+  return XLAL_SUCCESS;
+
+}
+
 int XLALPrintLatticeTilingIndexTrie(
   const LatticeTilingLocator *loc,
   FILE *file
@@ -395,6 +395,24 @@ int XLALSetLatticeTilingAlternatingIterator(
   const bool alternating                ///< [in] If true, set alternating iterator
 );
 
+///
+/// Restrict a lattice tiling iterator to one of \c nshards shards of the lattice tiling, which
+/// contain consecutive points and whose numbers of points differ by at most one. The shard sizes
+/// are determined from the point counts of XLALLatticeTilingStatistics(), and the iterator uses the
+/// index trie of \c loc to seek to the first point of its shard.
+///
+/// Shards may be iterated over independently, e.g. by different threads. Since the statistics may
+/// be computed on first use, XLALPerformLatticeTilingCallbacks() should be called on the tiling
+/// before creating iterators in different threads. The locator must not be destroyed before the
+/// iterator. Alternating iterators cannot be sharded.
+///
+int XLALSetLatticeTilingIteratorShard(
+  LatticeTilingIterator *itr,           ///< [in] Lattice tiling iterator
+  const LatticeTilingLocator *loc,      ///< [in] Lattice tiling locator
+  const UINT4 nshards,                  ///< [in] Number of shards to divide lattice tiling into
+  const UINT4 shard                     ///< [in] Index of shard to iterate over
+);
+
 ///
 /// Reset an iterator to the beginning of a lattice tiling.
 ///
@@ -425,6 +443,19 @@ int XLALNextLatticeTilingPoints(
   gsl_matrix **points                   ///< [out] Columns are next set of points in lattice tiling
 );
 
+///
+/// Move a lattice tiling iterator to the point with sequential index \c index, and optionally
+/// return this point in \c point. Subsequent calls to XLALNextLatticeTilingPoint() continue from
+/// this point. The point is found by binary search of the index trie of \c loc, which takes a time
+/// logarithmic in the number of points. Alternating iterators cannot seek.
+///
+int XLALSeekLatticeTilingIterator(
+  LatticeTilingIterator *itr,           ///< [in] Lattice tiling iterator
+  const LatticeTilingLocator *loc,      ///< [in] Lattice tiling locator
+  const UINT8 index,                    ///< [in] Sequential index of point to seek to
+  gsl_vector *point                     ///< [out] Point in lattice tiling
+);
+
 ///
 /// Return the total number of points covered by the lattice tiling iterator.
 ///
@@ -447,6 +478,16 @@ UINT8 XLALCurrentLatticeTilingIndex(
   const LatticeTilingIterator *itr      ///< [in] Lattice tiling iterator
 );
 
+///
+/// Return the range of sequential indexes of the points covered by the lattice tiling iterator,
+/// which is the whole lattice tiling unless the iterator has been restricted to a shard.
+///
+int XLALLatticeTilingIteratorRange(
+  const LatticeTilingIterator *itr,     ///< [in] Lattice tiling iterator
+  UINT8 *index_begin,                   ///< [out] Index of first point covered by iterator
+  UINT8 *index_end                      ///< [out] Index of one past the last point covered by iterator
+);
+
 ///
 /// Return indexes of the left-most and right-most points in the current block of points in the
 /// given dimension, relative to the current point.
@@ -537,6 +578,31 @@ int XLALNearestLatticeTilingBlock(
   INT4 *nearest_right                   ///< [out] Index of right-most point of block relative to nearest point
 );
 
+///
+/// Locate the nearest blocks in a lattice tiling to a given set of points. For each column of
+/// \c points, return the same outputs as XLALNearestLatticeTilingBlock(), i.e. the nearest point in
+/// \c nearest_points, the unique sequential index in dimension <tt>dim-1</tt> in \c nearest_indexes,
+/// and the indexes of the left-most and right-most points in the nearest block, relative to the
+/// nearest point, in \c nearest_lefts and \c nearest_rights. All points are located in a single
+/// pass, which is considerably faster than repeated calls to XLALNearestLatticeTilingBlock(); large
+/// sets of points are divided between threads if OpenMP is enabled. Outputs are dynamically resized
+/// as required.
+///
+#ifdef SWIG // SWIG interface directives
+SWIGLAL( INOUT_STRUCTS( gsl_matrix **, nearest_points ) );
+SWIGLAL( INOUT_STRUCTS( UINT8Vector **, nearest_indexes ) );
+SWIGLAL( INOUT_STRUCTS( INT4Vector **, nearest_lefts, nearest_rights ) );
+#endif
+int XLALNearestLatticeTilingBlocks(
+  const LatticeTilingLocator *loc,      ///< [in] Lattice tiling locator
+  const gsl_matrix *points,             ///< [in] Columns are set of points for which to find nearest points
+  const size_t dim,                     ///< [in] Dimension for which to return indexes
+  gsl_matrix **nearest_points,          ///< [out] Columns are the corresponding nearest points
+  UINT8Vector **nearest_indexes,        ///< [out] Unique sequential indexes of the nearest points in <tt>dim-1</tt>
+  INT4Vector **nearest_lefts,           ///< [out] Indexes of left-most points of blocks relative to nearest points
+  INT4Vector **nearest_rights           ///< [out] Indexes of right-most points of blocks relative to nearest points
+);
+
 ///
 /// Print the internal index trie of a lattice tiling locator to the given file pointer.
 ///
@@ -128,23 +128,41 @@ XLALNormalizeSFTVect( SFTVector  *sftVect,              /**< [in/out] pointer to
   /* memory allocation of rngmed using length of first sft -- assume all sfts have the same length*/
   UINT4 lengthsft = sftVect->data->data->length;
 
-  /* allocate memory for a single rngmed */
-  REAL8FrequencySeries *rngmed;
-  XLAL_CHECK( ( rngmed = XLALCalloc( 1, sizeof( *rngmed ) ) ) != NULL, XLAL_ENOMEM, "Failed to XLALCalloc(1,%zu)", sizeof( *rngmed ) );
-  XLAL_CHECK( ( rngmed->data = XLALCreateREAL8Vector( lengthsft ) ) != NULL, XLAL_EFUNC, "XLALCreateREAL8Vector ( %d ) failed.", lengthsft );
+  /* SFTs are normalized independently, so divide them between threads */
+  int errflag = 0;
+  #pragma omp parallel
+  {
+
+    /* allocate memory for a single rngmed for each thread */
+    REAL8FrequencySeries XLAL_INIT_DECL( rngmed );
+    if ( ( rngmed.data = XLALCreateREAL8Vector( lengthsft ) ) == NULL ) {
+      XLALPrintError( "%s: XLALCreateREAL8Vector ( %d ) failed.\n", __func__, lengthsft );
+      #pragma omp atomic write
+      errflag = 1;
+    }
+
+    /* loop over sfts and normalize them */
+    #pragma omp for schedule(dynamic)
+    for ( UINT4 j = 0; j < sftVect->length; j++ ) {
+      if ( errflag ) {
+        continue;
+      }
+      SFTtype *sft = &sftVect->data[j];
 
-  /* loop over sfts and normalize them */
-  for ( UINT4 j = 0; j < sftVect->length; j++ ) {
-    SFTtype *sft = &sftVect->data[j];
+      /* call sft normalization function */
+      if ( XLALNormalizeSFT( &rngmed, sft, blockSize, assumeSqrtS ) != XLAL_SUCCESS ) {
+        XLALPrintError( "%s: XLALNormalizeSFT() failed.\n", __func__ );
+        #pragma omp atomic write
+        errflag = 1;
+      }
 
-    /* call sft normalization function */
-    XLAL_CHECK( XLALNormalizeSFT( rngmed, sft, blockSize, assumeSqrtS ) == XLAL_SUCCESS, XLAL_EFUNC, "XLALNormalizeSFT() failed." );
+    } /* for j < sftVect->length */
 
-  } /* for j < sftVect->length */
+    /* free memory for psd */
+    XLALDestroyREAL8Vector( rngmed.data );
 
-  /* free memory for psd */
-  XLALDestroyREAL8Vector( rngmed->data );
-  XLALFree( rngmed );
+  } /* omp parallel */
+  XLAL_CHECK( errflag == 0, XLAL_EFUNC );
 
   return XLAL_SUCCESS;
 
@@ -183,20 +201,32 @@ XLALNormalizeMultiSFTVect( MultiSFTVector *multsft,             /**< [in/out] mu
     multiPSD->data[X]->length = numsft;
     XLAL_CHECK_NULL( ( multiPSD->data[X]->data = XLALCalloc( numsft, sizeof( *( multiPSD->data[X]->data ) ) ) ) != NULL, XLAL_ENOMEM, "Failed to XLALCalloc ( %d, %zu)", numsft, sizeof( *( multiPSD->data[X]->data ) ) );
 
-    /* loop over sfts for this IFO X */
+    /* memory allocation of psd vectors for each SFT */
     for ( UINT4 j = 0; j < numsft; j++ ) {
-      SFTtype *sft = &multsft->data[X]->data[j];
-
-      /* memory allocation of psd vector for this SFT */
-      UINT4 lengthsft = sft->data->length;
+      UINT4 lengthsft = multsft->data[X]->data[j].data->length;
       XLAL_CHECK_NULL( ( multiPSD->data[X]->data[j].data = XLALCreateREAL8Vector( lengthsft ) ) != NULL, XLAL_EFUNC, "XLALCreateREAL8Vector(%d) failed.", lengthsft );
+    }
+
+    /* if assumeSqrtSX is not given, pass 0.0 to calculate PSD from running median */
+    const REAL8 assumeSqrtS = ( assumeSqrtSX != NULL ) ? assumeSqrtSX->sqrtSn[X] : 0.0;
 
-      /* if assumeSqrtSX is not given, pass 0.0 to calculate PSD from running median */
-      const REAL8 assumeSqrtS = ( assumeSqrtSX != NULL ) ? assumeSqrtSX->sqrtSn[X] : 0.0;
+    /* loop over sfts for this IFO X; SFTs are normalized independently, so divide them between threads */
+    int errflag = 0;
+    #pragma omp parallel for schedule(dynamic)
+    for ( UINT4 j = 0; j < numsft; j++ ) {
+      if ( errflag ) {
+        continue;
+      }
+      SFTtype *sft = &multsft->data[X]->data[j];
 
-      XLAL_CHECK_NULL( XLALNormalizeSFT( &multiPSD->data[X]->data[j], sft, blockSize, assumeSqrtS ) == XLAL_SUCCESS, XLAL_EFUNC, "XLALNormalizeSFT() failed" );
+      if ( XLALNormalizeSFT( &multiPSD->data[X]->data[j], sft, blockSize, assumeSqrtS ) != XLAL_SUCCESS ) {
+        XLALPrintError( "%s: XLALNormalizeSFT() failed\n", __func__ );
+        #pragma omp atomic write
+        errflag = 1;
+      }
 
     } /* for j < numsft */
+    XLAL_CHECK_NULL( errflag == 0, XLAL_EFUNC );
 
   } /* for X < numifo */
 
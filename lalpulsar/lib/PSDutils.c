@@ -790,19 +790,12 @@ XLALComputePSDandNormSFTPower(
   /* allocate main output struct, using cropped length */
   XLAL_CHECK( ( *finalPSD = XLALCreateREAL8Vector( numBins ) ) != NULL, XLAL_ENOMEM, "Failed to create REAL8Vector for finalPSD." );
 
-  /* number of IFOs */
-  REAL8Vector *overIFOs = NULL; /* one frequency bin over IFOs */
-  XLAL_CHECK( ( overIFOs = XLALCreateREAL8Vector( numIFOs ) ) != NULL, XLAL_ENOMEM, "Failed to create REAL8Vector for overIFOs array." );
-
   /* maximum number of SFTs */
   UINT4 maxNumSFTs = 0;
   for ( UINT4 X = 0; X < numIFOs; ++X ) {
     maxNumSFTs = GSL_MAX( maxNumSFTs, ( *multiPSDVector )->data[X]->length );
   }
 
-  REAL8Vector *overSFTs = NULL; /* one frequency bin over SFTs */
-  XLAL_CHECK( ( overSFTs = XLALCreateREAL8Vector( maxNumSFTs ) ) != NULL, XLAL_ENOMEM, "Failed to create REAL8Vector for overSFTs array." );
-
   /* normalize rngmd(power) to get proper *single-sided* PSD: Sn = (2/Tsft) rngmed[|data|^2]] */
   REAL8 normPSD = 2.0 * dFreq;
 
@@ -821,75 +814,109 @@ XLALComputePSDandNormSFTPower(
     PSDtotalNumSFTsNormalizingFactor = XLALGetMathOpNormalizationFactorFromTotalNumberOfSFTs( totalNumSFTs, PSDmthopSFTs );
   }
 
-  XLAL_PRINT_INFO( "Computing spectrogram and PSD ..." );
-  /* loop over frequency bins in final PSD */
-  for ( UINT4 k = 0; k < numBins; ++k ) {
-
-    /* loop over IFOs */
-    for ( UINT4 X = 0; X < numIFOs; ++X ) {
-
-      /* number of SFTs for this IFO */
-      UINT4 numSFTs = ( *multiPSDVector )->data[X]->length;
-
-      /* copy PSD frequency bins and normalise multiPSDVector for later use */
-      for ( UINT4 alpha = 0; alpha < numSFTs; ++alpha ) {
-        ( *multiPSDVector )->data[X]->data[alpha].data->data[k] *= normPSD;
-        overSFTs->data[alpha] = ( *multiPSDVector )->data[X]->data[alpha].data->data[k];
-      }
-
-      /* compute math. operation over SFTs for this IFO */
-      overIFOs->data[X] = XLALMathOpOverArray( overSFTs->data, numSFTs, PSDmthopSFTs );
-      XLAL_CHECK( !XLAL_IS_REAL8_FAIL_NAN( overIFOs->data[X] ), XLAL_EFUNC, "XLALMathOpOverArray() returned NAN for overIFOs->data[X=%d]", X );
-
-    } /* for IFOs X */
-
-    /* compute math. operation over IFOs for this frequency */
-    ( *finalPSD )->data[k] = XLALMathOpOverArray( overIFOs->data, numIFOs, PSDmthopIFOs );
-    XLAL_CHECK( !XLAL_IS_REAL8_FAIL_NAN( ( *finalPSD )->data[k] ), XLAL_EFUNC, "XLALMathOpOverArray() returned NAN for finalPSD->data[k=%d]", k );
-
-    if ( PSDnormByTotalNumSFTs ) {
-      ( *finalPSD )->data[k] *= PSDtotalNumSFTsNormalizingFactor;
-    }
-
-  } /* for freq bins k */
-  XLAL_PRINT_INFO( "done." );
-
-  /* compute normalised SFT power */
   if ( returnNormSFT ) {
-    XLAL_PRINT_INFO( "Computing normalised SFT power ..." );
     XLAL_CHECK( ( *normSFT = XLALCreateREAL8Vector( numBins ) ) != NULL, XLAL_ENOMEM, "Failed to create REAL8Vector for normSFT." );
+  }
+
+  /* frequency bins are independent, so divide them between threads */
+  XLAL_PRINT_INFO( "Computing spectrogram and PSD%s ...", returnNormSFT ? " and normalised SFT power" : "" );
+  int errflag = 0;
+  #pragma omp parallel
+  {
+
+    /* one frequency bin over IFOs and SFTs; each thread has its own workspace */
+    REAL8 *overIFOs = XLALMalloc( numIFOs * sizeof( *overIFOs ) );
+    REAL8 *overSFTs = XLALMalloc( maxNumSFTs * sizeof( *overSFTs ) );
+    if ( overIFOs == NULL || overSFTs == NULL ) {
+      XLALPrintError( "%s: failed to allocate workspace for overIFOs, overSFTs arrays\n", __func__ );
+      #pragma omp atomic write
+      errflag = XLAL_ENOMEM;
+    }
 
-    /* loop over frequency bins in SFTs */
+    /* loop over frequency bins in final PSD */
+    #pragma omp for schedule(static)
     for ( UINT4 k = 0; k < numBins; ++k ) {
+      if ( errflag ) {
+        continue;
+      }
 
       /* loop over IFOs */
       for ( UINT4 X = 0; X < numIFOs; ++X ) {
 
         /* number of SFTs for this IFO */
-        UINT4 numSFTs = SFTs->data[X]->length;
+        UINT4 numSFTs = ( *multiPSDVector )->data[X]->length;
 
-        /* compute SFT power */
+        /* copy PSD frequency bins and normalise multiPSDVector for later use */
         for ( UINT4 alpha = 0; alpha < numSFTs; ++alpha ) {
-          COMPLEX8 bin = SFTs->data[X]->data[alpha].data->data[k];
-          overSFTs->data[alpha] = crealf( bin ) * crealf( bin ) + cimagf( bin ) * cimagf( bin );
+          ( *multiPSDVector )->data[X]->data[alpha].data->data[k] *= normPSD;
+          overSFTs[alpha] = ( *multiPSDVector )->data[X]->data[alpha].data->data[k];
         }
 
         /* compute math. operation over SFTs for this IFO */
-        overIFOs->data[X] = XLALMathOpOverArray( overSFTs->data, numSFTs, nSFTmthopSFTs );
-        XLAL_CHECK( !XLAL_IS_REAL8_FAIL_NAN( overIFOs->data[X] ), XLAL_EFUNC, "XLALMathOpOverArray() returned NAN for overIFOs->data[X=%d]", X );
+        overIFOs[X] = XLALMathOpOverArray( overSFTs, numSFTs, PSDmthopSFTs );
+        if ( XLAL_IS_REAL8_FAIL_NAN( overIFOs[X] ) ) {
+          XLALPrintError( "%s: XLALMathOpOverArray() returned NAN for overIFOs[X=%d]\n", __func__, X );
+          #pragma omp atomic write
+          errflag = XLAL_EFUNC;
+        }
 
-      } /* over IFOs */
+      } /* for IFOs X */
 
       /* compute math. operation over IFOs for this frequency */
-      ( *normSFT )->data[k] = XLALMathOpOverArray( overIFOs->data, numIFOs, nSFTmthopIFOs );
-      XLAL_CHECK( !XLAL_IS_REAL8_FAIL_NAN( ( *normSFT )->data[k] ), XLAL_EFUNC, "XLALMathOpOverArray() returned NAN for normSFT->data[k=%d]", k );
+      ( *finalPSD )->data[k] = XLALMathOpOverArray( overIFOs, numIFOs, PSDmthopIFOs );
+      if ( XLAL_IS_REAL8_FAIL_NAN( ( *finalPSD )->data[k] ) ) {
+        XLALPrintError( "%s: XLALMathOpOverArray() returned NAN for finalPSD->data[k=%d]\n", __func__, k );
+        #pragma omp atomic write
+        errflag = XLAL_EFUNC;
+      }
 
-    } /* over freq bins */
-    XLAL_PRINT_INFO( "done." );
-  } /* if returnNormSFT */
+      if ( PSDnormByTotalNumSFTs ) {
+        ( *finalPSD )->data[k] *= PSDtotalNumSFTsNormalizingFactor;
+      }
+
+      /* compute normalised SFT power */
+      if ( returnNormSFT ) {
+
+        /* loop over IFOs */
+        for ( UINT4 X = 0; X < numIFOs; ++X ) {
+
+          /* number of SFTs for this IFO */
+          UINT4 numSFTs = SFTs->data[X]->length;
+
+          /* compute SFT power */
+          for ( UINT4 alpha = 0; alpha < numSFTs; ++alpha ) {
+            COMPLEX8 bin = SFTs->data[X]->data[alpha].data->data[k];
+            overSFTs[alpha] = crealf( bin ) * crealf( bin ) + cimagf( bin ) * cimagf( bin );
+          }
+
+          /* compute math. operation over SFTs for this IFO */
+          overIFOs[X] = XLALMathOpOverArray( overSFTs, numSFTs, nSFTmthopSFTs );
+          if ( XLAL_IS_REAL8_FAIL_NAN( overIFOs[X] ) ) {
+            XLALPrintError( "%s: XLALMathOpOverArray() returned NAN for overIFOs[X=%d]\n", __func__, X );
+            #pragma omp atomic write
+            errflag = XLAL_EFUNC;
+          }
+
+        } /* over IFOs */
+
+        /* compute math. operation over IFOs for this frequency */
+        ( *normSFT )->data[k] = XLALMathOpOverArray( overIFOs, numIFOs, nSFTmthopIFOs );
+        if ( XLAL_IS_REAL8_FAIL_NAN( ( *normSFT )->data[k] ) ) {
+          XLALPrintError( "%s: XLALMathOpOverArray() returned NAN for normSFT->data[k=%d]\n", __func__, k );
+          #pragma omp atomic write
+          errflag = XLAL_EFUNC;
+        }
+
+      } /* if returnNormSFT */
 
-  XLALDestroyREAL8Vector( overSFTs );
-  XLALDestroyREAL8Vector( overIFOs );
+    } /* for freq bins k */
+
+    XLALFree( overSFTs );
+    XLALFree( overIFOs );
+
+  } /* omp parallel */
+  XLAL_CHECK( errflag == 0, errflag );
+  XLAL_PRINT_INFO( "done." );
 
   if ( !returnMultiPSDVector ) {
     XLALDestroyMultiPSDVector( *multiPSDVector );
@@ -3409,8 +3409,9 @@ XLALCreateCrossCorrWorkspace(
   XLAL_CHECK( ( ws->SRCtimes_DET = XLALCreateREAL8Vector( numSamplesFFT ) ) != NULL, XLAL_EFUNC );
   XLAL_CHECK( ( ws->FaX_k = fftw_malloc( numFreqBins * sizeof( COMPLEX8 ) ) ) != NULL, XLAL_ENOMEM );
   XLAL_CHECK( ( ws->FbX_k = fftw_malloc( numFreqBins * sizeof( COMPLEX8 ) ) ) != NULL, XLAL_ENOMEM );
-  XLAL_CHECK( ( ws->FabX_Raw = fftw_malloc( numSamplesFFT * sizeof( COMPLEX8 ) ) ) != NULL, XLAL_ENOMEM );
-  XLAL_CHECK( ( ws->TS_FFT   = fftw_malloc( numSamplesFFT * sizeof( COMPLEX8 ) ) ) != NULL, XLAL_ENOMEM );
+  /* Fa and Fb inputs/outputs are stored back-to-back so both are transformed by a single batched plan */
+  XLAL_CHECK( ( ws->FabX_Raw = fftw_malloc( 2 * numSamplesFFT * sizeof( COMPLEX8 ) ) ) != NULL, XLAL_ENOMEM );
+  XLAL_CHECK( ( ws->TS_FFT   = fftw_malloc( 2 * numSamplesFFT * sizeof( COMPLEX8 ) ) ) != NULL, XLAL_ENOMEM );
   ws->decimateFFT = decimateFFT;
   ws->numSamplesFFT = numSamplesFFT;
   ws->numFreqBinsOut = numFreqBins;
@@ -3418,7 +3419,8 @@ XLALCreateCrossCorrWorkspace(
   LAL_FFTW_WISDOM_LOCK;
   //XLALGetFFTPlanHints (& fft_plan_flags , & fft_plan_timeout );
   fftw_set_timelimit( fft_plan_timeout );
-  XLAL_CHECK( ( ws->fftplan = fftwf_plan_dft_1d( numSamplesFFT, ws->TS_FFT, ws->FabX_Raw, FFTW_FORWARD, fft_plan_flags ) ) != NULL, XLAL_EFAILED, "fftwf_plan_dft_1d() failed\n" );
+  const int fft_n = ( int ) numSamplesFFT;
+  XLAL_CHECK( ( ws->fftplan = fftwf_plan_many_dft( 1, &fft_n, 2, ws->TS_FFT, NULL, 1, fft_n, ws->FabX_Raw, NULL, 1, fft_n, FFTW_FORWARD, fft_plan_flags ) ) != NULL, XLAL_EFAILED, "fftwf_plan_many_dft() failed\n" );
   LAL_FFTW_WISDOM_UNLOCK;
   /* -- finish creating FFT plan with FFTW */
 
@@ -3860,14 +3862,16 @@ XLALComputeFaFb_CrossCorrResamp
     startFirstInd = resampDataArrayA->data->length;
   }
 
-  memset( ws->TS_FFT, 0, ws->numSamplesFFT * sizeof( ws->TS_FFT[0] ) );
   UINT4 sftLength = 0;
   if ( isL == TRUE ) {
     sftLength = resampMultiPairsDetXsftK->data[detY].length;
   } else {
     sftLength = 1;
   }
-  // Load and FFT A time series
+  // Load A and B time series into the two halves of the batched FFT input
+  COMPLEX8 *restrict TS_FFT_a = ws->TS_FFT;
+  COMPLEX8 *restrict TS_FFT_b = ws->TS_FFT + ws->numSamplesFFT;
+  memset( ws->TS_FFT, 0, 2 * ws->numSamplesFFT * sizeof( ws->TS_FFT[0] ) );
   for ( UINT4 sft = 0; sft < sftLength; sft++ ) {
     //if (resampMultiPairsDetXsftK->data[detY].data[sft].sciFlag > 0){
     /* Needs to be defined wrt resamp time series, so:*/
@@ -3888,24 +3892,8 @@ XLALComputeFaFb_CrossCorrResamp
       startInd = endInd;
     }
     UINT4 headOfSliceIndex = startInd - startFirstInd;
-    XLAL_CHECK( XLALApplyCrossCorrFreqShiftResamp( ws->TS_FFT, resampDataArrayA, dopplerpos, freqShiftInFFT, startInd, endInd, ws->numSamplesFFT, headOfSliceIndex ) == XLAL_SUCCESS, XLAL_EFUNC );
-    //}
-  }
-  fftwf_execute( ws->fftplan );
-  for ( UINT4 k = 0; k < ws->numFreqBinsOut; k++ ) {
-    ws->FaX_k[k] = ws->FabX_Raw [ offset_bins + ( UINT4 )floor( k * RedecimateFFT )  ];
-  }
-  // END load and FFT A time series
+    XLAL_CHECK( XLALApplyCrossCorrFreqShiftResamp( TS_FFT_a, resampDataArrayA, dopplerpos, freqShiftInFFT, startInd, endInd, ws->numSamplesFFT, headOfSliceIndex ) == XLAL_SUCCESS, XLAL_EFUNC );
 
-  // Load and FFT B time series
-  memset( ws->TS_FFT, 0, ws->numSamplesFFT * sizeof( ws->TS_FFT[0] ) );
-  for ( UINT4 sft = 0; sft < sftLength; sft++ ) {
-    //if (resampMultiPairsDetXsftK->data[detY].data[sft].sciFlag > 0){
-    if ( isL == TRUE ) {
-      sftInd = resampMultiPairsDetXsftK->data[detY].data[sft].sftInd;
-    } else {
-      sftInd = resampMultiPairsDetXsftK->sftInd;
-    }
     startInd = ( UINT4 )round( sftInd * SRCsampPerTcoh );
     endInd = ( UINT4 )round( ( sftInd + 1 ) * SRCsampPerTcoh );
     if ( startInd > resampDataArrayB->data->length ) {
@@ -3917,15 +3905,21 @@ XLALComputeFaFb_CrossCorrResamp
     if ( startInd > endInd ) {
       startInd = endInd;
     }
-    UINT4 headOfSliceIndex = startInd - startFirstInd;
-    XLAL_CHECK( XLALApplyCrossCorrFreqShiftResamp( ws->TS_FFT, resampDataArrayB, dopplerpos, freqShiftInFFT, startInd, endInd, ws->numSamplesFFT, headOfSliceIndex ) == XLAL_SUCCESS, XLAL_EFUNC );
+    headOfSliceIndex = startInd - startFirstInd;
+    XLAL_CHECK( XLALApplyCrossCorrFreqShiftResamp( TS_FFT_b, resampDataArrayB, dopplerpos, freqShiftInFFT, startInd, endInd, ws->numSamplesFFT, headOfSliceIndex ) == XLAL_SUCCESS, XLAL_EFUNC );
     //}
   }
+
+  // FFT A and B time series together with one batched plan
   fftwf_execute( ws->fftplan );
+  const COMPLEX8 *restrict FabX_Raw_a = ws->FabX_Raw;
+  const COMPLEX8 *restrict FabX_Raw_b = ws->FabX_Raw + ws->numSamplesFFT;
   for ( UINT4 k = 0; k < ws->numFreqBinsOut; k++ ) {
-    ws->FbX_k[k] = ws->FabX_Raw [ offset_bins + ( UINT4 )floor( k * RedecimateFFT )  ];
+    const UINT4 binInd = offset_bins + ( UINT4 )floor( k * RedecimateFFT );
+    ws->FaX_k[k] = FabX_Raw_a[binInd];
+    ws->FbX_k[k] = FabX_Raw_b[binInd];
   }
-  // End load and FFT B time series
+  // End load and FFT A and B time series
 
   const REAL8 dtauX = GPSDIFF( resampDataArrayB->epoch, dopplerpos->refTime );
   const REAL8 timeFromResampStartToSFTFirst = startFirstInd * dt_SRC;
@@ -255,9 +255,9 @@ typedef struct tagResampCrossCorrWorkspace {
   // input padded timeseries ts(t) and output Fab(f) of length 'numSamplesFFT' and corresponding fftw plan
   UINT4 numSamplesFFT;          //!< allocated number of zero-padded SRC-frame time samples (related to dFreq)
   UINT4 decimateFFT;            //!< output every n-th frequency bin, with n>1 iff (dFreq > 1/Tspan), and was internally decreased by n
-  fftwf_plan fftplan;           //!< buffer FFT plan for given numSamplesOut length
-  COMPLEX8 *TS_FFT;             //!< zero-padded, spindown-corr SRC-frame TS
-  COMPLEX8 *FabX_Raw;           //!< raw full-band FFT result Fa,Fb
+  fftwf_plan fftplan;           //!< buffer FFT plan for given numSamplesOut length, batched over the a(t)x(t) and b(t)x(t) timeseries
+  COMPLEX8 *TS_FFT;             //!< zero-padded, spindown-corr SRC-frame TS [2*numSamplesFFT: a(t)x(t) followed by b(t)x(t)]
+  COMPLEX8 *FabX_Raw;           //!< raw full-band FFT result Fa,Fb [2*numSamplesFFT: Fa followed by Fb]
 
   // arrays of size numFreqBinsOut over frequency bins f_k:
   UINT4 numFreqBinsOut;         //!< number of output frequency bins {f_k}
@@ -24,20 +24,78 @@
 
 /*---------- includes ----------*/
 
+#include <config.h>
+
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <gsl/gsl_math.h>
 
 #include <lal/Units.h>
 #include <lal/Sequence.h>
 
 #include "SFTinternal.h"
 
+/*---------- internal types ----------*/
+
+/* header information of one SFT-block in a file, as stored in an SFT catalog index */
+typedef struct {
+  long offset;                  /* offset of SFT-block in file */
+  long dataOffset;              /* offset of SFT data in file */
+  BOOLEAN swapEndian;           /* whether SFT data needs to be endian-swapped */
+  SFTtype header;               /* SFT header */
+  UINT4 version;                /* SFT-specification version */
+  UINT4 numBins;                /* number of frequency-bins */
+  UINT8 crc64;                  /* crc64 checksum */
+  UINT2 windowspec;             /* window specification */
+  CHAR *comment;                /* comment-entry in SFT header */
+  BOOLEAN wanted;               /* whether SFT-block satisfies user-constraints */
+} SFTBlockRecord;
+
+/* status of a file, used to check that an SFT catalog index entry is current */
+typedef struct {
+  INT8 size;                    /* size of file */
+  INT8 mtime;                   /* modification time of file, seconds part */
+  INT8 mtime_nsec;              /* modification time of file, nanoseconds part (0 if not supported) */
+  UINT8 inode;                  /* inode number of file */
+} SFTFileStatus;
+
+/* header information of all SFT-blocks in a file, as stored in an SFT catalog index */
+typedef struct {
+  CHAR *fname;                  /* name of file, as matched by file pattern; NULL for index entries */
+  CHAR *path;                   /* absolute path of file, used to look up index entries */
+  SFTFileStatus status;         /* status of file */
+  UINT4 numBlocks;              /* number of SFT-blocks in file */
+  SFTBlockRecord *blocks;       /* SFT-blocks in file */
+  BOOLEAN superseded;           /* whether index entry has been superseded by a matched file */
+} SFTFileRecord;
+
+/*---------- constants ----------*/
+
+/* SFT catalog index file magic string and format version */
+static const char SFT_INDEX_MAGIC[8] = { 'L', 'A', 'L', 'S', 'F', 'T', 'I', 'X' };
+#define SFT_INDEX_VERSION 2
+
 /*---------- internal prototypes ----------*/
 
 static long get_file_len( FILE *fp );
 
 static BOOLEAN consistent_mSFT_header( SFTtype header1, UINT4 version1, UINT4 nsamples1, UINT2 windowspec1, SFTtype header2, UINT4 version2, UINT4 nsamples2, UINT2 windowspec2 );
 static BOOLEAN timestamp_in_list( LIGOTimeGPS timestamp, LIGOTimeGPSVector *list );
+static void get_file_status( const char *fname, SFTFileStatus *status );
+static BOOLEAN same_file_status( const SFTFileStatus *status1, const SFTFileStatus *status2 );
+static int read_sft_file_record( SFTFileRecord *rec );
+static void free_sft_file_record( SFTFileRecord *rec );
+static void free_sft_file_records( UINT4 numRecords, SFTFileRecord *records );
+static int compare_sft_file_record( const void *ptr1, const void *ptr2 );
+static BOOLEAN want_sft_block( const SFTtype *header, const SFTConstraints *constraints );
+static int read_sft_catalog_index_fp( FILE *fp, UINT4 *numRecords, SFTFileRecord **records );
+static int read_sft_catalog_index( const CHAR *indexFile, UINT4 *numRecords, SFTFileRecord **records );
+static int write_sft_catalog_index_fp( FILE *fp, UINT4 numRecords, SFTFileRecord *const *records );
+static int write_sft_catalog_index( const CHAR *indexFile, UINT4 numRecords, SFTFileRecord *const *records );
 
 /*========== function definitions ==========*/
 
@@ -71,6 +129,40 @@ SFTCatalog *
 XLALSFTdataFind( const CHAR *file_pattern,             /**< which SFT-files */
                  const SFTConstraints *constraints     /**< additional constraints for SFT-selection */
                )
+{
+  const CHAR *indexFile = getenv( "LAL_SFT_INDEX_FILE" );
+  if ( indexFile != NULL && *indexFile == '\0' ) {
+    indexFile = NULL;
+  }
+  SFTCatalog *ret = XLALSFTdataFindWithIndex( file_pattern, constraints, indexFile );
+  XLAL_CHECK_NULL( ret != NULL, XLAL_EFUNC );
+  return ret;
+} /* XLALSFTdataFind() */
+
+
+/**
+ * Version of XLALSFTdataFind() which uses an SFT catalog index file \a indexFile to avoid parsing
+ * the headers of SFT files. The index records the header, file offset, and crc64 checksum of each
+ * SFT block in each file, together with the size, modification time (to nanoseconds, where supported)
+ * and inode number of the file; files are identified by their absolute path, so that an index may be
+ * shared between jobs running in different directories. Files whose size, modification time and inode
+ * match those recorded in the index are not opened; any other matched files are parsed (in parallel,
+ * if compiled with OpenMP) and the index is then updated. Since a file could still be replaced without
+ * changing any of these, XLALLoadSFTs() checks the SFT header at each recorded offset before reading
+ * SFT data, and fails if it does not match the catalog.
+ *
+ * The index is a cache: if it does not exist or cannot be read, the SFT files are parsed as usual;
+ * if it cannot be written, a warning is printed. The index is written to a temporary file which is
+ * then renamed, so concurrent jobs sharing the same index will never read a partially-written index.
+ * Index files are in the native byte order of the machine that wrote them, and are not portable.
+ *
+ * If \a indexFile is \c NULL, this function is equivalent to XLALSFTdataFind() without an index.
+ */
+SFTCatalog *
+XLALSFTdataFindWithIndex( const CHAR *file_pattern,             /**< which SFT-files */
+                          const SFTConstraints *constraints,    /**< additional constraints for SFT-selection */
+                          const CHAR *indexFile                 /**< SFT catalog index file (may be \c NULL) */
+                        )
 {
   /* ----- check input */
   XLAL_CHECK_NULL( file_pattern != NULL, XLAL_EINVAL );
@@ -81,198 +173,153 @@ XLALSFTdataFind( const CHAR *file_pattern,             /**< which SFT-files */
     }
   }
 
-  /* prepare return-catalog */
-  SFTCatalog *ret;
-  XLAL_CHECK_NULL( ( ret = LALCalloc( 1, sizeof( *ret ) ) ) != NULL, XLAL_ENOMEM );
-
   /* find matching filenames */
   LALStringVector *fnames;
   XLAL_CHECK_NULL( ( fnames = XLALFindFiles( file_pattern ) ) != NULL, XLAL_EFUNC, "Failed to find filelist matching pattern '%s'.\n\n", file_pattern );
   UINT4 numFiles = fnames->length;
 
-  UINT4 numSFTs = 0;
-  /* ----- main loop: parse all matching files */
-  for ( UINT4 i = 0; i < numFiles; i ++ ) {
-    const CHAR *fname = fnames->data[i];
-
-    /* merged SFTs need to satisfy stronger consistency-constraints (-> see spec) */
-    BOOLEAN mfirst_block = TRUE;
-    UINT4   mprev_version = 0;
-    SFTtype XLAL_INIT_DECL( mprev_header );
-    REAL8   mprev_nsamples = 0;
-    UINT2   mprev_windowspec = 0;
-
-    FILE *fp;
-    if ( ( fp = fopen( fname, "rb" ) ) == NULL ) {
-      XLALPrintError( "ERROR: Failed to open matched file '%s'\n\n", fname );
-      XLALDestroyStringVector( fnames );
-      XLALDestroySFTCatalog( ret );
-      XLAL_ERROR_NULL( XLAL_EIO );
+  /* read SFT catalog index, if given; since the index is only a cache, failure to read it is not an error */
+  UINT4 numIndexRecords = 0;
+  SFTFileRecord *indexRecords = NULL;
+  if ( indexFile != NULL ) {
+    if ( read_sft_catalog_index( indexFile, &numIndexRecords, &indexRecords ) != XLAL_SUCCESS ) {
+      XLALPrintWarning( "%s: ignoring unreadable SFT catalog index '%s'\n", __func__, indexFile );
+      XLALClearErrno();
+      numIndexRecords = 0;
+      indexRecords = NULL;
     }
+  }
 
-    long file_len;
-    if ( ( file_len = get_file_len( fp ) ) == 0 ) {
-      XLALPrintError( "ERROR: got file-len == 0 for '%s'\n\n", fname );
-      XLALDestroyStringVector( fnames );
-      XLALDestroySFTCatalog( ret );
-      fclose( fp );
-      XLAL_ERROR_NULL( XLAL_EIO );
-    }
-
-    /* go through SFT-blocks in fp */
-    while ( ftell( fp ) < file_len ) {
-      SFTtype this_header;
-      UINT4 this_version;
-      UINT4 this_nsamples;
-      UINT8 this_crc;
-      UINT2 this_windowspec;
-      CHAR *this_comment = NULL;
-      BOOLEAN endian;
-      BOOLEAN want_this_block = FALSE;
-
-      long this_filepos;
-      if ( ( this_filepos = ftell( fp ) ) == -1 ) {
-        XLALPrintError( "ERROR: ftell() failed for '%s'\n\n", fname );
-        XLALDestroyStringVector( fnames );
-        XLALDestroySFTCatalog( ret );
-        fclose( fp );
-        XLAL_ERROR_NULL( XLAL_EIO );
+  /* get the headers of all SFT blocks in the matched files, either from the index if it is current, or by parsing the files */
+  SFTCatalog *ret = NULL;
+  SFTFileRecord **writeRecords = NULL;
+  SFTFileRecord *records = XLALCalloc( GSL_MAX( numFiles, 1 ), sizeof( *records ) );
+  XLAL_CHECK_FAIL( records != NULL, XLAL_ENOMEM );
+  UINT4 numParsed = 0;
+  int errflag = 0;
+  #pragma omp parallel for schedule(dynamic) reduction(+:numParsed)
+  for ( UINT4 i = 0; i < numFiles; i ++ ) {
+    if ( errflag ) {
+      continue;
+    }
+    SFTFileRecord *rec = &records[i];
+    if ( ( rec->fname = XLALStringDuplicate( fnames->data[i] ) ) == NULL ) {
+      #pragma omp atomic write
+      errflag = 1;
+      continue;
+    }
+    get_file_status( rec->fname, &rec->status );
+    SFTFileRecord *irec = NULL;
+    if ( indexFile != NULL ) {
+      /* index entries are keyed by absolute path, so that the index can be shared between working directories */
+      char *path = realpath( rec->fname, NULL );
+      if ( path != NULL ) {
+        rec->path = XLALStringDuplicate( path );
+        free( path );
       }
-
-      if ( read_sft_header_from_fp( fp, &this_header, &this_version, &this_crc, &this_windowspec, &endian, &this_comment, &this_nsamples ) != 0 ) {
-        XLALPrintError( "ERROR: File-block '%s:%ld' is not a valid SFT!\n\n", fname, ftell( fp ) );
-        XLALDestroyStringVector( fnames );
-        XLALFree( this_comment );
-        XLALDestroySFTCatalog( ret );
-        fclose( fp );
-        XLAL_ERROR_NULL( XLAL_EDATA );
+      if ( rec->path != NULL && numIndexRecords > 0 ) {
+        irec = bsearch( rec, indexRecords, numIndexRecords, sizeof( indexRecords[0] ), compare_sft_file_record );
       }
-
-      /* if merged-SFT: check consistency constraints */
-      if ( !mfirst_block ) {
-        if ( ! consistent_mSFT_header( mprev_header, mprev_version, mprev_nsamples, mprev_windowspec, this_header, this_version, this_nsamples, this_windowspec ) ) {
-          XLALPrintError( "ERROR: merged SFT-file '%s' contains inconsistent SFT-blocks!\n\n", fname );
-          XLALFree( this_comment );
-          XLALDestroyStringVector( fnames );
-          XLALDestroySFTCatalog( ret );
-          fclose( fp );
-          XLAL_ERROR_NULL( XLAL_EDATA );
-        }
-      } /* if !mfirst_block */
-
-      mprev_header = this_header;
-      mprev_version = this_version;
-      mprev_nsamples = this_nsamples;
-      mprev_windowspec = this_windowspec;
-
-      want_this_block = TRUE;       /* default */
-      /* but does this SFT-block satisfy the user-constraints ? */
-      if ( constraints ) {
-        if ( constraints->detector ) {
-          if ( strncmp( constraints->detector, this_header.name, 2 ) ) {
-            want_this_block = FALSE;
-          }
-        }
-
-        if ( XLALCWGPSinRange( this_header.epoch, constraints->minStartTime, constraints->maxStartTime ) != 0 ) {
-          want_this_block = FALSE;
-        }
-
-        if ( constraints->timestamps && !timestamp_in_list( this_header.epoch, constraints->timestamps ) ) {
-          want_this_block = FALSE;
-        }
-
-      } /* if constraints */
-
-      if ( want_this_block ) {
-        numSFTs ++;
-
-        /* do we need to alloc more memory for the SFTs? */
-        if ( numSFTs > ret->length ) {
-          /* we realloc SFT-memory blockwise in order to
-           * improve speed in debug-mode (using LALMalloc/LALFree)
-           */
-          int len = ( ret->length + SFTFILEIO_REALLOC_BLOCKSIZE ) * sizeof( *( ret->data ) );
-          if ( ( ret->data = LALRealloc( ret->data, len ) ) == NULL ) {
-            XLALPrintError( "ERROR: SFT memory reallocation failed: nSFT:%d, len = %d\n", numSFTs, len );
-            XLALDestroyStringVector( fnames );
-            XLALDestroySFTCatalog( ret );
-            XLALFree( this_comment );
-            fclose( fp );
-            XLAL_ERROR_NULL( XLAL_ENOMEM );
-          }
-
-          /* properly initialize data-fields pointers to NULL to avoid SegV when Freeing */
-          for ( UINT4 j = 0; j < SFTFILEIO_REALLOC_BLOCKSIZE; j ++ ) {
-            memset( &( ret->data[ret->length + j] ), 0, sizeof( ret->data[0] ) );
-          }
-
-          ret->length += SFTFILEIO_REALLOC_BLOCKSIZE;
-        } // if numSFTs > ret->length
-
-        SFTDescriptor *desc = &( ret->data[numSFTs - 1] );
-
-        desc->locator = XLALCalloc( 1, sizeof( *( desc->locator ) ) );
-        if ( desc->locator ) {
-          desc->locator->fname = XLALCalloc( 1, strlen( fname ) + 1 );
-        }
-        if ( ( desc->locator == NULL ) || ( desc->locator->fname == NULL ) ) {
-          XLALPrintError( "ERROR: XLALCalloc() failed\n" );
-          XLALDestroyStringVector( fnames );
-          XLALDestroySFTCatalog( ret );
-          fclose( fp );
-          XLAL_ERROR_NULL( XLAL_ENOMEM );
+    }
+    if ( irec != NULL ) {
+      /* if index entry is current, take over its SFT blocks; several matched files (e.g. symbolic links)
+         may have the same absolute path, but only one of them can take over the index entry */
+      #pragma omp critical (XLALSFTdataFindWithIndex)
+      {
+        if ( irec->numBlocks > 0 && same_file_status( &irec->status, &rec->status ) ) {
+          rec->numBlocks = irec->numBlocks;
+          rec->blocks = irec->blocks;
+          irec->numBlocks = 0;
+          irec->blocks = NULL;
         }
-        strcpy( desc->locator->fname, fname );
-        desc->locator->offset = this_filepos;
-
-        XLAL_CHECK_NULL( parse_sft_windowspec( this_windowspec, &desc->window_type, &desc->window_param ) == XLAL_SUCCESS, XLAL_EFUNC );
-
-        desc->header  = this_header;
-        desc->comment = this_comment;
-        desc->numBins = this_nsamples;
-        desc->version = this_version;
-        desc->crc64   = this_crc;
+        irec->superseded = TRUE;
+      }
+    }
+    if ( rec->numBlocks == 0 ) {
+      /* parse SFT blocks from file */
+      ++numParsed;
+      if ( read_sft_file_record( rec ) != XLAL_SUCCESS ) {
+        #pragma omp atomic write
+        errflag = 1;
+      }
+    }
+  } /* for i < numFiles */
+  XLAL_CHECK_FAIL( errflag == 0, XLAL_EFUNC, "Failed to parse SFT files matching pattern '%s'.\n\n", file_pattern );
+
+  /* update SFT catalog index, if any SFT files were parsed; keep index entries for files not matched by this pattern */
+  if ( indexFile != NULL && numParsed > 0 ) {
+    UINT4 numWrite = 0;
+    XLAL_CHECK_FAIL( ( writeRecords = XLALCalloc( numFiles + numIndexRecords, sizeof( *writeRecords ) ) ) != NULL, XLAL_ENOMEM );
+    for ( UINT4 i = 0; i < numFiles; i ++ ) {
+      writeRecords[numWrite++] = &records[i];
+    }
+    for ( UINT4 i = 0; i < numIndexRecords; i ++ ) {
+      if ( !indexRecords[i].superseded ) {
+        writeRecords[numWrite++] = &indexRecords[i];
+      }
+    }
+    if ( write_sft_catalog_index( indexFile, numWrite, writeRecords ) != XLAL_SUCCESS ) {
+      XLALPrintWarning( "%s: failed to write SFT catalog index '%s'\n", __func__, indexFile );
+      XLALClearErrno();
+    } else {
+      XLALPrintInfo( "%s: wrote SFT catalog index '%s' (%u files, %u newly parsed)\n", __func__, indexFile, numWrite, numParsed );
+    }
+    XLALFree( writeRecords );
+    writeRecords = NULL;
+  }
+  free_sft_file_records( numIndexRecords, indexRecords );
+  numIndexRecords = 0;
+  indexRecords = NULL;
 
-      } /* if want_this_block */
-      else {
-        XLALFree( this_comment );
+  /* count SFT-blocks which satisfy the user-constraints */
+  UINT4 numSFTs = 0;
+  for ( UINT4 i = 0; i < numFiles; i ++ ) {
+    for ( UINT4 j = 0; j < records[i].numBlocks; j ++ ) {
+      records[i].blocks[j].wanted = want_sft_block( &records[i].blocks[j].header, constraints );
+      if ( records[i].blocks[j].wanted ) {
+        ++numSFTs;
       }
+    }
+  }
 
-      mfirst_block = FALSE;
+  /* prepare return-catalog */
+  XLAL_CHECK_FAIL( ( ret = LALCalloc( 1, sizeof( *ret ) ) ) != NULL, XLAL_ENOMEM );
+  XLAL_CHECK_FAIL( ( ret->data = XLALCalloc( GSL_MAX( numSFTs, 1 ), sizeof( *( ret->data ) ) ) ) != NULL, XLAL_ENOMEM );
+  ret->length = numSFTs;
 
-      /* skip seeking if we know we would reach the end */
-      if ( ftell( fp ) + ( long )this_nsamples * 8 >= file_len ) {
-        break;
+  /* fill catalog with SFT-blocks which satisfy the user-constraints */
+  UINT4 k = 0;
+  for ( UINT4 i = 0; i < numFiles; i ++ ) {
+    for ( UINT4 j = 0; j < records[i].numBlocks; j ++ ) {
+      const SFTBlockRecord *blk = &records[i].blocks[j];
+      if ( !blk->wanted ) {
+        continue;
       }
+      SFTDescriptor *desc = &( ret->data[k++] );
 
-      /* seek to end of SFT data-entries in file  */
-      if ( fseek( fp, this_nsamples * 8, SEEK_CUR ) == -1 ) {
-        XLALPrintError( "ERROR: Failed to skip DATA field for SFT '%s': %s\n", fname, strerror( errno ) );
-        XLALFree( this_comment );
-        XLALDestroyStringVector( fnames );
-        XLALDestroySFTCatalog( ret );
-        fclose( fp );
-        XLAL_ERROR_NULL( XLAL_EIO );
-      }
+      XLAL_CHECK_FAIL( ( desc->locator = XLALCalloc( 1, sizeof( *( desc->locator ) ) ) ) != NULL, XLAL_ENOMEM );
+      XLAL_CHECK_FAIL( ( desc->locator->fname = XLALStringDuplicate( records[i].fname ) ) != NULL, XLAL_EFUNC );
+      desc->locator->offset = blk->offset;
+      desc->locator->dataOffset = blk->dataOffset;
+      desc->locator->swapEndian = blk->swapEndian;
 
-    } /* while !feof */
+      XLAL_CHECK_FAIL( parse_sft_windowspec( blk->windowspec, &desc->window_type, &desc->window_param ) == XLAL_SUCCESS, XLAL_EFUNC );
 
-    fclose( fp );
+      desc->header  = blk->header;
+      if ( blk->comment != NULL ) {
+        XLAL_CHECK_FAIL( ( desc->comment = XLALStringDuplicate( blk->comment ) ) != NULL, XLAL_EFUNC );
+      }
+      desc->numBins = blk->numBins;
+      desc->version = blk->version;
+      desc->crc64   = blk->crc64;
 
+    }
   } /* for i < numFiles */
 
-  /* free matched filenames */
+  /* free file records and matched filenames */
+  free_sft_file_records( numFiles, records );
   XLALDestroyStringVector( fnames );
 
-  /* now realloc SFT-vector (alloc'ed blockwise) to its *actual size* */
-  int len;
-  if ( ( ret->data = XLALRealloc( ret->data, len = numSFTs * sizeof( *( ret->data ) ) ) ) == NULL ) {
-    XLALDestroySFTCatalog( ret );
-    XLAL_ERROR_NULL( XLAL_ENOMEM, "XLALRecalloc ( %d ) failed.\n", len );
-  }
-  ret->length = numSFTs;
-
   /* ----- final consistency-checks: ----- */
 
   /* did we find all timestamps that lie within [minStartTime, maxStartTime)? */
@@ -321,7 +368,15 @@ XLALSFTdataFind( const CHAR *file_pattern,             /**< which SFT-files */
   /* return result catalog (=sft-vect and locator-vect) */
   return ret;
 
-} /* XLALSFTdataFind() */
+XLAL_FAIL:
+  free_sft_file_records( numFiles, records );
+  free_sft_file_records( numIndexRecords, indexRecords );
+  XLALFree( writeRecords );
+  XLALDestroySFTCatalog( ret );
+  XLALDestroyStringVector( fnames );
+  return NULL;
+
+} /* XLALSFTdataFindWithIndex() */
 
 
 /** Free an 'SFT-catalogue' */
@@ -880,4 +935,402 @@ timestamp_in_list( LIGOTimeGPS timestamp, LIGOTimeGPSVector *list )
 
 } /* timestamp_in_list() */
 
+
+/* get size, modification time, and inode number of a file; size is set to -1 if file cannot be stat()ed */
+static void
+get_file_status( const char *fname, SFTFileStatus *status )
+{
+  XLAL_INIT_MEM( *status );
+  struct stat st;
+  if ( stat( fname, &st ) == 0 ) {
+    status->size = st.st_size;
+    status->mtime = st.st_mtime;
+#if defined(HAVE_STRUCT_STAT_ST_MTIM)
+    status->mtime_nsec = st.st_mtim.tv_nsec;
+#elif defined(HAVE_STRUCT_STAT_ST_MTIMESPEC)
+    status->mtime_nsec = st.st_mtimespec.tv_nsec;
+#endif
+    status->inode = st.st_ino;
+  } else {
+    status->size = -1;
+  }
+} /* get_file_status() */
+
+
+/* do two file statuses refer to the same, unmodified, non-empty file? */
+static BOOLEAN
+same_file_status( const SFTFileStatus *status1, const SFTFileStatus *status2 )
+{
+  return status1->size > 0 && status1->size == status2->size
+         && status1->mtime == status2->mtime && status1->mtime_nsec == status2->mtime_nsec
+         && status1->inode == status2->inode;
+} /* same_file_status() */
+
+
+/* parse the headers of all SFT-blocks in file 'rec->fname' */
+static int
+read_sft_file_record( SFTFileRecord *rec )
+{
+  FILE *fp;
+  XLAL_CHECK( ( fp = fopen( rec->fname, "rb" ) ) != NULL, XLAL_EIO, "Failed to open matched file '%s'\n\n", rec->fname );
+
+  long file_len;
+  if ( ( file_len = get_file_len( fp ) ) == 0 ) {
+    fclose( fp );
+    XLAL_ERROR( XLAL_EIO, "Got file-len == 0 for '%s'\n\n", rec->fname );
+  }
+
+  /* go through SFT-blocks in fp */
+  UINT4 maxBlocks = 0;
+  while ( ftell( fp ) < file_len ) {
+    SFTBlockRecord XLAL_INIT_DECL( blk );
+
+    if ( ( blk.offset = ftell( fp ) ) == -1 ) {
+      fclose( fp );
+      XLAL_ERROR( XLAL_EIO, "ftell() failed for '%s'\n\n", rec->fname );
+    }
+
+    if ( read_sft_header_from_fp( fp, &blk.header, &blk.version, &blk.crc64, &blk.windowspec, &blk.swapEndian, &blk.comment, &blk.numBins ) != 0 ) {
+      fclose( fp );
+      XLAL_ERROR( XLAL_EDATA, "File-block '%s:%ld' is not a valid SFT!\n\n", rec->fname, blk.offset );
+    }
+
+    if ( ( blk.dataOffset = ftell( fp ) ) == -1 ) {
+      XLALFree( blk.comment );
+      fclose( fp );
+      XLAL_ERROR( XLAL_EIO, "ftell() failed for '%s'\n\n", rec->fname );
+    }
+
+    /* if merged-SFT: check consistency constraints */
+    if ( rec->numBlocks > 0 ) {
+      const SFTBlockRecord *prev = &rec->blocks[rec->numBlocks - 1];
+      if ( ! consistent_mSFT_header( prev->header, prev->version, prev->numBins, prev->windowspec, blk.header, blk.version, blk.numBins, blk.windowspec ) ) {
+        XLALFree( blk.comment );
+        fclose( fp );
+        XLAL_ERROR( XLAL_EDATA, "Merged SFT-file '%s' contains inconsistent SFT-blocks!\n\n", rec->fname );
+      }
+    }
+
+    /* append SFT-block to file record */
+    if ( rec->numBlocks == maxBlocks ) {
+      maxBlocks = GSL_MAX( 2 * maxBlocks, 1 );
+      SFTBlockRecord *blocks = XLALRealloc( rec->blocks, maxBlocks * sizeof( rec->blocks[0] ) );
+      if ( blocks == NULL ) {
+        XLALFree( blk.comment );
+        fclose( fp );
+        XLAL_ERROR( XLAL_ENOMEM );
+      }
+      rec->blocks = blocks;
+    }
+    rec->blocks[rec->numBlocks++] = blk;
+
+    /* skip seeking if we know we would reach the end */
+    if ( ftell( fp ) + ( long )blk.numBins * 8 >= file_len ) {
+      break;
+    }
+
+    /* seek to end of SFT data-entries in file  */
+    if ( fseek( fp, blk.numBins * 8, SEEK_CUR ) == -1 ) {
+      fclose( fp );
+      XLAL_ERROR( XLAL_EIO, "Failed to skip DATA field for SFT '%s': %s\n", rec->fname, strerror( errno ) );
+    }
+
+  } /* while !feof */
+
+  fclose( fp );
+
+  return XLAL_SUCCESS;
+
+} /* read_sft_file_record() */
+
+
+/* free memory of a file record */
+static void
+free_sft_file_record( SFTFileRecord *rec )
+{
+  if ( rec ) {
+    for ( UINT4 j = 0; j < rec->numBlocks; j ++ ) {
+      XLALFree( rec->blocks[j].comment );
+    }
+    XLALFree( rec->blocks );
+    XLALFree( rec->fname );
+    XLALFree( rec->path );
+    XLAL_INIT_MEM( *rec );
+  }
+} /* free_sft_file_record() */
+
+
+/* free memory of an array of file records */
+static void
+free_sft_file_records( UINT4 numRecords, SFTFileRecord *records )
+{
+  if ( records ) {
+    for ( UINT4 i = 0; i < numRecords; i ++ ) {
+      free_sft_file_record( &records[i] );
+    }
+    XLALFree( records );
+  }
+} /* free_sft_file_records() */
+
+
+/* compare two file records by their absolute paths */
+static int
+compare_sft_file_record( const void *ptr1, const void *ptr2 )
+{
+  const SFTFileRecord *rec1 = ( const SFTFileRecord * )ptr1;
+  const SFTFileRecord *rec2 = ( const SFTFileRecord * )ptr2;
+  return strcmp( rec1->path, rec2->path );
+} /* compare_sft_file_record() */
+
+
+/* does this SFT-block satisfy the user-constraints ? */
+static BOOLEAN
+want_sft_block( const SFTtype *header, const SFTConstraints *constraints )
+{
+  if ( constraints ) {
+    if ( constraints->detector ) {
+      if ( strncmp( constraints->detector, header->name, 2 ) ) {
+        return FALSE;
+      }
+    }
+
+    if ( XLALCWGPSinRange( header->epoch, constraints->minStartTime, constraints->maxStartTime ) != 0 ) {
+      return FALSE;
+    }
+
+    if ( constraints->timestamps && !timestamp_in_list( header->epoch, constraints->timestamps ) ) {
+      return FALSE;
+    }
+
+  } /* if constraints */
+
+  return TRUE;
+
+} /* want_sft_block() */
+
+
+/* read/write a field of an SFT catalog index, and accumulate its crc64 checksum */
+#define INDEX_READ(fp, crc, ptr, size) do { \
+    if ( ( size ) > 0 ) { \
+      XLAL_CHECK( fread( ( ptr ), ( size ), 1, ( fp ) ) == 1, XLAL_EIO ); \
+      ( crc ) = crc64( ( const unsigned char * )( ptr ), ( size ), ( crc ) ); \
+    } \
+  } while(0)
+#define INDEX_WRITE(fp, crc, ptr, size) do { \
+    if ( ( size ) > 0 ) { \
+      XLAL_CHECK( fwrite( ( ptr ), ( size ), 1, ( fp ) ) == 1, XLAL_EIO ); \
+      ( crc ) = crc64( ( const unsigned char * )( ptr ), ( size ), ( crc ) ); \
+    } \
+  } while(0)
+
+/* maximum lengths of strings in an SFT catalog index, to guard against corrupted indexes */
+#define INDEX_MAX_FNAME_LEN     (1U << 16)
+#define INDEX_MAX_COMMENT_LEN   (1U << 28)
+
+/* read an SFT catalog index from file; on success, returned records are sorted by file name */
+static int
+read_sft_catalog_index_fp( FILE *fp, UINT4 *numRecords, SFTFileRecord **records )
+{
+  UINT8 crc = ~( 0ULL );
+
+  /* read and check header */
+  char magic[sizeof( SFT_INDEX_MAGIC )];
+  UINT4 version = 0, num = 0;
+  INDEX_READ( fp, crc, magic, sizeof( magic ) );
+  XLAL_CHECK( memcmp( magic, SFT_INDEX_MAGIC, sizeof( magic ) ) == 0, XLAL_EIO, "Not an SFT catalog index file\n" );
+  INDEX_READ( fp, crc, &version, sizeof( version ) );
+  XLAL_CHECK( version == SFT_INDEX_VERSION, XLAL_EIO, "Unsupported SFT catalog index version %u\n", version );
+  INDEX_READ( fp, crc, &num, sizeof( num ) );
+
+  /* read file records */
+  ( *records ) = XLALCalloc( GSL_MAX( num, 1 ), sizeof( **records ) );
+  XLAL_CHECK( ( *records ) != NULL, XLAL_ENOMEM );
+  ( *numRecords ) = num;
+  for ( UINT4 i = 0; i < num; i ++ ) {
+    SFTFileRecord *rec = &( *records )[i];
+    UINT4 path_len = 0;
+    INDEX_READ( fp, crc, &path_len, sizeof( path_len ) );
+    XLAL_CHECK( 1 < path_len && path_len < INDEX_MAX_FNAME_LEN, XLAL_EIO );
+    XLAL_CHECK( ( rec->path = XLALCalloc( path_len, 1 ) ) != NULL, XLAL_ENOMEM );
+    INDEX_READ( fp, crc, rec->path, path_len );
+    XLAL_CHECK( rec->path[0] == '/' && rec->path[path_len - 1] == '\0', XLAL_EIO );
+    INDEX_READ( fp, crc, &rec->status.size, sizeof( rec->status.size ) );
+    INDEX_READ( fp, crc, &rec->status.mtime, sizeof( rec->status.mtime ) );
+    INDEX_READ( fp, crc, &rec->status.mtime_nsec, sizeof( rec->status.mtime_nsec ) );
+    INDEX_READ( fp, crc, &rec->status.inode, sizeof( rec->status.inode ) );
+    UINT4 numBlocks = 0;
+    INDEX_READ( fp, crc, &numBlocks, sizeof( numBlocks ) );
+    XLAL_CHECK( 0 < numBlocks && ( ( INT8 ) numBlocks ) <= rec->status.size, XLAL_EIO );
+    XLAL_CHECK( ( rec->blocks = XLALCalloc( numBlocks, sizeof( rec->blocks[0] ) ) ) != NULL, XLAL_ENOMEM );
+    rec->numBlocks = numBlocks;
+    for ( UINT4 j = 0; j < numBlocks; j ++ ) {
+      SFTBlockRecord *blk = &rec->blocks[j];
+      INT8 offset = 0, dataOffset = 0;
+      UINT4 swapEndian = 0, comment_len = 0;
+      INT4 gps_sec = 0, gps_nsec = 0;
+      INDEX_READ( fp, crc, &offset, sizeof( offset ) );
+      INDEX_READ( fp, crc, &dataOffset, sizeof( dataOffset ) );
+      INDEX_READ( fp, crc, &swapEndian, sizeof( swapEndian ) );
+      INDEX_READ( fp, crc, blk->header.name, 2 );
+      INDEX_READ( fp, crc, &gps_sec, sizeof( gps_sec ) );
+      INDEX_READ( fp, crc, &gps_nsec, sizeof( gps_nsec ) );
+      INDEX_READ( fp, crc, &blk->header.f0, sizeof( blk->header.f0 ) );
+      INDEX_READ( fp, crc, &blk->header.deltaF, sizeof( blk->header.deltaF ) );
+      INDEX_READ( fp, crc, &blk->numBins, sizeof( blk->numBins ) );
+      INDEX_READ( fp, crc, &blk->version, sizeof( blk->version ) );
+      INDEX_READ( fp, crc, &blk->crc64, sizeof( blk->crc64 ) );
+      INDEX_READ( fp, crc, &blk->windowspec, sizeof( blk->windowspec ) );
+      INDEX_READ( fp, crc, &comment_len, sizeof( comment_len ) );
+      XLAL_CHECK( comment_len < INDEX_MAX_COMMENT_LEN, XLAL_EIO );
+      if ( comment_len > 0 ) {
+        XLAL_CHECK( ( blk->comment = XLALCalloc( comment_len, 1 ) ) != NULL, XLAL_ENOMEM );
+        INDEX_READ( fp, crc, blk->comment, comment_len );
+        XLAL_CHECK( blk->comment[comment_len - 1] == '\0', XLAL_EIO );
+      }
+      blk->offset = offset;
+      blk->dataOffset = dataOffset;
+      blk->swapEndian = swapEndian ? TRUE : FALSE;
+      blk->header.epoch.gpsSeconds = gps_sec;
+      blk->header.epoch.gpsNanoSeconds = gps_nsec;
+    }
+  }
+
+  /* check crc64 checksum of index */
+  UINT8 ref_crc = 0;
+  XLAL_CHECK( fread( &ref_crc, sizeof( ref_crc ), 1, fp ) == 1, XLAL_EIO );
+  XLAL_CHECK( ref_crc == crc, XLAL_EIO, "SFT catalog index has invalid crc64 checksum\n" );
+
+  /* sort records by file name, for lookup with bsearch() */
+  qsort( *records, *numRecords, sizeof( **records ), compare_sft_file_record );
+
+  return XLAL_SUCCESS;
+
+} /* read_sft_catalog_index_fp() */
+
+
+/* read an SFT catalog index; a non-existent index is returned as an empty index */
+static int
+read_sft_catalog_index( const CHAR *indexFile, UINT4 *numRecords, SFTFileRecord **records )
+{
+  ( *numRecords ) = 0;
+  ( *records ) = NULL;
+
+  FILE *fp = fopen( indexFile, "rb" );
+  if ( fp == NULL ) {
+    XLAL_CHECK( errno == ENOENT, XLAL_EIO, "Failed to open SFT catalog index '%s': %s\n", indexFile, strerror( errno ) );
+    return XLAL_SUCCESS;
+  }
+
+  int retn = read_sft_catalog_index_fp( fp, numRecords, records );
+  fclose( fp );
+  if ( retn != XLAL_SUCCESS ) {
+    free_sft_file_records( *numRecords, *records );
+    ( *numRecords ) = 0;
+    ( *records ) = NULL;
+    XLAL_ERROR( XLAL_EFUNC );
+  }
+
+  return XLAL_SUCCESS;
+
+} /* read_sft_catalog_index() */
+
+
+/* write an SFT catalog index to file */
+static int
+write_sft_catalog_index_fp( FILE *fp, UINT4 numRecords, SFTFileRecord *const *records )
+{
+  UINT8 crc = ~( 0ULL );
+
+  /* write header */
+  const UINT4 version = SFT_INDEX_VERSION;
+  INDEX_WRITE( fp, crc, SFT_INDEX_MAGIC, sizeof( SFT_INDEX_MAGIC ) );
+  INDEX_WRITE( fp, crc, &version, sizeof( version ) );
+
+  /* write file records; skip files without any SFT-blocks, which are not valid SFT files, and files without an absolute path */
+#define WANT_INDEX_RECORD(rec) ( ( rec )->numBlocks > 0 && ( rec )->status.size > 0 && ( rec )->path != NULL )
+  UINT4 num = 0;
+  for ( UINT4 i = 0; i < numRecords; i ++ ) {
+    if ( WANT_INDEX_RECORD( records[i] ) ) {
+      ++num;
+    }
+  }
+  INDEX_WRITE( fp, crc, &num, sizeof( num ) );
+  for ( UINT4 i = 0; i < numRecords; i ++ ) {
+    const SFTFileRecord *rec = records[i];
+    if ( !WANT_INDEX_RECORD( rec ) ) {
+      continue;
+    }
+    const UINT4 path_len = strlen( rec->path ) + 1;
+    INDEX_WRITE( fp, crc, &path_len, sizeof( path_len ) );
+    INDEX_WRITE( fp, crc, rec->path, path_len );
+    INDEX_WRITE( fp, crc, &rec->status.size, sizeof( rec->status.size ) );
+    INDEX_WRITE( fp, crc, &rec->status.mtime, sizeof( rec->status.mtime ) );
+    INDEX_WRITE( fp, crc, &rec->status.mtime_nsec, sizeof( rec->status.mtime_nsec ) );
+    INDEX_WRITE( fp, crc, &rec->status.inode, sizeof( rec->status.inode ) );
+    INDEX_WRITE( fp, crc, &rec->numBlocks, sizeof( rec->numBlocks ) );
+    for ( UINT4 j = 0; j < rec->numBlocks; j ++ ) {
+      const SFTBlockRecord *blk = &rec->blocks[j];
+      const INT8 offset = blk->offset, dataOffset = blk->dataOffset;
+      const UINT4 swapEndian = blk->swapEndian;
+      const INT4 gps_sec = blk->header.epoch.gpsSeconds, gps_nsec = blk->header.epoch.gpsNanoSeconds;
+      const UINT4 comment_len = ( blk->comment != NULL ) ? strlen( blk->comment ) + 1 : 0;
+      INDEX_WRITE( fp, crc, &offset, sizeof( offset ) );
+      INDEX_WRITE( fp, crc, &dataOffset, sizeof( dataOffset ) );
+      INDEX_WRITE( fp, crc, &swapEndian, sizeof( swapEndian ) );
+      INDEX_WRITE( fp, crc, blk->header.name, 2 );
+      INDEX_WRITE( fp, crc, &gps_sec, sizeof( gps_sec ) );
+      INDEX_WRITE( fp, crc, &gps_nsec, sizeof( gps_nsec ) );
+      INDEX_WRITE( fp, crc, &blk->header.f0, sizeof( blk->header.f0 ) );
+      INDEX_WRITE( fp, crc, &blk->header.deltaF, sizeof( blk->header.deltaF ) );
+      INDEX_WRITE( fp, crc, &blk->numBins, sizeof( blk->numBins ) );
+      INDEX_WRITE( fp, crc, &blk->version, sizeof( blk->version ) );
+      INDEX_WRITE( fp, crc, &blk->crc64, sizeof( blk->crc64 ) );
+      INDEX_WRITE( fp, crc, &blk->windowspec, sizeof( blk->windowspec ) );
+      INDEX_WRITE( fp, crc, &comment_len, sizeof( comment_len ) );
+      INDEX_WRITE( fp, crc, blk->comment, comment_len );
+    }
+  }
+
+#undef WANT_INDEX_RECORD
+
+  /* write crc64 checksum of index */
+  XLAL_CHECK( fwrite( &crc, sizeof( crc ), 1, fp ) == 1, XLAL_EIO );
+
+  return XLAL_SUCCESS;
+
+} /* write_sft_catalog_index_fp() */
+
+
+/* write an SFT catalog index to a temporary file, then atomically rename it to 'indexFile' */
+static int
+write_sft_catalog_index( const CHAR *indexFile, UINT4 numRecords, SFTFileRecord *const *records )
+{
+  char *tmpFile = XLALStringAppendFmt( NULL, "%s.XXXXXX", indexFile );
+  XLAL_CHECK( tmpFile != NULL, XLAL_EFUNC );
+  int fd = mkstemp( tmpFile );
+  if ( fd == -1 ) {
+    XLALFree( tmpFile );
+    XLAL_ERROR( XLAL_EIO, "Failed to create temporary file for SFT catalog index '%s': %s\n", indexFile, strerror( errno ) );
+  }
+  fchmod( fd, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH );
+  FILE *fp = fdopen( fd, "wb" );
+  if ( fp == NULL ) {
+    close( fd );
+    unlink( tmpFile );
+    XLALFree( tmpFile );
+    XLAL_ERROR( XLAL_EIO );
+  }
+  int retn = write_sft_catalog_index_fp( fp, numRecords, records );
+  if ( fclose( fp ) != 0 ) {
+    retn = XLAL_EIO;
+  }
+  if ( retn != XLAL_SUCCESS || rename( tmpFile, indexFile ) != 0 ) {
+    unlink( tmpFile );
+    XLALFree( tmpFile );
+    XLAL_ERROR( XLAL_EIO, "Failed to write SFT catalog index '%s'\n", indexFile );
+  }
+  XLALFree( tmpFile );
+  return XLAL_SUCCESS;
+} /* write_sft_catalog_index() */
+
 /// @}
@@ -25,6 +25,8 @@
 
 /*---------- includes ----------*/
 
+#include <unistd.h>
+
 #include "SFTinternal.h"
 #include "SFTReferenceLibrary.h"
 
@@ -59,6 +61,8 @@ typedef struct {
 /*---------- internal prototypes ----------*/
 
 static int read_header_from_fp( FILE *fp, SFTtype *header, UINT4 *nsamples, UINT8 *header_crc64, UINT8 *ref_crc64, UINT2 *SFTwindowspec, CHAR **SFTcomment, BOOLEAN swapEndian );
+static BOOLEAN can_load_sfts_direct( const SFTCatalog *catalog, UINT4 firstbin, UINT4 lastbin );
+static int load_sfts_direct( SFTVector *sftVector, const SFTCatalog *catalog, UINT4 firstbin );
 
 /*========== function definitions ==========*/
 
@@ -177,6 +181,14 @@ XLALLoadSFTs( const SFTCatalog *catalog,   /**< The 'catalogue' of SFTs to load
     XLALLOADSFTSERROR( XLAL_ENOMEM );
   }
 
+  /* if each SFT is a single SFT-block in a file, read the requested bins directly */
+  if ( can_load_sfts_direct( catalog, firstbin, lastbin ) ) {
+    if ( load_sfts_direct( sftVector, catalog, firstbin ) != XLAL_SUCCESS ) {
+      XLALLOADSFTSERROR( XLAL_EIO );
+    }
+    return sftVector;
+  }
+
   /* allocate an additional single SFT where SFTs are read in */
   if ( !( thisSFT = XLALCreateSFT( lastbin + 1 - firstbin ) ) ) {
     XLALPrintError( "ERROR: Couldn't create thisSFT\n" );
@@ -397,6 +409,148 @@ XLALLoadSFTs( const SFTCatalog *catalog,   /**< The 'catalogue' of SFTs to load
 } /* XLALLoadSFTs() */
 
 
+/* can XLALLoadSFTs() read bins [firstbin, lastbin] of all SFTs in the catalog using load_sfts_direct()? */
+static BOOLEAN
+can_load_sfts_direct( const SFTCatalog *catalog, UINT4 firstbin, UINT4 lastbin )
+{
+  const REAL8 deltaF = catalog->data[0].header.deltaF;
+  for ( UINT4 i = 0; i < catalog->length; i++ ) {
+    const SFTDescriptor *desc = &catalog->data[i];
+
+    /* SFT must be stored in a file, at a known data offset */
+    if ( desc->locator == NULL || desc->locator->dataOffset <= 0 || desc->header.data != NULL ) {
+      return FALSE;
+    }
+
+    /* SFT must not be split into segments across several catalog entries */
+    if ( i > 0 && GPSEQUAL( desc->header.epoch, catalog->data[i - 1].header.epoch ) ) {
+      return FALSE;
+    }
+
+    /* SFT must contain all requested bins */
+    volatile REAL8 tmp = desc->header.f0 / deltaF;
+    UINT4 firstSFTbin = lround( tmp );
+    UINT4 lastSFTbin = firstSFTbin + desc->numBins - 1;
+    if ( desc->header.deltaF != deltaF || firstbin < firstSFTbin || lastbin > lastSFTbin ) {
+      return FALSE;
+    }
+  }
+  return TRUE;
+} /* can_load_sfts_direct() */
+
+
+/* read bins starting at 'firstbin' of each SFT in the catalog into 'sftVector', using concurrent positional reads */
+static int
+load_sfts_direct( SFTVector *sftVector, const SFTCatalog *catalog, UINT4 firstbin )
+{
+  const REAL8 deltaF = catalog->data[0].header.deltaF;
+  int errflag = 0;
+  #pragma omp parallel
+  {
+
+    /* keep the last file open, since consecutive SFTs are often in the same (merged) file */
+    FILE *fp = NULL;
+    const char *fname = NULL;
+
+    /* SFTs are sorted by GPS epoch, so contiguous chunks of SFTs tend to be in the same file */
+    #pragma omp for schedule(static)
+    for ( UINT4 i = 0; i < catalog->length; i++ ) {
+      if ( errflag ) {
+        continue;
+      }
+      const SFTDescriptor *desc = &catalog->data[i];
+      const struct tagSFTLocator *locator = desc->locator;
+      SFTtype *sft = &sftVector->data[i];
+
+      /* open file if necessary */
+      if ( fname == NULL || strcmp( fname, locator->fname ) != 0 ) {
+        if ( fp != NULL ) {
+          fclose( fp );
+        }
+        fname = locator->fname;
+        if ( ( fp = fopen( fname, "rb" ) ) == NULL ) {
+          XLALPrintError( "ERROR: Couldn't open file '%s': %s\n", fname, strerror( errno ) );
+          fname = NULL;
+          #pragma omp atomic write
+          errflag = 1;
+          continue;
+        }
+      }
+
+      /* check that the SFT header at the catalogued offset still matches the catalog, in case the
+         file has changed since the catalog (or an SFT catalog index used to build it) was made */
+      SFTtype XLAL_INIT_DECL( header );
+      UINT4 version = 0, numBins = 0;
+      UINT8 crc64 = 0;
+      BOOLEAN swapEndian = 0;
+      if ( fseek( fp, locator->offset, SEEK_SET ) != 0
+           || read_sft_header_from_fp( fp, &header, &version, &crc64, NULL, &swapEndian, NULL, &numBins ) != 0
+           || ftell( fp ) != locator->dataOffset
+           || swapEndian != locator->swapEndian
+           || version != desc->version
+           || crc64 != desc->crc64
+           || numBins != desc->numBins
+           || strncmp( header.name, desc->header.name, 2 ) != 0
+           || XLALGPSCmp( &header.epoch, &desc->header.epoch ) != 0
+           || header.f0 != desc->header.f0
+           || header.deltaF != desc->header.deltaF ) {
+        XLALPrintError( "ERROR: SFT#%u (GPS %lf) in file '%s' does not match the SFT catalog; has the file changed?\n",
+                        i, GPS2REAL8( desc->header.epoch ), fname );
+        #pragma omp atomic write
+        errflag = 1;
+        continue;
+      }
+
+      /* read requested bins */
+      volatile REAL8 tmp = desc->header.f0 / deltaF;
+      const UINT4 firstSFTbin = lround( tmp );
+      const off_t offset = locator->dataOffset + ( off_t )( firstbin - firstSFTbin ) * sizeof( COMPLEX8 );
+      const size_t nbytes = sft->data->length * sizeof( COMPLEX8 );
+      const int fd = fileno( fp );
+      size_t nread = 0;
+      while ( nread < nbytes ) {
+        ssize_t n = pread( fd, ( ( char * ) sft->data->data ) + nread, nbytes - nread, offset + nread );
+        if ( n <= 0 ) {
+          break;
+        }
+        nread += n;
+      }
+      if ( nread != nbytes ) {
+        XLALPrintError( "ERROR: Failed to read %u bins of SFT#%u (GPS %lf) from file '%s'\n",
+                        sft->data->length, i, GPS2REAL8( desc->header.epoch ), fname );
+        #pragma omp atomic write
+        errflag = 1;
+        continue;
+      }
+      XLALPrintInfo( "%s: Read data from %s:%lu: %u - %u\n", __func__, fname, locator->offset, firstbin, firstbin + sft->data->length - 1 );
+
+      /* take care of endian-swapping */
+      if ( locator->swapEndian ) {
+        endian_swap( ( CHAR * ) sft->data->data, sizeof( REAL4 ), 2 * sft->data->length );
+      }
+
+      /* fill SFT header */
+      memcpy( sft->name, desc->header.name, sizeof( sft->name ) );
+      sft->epoch = desc->header.epoch;
+      sft->f0 = 1.0 * firstbin * deltaF;
+      sft->deltaF = deltaF;
+      sft->sampleUnits = desc->header.sampleUnits;
+
+    } /* for i < catalog->length */
+
+    if ( fp != NULL ) {
+      fclose( fp );
+    }
+
+  } /* omp parallel */
+
+  XLAL_CHECK( errflag == 0, XLAL_EIO );
+
+  return XLAL_SUCCESS;
+
+} /* load_sfts_direct() */
+
+
 /**
  * Function to load a catalog of SFTs from possibly different detectors.
  * This is similar to XLALLoadSFTs except that the input SFT catalog is
@@ -127,6 +127,10 @@ extern "C" {
  * <b>Note 3:</b> XLALSFTdataFind() will refuse to return any SFTs without their detector-name
  * properly set.
  *
+ * <b>Note 4:</b> the headers of large numbers of SFT files can be cached in an SFT catalog index,
+ * either by calling XLALSFTdataFindWithIndex(), or by setting the environment variable
+ * <tt>LAL_SFT_INDEX_FILE</tt> to the name of the index file to be used by XLALSFTdataFind().
+ *
  * The returned SFTCatalog is a vector of SFTDescriptor describing one SFT, with the fields
  * - \c locator:  an opaque data-type describing where to read this SFT from.
  * - \c header: the SFts header
@@ -159,6 +163,10 @@ extern "C" {
  * The function XLALLoadMultiSFTs() is similar to the above, except that it accepts an SFTCatalog with different detectors,
  * and returns corresponding multi-IFO vector of SFTVectors.
  *
+ * If every SFT in the SFTCatalog is stored in a single SFT-block covering the requested frequency-band,
+ * XLALLoadSFTs() reads only the requested frequency-bins of each SFT, using concurrent positional reads
+ * (if compiled with OpenMP).
+ *
  * <p><h2>Usage: Writing of SFT-files</h2>
  *
  * For <b>writing SFTs</b>:
@@ -439,6 +447,7 @@ LIGOTimeGPSVector *XLALTimestampsFromSegmentFile( const char *filename, REAL8 Ts
 // These functions are defined in SFTcatalog.c
 
 SFTCatalog *XLALSFTdataFind( const CHAR *file_pattern, const SFTConstraints *constraints );
+SFTCatalog *XLALSFTdataFindWithIndex( const CHAR *file_pattern, const SFTConstraints *constraints, const CHAR *indexFile );
 void XLALDestroySFTCatalog( SFTCatalog *catalog );
 
 MultiSFTCatalogView *XLALGetMultiSFTCatalogView( const SFTCatalog *catalog );
@@ -89,6 +89,8 @@ static const REAL8 fudge_down = 1 - 10 * LAL_REAL8_EPS; // about ~1 - 2e-15
 struct tagSFTLocator {
   CHAR *fname;          /* name of file containing this SFT */
   long offset;          /* SFT-offset with respect to a merged-SFT */
+  long dataOffset;      /* offset of SFT data with respect to start of file; 0 if unknown */
+  BOOLEAN swapEndian;   /* whether SFT data needs to be endian-swapped */
   UINT4 isft;           /* index of SFT this locator belongs to, used only in XLALLoadSFTs() */
 };
 
@@ -0,0 +1,105 @@
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with with program; see the file COPYING. If not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+// MA  02110-1301  USA
+//
+
+// ---------- INCLUDES ----------
+#include <string.h>
+
+#include <config.h>
+#include <simd_dispatch.h>
+
+#include <lal/SemicoherentSum.h>
+
+#include "SemicoherentSum_internal.h"
+
+// ---------- local constants ----------
+
+// Number of frequency bins processed at a time by XLALVectorsSemicoherentSumREAL4(); chosen so that
+// the outputs for one block stay in L1 cache while the coherent results of all segments are added
+#define SEMICOHERENT_BLOCK_LEN 1024
+
+//==================== FUNCTION DEFINITIONS ====================*/
+
+// -------------------- dispatch of SIMD-specific functions --------------------
+
+static int XLALVectorSemicoherentAddREAL4_DISPATCH SEMICOHERENTADD_ARG_DEF;
+
+static int ( *XLALVectorSemicoherentAddREAL4_ptr ) SEMICOHERENTADD_ARG_DEF = XLALVectorSemicoherentAddREAL4_DISPATCH;
+const char *XLALVectorSemicoherentAddREAL4_name = "\0";
+
+int XLALVectorSemicoherentAddREAL4_DISPATCH( REAL4 *sum2F, REAL4 *max2F, UINT4 *max2FSeg, UINT4 *count, const REAL4 threshold, const REAL4 *coh2F, const UINT4 segment, const UINT4 len )
+{
+
+  DISPATCH_SELECT_BEGIN();
+  DISPATCH_SELECT_AVX512F( XLALVectorSemicoherentAddREAL4_ptr = XLALVectorSemicoherentAddREAL4_AVX512F, XLALVectorSemicoherentAddREAL4_name = "XLALVectorSemicoherentAddREAL4_AVX512F" );
+  DISPATCH_SELECT_AVX2( XLALVectorSemicoherentAddREAL4_ptr = XLALVectorSemicoherentAddREAL4_AVX2, XLALVectorSemicoherentAddREAL4_name = "XLALVectorSemicoherentAddREAL4_AVX2" );
+  DISPATCH_SELECT_END( XLALVectorSemicoherentAddREAL4_ptr = XLALVectorSemicoherentAddREAL4_GEN, XLALVectorSemicoherentAddREAL4_name = "XLALVectorSemicoherentAddREAL4_GEN" );
+
+  return ( XLALVectorSemicoherentAddREAL4_ptr )( sum2F, max2F, max2FSeg, count, threshold, coh2F, segment, len );
+
+}
+
+// -------------------- exported functions --------------------
+
+int XLALVectorSemicoherentAddREAL4( REAL4 *sum2F, REAL4 *max2F, UINT4 *max2FSeg, UINT4 *count, const REAL4 threshold, const REAL4 *coh2F, const UINT4 segment, const UINT4 len )
+{
+
+  // Check input
+  XLAL_CHECK( coh2F != NULL, XLAL_EFAULT );
+  XLAL_CHECK( max2FSeg == NULL || max2F != NULL, XLAL_EINVAL );
+
+  return ( XLALVectorSemicoherentAddREAL4_ptr )( sum2F, max2F, max2FSeg, count, threshold, coh2F, segment, len );
+
+}
+
+int XLALVectorsSemicoherentSumREAL4( REAL4 *sum2F, REAL4 *max2F, UINT4 *count, const REAL4 threshold, const REAL4 **coh2F, const UINT4 nsegments, const UINT4 len )
+{
+
+  // Check input
+  XLAL_CHECK( coh2F != NULL, XLAL_EFAULT );
+  XLAL_CHECK( nsegments > 0, XLAL_EINVAL );
+  for ( UINT4 j = 0; j < nsegments; ++j ) {
+    XLAL_CHECK( coh2F[j] != NULL, XLAL_EFAULT );
+  }
+
+  for ( UINT4 i0 = 0; i0 < len; i0 += SEMICOHERENT_BLOCK_LEN ) {
+    const UINT4 n = ( len - i0 < SEMICOHERENT_BLOCK_LEN ) ? len - i0 : SEMICOHERENT_BLOCK_LEN;
+    REAL4 *sum2F_i0 = ( sum2F != NULL ) ? sum2F + i0 : NULL;
+    REAL4 *max2F_i0 = ( max2F != NULL ) ? max2F + i0 : NULL;
+    UINT4 *count_i0 = ( count != NULL ) ? count + i0 : NULL;
+
+    // Initialise outputs from first segment
+    if ( sum2F_i0 != NULL ) {
+      memcpy( sum2F_i0, coh2F[0] + i0, sizeof( sum2F_i0[0] ) * n );
+    }
+    if ( max2F_i0 != NULL ) {
+      memcpy( max2F_i0, coh2F[0] + i0, sizeof( max2F_i0[0] ) * n );
+    }
+    if ( count_i0 != NULL ) {
+      memset( count_i0, 0, sizeof( count_i0[0] ) * n );
+      XLAL_CHECK( ( XLALVectorSemicoherentAddREAL4_ptr )( NULL, NULL, NULL, count_i0, threshold, coh2F[0] + i0, 0, n ) == XLAL_SUCCESS, XLAL_EFUNC );
+    }
+
+    // Add remaining segments
+    for ( UINT4 j = 1; j < nsegments; ++j ) {
+      XLAL_CHECK( ( XLALVectorSemicoherentAddREAL4_ptr )( sum2F_i0, max2F_i0, NULL, count_i0, threshold, coh2F[j] + i0, j, n ) == XLAL_SUCCESS, XLAL_EFUNC );
+    }
+
+  }
+
+  return XLAL_SUCCESS;
+
+}
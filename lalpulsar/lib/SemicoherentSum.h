@@ -0,0 +1,82 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with with program; see the file COPYING. If not, write to the
+ * Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA  02110-1301  USA
+ *
+ */
+
+#ifndef _SEMICOHERENTSUM_H
+#define _SEMICOHERENTSUM_H
+
+#include <lal/LALStdlib.h>
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \defgroup SemicoherentSum_h Header SemicoherentSum.h
+ * \ingroup lalpulsar_coh
+ *
+ * \brief Fused kernels for combining per-segment coherent \f$2\mathcal{F}\f$ into semicoherent statistics.
+ *
+ * ### Synopsis ###
+ *
+ * \code
+ * #include <lal/SemicoherentSum.h>
+ * \endcode
+ *
+ * A semicoherent search combines the coherent \f$2\mathcal{F}\f$ values of each segment, at matching frequency bins,
+ * into a sum over segments, a maximum over segments (optionally recording the segment which attained it), and a
+ * number count of segments above a threshold.  The functions in this module compute all requested statistics in a
+ * single pass over each segment, using the most advanced SIMD instruction set (AVX2, AVX-512F) available at runtime,
+ * in the same way as the functions in \ref VectorMath_h.
+ *
+ * Any of the output arrays may be \c NULL, in which case that statistic is not computed.
+ *
+ * ### Alignment ###
+ *
+ * Neither input nor output arrays are \b required to have any particular memory alignment.
+ */
+/** @{ */
+
+/**
+ * Add the coherent \f$2\mathcal{F}\f$ values \c coh2F of segment \c segment to semicoherent statistics over \c len frequency bins:
+ * - <tt>sum2F += coh2F</tt>
+ * - <tt>max2F = max(max2F, coh2F)</tt>, and <tt>max2FSeg = segment</tt> wherever <tt>max2F <= coh2F</tt>
+ * - <tt>count += (coh2F > threshold)</tt>
+ *
+ * Intended to be called once per segment, in ascending order of segments, on outputs which have been initialised by the caller.
+ * \c max2FSeg may only be given if \c max2F is also given.
+ */
+int XLALVectorSemicoherentAddREAL4( REAL4 *sum2F, REAL4 *max2F, UINT4 *max2FSeg, UINT4 *count, const REAL4 threshold, const REAL4 *coh2F, const UINT4 segment, const UINT4 len );
+
+/**
+ * Compute semicoherent statistics over \c len frequency bins from the coherent \f$2\mathcal{F}\f$ values
+ * <tt>coh2F[0], ..., coh2F[nsegments-1]</tt> of \c nsegments segments:
+ * - <tt>sum2F = coh2F[0] + coh2F[1] + ...</tt>
+ * - <tt>max2F = max(coh2F[0], coh2F[1], ...)</tt>
+ * - <tt>count = (coh2F[0] > threshold) + (coh2F[1] > threshold) + ...</tt>
+ *
+ * Outputs are overwritten.  Frequency bins are processed in blocks small enough to remain in cache while all segments are added.
+ */
+int XLALVectorsSemicoherentSumREAL4( REAL4 *sum2F, REAL4 *max2F, UINT4 *count, const REAL4 threshold, const REAL4 **coh2F, const UINT4 nsegments, const UINT4 len );
+
+/** @} */
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif /* _SEMICOHERENTSUM_H */
@@ -0,0 +1,88 @@
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with with program; see the file COPYING. If not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+// MA  02110-1301  USA
+//
+
+// ---------- INCLUDES ----------
+#include <math.h>
+#include <config.h>
+
+#include <lal/SemicoherentSum.h>
+
+#include "SemicoherentSum_internal.h"
+
+#include <immintrin.h>
+
+#ifndef __AVX2__
+#error "SemicoherentSum_AVX2.c must be compiled with AVX2 support"
+#endif
+
+//==================== FUNCTION DEFINITIONS ====================*/
+
+int XLALVectorSemicoherentAddREAL4_AVX2( REAL4 *sum2F, REAL4 *max2F, UINT4 *max2FSeg, UINT4 *count, const REAL4 threshold, const REAL4 *coh2F, const UINT4 segment, const UINT4 len )
+{
+
+  const __m256 vthreshold = _mm256_set1_ps( threshold );
+  const __m256i vsegment = _mm256_set1_epi32( ( int ) segment );
+
+  UINT4 i = 0;
+
+  // Process 8 frequency bins at a time; comparisons yield all-ones lanes, which are used
+  // directly as blend masks, and subtracted from the number count to increment it
+  for ( ; i + 8 <= len; i += 8 ) {
+
+    const __m256 c = _mm256_loadu_ps( coh2F + i );
+
+    if ( sum2F != NULL ) {
+      _mm256_storeu_ps( sum2F + i, _mm256_add_ps( _mm256_loadu_ps( sum2F + i ), c ) );
+    }
+
+    if ( max2F != NULL ) {
+      const __m256 m = _mm256_loadu_ps( max2F + i );
+      if ( max2FSeg != NULL ) {
+        const __m256i louder = _mm256_castps_si256( _mm256_cmp_ps( m, c, _CMP_LE_OQ ) );
+        const __m256i s = _mm256_loadu_si256( ( const __m256i * )( max2FSeg + i ) );
+        _mm256_storeu_si256( ( __m256i * )( max2FSeg + i ), _mm256_blendv_epi8( s, vsegment, louder ) );
+      }
+      _mm256_storeu_ps( max2F + i, _mm256_max_ps( c, m ) );
+    }
+
+    if ( count != NULL ) {
+      const __m256i above = _mm256_castps_si256( _mm256_cmp_ps( vthreshold, c, _CMP_LT_OQ ) );
+      const __m256i n = _mm256_loadu_si256( ( const __m256i * )( count + i ) );
+      _mm256_storeu_si256( ( __m256i * )( count + i ), _mm256_sub_epi32( n, above ) );
+    }
+
+  }
+
+  // Process remaining frequency bins
+  for ( ; i < len; ++i ) {
+    if ( sum2F != NULL ) {
+      sum2F[i] += coh2F[i];
+    }
+    if ( max2F != NULL ) {
+      if ( max2FSeg != NULL ) {
+        max2FSeg[i] = ( max2F[i] <= coh2F[i] ) ? segment : max2FSeg[i];
+      }
+      max2F[i] = fmaxf( max2F[i], coh2F[i] );
+    }
+    if ( count != NULL ) {
+      count[i] += ( threshold < coh2F[i] );
+    }
+  }
+
+  return XLAL_SUCCESS;
+
+}
@@ -0,0 +1,71 @@
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with with program; see the file COPYING. If not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+// MA  02110-1301  USA
+//
+
+// ---------- INCLUDES ----------
+#include <config.h>
+
+#include <lal/SemicoherentSum.h>
+
+#include "SemicoherentSum_internal.h"
+
+#include <immintrin.h>
+
+#ifndef __AVX512F__
+#error "SemicoherentSum_AVX512F.c must be compiled with AVX-512F support"
+#endif
+
+//==================== FUNCTION DEFINITIONS ====================*/
+
+int XLALVectorSemicoherentAddREAL4_AVX512F( REAL4 *sum2F, REAL4 *max2F, UINT4 *max2FSeg, UINT4 *count, const REAL4 threshold, const REAL4 *coh2F, const UINT4 segment, const UINT4 len )
+{
+
+  const __m512 vthreshold = _mm512_set1_ps( threshold );
+  const __m512i vsegment = _mm512_set1_epi32( ( int ) segment );
+  const __m512i vone = _mm512_set1_epi32( 1 );
+
+  // Process 16 frequency bins at a time; the remaining bins are handled by the last
+  // iteration using masked loads and stores, so no scalar loop is needed
+  for ( UINT4 i = 0; i < len; i += 16 ) {
+
+    const __mmask16 k = ( len - i >= 16 ) ? ( __mmask16 ) 0xFFFF : ( __mmask16 )( ( 1u << ( len - i ) ) - 1 );
+
+    const __m512 c = _mm512_maskz_loadu_ps( k, coh2F + i );
+
+    if ( sum2F != NULL ) {
+      _mm512_mask_storeu_ps( sum2F + i, k, _mm512_add_ps( _mm512_maskz_loadu_ps( k, sum2F + i ), c ) );
+    }
+
+    if ( max2F != NULL ) {
+      const __m512 m = _mm512_maskz_loadu_ps( k, max2F + i );
+      if ( max2FSeg != NULL ) {
+        const __mmask16 louder = _mm512_mask_cmp_ps_mask( k, m, c, _CMP_LE_OQ );
+        _mm512_mask_storeu_epi32( max2FSeg + i, louder, vsegment );
+      }
+      _mm512_mask_storeu_ps( max2F + i, k, _mm512_max_ps( c, m ) );
+    }
+
+    if ( count != NULL ) {
+      const __mmask16 above = _mm512_mask_cmp_ps_mask( k, vthreshold, c, _CMP_LT_OQ );
+      const __m512i n = _mm512_maskz_loadu_epi32( k, count + i );
+      _mm512_mask_storeu_epi32( count + i, k, _mm512_mask_add_epi32( n, above, n, vone ) );
+    }
+
+  }
+
+  return XLAL_SUCCESS;
+
+}
@@ -0,0 +1,57 @@
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with with program; see the file COPYING. If not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+// MA  02110-1301  USA
+//
+
+// ---------- INCLUDES ----------
+#include <math.h>
+#include <config.h>
+
+#include <lal/SemicoherentSum.h>
+
+#include "SemicoherentSum_internal.h"
+
+//==================== FUNCTION DEFINITIONS ====================*/
+
+int XLALVectorSemicoherentAddREAL4_GEN( REAL4 *sum2F, REAL4 *max2F, UINT4 *max2FSeg, UINT4 *count, const REAL4 threshold, const REAL4 *coh2F, const UINT4 segment, const UINT4 len )
+{
+
+  if ( sum2F != NULL ) {
+    for ( UINT4 i = 0; i < len; ++i ) {
+      sum2F[i] += coh2F[i];
+    }
+  }
+
+  if ( max2FSeg != NULL ) {
+    for ( UINT4 i = 0; i < len; ++i ) {
+      max2FSeg[i] = ( max2F[i] <= coh2F[i] ) ? segment : max2FSeg[i];
+    }
+  }
+
+  if ( max2F != NULL ) {
+    for ( UINT4 i = 0; i < len; ++i ) {
+      max2F[i] = fmaxf( max2F[i], coh2F[i] );
+    }
+  }
+
+  if ( count != NULL ) {
+    for ( UINT4 i = 0; i < len; ++i ) {
+      count[i] += ( threshold < coh2F[i] );
+    }
+  }
+
+  return XLAL_SUCCESS;
+
+}
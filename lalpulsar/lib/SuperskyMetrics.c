@@ -819,9 +819,7 @@ int XLALFITSWriteSuperskyMetrics(
   {
     XLAL_CHECK( XLALFITSTableOpenWrite( file, "coh_rssky_transf", "coherent supersky metric transform data" ) == XLAL_SUCCESS, XLAL_EFUNC );
     XLAL_CHECK( fits_table_init_SuperskyTransformData( file ) == XLAL_SUCCESS, XLAL_EFUNC );
-    for ( size_t i = 0; i < metrics->num_segments; ++i ) {
-      XLAL_CHECK( XLALFITSTableWriteRow( file, metrics->coh_rssky_transf[i] ) == XLAL_SUCCESS, XLAL_EFUNC );
-    }
+    XLAL_CHECK( XLALFITSTableWriteRows( file, ( const void *const * ) metrics->coh_rssky_transf, metrics->num_segments ) == XLAL_SUCCESS, XLAL_EFUNC );
   }
 
   // Write semicoherent metric to a FITS array
@@ -880,8 +878,8 @@ int XLALFITSReadSuperskyMetrics(
     for ( size_t i = 0; i < ( *metrics )->num_segments; ++i ) {
       ( *metrics )->coh_rssky_transf[i] = XLALCalloc( 1, sizeof( *( *metrics )->coh_rssky_transf[i] ) );
       XLAL_CHECK( ( *metrics )->coh_rssky_transf[i] != NULL, XLAL_ENOMEM );
-      XLAL_CHECK( XLALFITSTableReadRow( file, ( *metrics )->coh_rssky_transf[i], &nrows ) == XLAL_SUCCESS, XLAL_EFUNC );
     }
+    XLAL_CHECK( XLALFITSTableReadRows( file, ( void *const * )( *metrics )->coh_rssky_transf, ( *metrics )->num_segments, &nrows ) == XLAL_SUCCESS, XLAL_EFUNC );
   }
 
   // Read semicoherent metric from a FITS array
@@ -207,6 +207,12 @@ static const struct {
 /* highest supported spindown-order */
 #define MAX_SPDNORDER 4
 
+/* number of Gauss-Legendre nodes per integration unit used by the fixed-quadrature metric, and by the
+ * lower-order rule used to estimate its error; both rules are evaluated at every integration unit */
+#define FIXEDQUAD_NODES_HI 16
+#define FIXEDQUAD_NODES_LO 12
+#define FIXEDQUAD_NUM_NODES ( FIXEDQUAD_NODES_HI + FIXEDQUAD_NODES_LO )
+
 /** 5-point derivative formulas (eg see http://math.fullerton.edu/mathews/articles/2003NumericalDiffFormulae.pdf) */
 #define DERIV5P_1(pm2,pm1,p0,pp1,pp2,h) ( ( (pm2) - 8.0 * (pm1) + 8.0 * (pp1) - (pp2)) / ( 12.0 * (h) ) )
 #define DERIV5P_2(pm2,pm1,p0,pp1,pp2,h) ( (-(pm2) + 16.0 * (pm1) - 30.0 * (p0) + 16.0 * (pp1) - (pp2) ) / ( 12.0 * (h) * (h) ) )
@@ -248,6 +254,14 @@ typedef struct {
   BOOLEAN approxPhase;                  /**< use an approximate phase-model, neglecting Roemer delay in spindown coordinates (or orders \>= 1) */
 } intparams_t;
 
+/** integration 'unit' used by the fixed-quadrature metric */
+typedef struct {
+  UINT4 k;                              /**< segment index */
+  UINT4 X;                              /**< detector index */
+  double ti;                            /**< integration start time, in units of the segment length */
+  double tf;                            /**< integration end time, in units of the segment length */
+} FixedQuadUnit;
+
 
 /*---------- Global variables ----------*/
 
@@ -266,6 +280,9 @@ static double CW_Phi_i( double tt, void *params );
 static double XLALAverage_am1_am2_Phi_i_Phi_j( const intparams_t *params, double *relerr_max );
 static double XLALCovariance_Phi_ij( const MultiLALDetector *multiIFO, const MultiNoiseFloor *multiNoiseFloor, const LALSegList *segList,
                                      const intparams_t *params, double *relerr_max );
+static int XLALCovariance_Phi_all( gsl_matrix *g_ij, double *relerr_max, const MultiLALDetector *multiIFO, const MultiNoiseFloor *multiNoiseFloor,
+                                   const LALSegList *segList, const intparams_t *params );
+static int XLALComputeAtomsFixedQuadrature( FmetricAtoms_t *atoms, const DopplerMetricParams *metricParams, const intparams_t *params );
 
 static UINT4 findHighestGCSpinOrder( const DopplerCoordinateSystem *coordSys );
 
@@ -472,55 +489,58 @@ XLALComputePhaseDerivative( REAL8 t,                                        ///<
 }  // XLALComputePhaseDerivativeSSB()
 
 /**
- * Partial derivative of continuous-wave (CW) phase, with respect
- * to Doppler coordinate 'i' := intparams_t->phderiv
+ * Time-dependent quantities shared by all partial derivatives of the continuous-wave (CW) phase
+ * at a given time; computed once by CW_PhaseDerivState() and then used by CW_PhaseDerivCoord()
+ * for every Doppler coordinate.
+ */
+typedef struct {
+  REAL8 cosa, sina, cosd, sind;         /**< trigonometric functions of the sky position */
+  vect3D_t nn_equ, nn_ecl;              /**< skypos unit vector in equatorial and ecliptic coordinates */
+  vect3D_t pos, spin_pos;               /**< total and spin-only detector position, in units of SCALE_R */
+  vect3D_t ecl_pos, ecl_orbit_pos;      /**< total and orbit-only detector position in ecliptic coordinates */
+  vect3D_t rr_ord_Equ, rr_ord_Ecl;      /**< 'reduced' detector position in equatorial and ecliptic coordinates */
+  REAL8 Freq;                           /**< frequency of Doppler point */
+  REAL8 tau;                            /**< time since reference time, in units of SCALE_T */
+  REAL8 orb_asini, orb_Omega, orb_kappa, orb_eta, orb_phase;    /**< binary orbital parameters */
+  REAL8 sinPsi, cosPsi, sin2Psi, cos2Psi;                       /**< trigonometric functions of the binary orbital phase */
+} PhaseDerivState_t;
+
+/**
+ * Compute the time-dependent quantities needed by CW_PhaseDerivCoord() at time 'tt'.
+ * This contains the single (expensive) call to XLALDetectorPosVel() per time.
  *
  * Time is in 'natural units' of Tspan, i.e. tt is in [0, 1] corresponding
  * to GPS-times in [startTime, startTime + Tspan ]
- *
  */
-static double
-CW_Phi_i( double tt, void *params )
+static int
+CW_PhaseDerivState( PhaseDerivState_t *st, double tt, const intparams_t *par )
 {
-  intparams_t *par = ( intparams_t * ) params;
-  if ( par->errnum ) {
-    return GSL_NAN;
-  }
-
-  vect3D_t nn_equ, nn_ecl;      /* skypos unit vector */
-  vect3D_t nDeriv_i;    /* derivative of sky-pos vector wrt i */
-
   /* positions/velocities at time tt: */
   PosVel3D_t XLAL_INIT_DECL( spin_posvel );
   PosVel3D_t XLAL_INIT_DECL( orbit_posvel );
   PosVel3D_t XLAL_INIT_DECL( posvel );
 
-  /* positions in ecliptic plane */
-  vect3D_t XLAL_INIT_DECL( ecl_orbit_pos );
-  vect3D_t XLAL_INIT_DECL( ecl_pos );
-
   /* get skypos-vector */
-  const REAL8 cosa = cos( par->dopplerPoint->Alpha );
-  const REAL8 sina = sin( par->dopplerPoint->Alpha );
-  const REAL8 cosd = cos( par->dopplerPoint->Delta );
-  const REAL8 sind = sin( par->dopplerPoint->Delta );
+  const REAL8 cosa = st->cosa = cos( par->dopplerPoint->Alpha );
+  const REAL8 sina = st->sina = sin( par->dopplerPoint->Alpha );
+  const REAL8 cosd = st->cosd = cos( par->dopplerPoint->Delta );
+  const REAL8 sind = st->sind = sin( par->dopplerPoint->Delta );
 
   /* ... in an equatorial coordinate-frame */
-  nn_equ[0] = cosd * cosa;
-  nn_equ[1] = cosd * sina;
-  nn_equ[2] = sind;
+  st->nn_equ[0] = cosd * cosa;
+  st->nn_equ[1] = cosd * sina;
+  st->nn_equ[2] = sind;
 
   /* and in an ecliptic coordinate-frame */
-  EQU_VECT_TO_ECL( nn_ecl, nn_equ );
+  EQU_VECT_TO_ECL( st->nn_ecl, st->nn_equ );
 
   /* get current detector position r(t) and velocity v(t) */
   REAL8 ttSI = par->startTime + tt * par->Tspan;        /* current GPS time in seconds */
   LIGOTimeGPS ttGPS;
   XLALGPSSetREAL8( &ttGPS, ttSI );
   if ( XLALDetectorPosVel( &spin_posvel, &orbit_posvel, &ttGPS, par->site, par->edat, par->detMotionType ) != XLAL_SUCCESS ) {
-    par->errnum = xlalErrno;
     XLALPrintError( "%s: Call to XLALDetectorPosVel() failed!\n", __func__ );
-    return GSL_NAN;
+    return xlalErrno;
   }
 
   /* XLALDetectorPosVel() returns detector positions and velocities from XLALBarycenter(),
@@ -538,11 +558,14 @@ CW_Phi_i( double tt, void *params )
   ADD_VECT( posvel.vel, orbit_posvel.vel );
 
   /* compute detector positions projected onto ecliptic plane */
-  EQU_VECT_TO_ECL( ecl_orbit_pos, orbit_posvel.pos );
-  EQU_VECT_TO_ECL( ecl_pos, posvel.pos );
+  EQU_VECT_TO_ECL( st->ecl_orbit_pos, orbit_posvel.pos );
+  EQU_VECT_TO_ECL( st->ecl_pos, posvel.pos );
+
+  COPY_VECT( st->pos, posvel.pos );
+  COPY_VECT( st->spin_pos, spin_posvel.pos );
 
   /* get frequency of Doppler point */
-  const REAL8 Freq = par->dopplerPoint->fkdot[0];
+  st->Freq = par->dopplerPoint->fkdot[0];
 
   /* get time span, normalised by internal scale SCALE_R */
   const REAL8 Tspan = par->Tspan / SCALE_T;
@@ -556,7 +579,7 @@ CW_Phi_i( double tt, void *params )
   /* correct for time-delay from SSB to detector (Roemer delay), neglecting relativistic effects */
   if ( !par->approxPhase ) {
     /* SSB time-delay in internal scaled units */
-    REAL8 dTRoemer = DOT_VECT( nn_equ, posvel.pos ) * ( SCALE_R / LAL_C_SI / SCALE_T );
+    REAL8 dTRoemer = DOT_VECT( st->nn_equ, posvel.pos ) * ( SCALE_R / LAL_C_SI / SCALE_T );
 
     tau += dTRoemer;
   }
@@ -564,9 +587,8 @@ CW_Phi_i( double tt, void *params )
   /* get 'reduced' detector position of order 'n': r_n(t) [passed in as argument]
    * defined as: r_n(t) = r(t) - dot{r_orb}(tau_ref) tau - 1/2! ddot{r_orb}(tau_re) tau^2 - ....
    */
-  vect3D_t rr_ord_Equ, rr_ord_Ecl;
   UINT4 i, n;
-  COPY_VECT( rr_ord_Equ, posvel.pos );          /* 0th order */
+  COPY_VECT( st->rr_ord_Equ, posvel.pos );          /* 0th order */
   if ( par->rOrb_n ) {
     /* par->rOrb_n are derivatives with SI time units, so multiply tau by SCALE_T */
     const double tauSI = tau * SCALE_T;
@@ -576,24 +598,212 @@ CW_Phi_i( double tt, void *params )
          We then divide by the internal scale SCALE_R. */
       REAL8 pre_n = LAL_FACT_INV[n] * pow( tauSI, n ) * ( LAL_C_SI / SCALE_R );
       for ( i = 0; i < 3; i++ ) {
-        rr_ord_Equ[i] -=  pre_n * par->rOrb_n->data[n][i];
+        st->rr_ord_Equ[i] -=  pre_n * par->rOrb_n->data[n][i];
       }
     }
   } /* if rOrb_n */
-  EQU_VECT_TO_ECL( rr_ord_Ecl, rr_ord_Equ );      /* convert into ecliptic coordinates */
+  EQU_VECT_TO_ECL( st->rr_ord_Ecl, st->rr_ord_Equ );      /* convert into ecliptic coordinates */
 
   // ---------- prepare shortcuts for binary orbital parameters ----------
   // See Leaci, Prix, PRD91, 102003 (2015):  DOI:10.1103/PhysRevD.91.102003
-  REAL8 orb_asini = par->dopplerPoint->asini;
-  REAL8 orb_Omega = ( LAL_TWOPI / par->dopplerPoint->period );
-  REAL8 orb_kappa = par->dopplerPoint->ecc * cos( par->dopplerPoint->argp );    // Eq.(33)
-  REAL8 orb_eta   = par->dopplerPoint->ecc * sin( par->dopplerPoint->argp );    // Eq.(34)
+  st->orb_asini = par->dopplerPoint->asini;
+  const REAL8 orb_Omega = st->orb_Omega = ( LAL_TWOPI / par->dopplerPoint->period );
+  st->orb_kappa = par->dopplerPoint->ecc * cos( par->dopplerPoint->argp );    // Eq.(33)
+  st->orb_eta   = par->dopplerPoint->ecc * sin( par->dopplerPoint->argp );    // Eq.(34)
+
+  const REAL8 orb_phase = st->orb_phase = par->dopplerPoint->argp + orb_Omega * ( ttSI - XLALGPSGetREAL8( &( par->dopplerPoint->tp ) ) ); // Eq.(35),(36)
+  st->sinPsi  = sin( orb_phase );
+  st->cosPsi  = cos( orb_phase );
+  st->sin2Psi = sin( 2.0 * orb_phase );
+  st->cos2Psi = cos( 2.0 * orb_phase );
+
+  st->tau = tau;
 
-  REAL8 orb_phase = par->dopplerPoint->argp + orb_Omega * ( ttSI - XLALGPSGetREAL8( &( par->dopplerPoint->tp ) ) ); // Eq.(35),(36)
-  REAL8 sinPsi  = sin( orb_phase );
-  REAL8 cosPsi  = cos( orb_phase );
-  REAL8 sin2Psi = sin( 2.0 * orb_phase );
-  REAL8 cos2Psi = cos( 2.0 * orb_phase );
+  return XLAL_SUCCESS;
+
+} /* CW_PhaseDerivState() */
+
+
+/**
+ * Partial derivative of continuous-wave (CW) phase, with respect to the Doppler coordinate
+ * with index 'coord', evaluated from the time-dependent quantities computed by CW_PhaseDerivState().
+ * The result is in the internal scaled units of CW_Phi_i().
+ */
+static int
+CW_PhaseDerivCoord( REAL8 *phi_out, const PhaseDerivState_t *st, const intparams_t *par, int coord )
+{
+  vect3D_t nDeriv_i;    /* derivative of sky-pos vector wrt i */
+
+  const REAL8 cosa = st->cosa, sina = st->sina, cosd = st->cosd, sind = st->sind;
+  const REAL8 *nn_equ = st->nn_equ, *nn_ecl = st->nn_ecl;
+  const REAL8 *ecl_pos = st->ecl_pos, *ecl_orbit_pos = st->ecl_orbit_pos;
+  const REAL8 *rr_ord_Equ = st->rr_ord_Equ, *rr_ord_Ecl = st->rr_ord_Ecl;
+  const REAL8 Freq = st->Freq, tau = st->tau;
+  const REAL8 orb_asini = st->orb_asini, orb_Omega = st->orb_Omega, orb_kappa = st->orb_kappa, orb_eta = st->orb_eta, orb_phase = st->orb_phase;
+  const REAL8 sinPsi = st->sinPsi, cosPsi = st->cosPsi, sin2Psi = st->sin2Psi, cos2Psi = st->cos2Psi;
+
+  REAL8 phi = 0.0;
+  const DopplerCoordinateID deriv = GET_COORD_ID( par->coordSys, coord );
+  switch ( deriv ) {
+
+  case DOPPLERCOORD_FREQ:             /**< Frequency [Units: Hz]. */
+  case DOPPLERCOORD_GC_NU0:           /**< Global correlation frequency [Units: Hz]. Activates 'reduced' detector position. */
+    phi = LAL_TWOPI * tau * LAL_FACT_INV[1];
+    break;
+  case DOPPLERCOORD_F1DOT:            /**< First spindown [Units: Hz/s]. */
+  case DOPPLERCOORD_GC_NU1:           /**< Global correlation first spindown [Units: Hz/s]. Activates 'reduced' detector position. */
+    phi = LAL_TWOPI * POW2( tau ) * LAL_FACT_INV[2];
+    break;
+  case DOPPLERCOORD_F2DOT:            /**< Second spindown [Units: Hz/s^2]. */
+  case DOPPLERCOORD_GC_NU2:           /**< Global correlation second spindown [Units: Hz/s^2]. Activates 'reduced' detector position. */
+    phi = LAL_TWOPI * POW3( tau ) * LAL_FACT_INV[3];
+    break;
+  case DOPPLERCOORD_F3DOT:            /**< Third spindown [Units: Hz/s^3]. */
+  case DOPPLERCOORD_GC_NU3:           /**< Global correlation third spindown [Units: Hz/s^3]. Activates 'reduced' detector position. */
+    phi = LAL_TWOPI * POW4( tau ) * LAL_FACT_INV[4];
+    break;
+  case DOPPLERCOORD_F4DOT:            /**< Fourth spindown [Units: Hz/s^4]. */
+  case DOPPLERCOORD_GC_NU4:           /**< Global correlation fourth spindown [Units: Hz/s^4]. Activates 'reduced' detector position. */
+    phi = LAL_TWOPI * POW5( tau ) * LAL_FACT_INV[5];
+    break;
+
+  case DOPPLERCOORD_ALPHA:            /**< Right ascension [Units: radians]. Uses 'reduced' detector position. */
+    nDeriv_i[0] = - cosd * sina;
+    nDeriv_i[1] =   cosd * cosa;
+    nDeriv_i[2] =   0;
+    phi = LAL_TWOPI * Freq * DOT_VECT( rr_ord_Equ, nDeriv_i );
+    break;
+  case DOPPLERCOORD_DELTA:            /**< Declination [Units: radians]. Uses 'reduced' detector position. */
+    nDeriv_i[0] = - sind * cosa;
+    nDeriv_i[1] = - sind * sina;
+    nDeriv_i[2] =   cosd;
+    phi = LAL_TWOPI * Freq * DOT_VECT( rr_ord_Equ, nDeriv_i );
+    break;
+
+  case DOPPLERCOORD_N2X_EQU:          /**< X component of constrained sky position in equatorial coordinates [Units: none]. Uses 'reduced' detector position. */
+    phi = LAL_TWOPI * Freq * ( rr_ord_Equ[0] - ( nn_equ[0] / nn_equ[2] ) * rr_ord_Equ[2] );
+    break;
+  case DOPPLERCOORD_N2Y_EQU:          /**< Y component of constrained sky position in equatorial coordinates [Units: none]. Uses 'reduced' detector position. */
+    phi = LAL_TWOPI * Freq * ( rr_ord_Equ[1] - ( nn_equ[1] / nn_equ[2] ) * rr_ord_Equ[2] );
+    break;
+
+  case DOPPLERCOORD_N2X_ECL:          /**< X component of constrained sky position in ecliptic coordinates [Units: none]. Uses 'reduced' detector position. */
+    phi = LAL_TWOPI * Freq * ( rr_ord_Ecl[0] - ( nn_ecl[0] / nn_ecl[2] ) * rr_ord_Ecl[2] );
+    break;
+  case DOPPLERCOORD_N2Y_ECL:          /**< Y component of constrained sky position in ecliptic coordinates [Units: none]. Uses 'reduced' detector position. */
+    phi = LAL_TWOPI * Freq * ( rr_ord_Ecl[1] - ( nn_ecl[1] / nn_ecl[2] ) * rr_ord_Ecl[2] );
+    break;
+
+  case DOPPLERCOORD_N3X_EQU:          /**< X component of unconstrained super-sky position in equatorial coordinates [Units: none]. */
+    phi = LAL_TWOPI * Freq * st->pos[0];
+    break;
+  case DOPPLERCOORD_N3Y_EQU:          /**< Y component of unconstrained super-sky position in equatorial coordinates [Units: none]. */
+    phi = LAL_TWOPI * Freq * st->pos[1];
+    break;
+  case DOPPLERCOORD_N3Z_EQU:          /**< Z component of unconstrained super-sky position in equatorial coordinates [Units: none]. */
+    phi = LAL_TWOPI * Freq * st->pos[2];
+    break;
+
+  case DOPPLERCOORD_N3X_ECL:          /**< X component of unconstrained super-sky position in ecliptic coordinates [Units: none]. */
+    phi = LAL_TWOPI * Freq * ecl_pos[0];
+    break;
+  case DOPPLERCOORD_N3Y_ECL:          /**< Y component of unconstrained super-sky position in ecliptic coordinates [Units: none]. */
+    phi = LAL_TWOPI * Freq * ecl_pos[1];
+    break;
+  case DOPPLERCOORD_N3Z_ECL:          /**< Z component of unconstrained super-sky position in ecliptic coordinates [Units: none]. */
+    phi = LAL_TWOPI * Freq * ecl_pos[2];
+    break;
+
+  case DOPPLERCOORD_N3SX_EQU: /**< X spin-component of unconstrained super-sky position in equatorial coordinates [Units: none]. */
+    phi = LAL_TWOPI * Freq * st->spin_pos[0];
+    break;
+  case DOPPLERCOORD_N3SY_EQU: /**< Y spin-component of unconstrained super-sky position in equatorial coordinates [Units: none]. */
+    phi = LAL_TWOPI * Freq * st->spin_pos[1];
+    break;
+
+  case DOPPLERCOORD_N3OX_ECL: /**< X orbit-component of unconstrained super-sky position in ecliptic coordinates [Units: none]. */
+    phi = LAL_TWOPI * Freq * ecl_orbit_pos[0];
+    break;
+  case DOPPLERCOORD_N3OY_ECL: /**< Y orbit-component of unconstrained super-sky position in ecliptic coordinates [Units: none]. */
+    phi = LAL_TWOPI * Freq * ecl_orbit_pos[1];
+    break;
+  case DOPPLERCOORD_N3OZ_ECL: /**< Z orbit-component of unconstrained super-sky position in ecliptic coordinates [Units: none]. */
+    phi = LAL_TWOPI * Freq * ecl_orbit_pos[2];
+    break;
+
+  // ---------- binary orbital parameters ----------
+  // Phase derivates taken from Eq.(39) in Leaci, Prix, PRD91, 102003 (2015):  DOI:10.1103/PhysRevD.91.102003
+  case DOPPLERCOORD_ASINI: /**< Projected semimajor axis of binary orbit in small-eccentricy limit (ELL1 model) [Units: light seconds]. */
+    phi = - LAL_TWOPI * Freq * ( sinPsi + 0.5 * orb_kappa * sin2Psi - 0.5 * orb_eta * cos2Psi );
+    break;
+  case DOPPLERCOORD_TASC: /**< Time of ascension (neutron star crosses line of nodes moving away from observer) for binary orbit (ELL1 model) [Units: GPS s]. */
+    phi = LAL_TWOPI * Freq * orb_asini * orb_Omega * ( cosPsi + orb_kappa * cos2Psi + orb_eta * sin2Psi );
+    break;
+  case DOPPLERCOORD_PORB: /**< Period of binary orbit (ELL1 model) [Units: s]. */
+    phi = Freq * orb_asini * orb_Omega * orb_phase * ( cosPsi + orb_kappa * cos2Psi + orb_eta * sin2Psi );
+    break;
+  case DOPPLERCOORD_KAPPA: /**< Lagrange parameter 'kappa = ecc * cos(argp)', ('ecc' = eccentricity, 'argp' = argument of periapse) of binary orbit (ELL1 model) [Units: none] */
+    phi = - LAL_PI * Freq * orb_asini * sin2Psi;
+    break;
+  case DOPPLERCOORD_ETA: /**< Lagrange parameter 'eta = ecc * sin(argp) of binary orbit (ELL1 model) [Units: none] */
+    phi = LAL_PI * Freq * orb_asini * cos2Psi;
+    break;
+
+  // --------- rescaled binary orbital parameters for (approximately) flat metric
+  case DOPPLERCOORD_DASC:  /**< Distance traversed on the arc of binary orbit (ELL1 model) 'dasc = 2 * pi * (ap/porb) * tasc' [Units: light second]." */
+    phi = LAL_TWOPI * Freq * ( cosPsi + orb_kappa * cos2Psi + orb_eta * sin2Psi );
+    break;
+
+  case DOPPLERCOORD_VP: /**< Rescaled (by asini) differential-coordinate 'dvp = asini * dOMEGA', ('OMEGA' = 2 * pi/'porb') of binary orbit (ELL1 model) [Units: (light second)/(GPS second)]. */
+    phi = - LAL_TWOPI * Freq * ( orb_phase / orb_Omega ) * ( cosPsi + orb_kappa * cos2Psi + orb_eta * sin2Psi );
+    break;
+
+  case DOPPLERCOORD_KAPPAP: /**< Rescaled (by asini) differential-coordinate 'dkappap = asini * dkappa' [Units: light seconds]. */
+    phi = - LAL_PI * Freq * sin2Psi;
+    break;
+
+  case DOPPLERCOORD_ETAP: /**< Rescaled (by asini) differential-coordinate 'detap = asini * deta' [Units: light seconds]. */
+    phi = LAL_PI * Freq * cos2Psi;
+    break;
+
+  // ------------------------------------------------
+  default:
+    XLALPrintError( "%s: Unknown phase-derivative type '%d'\n", __func__, deriv );
+    return XLAL_EINVAL;
+    break;
+
+  } /* switch deriv */
+
+  ( *phi_out ) = phi;
+
+  return XLAL_SUCCESS;
+
+} /* CW_PhaseDerivCoord() */
+
+
+/**
+ * Partial derivative of continuous-wave (CW) phase, with respect
+ * to Doppler coordinate 'i' := intparams_t->phderiv
+ *
+ * Time is in 'natural units' of Tspan, i.e. tt is in [0, 1] corresponding
+ * to GPS-times in [startTime, startTime + Tspan ]
+ *
+ */
+static double
+CW_Phi_i( double tt, void *params )
+{
+  intparams_t *par = ( intparams_t * ) params;
+  if ( par->errnum ) {
+    return GSL_NAN;
+  }
+
+  /* compute quantities shared by all phase derivatives at time tt */
+  PhaseDerivState_t st;
+  int errnum = CW_PhaseDerivState( &st, tt, par );
+  if ( errnum != XLAL_SUCCESS ) {
+    par->errnum = errnum;
+    return GSL_NAN;
+  }
 
   /* now compute the requested (possibly linear combination of) phase derivative(s) */
   REAL8 phase_deriv = 0.0;
@@ -613,137 +823,11 @@ CW_Phi_i( double tt, void *params )
 
     /* compute the phase derivative term */
     REAL8 ret = 0.0;
-    const DopplerCoordinateID deriv = GET_COORD_ID( par->coordSys, coord );
-    switch ( deriv ) {
-
-    case DOPPLERCOORD_FREQ:             /**< Frequency [Units: Hz]. */
-    case DOPPLERCOORD_GC_NU0:           /**< Global correlation frequency [Units: Hz]. Activates 'reduced' detector position. */
-      ret = LAL_TWOPI * tau * LAL_FACT_INV[1];
-      break;
-    case DOPPLERCOORD_F1DOT:            /**< First spindown [Units: Hz/s]. */
-    case DOPPLERCOORD_GC_NU1:           /**< Global correlation first spindown [Units: Hz/s]. Activates 'reduced' detector position. */
-      ret = LAL_TWOPI * POW2( tau ) * LAL_FACT_INV[2];
-      break;
-    case DOPPLERCOORD_F2DOT:            /**< Second spindown [Units: Hz/s^2]. */
-    case DOPPLERCOORD_GC_NU2:           /**< Global correlation second spindown [Units: Hz/s^2]. Activates 'reduced' detector position. */
-      ret = LAL_TWOPI * POW3( tau ) * LAL_FACT_INV[3];
-      break;
-    case DOPPLERCOORD_F3DOT:            /**< Third spindown [Units: Hz/s^3]. */
-    case DOPPLERCOORD_GC_NU3:           /**< Global correlation third spindown [Units: Hz/s^3]. Activates 'reduced' detector position. */
-      ret = LAL_TWOPI * POW4( tau ) * LAL_FACT_INV[4];
-      break;
-    case DOPPLERCOORD_F4DOT:            /**< Fourth spindown [Units: Hz/s^4]. */
-    case DOPPLERCOORD_GC_NU4:           /**< Global correlation fourth spindown [Units: Hz/s^4]. Activates 'reduced' detector position. */
-      ret = LAL_TWOPI * POW5( tau ) * LAL_FACT_INV[5];
-      break;
-
-    case DOPPLERCOORD_ALPHA:            /**< Right ascension [Units: radians]. Uses 'reduced' detector position. */
-      nDeriv_i[0] = - cosd * sina;
-      nDeriv_i[1] =   cosd * cosa;
-      nDeriv_i[2] =   0;
-      ret = LAL_TWOPI * Freq * DOT_VECT( rr_ord_Equ, nDeriv_i );
-      break;
-    case DOPPLERCOORD_DELTA:            /**< Declination [Units: radians]. Uses 'reduced' detector position. */
-      nDeriv_i[0] = - sind * cosa;
-      nDeriv_i[1] = - sind * sina;
-      nDeriv_i[2] =   cosd;
-      ret = LAL_TWOPI * Freq * DOT_VECT( rr_ord_Equ, nDeriv_i );
-      break;
-
-    case DOPPLERCOORD_N2X_EQU:          /**< X component of constrained sky position in equatorial coordinates [Units: none]. Uses 'reduced' detector position. */
-      ret = LAL_TWOPI * Freq * ( rr_ord_Equ[0] - ( nn_equ[0] / nn_equ[2] ) * rr_ord_Equ[2] );
-      break;
-    case DOPPLERCOORD_N2Y_EQU:          /**< Y component of constrained sky position in equatorial coordinates [Units: none]. Uses 'reduced' detector position. */
-      ret = LAL_TWOPI * Freq * ( rr_ord_Equ[1] - ( nn_equ[1] / nn_equ[2] ) * rr_ord_Equ[2] );
-      break;
-
-    case DOPPLERCOORD_N2X_ECL:          /**< X component of constrained sky position in ecliptic coordinates [Units: none]. Uses 'reduced' detector position. */
-      ret = LAL_TWOPI * Freq * ( rr_ord_Ecl[0] - ( nn_ecl[0] / nn_ecl[2] ) * rr_ord_Ecl[2] );
-      break;
-    case DOPPLERCOORD_N2Y_ECL:          /**< Y component of constrained sky position in ecliptic coordinates [Units: none]. Uses 'reduced' detector position. */
-      ret = LAL_TWOPI * Freq * ( rr_ord_Ecl[1] - ( nn_ecl[1] / nn_ecl[2] ) * rr_ord_Ecl[2] );
-      break;
-
-    case DOPPLERCOORD_N3X_EQU:          /**< X component of unconstrained super-sky position in equatorial coordinates [Units: none]. */
-      ret = LAL_TWOPI * Freq * posvel.pos[0];
-      break;
-    case DOPPLERCOORD_N3Y_EQU:          /**< Y component of unconstrained super-sky position in equatorial coordinates [Units: none]. */
-      ret = LAL_TWOPI * Freq * posvel.pos[1];
-      break;
-    case DOPPLERCOORD_N3Z_EQU:          /**< Z component of unconstrained super-sky position in equatorial coordinates [Units: none]. */
-      ret = LAL_TWOPI * Freq * posvel.pos[2];
-      break;
-
-    case DOPPLERCOORD_N3X_ECL:          /**< X component of unconstrained super-sky position in ecliptic coordinates [Units: none]. */
-      ret = LAL_TWOPI * Freq * ecl_pos[0];
-      break;
-    case DOPPLERCOORD_N3Y_ECL:          /**< Y component of unconstrained super-sky position in ecliptic coordinates [Units: none]. */
-      ret = LAL_TWOPI * Freq * ecl_pos[1];
-      break;
-    case DOPPLERCOORD_N3Z_ECL:          /**< Z component of unconstrained super-sky position in ecliptic coordinates [Units: none]. */
-      ret = LAL_TWOPI * Freq * ecl_pos[2];
-      break;
-
-    case DOPPLERCOORD_N3SX_EQU: /**< X spin-component of unconstrained super-sky position in equatorial coordinates [Units: none]. */
-      ret = LAL_TWOPI * Freq * spin_posvel.pos[0];
-      break;
-    case DOPPLERCOORD_N3SY_EQU: /**< Y spin-component of unconstrained super-sky position in equatorial coordinates [Units: none]. */
-      ret = LAL_TWOPI * Freq * spin_posvel.pos[1];
-      break;
-
-    case DOPPLERCOORD_N3OX_ECL: /**< X orbit-component of unconstrained super-sky position in ecliptic coordinates [Units: none]. */
-      ret = LAL_TWOPI * Freq * ecl_orbit_pos[0];
-      break;
-    case DOPPLERCOORD_N3OY_ECL: /**< Y orbit-component of unconstrained super-sky position in ecliptic coordinates [Units: none]. */
-      ret = LAL_TWOPI * Freq * ecl_orbit_pos[1];
-      break;
-    case DOPPLERCOORD_N3OZ_ECL: /**< Z orbit-component of unconstrained super-sky position in ecliptic coordinates [Units: none]. */
-      ret = LAL_TWOPI * Freq * ecl_orbit_pos[2];
-      break;
-
-    // ---------- binary orbital parameters ----------
-    // Phase derivates taken from Eq.(39) in Leaci, Prix, PRD91, 102003 (2015):  DOI:10.1103/PhysRevD.91.102003
-    case DOPPLERCOORD_ASINI: /**< Projected semimajor axis of binary orbit in small-eccentricy limit (ELL1 model) [Units: light seconds]. */
-      ret = - LAL_TWOPI * Freq * ( sinPsi + 0.5 * orb_kappa * sin2Psi - 0.5 * orb_eta * cos2Psi );
-      break;
-    case DOPPLERCOORD_TASC: /**< Time of ascension (neutron star crosses line of nodes moving away from observer) for binary orbit (ELL1 model) [Units: GPS s]. */
-      ret = LAL_TWOPI * Freq * orb_asini * orb_Omega * ( cosPsi + orb_kappa * cos2Psi + orb_eta * sin2Psi );
-      break;
-    case DOPPLERCOORD_PORB: /**< Period of binary orbit (ELL1 model) [Units: s]. */
-      ret = Freq * orb_asini * orb_Omega * orb_phase * ( cosPsi + orb_kappa * cos2Psi + orb_eta * sin2Psi );
-      break;
-    case DOPPLERCOORD_KAPPA: /**< Lagrange parameter 'kappa = ecc * cos(argp)', ('ecc' = eccentricity, 'argp' = argument of periapse) of binary orbit (ELL1 model) [Units: none] */
-      ret = - LAL_PI * Freq * orb_asini * sin2Psi;
-      break;
-    case DOPPLERCOORD_ETA: /**< Lagrange parameter 'eta = ecc * sin(argp) of binary orbit (ELL1 model) [Units: none] */
-      ret = LAL_PI * Freq * orb_asini * cos2Psi;
-      break;
-
-    // --------- rescaled binary orbital parameters for (approximately) flat metric
-    case DOPPLERCOORD_DASC:  /**< Distance traversed on the arc of binary orbit (ELL1 model) 'dasc = 2 * pi * (ap/porb) * tasc' [Units: light second]." */
-      ret = LAL_TWOPI * Freq * ( cosPsi + orb_kappa * cos2Psi + orb_eta * sin2Psi );
-      break;
-
-    case DOPPLERCOORD_VP: /**< Rescaled (by asini) differential-coordinate 'dvp = asini * dOMEGA', ('OMEGA' = 2 * pi/'porb') of binary orbit (ELL1 model) [Units: (light second)/(GPS second)]. */
-      ret = - LAL_TWOPI * Freq * ( orb_phase / orb_Omega ) * ( cosPsi + orb_kappa * cos2Psi + orb_eta * sin2Psi );
-      break;
-
-    case DOPPLERCOORD_KAPPAP: /**< Rescaled (by asini) differential-coordinate 'dkappap = asini * dkappa' [Units: light seconds]. */
-      ret = - LAL_PI * Freq * sin2Psi;
-      break;
-
-    case DOPPLERCOORD_ETAP: /**< Rescaled (by asini) differential-coordinate 'detap = asini * deta' [Units: light seconds]. */
-      ret = LAL_PI * Freq * cos2Psi;
-      break;
-
-    // ------------------------------------------------
-    default:
-      par->errnum = XLAL_EINVAL;
-      XLALPrintError( "%s: Unknown phase-derivative type '%d'\n", __func__, deriv );
+    errnum = CW_PhaseDerivCoord( &ret, &st, par, coord );
+    if ( errnum != XLAL_SUCCESS ) {
+      par->errnum = errnum;
       return GSL_NAN;
-      break;
-
-    } /* switch deriv */
+    }
 
     phase_deriv += coeff * ret;
 
@@ -1187,6 +1271,444 @@ XLALCovariance_Phi_ij( const MultiLALDetector *multiIFO,               //!< [in]
 
 } /* XLALCovariance_Phi_ij() */
 
+/**
+ * Compute the nodes 'x' and weights 'w' of the 'n'-point Gauss-Legendre quadrature rule on [-1, 1],
+ * by Newton iteration on the roots of the Legendre polynomial \f$ P_n(x) \f$ .
+ */
+static void
+GaussLegendreRule( const UINT4 n, REAL8 *x, REAL8 *w )
+{
+  for ( UINT4 i = 0; i < ( n + 1 ) / 2; ++i ) {
+    REAL8 z = cos( LAL_PI * ( i + 0.75 ) / ( n + 0.5 ) ), dp = 0;
+    for ( UINT4 iter = 0; iter < 100; ++iter ) {
+      /* evaluate P_n(z) and its derivative by recurrence */
+      REAL8 p0 = 1.0, p1 = 0.0;
+      for ( UINT4 j = 1; j <= n; ++j ) {
+        const REAL8 p2 = p1;
+        p1 = p0;
+        p0 = ( ( 2.0 * j - 1.0 ) * z * p1 - ( j - 1.0 ) * p2 ) / j;
+      }
+      dp = n * ( z * p0 - p1 ) / ( z * z - 1.0 );
+      const REAL8 dz = p0 / dp;
+      z -= dz;
+      if ( fabs( dz ) < 1e-15 ) {
+        break;
+      }
+    }
+    x[i] = -z;
+    x[n - 1 - i] = z;
+    w[i] = w[n - 1 - i] = 2.0 / ( ( 1.0 - z * z ) * dp * dp );
+  }
+} /* GaussLegendreRule() */
+
+
+/**
+ * Split each segment and detector into integration 'units' for the fixed-quadrature metric.
+ * Units are ordered by segment, then by detector, then by time; the units of segment 'k' are
+ * those with indexes in [firstUnit[k], firstUnit[k+1]).
+ */
+static FixedQuadUnit *
+XLALFixedQuadratureUnits( UINT4 *numUnits,                      //!< [out] total number of integration units
+                          UINT4 *firstUnit,                     //!< [out] array of 'Nseg+1' indexes of first unit of each segment
+                          const LALSegList *segList,            //!< [in] segment list
+                          const UINT4 numDet,                   //!< [in] number of detectors
+                          const intparams_t *params             //!< [in] integration parameters
+                        )
+{
+  const UINT4 Nseg = segList->length;
+
+  /* length of integration units; binary orbital phase derivatives oscillate on the orbital period, so resolve that as well */
+  double intT = params->intT;
+  if ( params->dopplerPoint->asini > 0 && params->dopplerPoint->period > 0 ) {
+    intT = MYMIN( intT, 0.25 * params->dopplerPoint->period );
+  }
+
+  /* count integration units */
+  UINT4 intN[Nseg];
+  ( *numUnits ) = 0;
+  for ( UINT4 k = 0; k < Nseg; ++k ) {
+    const REAL8 Tspan = XLALGPSDiff( &( segList->segs[k].end ), &( segList->segs[k].start ) );
+    intN[k] = ( UINT4 ) ceil( Tspan / intT );
+    firstUnit[k] = ( *numUnits );
+    ( *numUnits ) += numDet * intN[k];
+  }
+  firstUnit[Nseg] = ( *numUnits );
+
+  FixedQuadUnit *units = XLALCalloc( *numUnits, sizeof( *units ) );
+  XLAL_CHECK_NULL( units != NULL, XLAL_ENOMEM );
+
+  /* initialise integration units */
+  FixedQuadUnit *u = units;
+  for ( UINT4 k = 0; k < Nseg; ++k ) {
+    const double dT = 1.0 / intN[k];
+    for ( UINT4 X = 0; X < numDet; ++X ) {
+      for ( UINT4 n = 0; n < intN[k]; ++n, ++u ) {
+        u->k = k;
+        u->X = X;
+        u->ti = 1.0 * n * dT;
+        u->tf = MYMIN( ( n + 1.0 ) * dT, 1.0 );
+      }
+    }
+  }
+
+  return units;
+
+} /* XLALFixedQuadratureUnits() */
+
+
+/**
+ * Evaluate all phase derivatives \f$ \phi_i \f$ (scaled as in XLALCovariance_Phi_ij()) at every quadrature node of
+ * every integration unit, sharing one evaluation of the detector motion between all coordinates. If 'am' is non-NULL,
+ * also evaluate the antenna-pattern coefficients \f$ a(t), b(t) \f$ at each node. Integration units are evaluated in parallel.
+ *
+ * Output arrays are indexed as phi[(u * FIXEDQUAD_NUM_NODES + q) * dim + i] and am[(u * FIXEDQUAD_NUM_NODES + q) * 2 + l],
+ * where 'u' is the integration unit, 'q' the quadrature node, 'i' the coordinate, and 'l' = {0: a(t), 1: b(t)}.
+ */
+static int
+XLALFixedQuadratureEvaluate( REAL8 *phi,                                //!< [out] phase derivatives at all nodes
+                             REAL8 *am,                                 //!< [out] antenna-pattern coefficients at all nodes, or NULL
+                             const REAL8 *xq,                           //!< [in] quadrature nodes on [-1, 1]
+                             const FixedQuadUnit *units,                //!< [in] integration units
+                             const UINT4 numUnits,                      //!< [in] number of integration units
+                             const MultiLALDetector *multiIFO,          //!< [in] detectors to use
+                             const LALSegList *segList,                 //!< [in] segment list
+                             const intparams_t *params                  //!< [in] integration parameters
+                           )
+{
+  const UINT4 dim = params->coordSys->dim;
+
+  SkyPosition skypos;
+  skypos.system = COORDINATESYSTEM_EQUATORIAL;
+  skypos.longitude = params->dopplerPoint->Alpha;
+  skypos.latitude  = params->dopplerPoint->Delta;
+
+  int errflag = 0;
+  #pragma omp parallel for schedule(dynamic)
+  for ( UINT4 u = 0; u < numUnits; ++u ) {
+    if ( errflag ) {
+      continue;
+    }
+
+    const FixedQuadUnit *unit = &units[u];
+
+    // set start time, time span, and detector for this integration unit
+    intparams_t par = ( *params );
+    par.startTime = XLALGPSGetREAL8( &( segList->segs[unit->k].start ) );
+    par.Tspan = XLALGPSDiff( &( segList->segs[unit->k].end ), &( segList->segs[unit->k].start ) );
+    par.site = &multiIFO->sites[unit->X];
+
+    const double tmid = 0.5 * ( unit->ti + unit->tf );
+    const double thalf = 0.5 * ( unit->tf - unit->ti );
+
+    for ( UINT4 q = 0; q < FIXEDQUAD_NUM_NODES; ++q ) {
+      const double tt = tmid + thalf * xq[q];
+      const size_t node = ( size_t ) u * FIXEDQUAD_NUM_NODES + q;
+
+      /* compute all phase derivatives from a single detector position/velocity */
+      PhaseDerivState_t st;
+      int errnum = CW_PhaseDerivState( &st, tt, &par );
+      for ( UINT4 i = 0; errnum == XLAL_SUCCESS && i < dim; ++i ) {
+        REAL8 phi_i = 0;
+        errnum = CW_PhaseDerivCoord( &phi_i, &st, &par, ( int ) i );
+        phi[node * dim + i] = GET_COORD_SCALE( par.coordSys, ( int ) i ) * phi_i;
+      }
+
+      /* compute antenna-pattern coefficients if required */
+      if ( errnum == XLAL_SUCCESS && am != NULL ) {
+        LIGOTimeGPS ttGPS;
+        XLALGPSSetREAL8( &ttGPS, par.startTime + tt * par.Tspan );
+        if ( XLALComputeAntennaPatternCoeffs( &am[node * 2 + 0], &am[node * 2 + 1], &skypos, &ttGPS, par.site, par.edat ) != XLAL_SUCCESS ) {
+          errnum = XLAL_EFUNC;
+        }
+      }
+
+      if ( errnum != XLAL_SUCCESS ) {
+        #pragma omp atomic write
+        errflag = errnum;
+        break;
+      }
+
+    } /* for q < FIXEDQUAD_NUM_NODES */
+
+  } /* for u < numUnits */
+  XLAL_CHECK( errflag == 0, XLAL_EFUNC, "Evaluation of phase derivatives failed with errnum = %d", errflag );
+
+  return XLAL_SUCCESS;
+
+} /* XLALFixedQuadratureEvaluate() */
+
+
+/**
+ * Relative error of a metric quantity 'hi' computed with the high-order quadrature rule, estimated from its
+ * difference to the same quantity 'lo' computed with the low-order rule, and normalised by a Cauchy-Schwarz
+ * bound 'normsq' on the square of the quantity (so that nearly-vanishing off-diagonal components are not penalised).
+ */
+static double
+FixedQuadratureRelErr( const double hi, const double lo, const double normsq )
+{
+  return ( normsq > 0 ) ? fabs( hi - lo ) / sqrt( normsq ) : fabs( hi - lo );
+}
+
+
+/**
+ * Compute all pure phase-deriv covariances \f$ [\phi_i, \phi_j] = \langle phi_i phi_j\rangle - \langle phi_i\rangle\langle phi_j\rangle \f$
+ * together, i.e. the full "phase metric" in the coordinates of 'params->coordSys'. This is equivalent to calling
+ * XLALCovariance_Phi_ij() for every component with an identity coordinate transform, but all components are computed
+ * from a single set of phase-derivative evaluations at fixed Gauss-Legendre nodes, and the covariances are accumulated
+ * about the per-segment mean, which avoids the cancellation between \f$ \langle phi_i phi_j\rangle \f$ and
+ * \f$ \langle phi_i\rangle\langle phi_j\rangle \f$ that otherwise requires iterative reorthogonalisation.
+ *
+ * The error is estimated from the difference to the metric computed with a lower-order rule.
+ *
+ * NOTE: for passing unit noise-weights, set MultiNoiseFloor->length=0 (but multiNoiseFloor==NULL is invalid)
+ */
+static int
+XLALCovariance_Phi_all( gsl_matrix *g_ij,                               //!< [out] phase metric
+                        double *relerr_max,                             //!< [out] estimate of maximal relative error
+                        const MultiLALDetector *multiIFO,               //!< [in] detectors to use
+                        const MultiNoiseFloor *multiNoiseFloor,         //!< [in] corresponding noise floors for weights, NULL means unit-weights
+                        const LALSegList *segList,                      //!< [in] segment list
+                        const intparams_t *params                       //!< [in] integration parameters
+                      )
+{
+  XLAL_CHECK( g_ij != NULL, XLAL_EINVAL );
+  XLAL_CHECK( multiIFO != NULL, XLAL_EINVAL );
+  UINT4 numDet = multiIFO->length;
+  XLAL_CHECK( numDet > 0, XLAL_EINVAL );
+
+  // either no noise-weights given (multiNoiseFloor->length=0) or same number of detectors
+  XLAL_CHECK( multiNoiseFloor != NULL, XLAL_EINVAL );
+  BOOLEAN haveNoiseWeights = ( multiNoiseFloor->length > 0 );
+  XLAL_CHECK( !haveNoiseWeights || ( multiNoiseFloor->length == numDet ), XLAL_EINVAL );
+
+  XLAL_CHECK( segList != NULL, XLAL_EINVAL );
+  UINT4 Nseg = segList->length;
+
+  const UINT4 dim = params->coordSys->dim;
+  XLAL_CHECK( g_ij->size1 == dim && g_ij->size2 == dim, XLAL_EINVAL );
+
+  /* store detector weights and accumulate total weight */
+  REAL8 total_weight = 0.0, weights[numDet];
+  for ( UINT4 X = 0; X < numDet; X ++ ) {
+    weights[X] = haveNoiseWeights ? multiNoiseFloor->sqrtSn[X] : 1.0;
+    total_weight += weights[X];
+  }
+  XLAL_CHECK( total_weight > 0, XLAL_EDOM, "Detectors noise-floors given but all zero!" );
+
+  /* high-order quadrature rule, followed by low-order rule for error estimate */
+  REAL8 xq[FIXEDQUAD_NUM_NODES], wq[FIXEDQUAD_NUM_NODES];
+  GaussLegendreRule( FIXEDQUAD_NODES_HI, xq, wq );
+  GaussLegendreRule( FIXEDQUAD_NODES_LO, xq + FIXEDQUAD_NODES_HI, wq + FIXEDQUAD_NODES_HI );
+
+  /* ---------- evaluate phase derivatives at all quadrature nodes ---------- */
+  UINT4 numUnits = 0, firstUnit[Nseg + 1];
+  FixedQuadUnit *units = XLALFixedQuadratureUnits( &numUnits, firstUnit, segList, numDet, params );
+  XLAL_CHECK( units != NULL, XLAL_EFUNC );
+  REAL8 *phi = XLALMalloc( ( size_t ) numUnits * FIXEDQUAD_NUM_NODES * dim * sizeof( *phi ) );
+  if ( phi == NULL ) {
+    XLALFree( units );
+    XLAL_ERROR( XLAL_ENOMEM );
+  }
+  if ( XLALFixedQuadratureEvaluate( phi, NULL, xq, units, numUnits, multiIFO, segList, params ) != XLAL_SUCCESS ) {
+    XLALFree( units );
+    XLALFree( phi );
+    XLAL_ERROR( XLAL_EFUNC );
+  }
+
+  /* ---------- compute final result ---------- */
+
+  REAL8 g_rule[2][dim][dim];
+  memset( g_rule, 0, sizeof( g_rule ) );
+
+  // loop over segments and quadrature rules
+  for ( UINT4 k = 0; k < Nseg; ++k ) {
+    for ( UINT4 r = 0; r < 2; ++r ) {
+      const UINT4 q0 = ( r == 0 ) ? 0 : FIXEDQUAD_NODES_HI;
+      const UINT4 q1 = ( r == 0 ) ? FIXEDQUAD_NODES_HI : FIXEDQUAD_NUM_NODES;
+
+      // compute <phi_i> over detectors and integration 'units'
+      REAL8 av_i[dim];
+      memset( av_i, 0, sizeof( av_i ) );
+      for ( UINT4 u = firstUnit[k]; u < firstUnit[k + 1]; ++u ) {
+        const REAL8 wu = weights[units[u].X] / total_weight * 0.5 * ( units[u].tf - units[u].ti );
+        for ( UINT4 q = q0; q < q1; ++q ) {
+          const REAL8 *phi_q = &phi[( ( size_t ) u * FIXEDQUAD_NUM_NODES + q ) * dim];
+          for ( UINT4 i = 0; i < dim; ++i ) {
+            av_i[i] += wu * wq[q] * phi_q[i];
+          }
+        }
+      }
+
+      // accumulate <(phi_i - <phi_i>) (phi_j - <phi_j>)> over detectors and integration 'units'
+      for ( UINT4 u = firstUnit[k]; u < firstUnit[k + 1]; ++u ) {
+        const REAL8 wu = weights[units[u].X] / total_weight * 0.5 * ( units[u].tf - units[u].ti );
+        for ( UINT4 q = q0; q < q1; ++q ) {
+          const REAL8 *phi_q = &phi[( ( size_t ) u * FIXEDQUAD_NUM_NODES + q ) * dim];
+          REAL8 dphi[dim];
+          for ( UINT4 i = 0; i < dim; ++i ) {
+            dphi[i] = phi_q[i] - av_i[i];
+          }
+          for ( UINT4 i = 0; i < dim; ++i ) {
+            const REAL8 wdphi_i = wu * wq[q] * dphi[i] / Nseg;
+            for ( UINT4 j = 0; j <= i; ++j ) {
+              g_rule[r][i][j] += wdphi_i * dphi[j];
+            }
+          }
+        }
+      }
+
+    } // for r < 2
+  } // for k < Nseg
+
+  // return metric computed with high-order rule, and estimate its error from the low-order rule
+  double relerr = 0;
+  for ( UINT4 i = 0; i < dim; ++i ) {
+    for ( UINT4 j = 0; j <= i; ++j ) {
+      gsl_matrix_set( g_ij, i, j, g_rule[0][i][j] );
+      gsl_matrix_set( g_ij, j, i, g_rule[0][i][j] );
+      relerr = MYMAX( relerr, FixedQuadratureRelErr( g_rule[0][i][j], g_rule[1][i][j], g_rule[0][i][i] * g_rule[0][j][j] ) );
+    }
+  }
+  if ( relerr_max ) {
+    ( *relerr_max ) = relerr;
+  }
+
+  /* ----- cleanup ----- */
+  XLALFree( units );
+  XLALFree( phi );
+
+  return XLAL_SUCCESS;
+
+} /* XLALCovariance_Phi_all() */
+
+
+/**
+ * Compute all F-metric atoms together, using a single set of phase-derivative and antenna-pattern evaluations
+ * at fixed Gauss-Legendre nodes, instead of integrating each atom separately with XLALAverage_am1_am2_Phi_i_Phi_j().
+ * The error is estimated from the difference to the atoms computed with a lower-order rule.
+ */
+static int
+XLALComputeAtomsFixedQuadrature( FmetricAtoms_t *atoms,                         //!< [out] F-metric atoms
+                                 const DopplerMetricParams *metricParams,       //!< [in] input parameters determining the metric calculation
+                                 const intparams_t *params                      //!< [in] integration parameters
+                               )
+{
+  const UINT4 numDet = metricParams->multiIFO.length;
+  const BOOLEAN haveNoiseWeights = ( metricParams->multiNoiseFloor.length > 0 );
+  const UINT4 dim = params->coordSys->dim;
+
+  /* store detector weights and accumulate total weight */
+  REAL8 sum_weights = 0.0, weights[numDet];
+  for ( UINT4 X = 0; X < numDet; X ++ ) {
+    weights[X] = haveNoiseWeights ? metricParams->multiNoiseFloor.sqrtSn[X] : 1.0;
+    sum_weights += weights[X];
+  }
+  XLAL_CHECK( sum_weights > 0, XLAL_EDOM, "Detectors noise-floors given but all zero!" );
+
+  /* high-order quadrature rule, followed by low-order rule for error estimate */
+  REAL8 xq[FIXEDQUAD_NUM_NODES], wq[FIXEDQUAD_NUM_NODES];
+  GaussLegendreRule( FIXEDQUAD_NODES_HI, xq, wq );
+  GaussLegendreRule( FIXEDQUAD_NODES_LO, xq + FIXEDQUAD_NODES_HI, wq + FIXEDQUAD_NODES_HI );
+
+  /* ---------- evaluate phase derivatives and antenna patterns at all quadrature nodes ---------- */
+  UINT4 numUnits = 0, firstUnit[2];
+  FixedQuadUnit *units = XLALFixedQuadratureUnits( &numUnits, firstUnit, &metricParams->segmentList, numDet, params );
+  XLAL_CHECK( units != NULL, XLAL_EFUNC );
+  REAL8 *phi = XLALMalloc( ( size_t ) numUnits * FIXEDQUAD_NUM_NODES * dim * sizeof( *phi ) );
+  REAL8 *am = XLALMalloc( ( size_t ) numUnits * FIXEDQUAD_NUM_NODES * 2 * sizeof( *am ) );
+  if ( phi == NULL || am == NULL ) {
+    XLALFree( units );
+    XLALFree( phi );
+    XLALFree( am );
+    XLAL_ERROR( XLAL_ENOMEM );
+  }
+  if ( XLALFixedQuadratureEvaluate( phi, am, xq, units, numUnits, &metricParams->multiIFO, &metricParams->segmentList, params ) != XLAL_SUCCESS ) {
+    XLALFree( units );
+    XLALFree( phi );
+    XLALFree( am );
+    XLAL_ERROR( XLAL_EFUNC );
+  }
+
+  /* ---------- accumulate atoms for both quadrature rules ---------- */
+  REAL8 a_a[2], a_b[2], b_b[2];
+  REAL8 a_a_i[2][dim], a_b_i[2][dim], b_b_i[2][dim];
+  REAL8 a_a_i_j[2][dim][dim], a_b_i_j[2][dim][dim], b_b_i_j[2][dim][dim];
+  memset( a_a, 0, sizeof( a_a ) );
+  memset( a_b, 0, sizeof( a_b ) );
+  memset( b_b, 0, sizeof( b_b ) );
+  memset( a_a_i, 0, sizeof( a_a_i ) );
+  memset( a_b_i, 0, sizeof( a_b_i ) );
+  memset( b_b_i, 0, sizeof( b_b_i ) );
+  memset( a_a_i_j, 0, sizeof( a_a_i_j ) );
+  memset( a_b_i_j, 0, sizeof( a_b_i_j ) );
+  memset( b_b_i_j, 0, sizeof( b_b_i_j ) );
+  for ( UINT4 r = 0; r < 2; ++r ) {
+    const UINT4 q0 = ( r == 0 ) ? 0 : FIXEDQUAD_NODES_HI;
+    const UINT4 q1 = ( r == 0 ) ? FIXEDQUAD_NODES_HI : FIXEDQUAD_NUM_NODES;
+    for ( UINT4 u = 0; u < numUnits; ++u ) {
+      const REAL8 wu = weights[units[u].X] / sum_weights * 0.5 * ( units[u].tf - units[u].ti );
+      for ( UINT4 q = q0; q < q1; ++q ) {
+        const size_t node = ( size_t ) u * FIXEDQUAD_NUM_NODES + q;
+        const REAL8 *phi_q = &phi[node * dim];
+        const REAL8 ai = am[node * 2 + 0], bi = am[node * 2 + 1];
+        const REAL8 w_a_a = wu * wq[q] * ai * ai;
+        const REAL8 w_a_b = wu * wq[q] * ai * bi;
+        const REAL8 w_b_b = wu * wq[q] * bi * bi;
+        a_a[r] += w_a_a;
+        a_b[r] += w_a_b;
+        b_b[r] += w_b_b;
+        for ( UINT4 i = 0; i < dim; ++i ) {
+          a_a_i[r][i] += w_a_a * phi_q[i];
+          a_b_i[r][i] += w_a_b * phi_q[i];
+          b_b_i[r][i] += w_b_b * phi_q[i];
+          for ( UINT4 j = 0; j <= i; ++j ) {
+            a_a_i_j[r][i][j] += w_a_a * phi_q[i] * phi_q[j];
+            a_b_i_j[r][i][j] += w_a_b * phi_q[i] * phi_q[j];
+            b_b_i_j[r][i][j] += w_b_b * phi_q[i] * phi_q[j];
+          }
+        }
+      }
+    }
+  }
+
+  /* ---------- return atoms computed with high-order rule, and estimate their error from the low-order rule ---------- */
+  double relerr = 0;
+  atoms->a_a = a_a[0];
+  atoms->a_b = a_b[0];
+  atoms->b_b = b_b[0];
+  relerr = MYMAX( relerr, FixedQuadratureRelErr( a_a[0], a_a[1], a_a[0] * a_a[0] ) );
+  relerr = MYMAX( relerr, FixedQuadratureRelErr( a_b[0], a_b[1], a_a[0] * b_b[0] ) );
+  relerr = MYMAX( relerr, FixedQuadratureRelErr( b_b[0], b_b[1], b_b[0] * b_b[0] ) );
+  for ( UINT4 i = 0; i < dim; ++i ) {
+    gsl_vector_set( atoms->a_a_i, i, a_a_i[0][i] );
+    gsl_vector_set( atoms->a_b_i, i, a_b_i[0][i] );
+    gsl_vector_set( atoms->b_b_i, i, b_b_i[0][i] );
+    relerr = MYMAX( relerr, FixedQuadratureRelErr( a_a_i[0][i], a_a_i[1][i], a_a[0] * a_a_i_j[0][i][i] ) );
+    relerr = MYMAX( relerr, FixedQuadratureRelErr( a_b_i[0][i], a_b_i[1][i], a_a[0] * b_b_i_j[0][i][i] ) );
+    relerr = MYMAX( relerr, FixedQuadratureRelErr( b_b_i[0][i], b_b_i[1][i], b_b[0] * b_b_i_j[0][i][i] ) );
+    for ( UINT4 j = 0; j <= i; ++j ) {
+      gsl_matrix_set( atoms->a_a_i_j, i, j, a_a_i_j[0][i][j] );
+      gsl_matrix_set( atoms->a_a_i_j, j, i, a_a_i_j[0][i][j] );
+      gsl_matrix_set( atoms->a_b_i_j, i, j, a_b_i_j[0][i][j] );
+      gsl_matrix_set( atoms->a_b_i_j, j, i, a_b_i_j[0][i][j] );
+      gsl_matrix_set( atoms->b_b_i_j, i, j, b_b_i_j[0][i][j] );
+      gsl_matrix_set( atoms->b_b_i_j, j, i, b_b_i_j[0][i][j] );
+      relerr = MYMAX( relerr, FixedQuadratureRelErr( a_a_i_j[0][i][j], a_a_i_j[1][i][j], a_a_i_j[0][i][i] * a_a_i_j[0][j][j] ) );
+      relerr = MYMAX( relerr, FixedQuadratureRelErr( a_b_i_j[0][i][j], a_b_i_j[1][i][j], a_a_i_j[0][i][i] * b_b_i_j[0][j][j] ) );
+      relerr = MYMAX( relerr, FixedQuadratureRelErr( b_b_i_j[0][i][j], b_b_i_j[1][i][j], b_b_i_j[0][i][i] * b_b_i_j[0][j][j] ) );
+    }
+  }
+  atoms->maxrelerr = relerr;
+
+  /* ----- cleanup ----- */
+  XLALFree( units );
+  XLALFree( phi );
+  XLALFree( am );
+
+  return XLAL_SUCCESS;
+
+} /* XLALComputeAtomsFixedQuadrature() */
+
 
 /**
  * Calculate an approximate "phase-metric" with the specified parameters.
@@ -1277,107 +1799,121 @@ XLALComputeDopplerPhaseMetric( const DopplerMetricParams *metricParams,        /
   metric->maxrelerr = 0;
   double err = 0;
 
-  /* ========== use numerically-robust method to compute metric ========== */
-
   /* allocate memory for coordinate transform */
   gsl_matrix *transform = gsl_matrix_alloc( dim, dim );
   XLAL_CHECK_NULL( transform != NULL, XLAL_ENOMEM );
   gsl_matrix_set_identity( transform );
   intparams.coordTransf = transform;
 
-  for ( size_t n = 1; n <= dim; ++n ) {
+  if ( metricParams->fixedQuadrature ) {
 
-    /* NOTE: this level of accuracy is only achievable *without* AM-coefficients involved
-     * which are computed in REAL4 precision. For the current function this is OK, as this
-     * function is only supposed to compute *pure* phase-derivate covariances.
-     */
-    intparams.epsrel = 1e-6;
-    /* we need an abs-cutoff as well, as epsrel can be too restrictive for small integrals */
-    intparams.epsabs = 1e-3;
-    /* NOTE: this numerical integration still runs into problems when integrating over
-     * long durations (~O(23d)), as the integrands are oscillatory functions on order of ~1d
-     * and convergence degrades.
-     * As a solution, we split the integral into 'intN' units of ~1 day duration, and compute
-     * the final integral as a sum over partial integrals.
-     * It is VERY important to ensure that 'intT' is not exactly 1 day, since then an integrand
-     * with period ~1 day may integrate to zero, which is both slower and MUCH more difficult
-     * for the numerical integration functions (since the integrand them becomes small with
-     * respect to any integration errors).
-     */
-    intparams.intT = 0.9 * LAL_DAYSID_SI;
+    /* ========== compute all metric components together on fixed quadrature nodes ========== */
 
-    /* allocate memory for Cholesky decomposition */
-    gsl_matrix *cholesky = gsl_matrix_alloc( n, n );
-    XLAL_CHECK_NULL( cholesky != NULL, XLAL_ENOMEM );
+    /* a 16-point rule is accurate to near machine precision over one period (~1/2 day) of
+     * the most rapidly oscillating integrands, i.e. products of two daily terms */
+    intparams.intT = 0.5 * LAL_DAYSID_SI;
+    XLAL_CHECK_NULL( XLALCovariance_Phi_all( metric->g_ij, &metric->maxrelerr, &metricParams->multiIFO, &metricParams->multiNoiseFloor,
+                                             &metricParams->segmentList, &intparams ) == XLAL_SUCCESS, XLAL_EFUNC );
 
-    /* create views of n-by-n submatrices of metric and coordinate transform */
-    gsl_matrix_view g_ij_n = gsl_matrix_submatrix( metric->g_ij, 0, 0, n, n );
-    gsl_matrix_view transform_n = gsl_matrix_submatrix( transform, 0, 0, n, n );
+  } else {
 
-    /* try this loop a certain number of times */
-    const size_t max_tries = 64;
-    size_t tries = 0;
-    while ( ++tries <= max_tries ) {
+    /* ========== use numerically-robust method to compute metric ========== */
+
+    for ( size_t n = 1; n <= dim; ++n ) {
+
+      /* NOTE: this level of accuracy is only achievable *without* AM-coefficients involved
+       * which are computed in REAL4 precision. For the current function this is OK, as this
+       * function is only supposed to compute *pure* phase-derivate covariances.
+       */
+      intparams.epsrel = 1e-6;
+      /* we need an abs-cutoff as well, as epsrel can be too restrictive for small integrals */
+      intparams.epsabs = 1e-3;
+      /* NOTE: this numerical integration still runs into problems when integrating over
+       * long durations (~O(23d)), as the integrands are oscillatory functions on order of ~1d
+       * and convergence degrades.
+       * As a solution, we split the integral into 'intN' units of ~1 day duration, and compute
+       * the final integral as a sum over partial integrals.
+       * It is VERY important to ensure that 'intT' is not exactly 1 day, since then an integrand
+       * with period ~1 day may integrate to zero, which is both slower and MUCH more difficult
+       * for the numerical integration functions (since the integrand them becomes small with
+       * respect to any integration errors).
+       */
+      intparams.intT = 0.9 * LAL_DAYSID_SI;
+
+      /* allocate memory for Cholesky decomposition */
+      gsl_matrix *cholesky = gsl_matrix_alloc( n, n );
+      XLAL_CHECK_NULL( cholesky != NULL, XLAL_ENOMEM );
+
+      /* create views of n-by-n submatrices of metric and coordinate transform */
+      gsl_matrix_view g_ij_n = gsl_matrix_submatrix( metric->g_ij, 0, 0, n, n );
+      gsl_matrix_view transform_n = gsl_matrix_submatrix( transform, 0, 0, n, n );
+
+      /* try this loop a certain number of times */
+      const size_t max_tries = 64;
+      size_t tries = 0;
+      while ( ++tries <= max_tries ) {
+
+        /* ----- compute last row/column of n-by-n submatrix of metric ----- */
+        for ( size_t i = 0; i < n; ++i ) {
+          const size_t j = n - 1;
+
+          /* g_ij = [Phi_i, Phi_j] */
+          intparams.coord1 = i;
+          intparams.coord2 = j;
+          REAL8 gg = XLALCovariance_Phi_ij( &metricParams->multiIFO, &metricParams->multiNoiseFloor, &metricParams->segmentList,
+                                            &intparams, &err );
+          XLAL_CHECK_NULL( !gsl_isnan( gg ), XLAL_EFUNC, "%s: integration of phase metric g_{i=%zu,j=%zu} failed (n=%zu, tries=%zu)", __func__, i, j, n, tries );
+          gsl_matrix_set( &g_ij_n.matrix, i, j, gg );
+          gsl_matrix_set( &g_ij_n.matrix, j, i, gg );
+          metric->maxrelerr = MYMAX( metric->maxrelerr, err );
+
+        } /* for i < n */
+
+        /* ----- compute L D L^T Cholesky decomposition of metric ----- */
+        XLAL_CHECK_NULL( XLALCholeskyLDLTDecompMetric( &cholesky, &g_ij_n.matrix ) == XLAL_SUCCESS, XLAL_EFUNC );
+        gsl_vector_view D = gsl_matrix_diagonal( cholesky );
+        if ( ( tries > 1 ) && ( lalDebugLevel & LALINFOBIT ) ) {
+          /* diagnostic / debug output */
+          fprintf( stdout, "%s: n=%zu, try=%zu, Cholesky diagonal =", __func__, n, tries );
+          XLALfprintfGSLvector( stdout, "%0.2e", &D.vector );
+        }
 
-      /* ----- compute last row/column of n-by-n submatrix of metric ----- */
-      for ( size_t i = 0; i < n; ++i ) {
-        const size_t j = n - 1;
+        /* ----- check that all diagonal elements D are positive after at least 1 try; if so, exit try loop */
+        if ( ( tries > 1 ) && ( gsl_vector_min( &D.vector ) > 0.0 ) ) {
+          break;
+        }
 
-        /* g_ij = [Phi_i, Phi_j] */
-        intparams.coord1 = i;
-        intparams.coord2 = j;
-        REAL8 gg = XLALCovariance_Phi_ij( &metricParams->multiIFO, &metricParams->multiNoiseFloor, &metricParams->segmentList,
-                                          &intparams, &err );
-        XLAL_CHECK_NULL( !gsl_isnan( gg ), XLAL_EFUNC, "%s: integration of phase metric g_{i=%zu,j=%zu} failed (n=%zu, tries=%zu)", __func__, i, j, n, tries );
-        gsl_matrix_set( &g_ij_n.matrix, i, j, gg );
-        gsl_matrix_set( &g_ij_n.matrix, j, i, gg );
-        metric->maxrelerr = MYMAX( metric->maxrelerr, err );
-
-      } /* for i < n */
-
-      /* ----- compute L D L^T Cholesky decomposition of metric ----- */
-      XLAL_CHECK_NULL( XLALCholeskyLDLTDecompMetric( &cholesky, &g_ij_n.matrix ) == XLAL_SUCCESS, XLAL_EFUNC );
-      gsl_vector_view D = gsl_matrix_diagonal( cholesky );
-      if ( ( tries > 1 ) && ( lalDebugLevel & LALINFOBIT ) ) {
-        /* diagnostic / debug output */
-        fprintf( stdout, "%s: n=%zu, try=%zu, Cholesky diagonal =", __func__, n, tries );
-        XLALfprintfGSLvector( stdout, "%0.2e", &D.vector );
-      }
+        /* zero out all but last row of L, since we do not want to coordinates before 'n' */
+        if ( n > 1 ) {
+          gsl_matrix_view cholesky_nm1 = gsl_matrix_submatrix( cholesky, 0, 0, n - 1, n );
+          gsl_matrix_set_identity( &cholesky_nm1.matrix );
+        }
 
-      /* ----- check that all diagonal elements D are positive after at least 1 try; if so, exit try loop */
-      if ( ( tries > 1 ) && ( gsl_vector_min( &D.vector ) > 0.0 ) ) {
-        break;
-      }
+        /* multiply transform by inverse of L (with unit diagonal), to transform 'n'th coordinates so that metric is diagonal */
+        gsl_blas_dtrsm( CblasLeft, CblasLower, CblasNoTrans, CblasUnit, 1.0, cholesky, &transform_n.matrix );
+
+        /* decrease relative error tolerances; don't do this too quickly, since
+           too-stringent tolerances may make GSL integration fail to converge */
+        intparams.epsrel = intparams.epsrel * 0.9;
+        /* decrease absolute error tolerances; don't do this too quickly, since
+           too-stringent tolerances may make GSL integration fail to converge,
+           and only after a certain number of tries, otherwise small integrals
+           fail to converge */
+        if ( tries >= 8 ) {
+          intparams.epsabs = intparams.epsabs * 0.9;
+        }
+        /* reduce the length of integration time units, but stop at 900s,
+           and ensure that 'intT' does NOT become divisible by 1/day, for
+           the same reason given at the initialisation of 'intT' above */
+        intparams.intT = MYMAX( 900, intparams.intT * 0.9 );
 
-      /* zero out all but last row of L, since we do not want to coordinates before 'n' */
-      if ( n > 1 ) {
-        gsl_matrix_view cholesky_nm1 = gsl_matrix_submatrix( cholesky, 0, 0, n - 1, n );
-        gsl_matrix_set_identity( &cholesky_nm1.matrix );
       }
+      XLAL_CHECK_NULL( tries <= max_tries, XLAL_EMAXITER, "%s: convergence of phase metric failed (n=%zu)", __func__, n );
 
-      /* multiply transform by inverse of L (with unit diagonal), to transform 'n'th coordinates so that metric is diagonal */
-      gsl_blas_dtrsm( CblasLeft, CblasLower, CblasNoTrans, CblasUnit, 1.0, cholesky, &transform_n.matrix );
-
-      /* decrease relative error tolerances; don't do this too quickly, since
-         too-stringent tolerances may make GSL integration fail to converge */
-      intparams.epsrel = intparams.epsrel * 0.9;
-      /* decrease absolute error tolerances; don't do this too quickly, since
-         too-stringent tolerances may make GSL integration fail to converge,
-         and only after a certain number of tries, otherwise small integrals
-         fail to converge */
-      if ( tries >= 8 ) {
-        intparams.epsabs = intparams.epsabs * 0.9;
-      }
-      /* reduce the length of integration time units, but stop at 900s,
-         and ensure that 'intT' does NOT become divisible by 1/day, for
-         the same reason given at the initialisation of 'intT' above */
-      intparams.intT = MYMAX( 900, intparams.intT * 0.9 );
+      /* free memory which is then re-allocated in next loop */
+      gsl_matrix_free( cholesky );
 
     }
-    XLAL_CHECK_NULL( tries <= max_tries, XLAL_EMAXITER, "%s: convergence of phase metric failed (n=%zu)", __func__, n );
-
-    /* free memory which is then re-allocated in next loop */
-    gsl_matrix_free( cholesky );
 
   }
 
@@ -1711,6 +2247,19 @@ XLALComputeAtomsForFmetric( const DopplerMetricParams *metricParams,   /**< inpu
 
   }
 
+  /* ----- if requested, integrate all atoms together on fixed quadrature nodes */
+  if ( metricParams->fixedQuadrature ) {
+    int errnum = XLALComputeAtomsFixedQuadrature( ret, metricParams, &intparams );
+    XLALDestroyVect3Dlist( intparams.rOrb_n );
+    if ( errnum != XLAL_SUCCESS || ret->maxrelerr > relerr_thresh ) {
+      XLALPrintError( "%s: XLALComputeAtomsFixedQuadrature() failed, or maximal relative F-metric error too high: %.2e > %.2e\n", __func__, ret->maxrelerr, relerr_thresh );
+      XLALDestroyFmetricAtoms( ret );
+      XLAL_ERROR_NULL( XLAL_EFUNC );
+    }
+    XLALPrintInfo( "\nMaximal relative error in F-metric: %.2e\n", ret->maxrelerr );
+    return ret;
+  }
+
   /* ----- integrate antenna-pattern coefficients A, B, C */
   REAL8 sum_weights = 0;
   A = B = C = 0;
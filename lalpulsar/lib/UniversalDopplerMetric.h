@@ -188,6 +188,7 @@ typedef struct tagDopplerMetricParams {
   INT4 projectCoord;                            /**< project metric onto subspace orthogonal to this axis (-1 = none, 0 = 1st coordinate, etc) */
 
   BOOLEAN approxPhase;                          /**< use an approximate phase-model, neglecting Roemer delay in spindown coordinates */
+  BOOLEAN fixedQuadrature;                      /**< integrate all metric components together on fixed Gauss-Legendre nodes, instead of adaptively one at a time */
 } DopplerMetricParams;
 
 
@@ -0,0 +1 @@
+../../lal/lib/simd_dispatch.h
\ No newline at end of file
@@ -75,6 +75,12 @@ typedef struct {
   const TestSubRecord *sub;
 } TestRecord;
 
+typedef struct {
+  UINT4 index;
+  REAL8 freq;
+  CHAR name[12];
+} TestRowRecord;
+
 REAL4 testarray[3][1824] = { { 0 }, { 0 }, { 0 } };
 
 const TestSubRecord testsub[3][2] = {
@@ -608,6 +614,143 @@ int main( int argc, char *argv[] )
   fprintf( stderr, "\n" );
   fflush( stderr );
 
+  // Write and read back many table rows at once, using a compressed (if supported) and memory-mapped FITS file
+  {
+    const size_t nrows = 23456;
+    TestRowRecord *rows = XLALCalloc( nrows, sizeof( *rows ) );
+    XLAL_CHECK_MAIN( rows != NULL, XLAL_ENOMEM );
+    TestRowRecord **row_ptrs = XLALCalloc( nrows, sizeof( *row_ptrs ) );
+    XLAL_CHECK_MAIN( row_ptrs != NULL, XLAL_ENOMEM );
+    for ( size_t i = 0; i < nrows; ++i ) {
+      rows[i].index = 3 * i + 1;
+      rows[i].freq = 100.0 + LAL_PI * i;
+      snprintf( rows[i].name, sizeof( rows[i].name ), "row%zu", i );
+      row_ptrs[i] = &rows[i];
+    }
+
+#if defined(HAVE_FITS_COMPRESS_TABLE)
+    FITSFile *file = XLALFITSFileOpenWriteCompressed( "FITSFileIOTestRows.fits" );
+#else
+    FITSFile *file = XLALFITSFileOpenWrite( "FITSFileIOTestRows.fits" );
+#endif
+    XLAL_CHECK_MAIN( file != NULL, XLAL_EFUNC );
+    fprintf( stderr, "PASSED: opened 'FITSFileIOTestRows.fits' for writing\n" );
+    XLAL_CHECK_MAIN( XLALFITSTableOpenWrite( file, "rows", "many table rows" ) == XLAL_SUCCESS, XLAL_EFUNC );
+    {
+      XLAL_FITS_TABLE_COLUMN_BEGIN( TestRowRecord );
+      XLAL_CHECK_MAIN( XLAL_FITS_TABLE_COLUMN_ADD( file, UINT4, index ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK_MAIN( XLAL_FITS_TABLE_COLUMN_ADD_NAMED( file, REAL8, freq, "freq [Hz]" ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK_MAIN( XLAL_FITS_TABLE_COLUMN_ADD_ARRAY( file, CHAR, name ) == XLAL_SUCCESS, XLAL_EFUNC );
+    }
+    for ( size_t i = 0; i < 100; ++i ) {
+      XLAL_CHECK_MAIN( XLALFITSTableWriteRow( file, row_ptrs[i] ) == XLAL_SUCCESS, XLAL_EFUNC );
+    }
+    XLAL_CHECK_MAIN( XLALFITSTableWriteRows( file, ( const void *const * ) &row_ptrs[100], nrows - 100 ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( XLALFITSHeaderWriteUINT8( file, "nrows", nrows, "number of rows" ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLALFITSFileClose( file );
+    fprintf( stderr, "PASSED: wrote many table rows\n" );
+
+    memset( rows, 0, nrows * sizeof( *rows ) );
+    file = XLALFITSFileOpenReadMapped( "FITSFileIOTestRows.fits" );
+    XLAL_CHECK_MAIN( file != NULL, XLAL_EFUNC );
+    fprintf( stderr, "PASSED: opened 'FITSFileIOTestRows.fits' for memory-mapped reading\n" );
+    UINT8 rem_nrows = 0;
+    XLAL_CHECK_MAIN( XLALFITSTableOpenRead( file, "rows", &rem_nrows ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( rem_nrows == nrows, XLAL_EFAILED );
+    {
+      XLAL_FITS_TABLE_COLUMN_BEGIN( TestRowRecord );
+      XLAL_CHECK_MAIN( XLAL_FITS_TABLE_COLUMN_ADD( file, UINT4, index ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK_MAIN( XLAL_FITS_TABLE_COLUMN_ADD_NAMED( file, REAL8, freq, "freq [Hz]" ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK_MAIN( XLAL_FITS_TABLE_COLUMN_ADD_ARRAY( file, CHAR, name ) == XLAL_SUCCESS, XLAL_EFUNC );
+    }
+    XLAL_CHECK_MAIN( XLALFITSTableReadRow( file, row_ptrs[0], &rem_nrows ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( rem_nrows == nrows - 1, XLAL_EFAILED );
+    for ( size_t i = 1; i < nrows; i += 1000 ) {
+      const size_t n = ( nrows - i < 1000 ) ? nrows - i : 1000;
+      XLAL_CHECK_MAIN( XLALFITSTableReadRows( file, ( void *const * ) &row_ptrs[i], n, &rem_nrows ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK_MAIN( rem_nrows == nrows - i - n, XLAL_EFAILED );
+    }
+    {
+      int errnum = 0;
+      XLAL_TRY_SILENT( XLALFITSTableReadRows( file, ( void *const * ) row_ptrs, 1, NULL ), errnum );
+      XLAL_CHECK_MAIN( errnum == XLAL_ERANGE, XLAL_EFAILED );
+    }
+    for ( size_t i = 0; i < nrows; ++i ) {
+      char name_ref[sizeof( rows[i].name )];
+      snprintf( name_ref, sizeof( name_ref ), "row%zu", i );
+      XLAL_CHECK_MAIN( rows[i].index == 3 * i + 1, XLAL_EFAILED, "rows[%zu].index = %u", i, rows[i].index );
+      XLAL_CHECK_MAIN( rows[i].freq == 100.0 + LAL_PI * i, XLAL_EFAILED, "rows[%zu].freq = %g", i, rows[i].freq );
+      XLAL_CHECK_MAIN( strcmp( rows[i].name, name_ref ) == 0, XLAL_EFAILED, "rows[%zu].name = '%s'", i, rows[i].name );
+    }
+    {
+      UINT8 nrows_chk = 0;
+      XLAL_CHECK_MAIN( XLALFITSHeaderReadUINT8( file, "nrows", &nrows_chk ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK_MAIN( nrows_chk == nrows, XLAL_EFAILED );
+    }
+    XLALFITSFileClose( file );
+    fprintf( stderr, "PASSED: read and verified many table rows\n" );
+
+    XLALFree( rows );
+    XLALFree( row_ptrs );
+  }
+  fprintf( stderr, "\n" );
+  fflush( stderr );
+
+  // Write buffered table rows, seek another named HDU before closing, and read the rows back
+  {
+    const size_t nrows = 17;
+    FITSFile *file = XLALFITSFileOpenWrite( "FITSFileIOTestSeek.fits" );
+    XLAL_CHECK_MAIN( file != NULL, XLAL_EFUNC );
+    fprintf( stderr, "PASSED: opened 'FITSFileIOTestSeek.fits' for writing\n" );
+    XLAL_CHECK_MAIN( XLALFITSArrayOpenWrite1( file, "seekarray", 3, "array to seek to" ) == XLAL_SUCCESS, XLAL_EFUNC );
+    for ( size_t i = 0; i < 3; ++i ) {
+      const size_t idx[] = { i };
+      XLAL_CHECK_MAIN( XLALFITSArrayWriteREAL4( file, idx, 1.5 * i ) == XLAL_SUCCESS, XLAL_EFUNC );
+    }
+    XLAL_CHECK_MAIN( XLALFITSTableOpenWrite( file, "seektable", "rows buffered before seeking" ) == XLAL_SUCCESS, XLAL_EFUNC );
+    {
+      XLAL_FITS_TABLE_COLUMN_BEGIN( TestRowRecord );
+      XLAL_CHECK_MAIN( XLAL_FITS_TABLE_COLUMN_ADD( file, UINT4, index ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK_MAIN( XLAL_FITS_TABLE_COLUMN_ADD_NAMED( file, REAL8, freq, "freq [Hz]" ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK_MAIN( XLAL_FITS_TABLE_COLUMN_ADD_ARRAY( file, CHAR, name ) == XLAL_SUCCESS, XLAL_EFUNC );
+    }
+    for ( size_t i = 0; i < nrows; ++i ) {
+      TestRowRecord record = { .index = 5 * i + 2, .freq = 50.0 + LAL_E * i };
+      snprintf( record.name, sizeof( record.name ), "seek%zu", i );
+      XLAL_CHECK_MAIN( XLALFITSTableWriteRow( file, &record ) == XLAL_SUCCESS, XLAL_EFUNC );
+    }
+    XLAL_CHECK_MAIN( XLALFITSFileSeekNamedHDU( file, "seekarray" ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLALFITSFileClose( file );
+    fprintf( stderr, "PASSED: wrote table rows and sought another HDU\n" );
+
+    file = XLALFITSFileOpenRead( "FITSFileIOTestSeek.fits" );
+    XLAL_CHECK_MAIN( file != NULL, XLAL_EFUNC );
+    fprintf( stderr, "PASSED: opened 'FITSFileIOTestSeek.fits' for reading\n" );
+    UINT8 rem_nrows = 0;
+    XLAL_CHECK_MAIN( XLALFITSTableOpenRead( file, "seektable", &rem_nrows ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( rem_nrows == nrows, XLAL_EFAILED, "rem_nrows = %" LAL_UINT8_FORMAT " != %zu", rem_nrows, nrows );
+    {
+      XLAL_FITS_TABLE_COLUMN_BEGIN( TestRowRecord );
+      XLAL_CHECK_MAIN( XLAL_FITS_TABLE_COLUMN_ADD( file, UINT4, index ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK_MAIN( XLAL_FITS_TABLE_COLUMN_ADD_NAMED( file, REAL8, freq, "freq [Hz]" ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK_MAIN( XLAL_FITS_TABLE_COLUMN_ADD_ARRAY( file, CHAR, name ) == XLAL_SUCCESS, XLAL_EFUNC );
+    }
+    for ( size_t i = 0; i < nrows; ++i ) {
+      TestRowRecord record;
+      char name_ref[sizeof( record.name )];
+      snprintf( name_ref, sizeof( name_ref ), "seek%zu", i );
+      XLAL_CHECK_MAIN( XLALFITSTableReadRow( file, &record, &rem_nrows ) == XLAL_SUCCESS, XLAL_EFUNC );
+      XLAL_CHECK_MAIN( rem_nrows == nrows - i - 1, XLAL_EFAILED );
+      XLAL_CHECK_MAIN( record.index == 5 * i + 2, XLAL_EFAILED, "record[%zu].index = %u", i, record.index );
+      XLAL_CHECK_MAIN( record.freq == 50.0 + LAL_E * i, XLAL_EFAILED, "record[%zu].freq = %g", i, record.freq );
+      XLAL_CHECK_MAIN( strcmp( record.name, name_ref ) == 0, XLAL_EFAILED, "record[%zu].name = '%s'", i, record.name );
+    }
+    XLALFITSFileClose( file );
+    fprintf( stderr, "PASSED: read and verified table rows written before seeking\n" );
+  }
+  fprintf( stderr, "\n" );
+  fflush( stderr );
+
   // Cleanup
   XLALDestroyUserVars();
   LALCheckMemoryLeaks();
@@ -211,6 +211,75 @@ main( void )
   XLALPrintError( "XLALBarycenter()     %g s\n", tau / counter );
   XLALPrintError( "XLALBarycenterOpt()  %g s (= %.1f %%)\n", tau_opt / counter,  - 100 * ( tau - tau_opt ) / tau );
 
+  /* ===== test XLALFitEphemerisDataChebyshev() and binary ephemeris files ===== */
+  XLALPrintInfo( "\n\nTesting XLALFitEphemerisDataChebyshev() and XLALWriteEphemerisDataBinary() ... " );
+  {
+    const char binEphFile[] = "LALBarycenterTestEphem.bin";
+    XLAL_CHECK( XLALWriteEphemerisDataBinary( binEphFile, edat ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( edat->cheb == NULL, XLAL_EFAILED );
+    EphemerisData *edat_bin = XLALInitBarycenter( binEphFile, NULL );
+    XLAL_CHECK( edat_bin != NULL, XLAL_EFUNC );
+    XLAL_CHECK( edat_bin->cheb != NULL, XLAL_EFAILED );
+    XLAL_CHECK( edat_bin->etype == edat->etype, XLAL_EFAILED );
+    XLAL_CHECK( edat_bin->nentriesE == edat->nentriesE && edat_bin->dtEtable == edat->dtEtable, XLAL_EFAILED );
+    XLAL_CHECK( edat_bin->nentriesS == edat->nentriesS && edat_bin->dtStable == edat->dtStable, XLAL_EFAILED );
+    XLAL_CHECK( memcmp( edat_bin->ephemE, edat->ephemE, edat->nentriesE * sizeof( edat->ephemE[0] ) ) == 0, XLAL_EFAILED );
+    XLAL_CHECK( memcmp( edat_bin->ephemS, edat->ephemS, edat->nentriesS * sizeof( edat->ephemS[0] ) ) == 0, XLAL_EFAILED );
+
+    /* compare Chebyshev series against Taylor expansion at and between Earth table entries */
+    REAL8 maxPosNode = 0, maxVelNode = 0, maxPos = 0, maxVel = 0;
+    for ( INT4 i = 1; i < edat->nentriesE - 1; ++i ) {
+      for ( UINT4 n = 0; n < 2; ++n ) {
+        EarthState earth_bin;
+        XLALGPSSetREAL8( &tGPS, edat->ephemE[i].gps + 0.5 * n * edat->dtEtable );
+        XLAL_CHECK( XLALBarycenterEarth( &earth, &tGPS, edat ) == XLAL_SUCCESS, XLAL_EFUNC );
+        XLAL_CHECK( XLALBarycenterEarth( &earth_bin, &tGPS, edat_bin ) == XLAL_SUCCESS, XLAL_EFUNC );
+        for ( UINT4 j = 0; j < 3; ++j ) {
+          const REAL8 dpos = fmax( fabs( earth_bin.posNow[j] - earth.posNow[j] ), fabs( earth_bin.se[j] - earth.se[j] ) );
+          const REAL8 dvel = fmax( fabs( earth_bin.velNow[j] - earth.velNow[j] ), fabs( earth_bin.dse[j] - earth.dse[j] ) );
+          if ( n == 0 ) {
+            maxPosNode = fmax( maxPosNode, dpos );
+            maxVelNode = fmax( maxVelNode, dvel );
+          } else {
+            maxPos = fmax( maxPos, dpos );
+            maxVel = fmax( maxVel, dvel );
+          }
+        }
+        XLAL_CHECK( earth_bin.einstein == earth.einstein && earth_bin.gmstRad == earth.gmstRad, XLAL_EFAILED );
+      }
+    }
+    XLALPrintInfo( "Max error between Chebyshev series and table entries: position %g s, velocity %g\n", maxPosNode, maxVelNode );
+    XLALPrintInfo( "Max difference between Chebyshev series and Taylor expansion: position %g s, velocity %g\n", maxPos, maxVel );
+    XLAL_CHECK( maxPosNode < 1e-8 && maxVelNode < 1e-11, XLAL_EFAILED, "Chebyshev series does not match table entries: position %g s, velocity %g\n", maxPosNode, maxVelNode );
+    XLAL_CHECK( maxPos < 1e-6 && maxVel < 1e-9, XLAL_EFAILED, "Chebyshev series does not match Taylor expansion: position %g s, velocity %g\n", maxPos, maxVel );
+
+    /* fit Chebyshev series in memory, and check XLALBarycenterEarthVector() against file-loaded series */
+    XLAL_CHECK( XLALFitEphemerisDataChebyshev( edat ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK( edat->cheb != NULL, XLAL_EFAILED );
+    const UINT4 numTimes = 1000;
+    LIGOTimeGPS *tGPSV = XLALCalloc( numTimes, sizeof( *tGPSV ) );
+    EarthState *earthV = XLALCalloc( numTimes, sizeof( *earthV ) );
+    XLAL_CHECK( tGPSV != NULL && earthV != NULL, XLAL_ENOMEM );
+    for ( UINT4 i = 0; i < numTimes; ++i ) {
+      XLALGPSSetREAL8( &tGPSV[i], t1998 + ( 1.0 * rand() / RAND_MAX ) * LAL_YRSID_SI );
+    }
+    XLAL_CHECK( XLALBarycenterEarthVector( earthV, tGPSV, numTimes, edat ) == XLAL_SUCCESS, XLAL_EFUNC );
+    for ( UINT4 i = 0; i < numTimes; ++i ) {
+      XLAL_CHECK( XLALBarycenterEarth( &earth, &tGPSV[i], edat_bin ) == XLAL_SUCCESS, XLAL_EFUNC );
+      for ( UINT4 j = 0; j < 3; ++j ) {
+        XLAL_CHECK( earthV[i].posNow[j] == earth.posNow[j] && earthV[i].velNow[j] == earth.velNow[j], XLAL_EFAILED,
+                    "XLALBarycenterEarthVector() does not match XLALBarycenterEarth() at time %d", i );
+        XLAL_CHECK( earthV[i].se[j] == earth.se[j] && earthV[i].dse[j] == earth.dse[j], XLAL_EFAILED,
+                    "XLALBarycenterEarthVector() does not match XLALBarycenterEarth() at time %d", i );
+      }
+    }
+    XLALFree( tGPSV );
+    XLALFree( earthV );
+
+    XLALDestroyEphemerisData( edat_bin );
+  }
+  XLALPrintInfo( "PASSED\n\n" );
+
   /* ===== test XLALRestrictEphemerisData() ===== */
   XLALPrintInfo( "\n\nTesting XLALRestrictEphemerisData() ... " );
   {
@@ -336,6 +336,77 @@ static int BasicTest(
     }
     printf( " done\n" );
 
+    // Get nearest blocks to all templates at once, check for consistency with XLALNearestLatticeTilingBlock()
+    printf( "  Testing XLALNearestLatticeTilingBlocks() ..." );
+    {
+      gsl_matrix *nearest_blocks = NULL;
+      UINT8Vector *nearest_block_indexes = NULL;
+      INT4Vector *nearest_block_lefts = NULL, *nearest_block_rights = NULL;
+      XLAL_CHECK( XLALNearestLatticeTilingBlocks( loc, points, i, &nearest_blocks, &nearest_block_indexes, &nearest_block_lefts, &nearest_block_rights ) == XLAL_SUCCESS, XLAL_EFUNC );
+      for ( UINT8 k = 0; k < total; ++k ) {
+        gsl_vector_const_view point_view = gsl_matrix_const_column( points, k );
+        UINT8 nearest_index = 0;
+        INT4 nearest_left = 0, nearest_right = 0;
+        XLAL_CHECK( XLALNearestLatticeTilingBlock( loc, &point_view.vector, i, nearest, &nearest_index, &nearest_left, &nearest_right ) == XLAL_SUCCESS, XLAL_EFUNC );
+        gsl_vector_const_view nearest_block_view = gsl_matrix_const_column( nearest_blocks, k );
+        gsl_vector_sub( nearest, &nearest_block_view.vector );
+        XLAL_CHECK( gsl_blas_dasum( nearest ) == 0, XLAL_EFAILED, "nearest points differ at k = %" LAL_UINT8_FORMAT, k );
+        XLAL_CHECK( nearest_block_indexes->data[k] == nearest_index, XLAL_EFAILED, "nearest_block_indexes[%" LAL_UINT8_FORMAT "] = %" LAL_UINT8_FORMAT " != %" LAL_UINT8_FORMAT, k, nearest_block_indexes->data[k], nearest_index );
+        XLAL_CHECK( nearest_block_lefts->data[k] == nearest_left, XLAL_EFAILED, "nearest_block_lefts[%" LAL_UINT8_FORMAT "] = %i != %i", k, nearest_block_lefts->data[k], nearest_left );
+        XLAL_CHECK( nearest_block_rights->data[k] == nearest_right, XLAL_EFAILED, "nearest_block_rights[%" LAL_UINT8_FORMAT "] = %i != %i", k, nearest_block_rights->data[k], nearest_right );
+      }
+      GFMAT( nearest_blocks );
+      XLALDestroyUINT8Vector( nearest_block_indexes );
+      XLALDestroyINT4Vector( nearest_block_lefts );
+      XLALDestroyINT4Vector( nearest_block_rights );
+    }
+    printf( " done\n" );
+
+    // Iterate over shards of the lattice tiling, check for consistency with all points
+    printf( "  Testing XLALSetLatticeTilingIteratorShard() ..." );
+    for ( UINT4 nshards = 1; nshards <= 7; nshards += 3 ) {
+      UINT8 k = 0;
+      for ( UINT4 shard = 0; shard < nshards; ++shard ) {
+        LatticeTilingIterator *itr_shard = XLALCreateLatticeTilingIterator( tiling, i + 1 );
+        XLAL_CHECK( itr_shard != NULL, XLAL_EFUNC );
+        XLAL_CHECK( XLALSetLatticeTilingIteratorShard( itr_shard, loc, nshards, shard ) == XLAL_SUCCESS, XLAL_EFUNC );
+        UINT8 index_begin = 0, index_end = 0;
+        XLAL_CHECK( XLALLatticeTilingIteratorRange( itr_shard, &index_begin, &index_end ) == XLAL_SUCCESS, XLAL_EFUNC );
+        XLAL_CHECK( index_begin == k, XLAL_EFAILED, "index_begin = %" LAL_UINT8_FORMAT " != %" LAL_UINT8_FORMAT, index_begin, k );
+        XLAL_CHECK( index_end - index_begin <= total / nshards + 1, XLAL_EFAILED, "shard %u/%u is unbalanced", shard, nshards );
+        while ( XLALNextLatticeTilingPoint( itr_shard, nearest ) > 0 ) {
+          const UINT8 itr_index = XLALCurrentLatticeTilingIndex( itr_shard );
+          XLAL_CHECK( k == itr_index, XLAL_EFUNC, "k = %" LAL_UINT8_FORMAT " != %" LAL_UINT8_FORMAT " = itr_index", k, itr_index );
+          gsl_vector_const_view point_view = gsl_matrix_const_column( points, k );
+          gsl_vector_sub( nearest, &point_view.vector );
+          double err = gsl_blas_dasum( nearest ) / n;
+          XLAL_CHECK( err < 1e-10, XLAL_EFAILED, "err = %e < 1e-10", err );
+          ++k;
+        }
+        XLAL_CHECK( k == index_end, XLAL_EFAILED, "k = %" LAL_UINT8_FORMAT " != %" LAL_UINT8_FORMAT " = index_end", k, index_end );
+        XLALDestroyLatticeTilingIterator( itr_shard );
+      }
+      XLAL_CHECK( k == total, XLAL_EFAILED, "k = %" LAL_UINT8_FORMAT " != %" LAL_UINT8_FORMAT " = total", k, total );
+    }
+    printf( " done\n" );
+
+    // Seek to each point in reverse order, check for consistency with all points
+    printf( "  Testing XLALSeekLatticeTilingIterator() ..." );
+    for ( UINT8 k = total; k-- > 0; ) {
+      XLAL_CHECK( XLALSeekLatticeTilingIterator( itr, loc, k, nearest ) == XLAL_SUCCESS, XLAL_EFUNC );
+      const UINT8 itr_index = XLALCurrentLatticeTilingIndex( itr );
+      XLAL_CHECK( k == itr_index, XLAL_EFUNC, "k = %" LAL_UINT8_FORMAT " != %" LAL_UINT8_FORMAT " = itr_index", k, itr_index );
+      gsl_vector_const_view point_view = gsl_matrix_const_column( points, k );
+      gsl_vector_sub( nearest, &point_view.vector );
+      double err = gsl_blas_dasum( nearest ) / n;
+      XLAL_CHECK( err < 1e-10, XLAL_EFAILED, "err = %e < 1e-10", err );
+    }
+    if ( total > 1 ) {
+      XLAL_CHECK( XLALNextLatticeTilingPoint( itr, NULL ) > 0, XLAL_EFUNC );
+      XLAL_CHECK( XLALCurrentLatticeTilingIndex( itr ) == 1, XLAL_EFAILED );
+    }
+    printf( " done\n" );
+
     // Cleanup
     XLALDestroyLatticeTilingIterator( itr );
     GFMAT( points );
@@ -101,6 +101,49 @@ static int CompareSFTVectors( SFTVector *sft_vect, SFTVector *sft_vect2 )
   return ( 0 );
 }
 
+static int CompareSFTCatalogs( SFTCatalog *catalog, SFTCatalog *catalog2 );
+static int CompareSFTCatalogs( SFTCatalog *catalog, SFTCatalog *catalog2 )
+{
+  if ( catalog->length != catalog2->length ) {
+    XLALPrintError( "CompareSFTCatalogs(): catalog lengths differ!\n" );
+    return ( -1 );
+  }
+  for ( UINT4 i = 0; i < catalog->length; i++ ) {
+    const SFTDescriptor *desc1 = &catalog->data[i];
+    const SFTDescriptor *desc2 = &catalog2->data[i];
+    if ( XLALGPSCmp( &desc1->header.epoch, &desc2->header.epoch ) != 0 ) {
+      XLALPrintError( "CompareSFTCatalogs(): SFT#%u epochs differ (%f/%f)!\n",
+                      i, GPS2REAL8( desc1->header.epoch ), GPS2REAL8( desc2->header.epoch ) );
+      return ( -1 );
+    }
+    if ( strncmp( desc1->header.name, desc2->header.name, sizeof( desc1->header.name ) ) ||
+         ( desc1->header.f0 != desc2->header.f0 ) || ( desc1->header.deltaF != desc2->header.deltaF ) ) {
+      XLALPrintError( "CompareSFTCatalogs(): SFT#%u headers differ!\n", i );
+      return ( -1 );
+    }
+    if ( ( desc1->numBins != desc2->numBins ) || ( desc1->version != desc2->version ) || ( desc1->crc64 != desc2->crc64 ) ) {
+      XLALPrintError( "CompareSFTCatalogs(): SFT#%u bins, versions, or checksums differ!\n", i );
+      return ( -1 );
+    }
+    if ( strcmp( desc1->window_type, desc2->window_type ) || ( desc1->window_param != desc2->window_param ) ) {
+      XLALPrintError( "CompareSFTCatalogs(): SFT#%u windows differ!\n", i );
+      return ( -1 );
+    }
+    if ( ( desc1->comment == NULL ) != ( desc2->comment == NULL ) ||
+         ( desc1->comment != NULL && strcmp( desc1->comment, desc2->comment ) ) ) {
+      XLALPrintError( "CompareSFTCatalogs(): SFT#%u comments differ!\n", i );
+      return ( -1 );
+    }
+    char locator1[512];
+    snprintf( locator1, sizeof( locator1 ), "%s", XLALshowSFTLocator( desc1->locator ) );
+    if ( strcmp( locator1, XLALshowSFTLocator( desc2->locator ) ) ) {
+      XLALPrintError( "CompareSFTCatalogs(): SFT#%u locators differ!\n", i );
+      return ( -1 );
+    }
+  }
+  return ( 0 );
+}
+
 int main( void )
 {
   const char *fn = __func__;
@@ -382,6 +425,85 @@ int main( void )
   sft_vect = NULL;
   XLALDestroySFTCatalog( catalog );
 
+  /* ---------- test SFT catalog index ---------- */
+  {
+#define INDEX_FNAME "SFTfileIOTest.sftindex"
+    SFTCatalog *ref_catalog = NULL;
+    remove( INDEX_FNAME );
+
+    /* reference catalog and SFTs, without an index */
+    XLAL_CHECK_MAIN( ( ref_catalog = XLALSFTdataFind( "outputsft_r*.sft", NULL ) ) != NULL, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( ( sft_vect = XLALLoadSFTs( ref_catalog, -1, -1 ) ) != NULL, XLAL_EFUNC );
+
+    /* first call writes the index, second call reads it back; both must match the reference */
+    for ( int pass = 0; pass < 2; ++pass ) {
+      XLAL_CHECK_MAIN( ( catalog = XLALSFTdataFindWithIndex( "outputsft_r*.sft", NULL, INDEX_FNAME ) ) != NULL, XLAL_EFUNC );
+      XLAL_CHECK_MAIN( CompareSFTCatalogs( ref_catalog, catalog ) == 0, XLAL_EFAILED, "SFT catalog with index differs from reference (pass %i)", pass );
+      XLAL_CHECK_MAIN( ( sft_vect2 = XLALLoadSFTs( catalog, -1, -1 ) ) != NULL, XLAL_EFUNC );
+      XLAL_CHECK_MAIN( CompareSFTVectors( sft_vect, sft_vect2 ) == 0, XLAL_EFAILED, "SFTs loaded with index differ from reference (pass %i)", pass );
+      XLALDestroySFTVector( sft_vect2 );
+      sft_vect2 = NULL;
+      XLALDestroySFTCatalog( catalog );
+      FILE *fp = fopen( INDEX_FNAME, "rb" );
+      XLAL_CHECK_MAIN( fp != NULL, XLAL_EIO, "SFT catalog index '%s' was not written", INDEX_FNAME );
+      fclose( fp );
+    }
+
+    /* a corrupt index must be ignored, and the SFT files parsed instead */
+    {
+      FILE *fp = fopen( INDEX_FNAME, "r+b" );
+      XLAL_CHECK_MAIN( fp != NULL, XLAL_EIO );
+      XLAL_CHECK_MAIN( fseek( fp, 24, SEEK_SET ) == 0, XLAL_EIO );
+      const int c = fgetc( fp );
+      XLAL_CHECK_MAIN( c != EOF, XLAL_EIO );
+      XLAL_CHECK_MAIN( fseek( fp, 24, SEEK_SET ) == 0, XLAL_EIO );
+      XLAL_CHECK_MAIN( fputc( c ^ 0xff, fp ) != EOF, XLAL_EIO );
+      fclose( fp );
+    }
+    XLAL_CHECK_MAIN( ( catalog = XLALSFTdataFindWithIndex( "outputsft_r*.sft", NULL, INDEX_FNAME ) ) != NULL, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( CompareSFTCatalogs( ref_catalog, catalog ) == 0, XLAL_EFAILED, "SFT catalog with corrupt index differs from reference" );
+    XLALDestroySFTCatalog( catalog );
+    {
+      FILE *fp = fopen( INDEX_FNAME, "wb" );
+      XLAL_CHECK_MAIN( fp != NULL, XLAL_EIO );
+      fprintf( fp, "not an SFT catalog index\n" );
+      fclose( fp );
+    }
+    XLAL_CHECK_MAIN( ( catalog = XLALSFTdataFindWithIndex( "outputsft_r*.sft", NULL, INDEX_FNAME ) ) != NULL, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( CompareSFTCatalogs( ref_catalog, catalog ) == 0, XLAL_EFAILED, "SFT catalog with invalid index differs from reference" );
+    XLALDestroySFTCatalog( catalog );
+
+    /* replace one SFT file with a different SFT of the same size, using an index which is now current */
+    SFTCatalog *stale_catalog = NULL;
+    XLAL_CHECK_MAIN( ( stale_catalog = XLALSFTdataFindWithIndex( "outputsft_r*.sft", NULL, INDEX_FNAME ) ) != NULL, XLAL_EFUNC );
+    sft_vect->data[1].epoch.gpsSeconds += 1000;
+    for ( UINT4 bin = 0; bin < sft_vect->data[1].data->length; bin++ ) {
+      sft_vect->data[1].data->data[bin] *= 2;
+    }
+    XLAL_CHECK_MAIN( XLALWriteSFT2NamedFile( &sft_vect->data[1], "outputsft_r3.sft.tmp", spec.window_type, spec.window_param, "A SFT file for testing!" ) == XLAL_SUCCESS, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( rename( "outputsft_r3.sft.tmp", "outputsft_r2.sft" ) == 0, XLAL_EIO );
+
+    /* loading SFTs from a catalog made before the file changed must fail, rather than read the wrong data */
+    XLAL_CHECK_MAIN( ( sft_vect2 = XLALLoadSFTs( stale_catalog, -1, -1 ) ) == NULL, XLAL_EFAILED, "XLALLoadSFTs() did not detect a changed SFT file" );
+    XLALClearErrno();
+    XLALDestroySFTCatalog( stale_catalog );
+
+    /* the stale index entry must be ignored, and the changed file parsed instead */
+    XLALDestroySFTCatalog( ref_catalog );
+    XLAL_CHECK_MAIN( ( ref_catalog = XLALSFTdataFind( "outputsft_r*.sft", NULL ) ) != NULL, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( ( catalog = XLALSFTdataFindWithIndex( "outputsft_r*.sft", NULL, INDEX_FNAME ) ) != NULL, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( CompareSFTCatalogs( ref_catalog, catalog ) == 0, XLAL_EFAILED, "SFT catalog with stale index differs from reference" );
+    XLAL_CHECK_MAIN( ( sft_vect2 = XLALLoadSFTs( catalog, -1, -1 ) ) != NULL, XLAL_EFUNC );
+    XLAL_CHECK_MAIN( CompareSFTVectors( sft_vect, sft_vect2 ) == 0, XLAL_EFAILED, "SFTs loaded with stale index differ from changed SFTs" );
+
+    XLALDestroySFTVector( sft_vect2 );
+    sft_vect2 = NULL;
+    XLALDestroySFTVector( sft_vect );
+    sft_vect = NULL;
+    XLALDestroySFTCatalog( catalog );
+    XLALDestroySFTCatalog( ref_catalog );
+  }
+
   /* ---------- test timestamps-reading functions by comparing LAL- and XLAL-versions against each other ---------- */
   {
 #define TS_FNAME "testTimestamps.dat"
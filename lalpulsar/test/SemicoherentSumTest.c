@@ -0,0 +1,227 @@
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with with program; see the file COPYING. If not, write to the
+// Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+// MA  02110-1301  USA
+//
+
+// Test and benchmark the semicoherent summing kernels in SemicoherentSum.h.
+// Each available SIMD variant is checked for exact agreement with the generic
+// implementation, and timed against the equivalent sequence of VectorMath calls.
+// Set LAL_SIMD_ISET to restrict the instruction set used by the dispatched functions.
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <config.h>
+
+#include <lal/LALStdlib.h>
+#include <lal/AVFactories.h>
+#include <lal/LALSIMD.h>
+#include <lal/LogPrintf.h>
+#include <lal/UserInput.h>
+#include <lal/VectorMath.h>
+#include <lal/SemicoherentSum.h>
+#include <lal/LALPulsarVCSInfo.h>
+
+/* for access to internal prototypes for generic (GEN) functions, for reference results */
+#include <SemicoherentSum_internal.h>
+
+// ---------- Macros ----------
+#define frand() (rand() / (REAL4)RAND_MAX)
+
+// local types
+typedef struct {
+  INT4 randSeed;        // random-number seed
+  INT4 Nruns;           // number of repeated timing 'runs' to average over in order to improve variance of result
+  INT4 nsegments;       // number of segments to sum over
+  INT4 nfreqs;          // number of frequency bins per segment
+} UserInput_t;
+
+typedef int ( *SemicoherentAddFunc ) SEMICOHERENTADD_ARG_DEF;
+
+// ---------- internal prototypes ----------
+static int test_semicoherent_add( const char *name, SemicoherentAddFunc func, const REAL4 **coh2F, const UINT4 nsegments, const UINT4 nfreqs, const REAL4 threshold, const UINT4 Nruns );
+
+// ---------- main ----------
+int main( int argc, char *argv[] )
+{
+  UserInput_t XLAL_INIT_DECL( uvar_s );
+  UserInput_t *uvar = &uvar_s;
+
+  uvar->randSeed = 1;
+  uvar->Nruns = 1;
+  uvar->nsegments = 100;
+  uvar->nfreqs = 100000 + 7;
+
+  XLAL_CHECK_MAIN( XLALRegisterUvarMember( randSeed,  INT4, 's', OPTIONAL, "Random-number seed" ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( XLALRegisterUvarMember( Nruns,     INT4, 'r', OPTIONAL, "Number of repeated timing 'runs' to average over (=improves variance)" ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( XLALRegisterUvarMember( nsegments, INT4, 'n', OPTIONAL, "Number of segments to sum over" ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLAL_CHECK_MAIN( XLALRegisterUvarMember( nfreqs,    INT4, 'f', OPTIONAL, "Number of frequency bins per segment" ) == XLAL_SUCCESS, XLAL_EFUNC );
+
+  BOOLEAN should_exit = 0;
+  XLAL_CHECK_MAIN( XLALUserVarReadAllInput( &should_exit, argc, argv, lalPulsarVCSInfoList ) == XLAL_SUCCESS, XLAL_EFUNC );
+  if ( should_exit ) {
+    return EXIT_FAILURE;
+  }
+  XLAL_CHECK_MAIN( uvar->Nruns >= 1, XLAL_EDOM );
+  XLAL_CHECK_MAIN( uvar->nsegments >= 1, XLAL_EDOM );
+  XLAL_CHECK_MAIN( uvar->nfreqs >= 1, XLAL_EDOM );
+
+  srand( uvar->randSeed );
+  const UINT4 Nruns = uvar->Nruns;
+  const UINT4 nsegments = uvar->nsegments;
+  const UINT4 nfreqs = uvar->nfreqs;
+
+  // Semicoherent number-count threshold, as used by HierarchSearchGCT
+  const REAL4 threshold = 2.0 * 2.6;
+
+  // Create coherent 2F values, roughly chi^2-distributed with 4 degrees of freedom
+  REAL4Vector *coh2F_data = XLALCreateREAL4Vector( nsegments * nfreqs );
+  XLAL_CHECK_MAIN( coh2F_data != NULL, XLAL_EFUNC );
+  const REAL4 **coh2F = XLALCalloc( nsegments, sizeof( *coh2F ) );
+  XLAL_CHECK_MAIN( coh2F != NULL, XLAL_ENOMEM );
+  for ( UINT4 j = 0; j < nsegments; ++j ) {
+    for ( UINT4 i = 0; i < nfreqs; ++i ) {
+      coh2F_data->data[j * nfreqs + i] = -2.0 * ( logf( frand() + 1e-6 ) + logf( frand() + 1e-6 ) );
+    }
+    coh2F[j] = coh2F_data->data + j * nfreqs;
+  }
+
+  XLALPrintInfo( "Testing semicoherent summing over %u segments of %u frequency bins\n", nsegments, nfreqs );
+
+  // Test the available SIMD variants against the generic implementation
+  XLAL_CHECK_MAIN( test_semicoherent_add( "XLALVectorSemicoherentAddREAL4_GEN", XLALVectorSemicoherentAddREAL4_GEN, coh2F, nsegments, nfreqs, threshold, Nruns ) == XLAL_SUCCESS, XLAL_EFUNC );
+#if defined(HAVE_AVX2_COMPILER)
+  if ( LAL_HAVE_AVX2_RUNTIME() ) {
+    XLAL_CHECK_MAIN( test_semicoherent_add( "XLALVectorSemicoherentAddREAL4_AVX2", XLALVectorSemicoherentAddREAL4_AVX2, coh2F, nsegments, nfreqs, threshold, Nruns ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+#endif
+#if defined(HAVE_AVX512F_COMPILER)
+  if ( LAL_HAVE_AVX512F_RUNTIME() ) {
+    XLAL_CHECK_MAIN( test_semicoherent_add( "XLALVectorSemicoherentAddREAL4_AVX512F", XLALVectorSemicoherentAddREAL4_AVX512F, coh2F, nsegments, nfreqs, threshold, Nruns ) == XLAL_SUCCESS, XLAL_EFUNC );
+  }
+#endif
+  XLAL_CHECK_MAIN( test_semicoherent_add( "XLALVectorSemicoherentAddREAL4", XLALVectorSemicoherentAddREAL4, coh2F, nsegments, nfreqs, threshold, Nruns ) == XLAL_SUCCESS, XLAL_EFUNC );
+  XLALPrintInfo( "XLALVectorSemicoherentAddREAL4() dispatches to %s\n", XLALVectorSemicoherentAddREAL4_name );
+
+  // Test summing over all segments at once against the equivalent VectorMath calls, as previously used by Weave
+  {
+    REAL4 *sum2F_ref = XLALCalloc( nfreqs, sizeof( *sum2F_ref ) );
+    REAL4 *max2F_ref = XLALCalloc( nfreqs, sizeof( *max2F_ref ) );
+    UINT4 *count_ref = XLALCalloc( nfreqs, sizeof( *count_ref ) );
+    REAL4 *sum2F = XLALCalloc( nfreqs, sizeof( *sum2F ) );
+    REAL4 *max2F = XLALCalloc( nfreqs, sizeof( *max2F ) );
+    UINT4 *count = XLALCalloc( nfreqs, sizeof( *count ) );
+    XLAL_CHECK_MAIN( sum2F_ref != NULL && max2F_ref != NULL && count_ref != NULL && sum2F != NULL && max2F != NULL && count != NULL, XLAL_ENOMEM );
+
+    REAL8 tic = XLALGetCPUTime();
+    for ( UINT4 l = 0; l < Nruns; ++l ) {
+      memcpy( sum2F_ref, coh2F[0], sizeof( sum2F_ref[0] ) * nfreqs );
+      memcpy( max2F_ref, coh2F[0], sizeof( max2F_ref[0] ) * nfreqs );
+      for ( UINT4 j = 1; j < nsegments; ++j ) {
+        XLAL_CHECK_MAIN( XLALVectorAddREAL4( sum2F_ref, sum2F_ref, coh2F[j], nfreqs ) == XLAL_SUCCESS, XLAL_EFUNC );
+        XLAL_CHECK_MAIN( XLALVectorMaxREAL4( max2F_ref, max2F_ref, coh2F[j], nfreqs ) == XLAL_SUCCESS, XLAL_EFUNC );
+      }
+    }
+    REAL8 toc = XLALGetCPUTime();
+    for ( UINT4 i = 0; i < nfreqs; ++i ) {
+      count_ref[i] = 0;
+      for ( UINT4 j = 0; j < nsegments; ++j ) {
+        count_ref[i] += ( threshold < coh2F[j][i] );
+      }
+    }
+    XLALPrintInfo( "%-40s: %6.0f Mops/sec\n", "XLALVectorAddREAL4+XLALVectorMaxREAL4", ( REAL8 )nsegments * nfreqs * Nruns / ( toc - tic ) / 1e6 );
+
+    tic = XLALGetCPUTime();
+    for ( UINT4 l = 0; l < Nruns; ++l ) {
+      XLAL_CHECK_MAIN( XLALVectorsSemicoherentSumREAL4( sum2F, max2F, count, threshold, coh2F, nsegments, nfreqs ) == XLAL_SUCCESS, XLAL_EFUNC );
+    }
+    toc = XLALGetCPUTime();
+    XLALPrintInfo( "%-40s: %6.0f Mops/sec\n", "XLALVectorsSemicoherentSumREAL4", ( REAL8 )nsegments * nfreqs * Nruns / ( toc - tic ) / 1e6 );
+
+    for ( UINT4 i = 0; i < nfreqs; ++i ) {
+      XLAL_CHECK_MAIN( sum2F[i] == sum2F_ref[i], XLAL_ETOL, "sum2F[%u] = %g differs from reference %g", i, sum2F[i], sum2F_ref[i] );
+      XLAL_CHECK_MAIN( max2F[i] == max2F_ref[i], XLAL_ETOL, "max2F[%u] = %g differs from reference %g", i, max2F[i], max2F_ref[i] );
+      XLAL_CHECK_MAIN( count[i] == count_ref[i], XLAL_ETOL, "count[%u] = %u differs from reference %u", i, count[i], count_ref[i] );
+    }
+
+    XLALFree( sum2F_ref );
+    XLALFree( max2F_ref );
+    XLALFree( count_ref );
+    XLALFree( sum2F );
+    XLALFree( max2F );
+    XLALFree( count );
+  }
+
+  // Cleanup
+  XLALFree( coh2F );
+  XLALDestroyREAL4Vector( coh2F_data );
+  XLALDestroyUserVars();
+  LALCheckMemoryLeaks();
+
+  return EXIT_SUCCESS;
+
+}
+
+/// Sum over segments with one semicoherent-add function, compare against a scalar reference, and time it
+static int test_semicoherent_add( const char *name, SemicoherentAddFunc func, const REAL4 **coh2F, const UINT4 nsegments, const UINT4 nfreqs, const REAL4 threshold, const UINT4 Nruns )
+{
+
+  REAL4 *sum2F = XLALCalloc( nfreqs, sizeof( *sum2F ) );
+  REAL4 *max2F = XLALCalloc( nfreqs, sizeof( *max2F ) );
+  UINT4 *max2FSeg = XLALCalloc( nfreqs, sizeof( *max2FSeg ) );
+  UINT4 *count = XLALCalloc( nfreqs, sizeof( *count ) );
+  XLAL_CHECK( sum2F != NULL && max2F != NULL && max2FSeg != NULL && count != NULL, XLAL_ENOMEM );
+
+  // Time summing over all segments
+  REAL8 tic = XLALGetCPUTime();
+  for ( UINT4 l = 0; l < Nruns; ++l ) {
+    memset( sum2F, 0, sizeof( sum2F[0] ) * nfreqs );
+    memset( max2F, 0, sizeof( max2F[0] ) * nfreqs );
+    memset( max2FSeg, 0, sizeof( max2FSeg[0] ) * nfreqs );
+    memset( count, 0, sizeof( count[0] ) * nfreqs );
+    for ( UINT4 j = 0; j < nsegments; ++j ) {
+      XLAL_CHECK( func( sum2F, max2F, max2FSeg, count, threshold, coh2F[j], j, nfreqs ) == XLAL_SUCCESS, XLAL_EFUNC );
+    }
+  }
+  REAL8 toc = XLALGetCPUTime();
+  XLALPrintInfo( "%-40s: %6.0f Mops/sec\n", name, ( REAL8 )nsegments * nfreqs * Nruns / ( toc - tic ) / 1e6 );
+
+  // Compare against scalar reference; additions are performed in the same order, so results must agree exactly
+  for ( UINT4 i = 0; i < nfreqs; ++i ) {
+    REAL4 sum2F_ref = 0, max2F_ref = 0;
+    UINT4 max2FSeg_ref = 0, count_ref = 0;
+    for ( UINT4 j = 0; j < nsegments; ++j ) {
+      sum2F_ref += coh2F[j][i];
+      if ( max2F_ref <= coh2F[j][i] ) {
+        max2F_ref = coh2F[j][i];
+        max2FSeg_ref = j;
+      }
+      count_ref += ( threshold < coh2F[j][i] );
+    }
+    XLAL_CHECK( sum2F[i] == sum2F_ref, XLAL_ETOL, "%s: sum2F[%u] = %g differs from reference %g", name, i, sum2F[i], sum2F_ref );
+    XLAL_CHECK( max2F[i] == max2F_ref, XLAL_ETOL, "%s: max2F[%u] = %g differs from reference %g", name, i, max2F[i], max2F_ref );
+    XLAL_CHECK( max2FSeg[i] == max2FSeg_ref, XLAL_ETOL, "%s: max2FSeg[%u] = %u differs from reference %u", name, i, max2FSeg[i], max2FSeg_ref );
+    XLAL_CHECK( count[i] == count_ref, XLAL_ETOL, "%s: count[%u] = %u differs from reference %u", name, i, count[i], count_ref );
+  }
+
+  XLALFree( sum2F );
+  XLALFree( max2F );
+  XLALFree( max2FSeg );
+  XLALFree( count );
+
+  return XLAL_SUCCESS;
+
+}
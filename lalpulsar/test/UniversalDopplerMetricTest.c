@@ -512,6 +512,52 @@ test_XLALComputeDopplerMetrics( void )
   } // end: Round 6 + 7 (binary orbital metrics)
 
 
+  XLALPrintWarning( "\n---------- ROUND 8: fixed-quadrature vs adaptive-integration, multi-IFO phase and F-stat metrics ----------\n" );
+  {
+    const REAL8 tolFQ = 1e-4;   // both methods should agree to within numerical-integration accuracy
+    DopplerPhaseMetric *metricP, *metricFQP;
+    DopplerFstatMetric *metricF, *metricFQF;
+    REAL8 diff;
+
+    DopplerMetricParams pars2 = master_pars2;
+
+    // 1) segment-averaged phase metric
+    const UINT4 Nseg = 3;
+    LALSegList XLAL_INIT_DECL( NsegList );
+    ret = XLALSegListInitSimpleSegments( &NsegList, startTimeGPS, Nseg, Tseg );
+    XLAL_CHECK( ret == XLAL_SUCCESS, XLAL_EFUNC, "XLALSegListInitSimpleSegments() failed with xlalErrno = %d\n", xlalErrno );
+    pars2.segmentList = NsegList;
+
+    pars2.fixedQuadrature = 0;
+    XLAL_CHECK( ( metricP = XLALComputeDopplerPhaseMetric( &pars2, edat ) ) != NULL, XLAL_EFUNC );
+    pars2.fixedQuadrature = 1;
+    XLAL_CHECK( ( metricFQP = XLALComputeDopplerPhaseMetric( &pars2, edat ) ) != NULL, XLAL_EFUNC );
+
+    XLAL_CHECK( ( diff = XLALCompareMetrics( metricFQP->g_ij, metricP->g_ij ) ) < tolFQ, XLAL_ETOL, "Error(gFQ,g)= %g exceeds tolerance of %g\n", diff, tolFQ );
+    XLALPrintWarning( "g:    diff = %e, maxrelerr = %e\n", diff, metricFQP->maxrelerr );
+
+    XLALDestroyDopplerPhaseMetric( metricP );
+    XLALDestroyDopplerPhaseMetric( metricFQP );
+    XLALSegListClear( &NsegList );
+
+    // 2) single-segment F-stat metric
+    pars2.segmentList = master_pars2.segmentList;
+
+    pars2.fixedQuadrature = 0;
+    XLAL_CHECK( ( metricF = XLALComputeDopplerFstatMetric( &pars2, edat ) ) != NULL, XLAL_EFUNC );
+    pars2.fixedQuadrature = 1;
+    XLAL_CHECK( ( metricFQF = XLALComputeDopplerFstatMetric( &pars2, edat ) ) != NULL, XLAL_EFUNC );
+
+    XLAL_CHECK( ( diff = XLALCompareMetrics( metricFQF->gF_ij, metricF->gF_ij ) ) < tolPh, XLAL_ETOL, "Error(gFFQ,gF)= %e exceeds tolerance of %e\n", diff, tolPh );
+    XLALPrintWarning( "gF:   diff = %e\n", diff );
+    XLAL_CHECK( ( diff = XLALCompareMetrics( metricFQF->gFav_ij, metricF->gFav_ij ) ) < tolPh, XLAL_ETOL, "Error(gFavFQ,gFav)= %e exceeds tolerance of %e\n", diff, tolPh );
+    XLALPrintWarning( "gFav: diff = %e\n", diff );
+
+    XLALDestroyDopplerFstatMetric( metricF );
+    XLALDestroyDopplerFstatMetric( metricFQF );
+  }
+
+
   // ----- clean up memory
   XLALSegListClear( &segList );
   XLALDestroyEphemerisData( edat );